@@ -26,12 +26,16 @@ $(TEST_OUTPUT)_SRC := \
 	tests/test_common/keyboard_report_util.cpp \
 	tests/test_common/mouse_report_util.cpp \
 	tests/test_common/keycode_util.cpp \
-	tests/test_common/keycode_table.cpp \
 	tests/test_common/test_fixture.cpp \
 	tests/test_common/test_keymap_key.cpp \
 	tests/test_common/test_logger.cpp \
 	$(patsubst $(ROOTDIR)/%,%,$(wildcard $(TEST_PATH)/*.cpp))
 
+# Keycode names for test output, unless the test enables the feature itself
+ifneq ($(strip $(KEYCODE_STRING_ENABLE)), yes)
+    $(TEST_OUTPUT)_SRC += $(QUANTUM_PATH)/keycode_string.c
+endif
+
 $(TEST_OUTPUT)_DEFS := $(OPT_DEFS) "-DKEYMAP_C=\"keymap.c\""
 
 $(TEST_OUTPUT)_CONFIG := $(TEST_PATH)/config.h
@@ -38,6 +38,12 @@ else
     include $(PLATFORM_PATH)/$(PLATFORM_KEY)/printf.mk
 endif
 
+ifeq ($(strip $(BINARY_LOG_ENABLE)), yes)
+    OPT_DEFS += -DBINARY_LOG_ENABLE
+    CONSOLE_ENABLE = yes
+    QUANTUM_SRC += $(QUANTUM_DIR)/logging/binary_log.c
+endif
+
 ifeq ($(strip $(DEBUG_MATRIX_SCAN_RATE_ENABLE)), yes)
     OPT_DEFS += -DDEBUG_MATRIX_SCAN_RATE
     CONSOLE_ENABLE = yes
@@ -85,10 +91,9 @@ ifeq ($(strip $(MIDI_ENABLE)), yes)
     COMMON_VPATH += $(QUANTUM_PATH)/midi
     SRC += $(QUANTUM_DIR)/midi/midi.c
     SRC += $(QUANTUM_DIR)/midi/midi_device.c
+    SRC += $(QUANTUM_DIR)/midi/midi_usb_packet.c
     SRC += $(QUANTUM_DIR)/midi/qmk_midi.c
     SRC += $(QUANTUM_DIR)/midi/sysex_tools.c
-    SRC += $(QUANTUM_DIR)/midi/bytequeue/bytequeue.c
-    SRC += $(QUANTUM_DIR)/midi/bytequeue/interrupt_setting.c
     SRC += $(QUANTUM_DIR)/process_keycode/process_midi.c
 endif
 
@@ -119,6 +124,8 @@ endif
 
 ifeq ($(strip $(MOUSEKEY_ENABLE)), yes)
     MOUSE_ENABLE := yes
+    VPATH += $(QUANTUM_DIR)/pointing_device
+    SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_accel.c
 endif
 
 VALID_POINTING_DEVICE_DRIVER_TYPES := adns5050 adns9800 analog_joystick azoteq_iqs5xx cirque_pinnacle_i2c cirque_pinnacle_spi paw3204 pmw3320 pmw3360 pmw3389 pimoroni_trackball custom
@@ -131,6 +138,7 @@ ifeq ($(strip $(POINTING_DEVICE_ENABLE)), yes)
         VPATH += $(QUANTUM_DIR)/pointing_device
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device.c
         SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_auto_mouse.c
+        SRC += $(QUANTUM_DIR)/pointing_device/pointing_device_accel.c
         ifneq ($(strip $(POINTING_DEVICE_DRIVER)), custom)
             SRC += drivers/sensors/$(strip $(POINTING_DEVICE_DRIVER)).c
             OPT_DEFS += -DPOINTING_DEVICE_DRIVER_$(strip $(shell echo $(POINTING_DEVICE_DRIVER) | tr '[:lower:]' '[:upper:]'))
@@ -188,12 +196,12 @@ else
     # External I2C EEPROM implementation
     OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_I2C
     I2C_DRIVER_REQUIRED = yes
-    SRC += eeprom_driver.c eeprom_i2c.c
+    SRC += eeprom_driver.c eeprom_i2c.c eeprom_paged.c
   else ifeq ($(strip $(EEPROM_DRIVER)), spi)
     # External SPI EEPROM implementation
     OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_SPI
     SPI_DRIVER_REQUIRED = yes
-    SRC += eeprom_driver.c eeprom_spi.c
+    SRC += eeprom_driver.c eeprom_spi.c eeprom_paged.c
   else ifeq ($(strip $(EEPROM_DRIVER)), legacy_stm32_flash)
     # STM32 Emulated EEPROM, backed by MCU flash (soon to be deprecated)
     OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_LEGACY_EMULATED_FLASH
@@ -203,7 +211,7 @@ else
   else ifeq ($(strip $(EEPROM_DRIVER)), transient)
     # Transient EEPROM implementation -- no data storage but provides runtime area for it
     OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_TRANSIENT
-    SRC += eeprom_driver.c eeprom_transient.c
+    SRC += eeprom_driver.c eeprom_transient.c eeprom_paged.c
   else ifeq ($(strip $(EEPROM_DRIVER)), vendor)
     # Vendor-implemented EEPROM
     OPT_DEFS += -DEEPROM_VENDOR
@@ -237,7 +245,7 @@ else
       else
         # Fall back to transient, i.e. non-persistent
         OPT_DEFS += -DEEPROM_DRIVER -DEEPROM_TRANSIENT
-        SRC += eeprom_driver.c eeprom_transient.c
+        SRC += eeprom_driver.c eeprom_transient.c eeprom_paged.c
       endif
     else ifeq ($(PLATFORM),TEST)
       # Test harness "EEPROM"
@@ -351,6 +359,7 @@ ifeq ($(strip $(LED_MATRIX_ENABLE)), yes)
     POST_CONFIG_H += $(QUANTUM_DIR)/led_matrix/post_config.h
     SRC += $(QUANTUM_DIR)/process_keycode/process_led_matrix.c
     SRC += $(QUANTUM_DIR)/led_matrix/led_matrix.c
+    SRC += $(QUANTUM_DIR)/effect_render.c
     SRC += $(QUANTUM_DIR)/led_matrix/led_matrix_drivers.c
     LIB8TION_ENABLE := yes
     CIE1931_CURVE := yes
@@ -471,6 +480,7 @@ ifeq ($(strip $(RGB_MATRIX_ENABLE)), yes)
     SRC += $(QUANTUM_DIR)/process_keycode/process_rgb_matrix.c
     SRC += $(QUANTUM_DIR)/color.c
     SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix.c
+    SRC += $(QUANTUM_DIR)/effect_render.c
     SRC += $(QUANTUM_DIR)/rgb_matrix/rgb_matrix_drivers.c
     LIB8TION_ENABLE := yes
     CIE1931_CURVE := yes
@@ -631,6 +641,7 @@ endif
 ifeq ($(strip $(VIA_ENABLE)), yes)
     DYNAMIC_KEYMAP_ENABLE := yes
     RAW_ENABLE := yes
+    CRC_ENABLE := yes
     BOOTMAGIC_ENABLE := yes
     TRI_LAYER_ENABLE := yes
 endif
@@ -702,6 +713,17 @@ ifeq ($(strip $(SPLIT_KEYBOARD)), yes)
     COMMON_VPATH += $(QUANTUM_PATH)/split_common
 endif
 
+VALID_CRC_DRIVER_TYPES := software stm32
+
+CRC_DRIVER ?= software
+ifeq ($(strip $(CRC_ENABLE)), yes)
+    ifeq ($(filter $(CRC_DRIVER),$(VALID_CRC_DRIVER_TYPES)),)
+        $(call CATASTROPHIC_ERROR,Invalid CRC_DRIVER,CRC_DRIVER="$(CRC_DRIVER)" is not a valid CRC driver)
+    else ifneq ($(strip $(CRC_DRIVER)), software)
+        SRC += $(PLATFORM_PATH)/$(PLATFORM_KEY)/$(DRIVER_DIR)/crc_$(strip $(CRC_DRIVER)).c
+    endif
+endif
+
 ifeq ($(strip $(FNV_ENABLE)), yes)
     OPT_DEFS += -DFNV_ENABLE
     VPATH += $(LIB_PATH)/fnv
@@ -930,6 +952,12 @@ ifeq ($(strip $(DIP_SWITCH_ENABLE)), yes)
     endif
 endif
 
+ifeq ($(strip $(LEADER_ENABLE)), yes)
+    ifeq ($(strip $(LEADER_DICTIONARY_ENABLE)), yes)
+        OPT_DEFS += -DLEADER_DICTIONARY_ENABLE
+    endif
+endif
+
 VALID_WS2812_DRIVER_TYPES := bitbang custom i2c pwm spi vendor
 
 WS2812_DRIVER ?= bitbang
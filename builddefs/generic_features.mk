@@ -34,6 +34,8 @@ GENERIC_FEATURES = \
     DYNAMIC_TAPPING_TERM \
     GRAVE_ESC \
     HAPTIC \
+    KEYCODE_STRING \
+    KEY_EVENT_QUEUE \
     KEY_LOCK \
     KEY_OVERRIDE \
     LAYER_LOCK \
@@ -48,6 +50,7 @@ GENERIC_FEATURES = \
     SEND_STRING \
     SEQUENCER \
     SPACE_CADET \
+    SPARSE_KEYMAP \
     SWAP_HANDS \
     TAP_DANCE \
     TRI_LAYER \
@@ -42,6 +42,7 @@ OTHER_OPTION_NAMES = \
   KEY_LOCK_ENABLE \
   KEY_OVERRIDE_ENABLE \
   LEADER_ENABLE \
+  LEADER_DICTIONARY_ENABLE \
   STENO_ENABLE \
   STENO_PROTOCOL \
   TAP_DANCE_ENABLE \
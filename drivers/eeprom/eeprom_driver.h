@@ -17,8 +17,34 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 #include "eeprom.h"
 
 void eeprom_driver_init(void);
 void eeprom_driver_format(bool erase);
 void eeprom_driver_erase(void);
+
+/*
+    Background processing, called from the housekeeping task. Drivers that
+    defer writes use it to push pending data out to the device.
+*/
+void eeprom_driver_task(void);
+
+/*
+    Writes out any deferred data, blocking until the device has completed.
+*/
+void eeprom_driver_flush(void);
+
+/*
+    Page level interface of the external EEPROM drivers (i2c, spi, transient).
+
+    eeprom_paged.c builds the regular eeprom_read_block()/eeprom_write_block()
+    API on top of these, optionally with a RAM page cache.
+*/
+
+// Reads from the device, waiting for any write cycle in progress to complete first
+void eeprom_driver_read(void *buf, uintptr_t addr, size_t len);
+// Starts writing data that is contained within a single device page, without waiting for the write cycle to complete
+void eeprom_driver_write_page(const void *buf, uintptr_t addr, size_t len);
+// Whether the device is still busy with a write cycle
+bool eeprom_driver_busy(void);
@@ -22,8 +22,9 @@
 
 /*
     Note that the implementations of eeprom_XXXX_YYYY on AVR are normally
-    provided by avr-libc. The same functions are reimplemented below and are
-    rerouted to the external i2c equivalent.
+    provided by avr-libc. The same functions are reimplemented in
+    eeprom_paged.c on top of the page level access below, and are rerouted to
+    the external i2c equivalent.
 
     Seemingly, as this is compiled from within QMK, the object file generated
     during the build overrides the avr-libc implementation during the linking
@@ -34,6 +35,7 @@
 */
 
 #include "wait.h"
+#include "timer.h"
 #include "i2c_master.h"
 #include "eeprom.h"
 #include "eeprom_driver.h"
@@ -42,10 +44,16 @@
 // #define DEBUG_EEPROM_OUTPUT
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-#    include "timer.h"
 #    include "debug.h"
 #endif // DEBUG_EEPROM_OUTPUT
 
+#if defined(EXTERNAL_EEPROM_WP_PIN) || EXTERNAL_EEPROM_WRITE_TIME > 0
+static bool write_pending = false;
+#endif
+#if EXTERNAL_EEPROM_WRITE_TIME > 0
+static uint16_t last_write_time;
+#endif
+
 static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     uintptr_t p = (uintptr_t)addr;
     for (int i = 0; i < EXTERNAL_EEPROM_ADDRESS_SIZE; ++i) {
@@ -54,8 +62,7 @@ static inline void fill_target_address(uint8_t *buffer, const void *addr) {
     }
 }
 
-void eeprom_driver_init(void) {
-    i2c_init();
+static inline void write_protect(void) {
 #if defined(EXTERNAL_EEPROM_WP_PIN)
     /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
     gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 1);
@@ -63,6 +70,18 @@ void eeprom_driver_init(void) {
 #endif
 }
 
+static inline void write_unprotect(void) {
+#if defined(EXTERNAL_EEPROM_WP_PIN)
+    gpio_set_pin_output(EXTERNAL_EEPROM_WP_PIN);
+    gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 0);
+#endif
+}
+
+void eeprom_driver_init(void) {
+    i2c_init();
+    write_protect();
+}
+
 void eeprom_driver_format(bool erase) {
     /* i2c eeproms do not need to be formatted before use */
     if (erase) {
@@ -70,28 +89,37 @@ void eeprom_driver_format(bool erase) {
     }
 }
 
-void eeprom_driver_erase(void) {
-#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-    uint32_t start = timer_read32();
+bool eeprom_driver_busy(void) {
+#if defined(EXTERNAL_EEPROM_WP_PIN) || EXTERNAL_EEPROM_WRITE_TIME > 0
+    if (!write_pending) {
+        return false;
+    }
+#    if EXTERNAL_EEPROM_WRITE_TIME > 0
+    // The timer ticks in whole milliseconds, so one more tick makes sure the full write cycle time has passed
+    if (timer_elapsed(last_write_time) <= EXTERNAL_EEPROM_WRITE_TIME) {
+        return true;
+    }
+#    endif
+    // The write cycle has completed, the device can be protected again
+    write_pending = false;
+    write_protect();
 #endif
+    return false;
+}
 
-    uint8_t buf[EXTERNAL_EEPROM_PAGE_SIZE];
-    memset(buf, 0x00, EXTERNAL_EEPROM_PAGE_SIZE);
-    for (uint32_t addr = 0; addr < EXTERNAL_EEPROM_BYTE_COUNT; addr += EXTERNAL_EEPROM_PAGE_SIZE) {
-        eeprom_write_block(buf, (void *)(uintptr_t)addr, EXTERNAL_EEPROM_PAGE_SIZE);
+static void wait_while_busy(void) {
+    while (eeprom_driver_busy()) {
+        wait_ms(1);
     }
-
-#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-    dprintf("EEPROM erase took %ldms to complete\n", ((long)(timer_read32() - start)));
-#endif
 }
 
-void eeprom_read_block(void *buf, const void *addr, size_t len) {
+void eeprom_driver_read(void *buf, uintptr_t addr, size_t len) {
     uint8_t complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE];
-    fill_target_address(complete_packet, addr);
+    fill_target_address(complete_packet, (const void *)addr);
 
-    i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, 100);
-    i2c_receive(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), buf, len, 100);
+    wait_while_busy();
+    i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS(addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE, 100);
+    i2c_receive(EXTERNAL_EEPROM_I2C_ADDRESS(addr), buf, len, 100);
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
     dprintf("[EEPROM R] 0x%04X: ", ((int)addr));
@@ -102,47 +130,32 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
 #endif // DEBUG_EEPROM_OUTPUT
 }
 
-void eeprom_write_block(const void *buf, void *addr, size_t len) {
-    uint8_t   complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + EXTERNAL_EEPROM_PAGE_SIZE];
-    uint8_t * read_buf    = (uint8_t *)buf;
-    uintptr_t target_addr = (uintptr_t)addr;
+void eeprom_driver_write_page(const void *buf, uintptr_t addr, size_t len) {
+    uint8_t        complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + EXTERNAL_EEPROM_PAGE_SIZE];
+    const uint8_t *read_buf = (const uint8_t *)buf;
 
-#if defined(EXTERNAL_EEPROM_WP_PIN)
-    gpio_set_pin_output(EXTERNAL_EEPROM_WP_PIN);
-    gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 0);
-#endif
+    wait_while_busy();
 
-    while (len > 0) {
-        uintptr_t page_offset  = target_addr % EXTERNAL_EEPROM_PAGE_SIZE;
-        int       write_length = EXTERNAL_EEPROM_PAGE_SIZE - page_offset;
-        if (write_length > len) {
-            write_length = len;
-        }
-
-        fill_target_address(complete_packet, (const void *)target_addr);
-        for (uint8_t i = 0; i < write_length; i++) {
-            complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + i] = read_buf[i];
-        }
+    fill_target_address(complete_packet, (const void *)addr);
+    for (uint8_t i = 0; i < len; i++) {
+        complete_packet[EXTERNAL_EEPROM_ADDRESS_SIZE + i] = read_buf[i];
+    }
 
 #if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
-        dprintf("[EEPROM W] 0x%04X: ", ((int)target_addr));
-        for (uint8_t i = 0; i < write_length; i++) {
-            dprintf(" %02X", (int)(read_buf[i]));
-        }
-        dprintf("\n");
+    dprintf("[EEPROM W] 0x%04X: ", ((int)addr));
+    for (uint8_t i = 0; i < len; i++) {
+        dprintf(" %02X", (int)(read_buf[i]));
+    }
+    dprintf("\n");
 #endif // DEBUG_EEPROM_OUTPUT
 
-        i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS((uintptr_t)addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + write_length, 100);
-        wait_ms(EXTERNAL_EEPROM_WRITE_TIME);
+    write_unprotect();
+    i2c_transmit(EXTERNAL_EEPROM_I2C_ADDRESS(addr), complete_packet, EXTERNAL_EEPROM_ADDRESS_SIZE + len, 100);
 
-        read_buf += write_length;
-        target_addr += write_length;
-        len -= write_length;
-    }
-
-#if defined(EXTERNAL_EEPROM_WP_PIN)
-    /* We are setting the WP pin to high in a way that requires at least two bit-flips to change back to 0 */
-    gpio_write_pin(EXTERNAL_EEPROM_WP_PIN, 1);
-    gpio_set_pin_input_high(EXTERNAL_EEPROM_WP_PIN);
+#if defined(EXTERNAL_EEPROM_WP_PIN) || EXTERNAL_EEPROM_WRITE_TIME > 0
+    write_pending = true;
+#endif
+#if EXTERNAL_EEPROM_WRITE_TIME > 0
+    last_write_time = timer_read();
 #endif
 }
@@ -0,0 +1,321 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <stdint.h>
+#include <string.h>
+
+#include "eeprom.h"
+#include "eeprom_driver.h"
+#include "timer.h"
+
+/*
+    Block level EEPROM access for the external EEPROM drivers, built on the
+    page level interface in eeprom_driver.h.
+
+    If EEPROM_PAGE_CACHE_COUNT is defined, that many device pages are kept in
+    RAM. Reads are served from the cache, and writes only update the cached
+    copy of a page. Dirty pages are written back to the device one at a time
+    from eeprom_driver_task(), whenever the device is not busy with a write
+    cycle, so the matrix scan no longer waits out the write cycle time.
+    Repeated writes to a page coalesce into a single page write.
+
+    Pages are written back in the order they were first dirtied, and writing
+    to a dirty page once another page has been dirtied after it writes the
+    cache back first. Data therefore never reaches the device ahead of data
+    written before it, which the commit markers in eeconfig, VIA and the
+    dynamic keymap rely on.
+
+    Data that has not been written back yet is lost on power loss, call
+    eeprom_driver_flush() before deliberately resetting the MCU.
+*/
+
+// #define DEBUG_EEPROM_OUTPUT
+
+#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
+#    include "debug.h"
+#endif // DEBUG_EEPROM_OUTPUT
+
+#ifndef EXTERNAL_EEPROM_BUSY_TIMEOUT
+#    define EXTERNAL_EEPROM_BUSY_TIMEOUT 100
+#endif
+
+// Waits for the write cycle in progress to complete. A missing SPI device reads as busy forever, so this gives up after a while.
+static void wait_while_busy(void) {
+    uint32_t start = timer_read32();
+    while (eeprom_driver_busy()) {
+        if (timer_elapsed32(start) > EXTERNAL_EEPROM_BUSY_TIMEOUT) {
+            return;
+        }
+    }
+}
+
+#if defined(EEPROM_TRANSIENT)
+#    define EEPROM_PAGED_PAGE_SIZE (TRANSIENT_EEPROM_PAGE_SIZE)
+#else
+#    define EEPROM_PAGED_PAGE_SIZE (EXTERNAL_EEPROM_PAGE_SIZE)
+#endif
+
+#ifdef EEPROM_PAGE_CACHE_COUNT
+
+#    if EEPROM_PAGE_CACHE_COUNT < 1 || EEPROM_PAGE_CACHE_COUNT > 255
+#        error "EEPROM_PAGE_CACHE_COUNT must be between 1 and 255"
+#    endif
+
+typedef struct {
+    uint16_t page;        // device page held by this entry
+    uint16_t last_used;   // for least recently used replacement
+    uint16_t dirty_seq;   // when the page was first dirtied since its last write back
+    uint16_t dirty_start; // dirty byte range within the page, empty if dirty_start == dirty_end
+    uint16_t dirty_end;
+    bool     valid;
+    uint8_t  data[EEPROM_PAGED_PAGE_SIZE];
+} eeprom_page_cache_t;
+
+static eeprom_page_cache_t page_cache[EEPROM_PAGE_CACHE_COUNT];
+static uint16_t            page_cache_clock;
+static uint16_t            page_cache_dirty_clock;
+
+static inline bool page_cache_is_dirty(const eeprom_page_cache_t *entry) {
+    return entry->dirty_end > entry->dirty_start;
+}
+
+static inline uint16_t page_cache_dirty_age(const eeprom_page_cache_t *entry) {
+    return page_cache_dirty_clock - entry->dirty_seq;
+}
+
+static eeprom_page_cache_t *page_cache_first_dirtied(void) {
+    eeprom_page_cache_t *entry = NULL;
+    for (uint8_t i = 0; i < EEPROM_PAGE_CACHE_COUNT; i++) {
+        if (page_cache_is_dirty(&page_cache[i]) && (entry == NULL || page_cache_dirty_age(&page_cache[i]) > page_cache_dirty_age(entry))) {
+            entry = &page_cache[i];
+        }
+    }
+    return entry;
+}
+
+static void page_cache_write_back(eeprom_page_cache_t *entry) {
+    if (!page_cache_is_dirty(entry)) {
+        return;
+    }
+
+    uintptr_t addr = (uintptr_t)entry->page * EEPROM_PAGED_PAGE_SIZE + entry->dirty_start;
+    eeprom_driver_write_page(&entry->data[entry->dirty_start], addr, entry->dirty_end - entry->dirty_start);
+    entry->dirty_start = entry->dirty_end = 0;
+}
+
+static void page_cache_write_back_all(void) {
+    eeprom_page_cache_t *entry;
+    while ((entry = page_cache_first_dirtied()) != NULL) {
+        page_cache_write_back(entry);
+    }
+}
+
+/**
+ * \brief Keeps the device write order when a dirty page is about to be written to again.
+ *
+ * The new data would otherwise reach the device along with the older data of the page,
+ * ahead of the pages dirtied in between.
+ */
+static void page_cache_keep_order(const eeprom_page_cache_t *entry) {
+    if (!page_cache_is_dirty(entry)) {
+        return;
+    }
+    for (uint8_t i = 0; i < EEPROM_PAGE_CACHE_COUNT; i++) {
+        if (page_cache_is_dirty(&page_cache[i]) && page_cache_dirty_age(&page_cache[i]) < page_cache_dirty_age(entry)) {
+            page_cache_write_back_all();
+            return;
+        }
+    }
+}
+
+static eeprom_page_cache_t *page_cache_find(uint16_t page) {
+    for (uint8_t i = 0; i < EEPROM_PAGE_CACHE_COUNT; i++) {
+        if (page_cache[i].valid && page_cache[i].page == page) {
+            page_cache[i].last_used = ++page_cache_clock;
+            return &page_cache[i];
+        }
+    }
+    return NULL;
+}
+
+/**
+ * \brief Assigns a cache entry to the given page, evicting the least recently used clean one if needed.
+ *
+ * Only when all pages are dirty, the first dirtied one is evicted, as writing back any other would reorder the writes.
+ *
+ * \param fill whether to read the current page content from the device
+ */
+static eeprom_page_cache_t *page_cache_load(uint16_t page, bool fill) {
+    eeprom_page_cache_t *entry = NULL;
+    for (uint8_t i = 0; i < EEPROM_PAGE_CACHE_COUNT; i++) {
+        if (!page_cache[i].valid) {
+            entry = &page_cache[i];
+            break;
+        }
+        if (page_cache_is_dirty(&page_cache[i])) {
+            continue;
+        }
+        if (entry == NULL || (uint16_t)(page_cache_clock - page_cache[i].last_used) > (uint16_t)(page_cache_clock - entry->last_used)) {
+            entry = &page_cache[i];
+        }
+    }
+    if (entry == NULL) {
+        entry = page_cache_first_dirtied();
+        page_cache_write_back(entry);
+    }
+
+    entry->page      = page;
+    entry->valid     = true;
+    entry->last_used = ++page_cache_clock;
+    if (fill) {
+        eeprom_driver_read(entry->data, (uintptr_t)page * EEPROM_PAGED_PAGE_SIZE, EEPROM_PAGED_PAGE_SIZE);
+    }
+    return entry;
+}
+
+static void page_cache_mark_dirty(eeprom_page_cache_t *entry, uint16_t start, uint16_t end) {
+    if (!page_cache_is_dirty(entry)) {
+        entry->dirty_start = start;
+        entry->dirty_end   = end;
+        entry->dirty_seq   = ++page_cache_dirty_clock;
+        return;
+    }
+    if (start < entry->dirty_start) entry->dirty_start = start;
+    if (end > entry->dirty_end) entry->dirty_end = end;
+}
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    uint8_t * dest        = (uint8_t *)buf;
+    uintptr_t target_addr = (uintptr_t)addr;
+
+    while (len > 0) {
+        uint16_t page        = target_addr / EEPROM_PAGED_PAGE_SIZE;
+        uint16_t page_offset = target_addr % EEPROM_PAGED_PAGE_SIZE;
+        size_t   read_length = EEPROM_PAGED_PAGE_SIZE - page_offset;
+        if (read_length > len) {
+            read_length = len;
+        }
+
+        eeprom_page_cache_t *entry = page_cache_find(page);
+        // Small reads are typically repeated, whole pages are typically part of bulk transfers that would only thrash the cache
+        if (entry == NULL && read_length < EEPROM_PAGED_PAGE_SIZE) {
+            entry = page_cache_load(page, true);
+        }
+
+        if (entry) {
+            memcpy(dest, &entry->data[page_offset], read_length);
+        } else {
+            eeprom_driver_read(dest, target_addr, read_length);
+        }
+
+        dest += read_length;
+        target_addr += read_length;
+        len -= read_length;
+    }
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    const uint8_t *src         = (const uint8_t *)buf;
+    uintptr_t      target_addr = (uintptr_t)addr;
+
+    while (len > 0) {
+        uint16_t page         = target_addr / EEPROM_PAGED_PAGE_SIZE;
+        uint16_t page_offset  = target_addr % EEPROM_PAGED_PAGE_SIZE;
+        size_t   write_length = EEPROM_PAGED_PAGE_SIZE - page_offset;
+        if (write_length > len) {
+            write_length = len;
+        }
+
+        eeprom_page_cache_t *entry = page_cache_find(page);
+        if (entry == NULL) {
+            // No need to read the page if it is about to be overwritten completely
+            bool whole_page = write_length == EEPROM_PAGED_PAGE_SIZE;
+            entry           = page_cache_load(page, !whole_page);
+            if (whole_page) {
+                memcpy(entry->data, src, write_length);
+                page_cache_mark_dirty(entry, 0, EEPROM_PAGED_PAGE_SIZE);
+            }
+        }
+
+        if (memcmp(&entry->data[page_offset], src, write_length) != 0) {
+            page_cache_keep_order(entry);
+            memcpy(&entry->data[page_offset], src, write_length);
+            page_cache_mark_dirty(entry, page_offset, page_offset + write_length);
+        }
+
+        src += write_length;
+        target_addr += write_length;
+        len -= write_length;
+    }
+}
+
+void eeprom_driver_task(void) {
+    if (eeprom_driver_busy()) {
+        return;
+    }
+
+    eeprom_page_cache_t *entry = page_cache_first_dirtied();
+    if (entry) {
+        page_cache_write_back(entry);
+    }
+}
+
+void eeprom_driver_flush(void) {
+    page_cache_write_back_all();
+    wait_while_busy();
+}
+
+static void page_cache_invalidate(void) {
+    memset(page_cache, 0, sizeof(page_cache));
+}
+
+#else // EEPROM_PAGE_CACHE_COUNT
+
+void eeprom_read_block(void *buf, const void *addr, size_t len) {
+    eeprom_driver_read(buf, (uintptr_t)addr, len);
+}
+
+void eeprom_write_block(const void *buf, void *addr, size_t len) {
+    const uint8_t *src         = (const uint8_t *)buf;
+    uintptr_t      target_addr = (uintptr_t)addr;
+
+    while (len > 0) {
+        uintptr_t page_offset  = target_addr % EEPROM_PAGED_PAGE_SIZE;
+        size_t    write_length = EEPROM_PAGED_PAGE_SIZE - page_offset;
+        if (write_length > len) {
+            write_length = len;
+        }
+
+        eeprom_driver_write_page(src, target_addr, write_length);
+
+        src += write_length;
+        target_addr += write_length;
+        len -= write_length;
+    }
+
+    // Keep writes synchronous, subsequent code may rely on the data having reached the device
+    wait_while_busy();
+}
+
+#    define page_cache_invalidate()
+
+#endif // EEPROM_PAGE_CACHE_COUNT
+
+void eeprom_driver_erase(void) {
+#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
+    uint32_t start = timer_read32();
+#endif
+
+    page_cache_invalidate();
+
+    uint8_t buf[EEPROM_PAGED_PAGE_SIZE];
+    memset(buf, 0x00, EEPROM_PAGED_PAGE_SIZE);
+    for (uint32_t addr = 0; addr < TOTAL_EEPROM_BYTE_COUNT; addr += EEPROM_PAGED_PAGE_SIZE) {
+        eeprom_driver_write_page(buf, addr, EEPROM_PAGED_PAGE_SIZE);
+    }
+    wait_while_busy();
+
+#if defined(CONSOLE_ENABLE) && defined(DEBUG_EEPROM_OUTPUT)
+    dprintf("EEPROM erase took %ldms to complete\n", ((long)(timer_read32() - start)));
+#endif
+}
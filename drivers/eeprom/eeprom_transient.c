@@ -19,10 +19,21 @@
 
 #include "eeprom_driver.h"
 #include "eeprom_transient.h"
+#if TRANSIENT_EEPROM_WRITE_TIME > 0
+#    include "timer.h"
+#endif
 
 __attribute__((aligned(4))) static uint8_t transientBuffer[TRANSIENT_EEPROM_SIZE] = {0};
 
+#if TRANSIENT_EEPROM_WRITE_TIME > 0
+static bool     write_pending = false;
+static uint32_t last_write_time;
+#endif
+
 size_t clamp_length(intptr_t offset, size_t len) {
+    if (offset >= TRANSIENT_EEPROM_SIZE) {
+        return 0;
+    }
     if (offset + len > TRANSIENT_EEPROM_SIZE) {
         len = TRANSIENT_EEPROM_SIZE - offset;
     }
@@ -39,12 +50,23 @@ void eeprom_driver_format(bool erase) {
     }
 }
 
-void eeprom_driver_erase(void) {
-    memset(transientBuffer, 0x00, TRANSIENT_EEPROM_SIZE);
+bool eeprom_driver_busy(void) {
+#if TRANSIENT_EEPROM_WRITE_TIME > 0
+    if (write_pending && timer_elapsed32(last_write_time) < TRANSIENT_EEPROM_WRITE_TIME) {
+        return true;
+    }
+    write_pending = false;
+#endif
+    return false;
 }
 
-void eeprom_read_block(void *buf, const void *addr, size_t len) {
+void eeprom_driver_read(void *buf, uintptr_t addr, size_t len) {
     intptr_t offset = (intptr_t)addr;
+
+    // Like a real device, do not respond until the write cycle has completed
+    while (eeprom_driver_busy()) {
+    }
+
     memset(buf, 0x00, len);
     len = clamp_length(offset, len);
     if (len > 0) {
@@ -52,10 +74,19 @@ void eeprom_read_block(void *buf, const void *addr, size_t len) {
     }
 }
 
-void eeprom_write_block(const void *buf, void *addr, size_t len) {
+void eeprom_driver_write_page(const void *buf, uintptr_t addr, size_t len) {
     intptr_t offset = (intptr_t)addr;
-    len             = clamp_length(offset, len);
+
+    while (eeprom_driver_busy()) {
+    }
+
+    len = clamp_length(offset, len);
     if (len > 0) {
         memcpy(&transientBuffer[offset], buf, len);
     }
+
+#if TRANSIENT_EEPROM_WRITE_TIME > 0
+    write_pending   = true;
+    last_write_time = timer_read32();
+#endif
 }
@@ -23,3 +23,20 @@
 #    include "eeconfig.h"
 #    define TRANSIENT_EEPROM_SIZE (((EECONFIG_SIZE + 3) / 4) * 4) // based off eeconfig's current usage, aligned to 4-byte sizes, to deal with LTO
 #endif
+
+/*
+    The simulated page size. Writes are split up at page boundaries, like
+    they would be for an external EEPROM.
+*/
+#ifndef TRANSIENT_EEPROM_PAGE_SIZE
+#    define TRANSIENT_EEPROM_PAGE_SIZE 32
+#endif
+
+/*
+    The simulated write cycle time in milliseconds. While a write cycle is in
+    progress, further reads and writes block. Mainly useful to exercise the
+    EEPROM page cache in tests.
+*/
+#ifndef TRANSIENT_EEPROM_WRITE_TIME
+#    define TRANSIENT_EEPROM_WRITE_TIME 0
+#endif
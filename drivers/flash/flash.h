@@ -71,6 +71,24 @@ flash_status_t flash_wait_erase_chip(void);
  */
 flash_status_t flash_erase_chip(void);
 
+/**
+ * @brief Initiates a block erase operation.
+ *
+ * This function does not wait for the flash to become ready. Completion can be polled with flash_is_busy(), or waited for with flash_wait_erase_block().
+ *
+ * @param addr The address of the block to erase.
+ *
+ * @return FLASH_STATUS_SUCCESS if the erase command was successfully sent, FLASH_STATUS_TIMEOUT if the flash is busy, or FLASH_STATUS_ERROR if an error occurred.
+ */
+flash_status_t flash_begin_erase_block(uint32_t addr);
+
+/**
+ * @brief Waits for the block erase operation to complete.
+ *
+ * @return FLASH_STATUS_SUCCESS if the block erase operation completed successfully, FLASH_STATUS_TIMEOUT if the flash was still busy, or FLASH_STATUS_ERROR if an error occurred.
+ */
+flash_status_t flash_wait_erase_block(void);
+
 /**
  * @brief Erases a block of flash memory.
  *
@@ -83,6 +101,24 @@ flash_status_t flash_erase_chip(void);
  */
 flash_status_t flash_erase_block(uint32_t addr);
 
+/**
+ * @brief Initiates a sector erase operation.
+ *
+ * This function does not wait for the flash to become ready. Completion can be polled with flash_is_busy(), or waited for with flash_wait_erase_sector().
+ *
+ * @param addr The address of the sector to erase.
+ *
+ * @return FLASH_STATUS_SUCCESS if the erase command was successfully sent, FLASH_STATUS_TIMEOUT if the flash is busy, or FLASH_STATUS_ERROR if an error occurred.
+ */
+flash_status_t flash_begin_erase_sector(uint32_t addr);
+
+/**
+ * @brief Waits for the sector erase operation to complete.
+ *
+ * @return FLASH_STATUS_SUCCESS if the sector erase operation completed successfully, FLASH_STATUS_TIMEOUT if the flash was still busy, or FLASH_STATUS_ERROR if an error occurred.
+ */
+flash_status_t flash_wait_erase_sector(void);
+
 /**
  * @brief Erases a sector of flash memory.
  *
@@ -108,6 +144,20 @@ flash_status_t flash_erase_sector(uint32_t addr);
  */
 flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len);
 
+/**
+ * @brief Initiates writes to a range of flash memory.
+ *
+ * Each page is programmed once the previous one has completed, but this function does not wait for the last page program to complete.
+ * Any subsequent flash operation waits for it, so the buffer may be reused as soon as this function returns.
+ *
+ * @param addr The address of the range to write.
+ * @param buf A pointer to the buffer to write to the range.
+ * @param len The length of the range to write.
+ *
+ * @return FLASH_STATUS_SUCCESS if all page programs were successfully started, FLASH_STATUS_BAD_ADDRESS if the address is out of bounds, FLASH_STATUS_TIMEOUT if the flash is busy, or FLASH_STATUS_ERROR if an error occurred.
+ */
+flash_status_t flash_begin_write_range(uint32_t addr, const void *buf, size_t len);
+
 /**
  * @brief Writes a range of flash memory.
  *
@@ -209,7 +209,7 @@ flash_status_t flash_erase_chip(void) {
     return flash_wait_erase_chip();
 }
 
-flash_status_t flash_erase_sector(uint32_t addr) {
+flash_status_t flash_begin_erase_sector(uint32_t addr) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
 
     /* Check that the address exceeds the limit. */
@@ -239,17 +239,28 @@ flash_status_t flash_erase_sector(uint32_t addr) {
         return response;
     }
 
-    /* Wait for the write-in-progress bit to be cleared.*/
-    response = spi_flash_wait_while_busy();
+    return response;
+}
+
+flash_status_t flash_wait_erase_sector(void) {
+    flash_status_t response = spi_flash_wait_while_busy();
     if (response != FLASH_STATUS_SUCCESS) {
         dprint("Failed to check WIP flag! [spi flash erase sector]\n");
         return response;
     }
-
     return response;
 }
 
-flash_status_t flash_erase_block(uint32_t addr) {
+flash_status_t flash_erase_sector(uint32_t addr) {
+    flash_status_t response = flash_begin_erase_sector(addr);
+    if (response != FLASH_STATUS_SUCCESS) {
+        return response;
+    }
+
+    return flash_wait_erase_sector();
+}
+
+flash_status_t flash_begin_erase_block(uint32_t addr) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
 
     /* Check that the address exceeds the limit. */
@@ -279,16 +290,27 @@ flash_status_t flash_erase_block(uint32_t addr) {
         return response;
     }
 
-    /* Wait for the write-in-progress bit to be cleared.*/
-    response = spi_flash_wait_while_busy();
+    return response;
+}
+
+flash_status_t flash_wait_erase_block(void) {
+    flash_status_t response = spi_flash_wait_while_busy();
     if (response != FLASH_STATUS_SUCCESS) {
         dprint("Failed to check WIP flag! [spi flash erase block]\n");
         return response;
     }
-
     return response;
 }
 
+flash_status_t flash_erase_block(uint32_t addr) {
+    flash_status_t response = flash_begin_erase_block(addr);
+    if (response != FLASH_STATUS_SUCCESS) {
+        return response;
+    }
+
+    return flash_wait_erase_block();
+}
+
 flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len) {
     flash_status_t response = FLASH_STATUS_SUCCESS;
     uint8_t *      read_buf = (uint8_t *)buf;
@@ -320,7 +342,7 @@ flash_status_t flash_read_range(uint32_t addr, void *buf, size_t len) {
     return response;
 }
 
-flash_status_t flash_write_range(uint32_t addr, const void *buf, size_t len) {
+flash_status_t flash_begin_write_range(uint32_t addr, const void *buf, size_t len) {
     flash_status_t response  = FLASH_STATUS_SUCCESS;
     uint8_t *      write_buf = (uint8_t *)buf;
 
@@ -331,7 +353,7 @@ flash_status_t flash_write_range(uint32_t addr, const void *buf, size_t len) {
             write_length = len;
         }
 
-        /* Wait for the write-in-progress bit to be cleared. */
+        /* Wait for the previous page program to complete. */
         response = spi_flash_wait_while_busy();
         if (response != FLASH_STATUS_SUCCESS) {
             dprint("Failed to check WIP flag! [spi flash write block]\n");
@@ -365,6 +387,15 @@ flash_status_t flash_write_range(uint32_t addr, const void *buf, size_t len) {
         len -= write_length;
     }
 
+    return response;
+}
+
+flash_status_t flash_write_range(uint32_t addr, const void *buf, size_t len) {
+    flash_status_t response = flash_begin_write_range(addr, buf, len);
+    if (response != FLASH_STATUS_SUCCESS) {
+        return response;
+    }
+
     /* Wait for the write-in-progress bit to be cleared. */
     response = spi_flash_wait_while_busy();
     if (response != FLASH_STATUS_SUCCESS) {
@@ -27,10 +27,11 @@ bool __attribute__((cold)) pmw33xx_upload_firmware(uint8_t sensor);
 bool __attribute__((cold)) pmw33xx_check_signature(uint8_t sensor);
 
 const pointing_device_driver_t pmw33xx_pointing_device_driver = {
-    .init       = pmw33xx_init_wrapper,
-    .get_report = pmw33xx_get_report,
-    .set_cpi    = pmw33xx_set_cpi_wrapper,
-    .get_cpi    = pmw33xx_get_cpi_wrapper,
+    .init                 = pmw33xx_init_wrapper,
+    .get_report           = pmw33xx_get_report,
+    .set_cpi              = pmw33xx_set_cpi_wrapper,
+    .get_cpi              = pmw33xx_get_cpi_wrapper,
+    .get_report_unclamped = pmw33xx_get_report_unclamped,
 };
 
 uint16_t __attribute__((weak)) pmw33xx_srom_get_length(void) {
@@ -248,7 +249,7 @@ uint16_t pmw33xx_get_cpi_wrapper(void) {
     return pmw33xx_get_cpi(0);
 }
 
-report_mouse_t pmw33xx_get_report(report_mouse_t mouse_report) {
+report_mouse_t pmw33xx_get_report_unclamped(report_mouse_t mouse_report, int16_t *x, int16_t *y) {
     pmw33xx_report_t report    = pmw33xx_read_burst(0);
     static bool      in_motion = false;
 
@@ -266,7 +267,17 @@ report_mouse_t pmw33xx_get_report(report_mouse_t mouse_report) {
         pd_dprintf("PWM3360 (0): starting motion\n");
     }
 
-    mouse_report.x = CONSTRAIN_HID_XY(report.delta_x);
-    mouse_report.y = CONSTRAIN_HID_XY(report.delta_y);
+    *x = report.delta_x;
+    *y = report.delta_y;
+    return mouse_report;
+}
+
+report_mouse_t pmw33xx_get_report(report_mouse_t mouse_report) {
+    int16_t x    = mouse_report.x;
+    int16_t y    = mouse_report.y;
+    mouse_report = pmw33xx_get_report_unclamped(mouse_report, &x, &y);
+
+    mouse_report.x = CONSTRAIN_HID_XY(x);
+    mouse_report.y = CONSTRAIN_HID_XY(y);
     return mouse_report;
 }
@@ -180,3 +180,4 @@ void           pmw33xx_init_wrapper(void);
 void           pmw33xx_set_cpi_wrapper(uint16_t cpi);
 uint16_t       pmw33xx_get_cpi_wrapper(void);
 report_mouse_t pmw33xx_get_report(report_mouse_t mouse_report);
+report_mouse_t pmw33xx_get_report_unclamped(report_mouse_t mouse_report, int16_t *x, int16_t *y);
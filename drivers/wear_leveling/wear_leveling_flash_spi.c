@@ -41,6 +41,73 @@ bool backing_store_erase(void) {
     return ret;
 }
 
+/*
+    Consolidation erases are asynchronous: each block erase is started from
+    backing_store_erase_in_progress() once the previous one has completed, so
+    that the wear-leveling layer can keep serving requests from its cache in the
+    meantime.
+*/
+static struct {
+    uint16_t next_block;  // index of the next block to erase
+    bool     in_progress; // erase sequence running
+    bool     failed;      // any of the block erases failed
+} async_erase;
+
+static bool async_erase_next_block(void) {
+    flash_status_t status = flash_begin_erase_block(((WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_OFFSET) + async_erase.next_block) * (EXTERNAL_FLASH_BLOCK_SIZE));
+    if (status != FLASH_STATUS_SUCCESS) {
+        async_erase.failed      = true;
+        async_erase.in_progress = false;
+        return false;
+    }
+    async_erase.next_block++;
+    return true;
+}
+
+bool backing_store_begin_erase(void) {
+    bs_dprintf("Begin erase\n");
+    async_erase.next_block  = 0;
+    async_erase.failed      = false;
+    async_erase.in_progress = true;
+    return async_erase_next_block();
+}
+
+bool backing_store_erase_in_progress(void) {
+    if (!async_erase.in_progress) {
+        return false;
+    }
+
+    flash_status_t status = flash_is_busy();
+    if (status == FLASH_STATUS_BUSY) {
+        return true;
+    }
+    if (status != FLASH_STATUS_SUCCESS) {
+        async_erase.failed      = true;
+        async_erase.in_progress = false;
+        return false;
+    }
+
+    if (async_erase.next_block < (WEAR_LEVELING_EXTERNAL_FLASH_BLOCK_COUNT)) {
+        return async_erase_next_block();
+    }
+
+    bs_dprintf("Erase complete\n");
+    async_erase.in_progress = false;
+    return false;
+}
+
+bool backing_store_end_erase(void) {
+    while (async_erase.in_progress) {
+        if (flash_wait_erase_block() != FLASH_STATUS_SUCCESS) {
+            async_erase.failed      = true;
+            async_erase.in_progress = false;
+            break;
+        }
+        backing_store_erase_in_progress();
+    }
+    return !async_erase.failed;
+}
+
 bool backing_store_write(uint32_t address, backing_store_int_t value) {
     return backing_store_write_bulk(address, &value, 1);
 }
@@ -87,8 +154,8 @@ bool backing_store_write_bulk(uint32_t address, backing_store_int_t *values, siz
             temp[i] = ~temp[i];
         }
 
-        // Write out the block
-        if (flash_write_range(offset, temp, sizeof(backing_store_int_t) * this_loop) != FLASH_STATUS_SUCCESS) {
+        // Write out the block, without waiting for the last page program -- subsequent flash operations wait for it
+        if (flash_begin_write_range(offset, temp, sizeof(backing_store_int_t) * this_loop) != FLASH_STATUS_SUCCESS) {
             return false;
         }
 
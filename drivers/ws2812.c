@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: GPL-2.0-or-later
 
 #include "ws2812.h"
+#include <string.h>
 
 #if defined(WS2812_RGBW)
 void ws2812_rgb_to_rgbw(ws2812_led_t *led) {
@@ -13,3 +14,39 @@ void ws2812_rgb_to_rgbw(ws2812_led_t *led) {
     led->b -= led->w;
 }
 #endif
+
+// A WS2812 bit is sent as 1110 or 1000 by the SPI driver, so a pair of bits fits in one byte
+#define WS2812_SPI_PAIR(bits) ((((bits) & 2) ? 0xE0 : 0x80) | (((bits) & 1) ? 0x0E : 0x08))
+#define WS2812_SPI_NIBBLE(nibble) \
+    { WS2812_SPI_PAIR((nibble) >> 2), WS2812_SPI_PAIR((nibble) & 3) }
+
+static const uint8_t ws2812_spi_nibbles[16][2] = {
+    WS2812_SPI_NIBBLE(0),  WS2812_SPI_NIBBLE(1),  WS2812_SPI_NIBBLE(2),  WS2812_SPI_NIBBLE(3),  //
+    WS2812_SPI_NIBBLE(4),  WS2812_SPI_NIBBLE(5),  WS2812_SPI_NIBBLE(6),  WS2812_SPI_NIBBLE(7),  //
+    WS2812_SPI_NIBBLE(8),  WS2812_SPI_NIBBLE(9),  WS2812_SPI_NIBBLE(10), WS2812_SPI_NIBBLE(11), //
+    WS2812_SPI_NIBBLE(12), WS2812_SPI_NIBBLE(13), WS2812_SPI_NIBBLE(14), WS2812_SPI_NIBBLE(15), //
+};
+
+void ws2812_spi_encode_led(uint8_t *dest, const ws2812_led_t *led) {
+    // The fields of ws2812_led_t are laid out in the order they are sent
+    const uint8_t *bytes = (const uint8_t *)led;
+    for (uint8_t i = 0; i < sizeof(ws2812_led_t); i++) {
+        const uint8_t *high = ws2812_spi_nibbles[bytes[i] >> 4];
+        const uint8_t *low  = ws2812_spi_nibbles[bytes[i] & 0x0F];
+        dest[0]             = high[0];
+        dest[1]             = high[1];
+        dest[2]             = low[0];
+        dest[3]             = low[1];
+        dest += WS2812_SPI_BYTES_PER_BYTE;
+    }
+}
+
+int ws2812_next_changed_led(ws2812_led_t *encoded, const ws2812_led_t *leds, int start, int count) {
+    for (int i = start; i < count; i++) {
+        if (memcmp(&encoded[i], &leds[i], sizeof(ws2812_led_t)) != 0) {
+            encoded[i] = leds[i];
+            return i;
+        }
+    }
+    return count;
+}
@@ -95,3 +95,23 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue);
 void ws2812_flush(void);
 
 void ws2812_rgb_to_rgbw(ws2812_led_t *led);
+
+/**
+ * \brief Expands the colour of an LED into the bit stream of the SPI driver.
+ *
+ * Every WS2812 bit is sent as four SPI bits, so each colour byte becomes
+ * `WS2812_SPI_BYTES_PER_BYTE` bytes, in the byte order of the LEDs.
+ */
+#define WS2812_SPI_BYTES_PER_BYTE 4
+void ws2812_spi_encode_led(uint8_t *dest, const ws2812_led_t *led);
+
+/**
+ * \brief Finds the next LED whose colour changed since a frame was last encoded.
+ *
+ * \param encoded the colours the frame buffer holds, the returned LED is updated to its new colour
+ * \param leds the colours to display
+ * \param start the LED to start searching from
+ * \param count the number of LEDs
+ * \return the index of the first changed LED from `start`, or `count` if there is none
+ */
+int ws2812_next_changed_led(ws2812_led_t *encoded, const ws2812_led_t *leds, int start, int count);
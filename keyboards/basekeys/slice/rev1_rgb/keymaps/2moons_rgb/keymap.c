@@ -38,7 +38,7 @@ enum tapdances{
   TD_ESQW,
 };
 
-tap_dance_action_t tap_dance_actions[] = {
+const tap_dance_action_t PROGMEM tap_dance_actions[] = {
   [TD_ESFL] = ACTION_TAP_DANCE_LAYER_MOVE(KC_ESC, _FLOCK),
   [TD_ESQW] = ACTION_TAP_DANCE_LAYER_MOVE(KC_ESC, _QWERTY),
 };
@@ -35,7 +35,7 @@ typedef enum {
 
 extern accent_state_t accent_state;
 
-extern tap_dance_action_t tap_dance_actions[TAP_DANCE_ACTIONS_COUNT];
+extern const tap_dance_action_t PROGMEM tap_dance_actions[TAP_DANCE_ACTIONS_COUNT];
 
 void dance_shift_capsword_finished (tap_dance_state_t *state, void *user_data);
 void dance_shift_capsword_reset (tap_dance_state_t *state, void *user_data);
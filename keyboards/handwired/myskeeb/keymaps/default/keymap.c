@@ -55,7 +55,7 @@ void tilded(tap_dance_state_t *state, void *user_data) {
 	}
 } 
   
-tap_dance_action_t tap_dance_actions[] = {
+const tap_dance_action_t PROGMEM tap_dance_actions[] = {
 	[OP_QT] = ACTION_TAP_DANCE_FN(tri_open),
 	[CL_QT] = ACTION_TAP_DANCE_FN(tri_close),
 	[TD_DQ] = ACTION_TAP_DANCE_FN(dquote),
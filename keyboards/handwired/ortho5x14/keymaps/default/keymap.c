@@ -73,7 +73,7 @@ void dance_onshot_lsft(tap_dance_state_t *state, void *user_data) {
 }
 
 //Tap Dance Definitions
-tap_dance_action_t tap_dance_actions[] = {
+const tap_dance_action_t PROGMEM tap_dance_actions[] = {
    [TD_DEL_BSPC]  = ACTION_TAP_DANCE_DOUBLE(KC_DEL, KC_BSPC),
    [TD_ESC_GRAVE]  = ACTION_TAP_DANCE_DOUBLE(KC_ESC, KC_GRAVE),
    [TD_TAB_TILDE]  = ACTION_TAP_DANCE_DOUBLE(KC_TAB, KC_TILDE),
@@ -30,7 +30,7 @@ enum tapdances{
   TD_ENT = 0,
 };
 
-tap_dance_action_t tap_dance_actions[] = {
+const tap_dance_action_t PROGMEM tap_dance_actions[] = {
   [TD_ENT] = ACTION_TAP_DANCE_DOUBLE(KC_ENT, KC_ENT),
 };
 
@@ -0,0 +1,133 @@
+"""Functions to decode the firmware's binary console log.
+
+See `quantum/logging/binary_log.h` for the record format.
+"""
+import re
+import struct
+
+FORMATS_SECTION = 'binary_log_formats'
+DROPPED = 0xFFFF
+
+# A printf conversion, as parsed by the firmware
+CONVERSION = re.compile(r'%([-+ #0-9.*]*)[lhz]*(.?)', re.DOTALL)
+
+
+def read_formats(elf_file):
+    """Returns the contents of the format string section of an ELF file.
+    """
+    data = elf_file.read_bytes()
+
+    if data[:4] != b'\x7fELF':
+        raise ValueError(f'{elf_file} is not an ELF file')
+
+    is_64 = data[4] == 2
+    endian = '<' if data[5] == 1 else '>'
+
+    if is_64:
+        shoff, = struct.unpack_from(endian + 'Q', data, 0x28)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + 'HHH', data, 0x3A)
+        section_header = endian + 'IIQQQQ'
+    else:
+        shoff, = struct.unpack_from(endian + 'I', data, 0x20)
+        shentsize, shnum, shstrndx = struct.unpack_from(endian + 'HHH', data, 0x2E)
+        section_header = endian + 'IIIIII'
+
+    sections = [struct.unpack_from(section_header, data, shoff + i * shentsize) for i in range(shnum)]
+    names_offset = sections[shstrndx][4]
+
+    for name, _, _, _, offset, size in sections:
+        name_end = data.index(b'\0', names_offset + name)
+        if data[names_offset + name:name_end].decode() == FORMATS_SECTION:
+            return data[offset:offset + size]
+
+    raise ValueError(f'{elf_file} has no {FORMATS_SECTION} section, was it built with BINARY_LOG_ENABLE = yes?')
+
+
+def cobs_decode(data):
+    """Returns the bytes of one COBS encoded record, without its zero delimiter.
+    """
+    record = bytearray()
+    i = 0
+
+    while i < len(data):
+        code = data[i]
+        record += data[i + 1:i + code]
+        i += code
+        if code < 0xFF and i < len(data):
+            record.append(0)
+
+    return bytes(record)
+
+
+def render(formats, record):
+    """Rebuilds the text of a decoded record.
+    """
+    if len(record) < 2:
+        return '<short record>'
+
+    format_id, = struct.unpack_from('<H', record)
+    if format_id == DROPPED:
+        return f'<{struct.unpack_from("<H", record, 2)[0] if len(record) >= 4 else "?"} dropped>\n'
+
+    if format_id >= len(formats):
+        return f'<unknown format {format_id}, is the ELF file the flashed firmware?>'
+
+    format_string = formats[format_id:formats.index(b'\0', format_id)].decode(errors='replace')
+    offset = 2
+
+    def take_bytes(size):
+        nonlocal offset
+        if offset + size > len(record):
+            raise IndexError
+        offset += size
+        return record[offset - size:offset]
+
+    def take(size):
+        return int.from_bytes(take_bytes(size), 'little')
+
+    def signed(value):
+        return value - (1 << 32) if value & (1 << 31) else value
+
+    def convert(match):
+        spec, conversion = match.groups()
+        spec = re.sub(r'\*', lambda _: str(signed(take(4))), spec)
+
+        if not conversion:
+            return ''
+        if conversion in 'di':
+            return ('%' + spec + 'd') % signed(take(4))
+        if conversion in 'uxXo':
+            return ('%' + spec + conversion.replace('u', 'd')) % take(4)
+        if conversion == 'b':
+            flags, width = re.match(r'([-+ #0]*)(\d*)', spec).groups()
+            return format(take(4), ('<' if '-' in flags else '0' if '0' in flags else '') + width + 'b')
+        if conversion == 'c':
+            return ('%' + spec + 'c') % take(1)
+        if conversion == 'p':
+            return '0x%08x' % take(4)
+        if conversion == 's':
+            return ('%' + spec + 's') % take_bytes(take(1)).decode(errors='replace')
+
+        return conversion
+
+    try:
+        return CONVERSION.sub(convert, format_string)
+    except IndexError:
+        return f'<record too short for {format_string!r}>'
+
+
+def decode_stream(formats, chunks, synced=True):
+    """Yields the text of each record in an iterable of byte chunks.
+
+    If `synced` is false, the stream may begin in the middle of a record, and decoding starts after the first zero byte.
+    """
+    pending = bytearray() if synced else None
+
+    for chunk in chunks:
+        for byte in chunk:
+            if byte == 0:
+                if pending:
+                    yield render(formats, cobs_decode(pending))
+                pending = bytearray()
+            elif pending is not None:
+                pending.append(byte)
@@ -38,6 +38,7 @@ subcommands = [
     'qmk.cli.chibios.confmigrate',
     'qmk.cli.clean',
     'qmk.cli.compile',
+    'qmk.cli.console_decode',
     'qmk.cli.docs',
     'qmk.cli.doctor',
     'qmk.cli.find',
@@ -57,7 +58,6 @@ subcommands = [
     'qmk.cli.generate.keyboard_c',
     'qmk.cli.generate.keyboard_h',
     'qmk.cli.generate.keycodes',
-    'qmk.cli.generate.keycodes_tests',
     'qmk.cli.generate.keymap_h',
     'qmk.cli.generate.make_dependencies',
     'qmk.cli.generate.rgb_breathe_table',
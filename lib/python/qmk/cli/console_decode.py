@@ -0,0 +1,66 @@
+"""Decode the binary console log of a keyboard built with BINARY_LOG_ENABLE.
+"""
+import sys
+
+from milc import cli
+
+from qmk.binary_log import decode_stream, read_formats
+from qmk.path import normpath
+
+CONSOLE_USAGE_PAGE = 0xFF31
+CONSOLE_USAGE = 0x0074
+
+
+def _device_reports():
+    """Yields the reports of the first QMK console found.
+    """
+    import hid
+
+    devices = [device for device in hid.enumerate() if device['usage_page'] == CONSOLE_USAGE_PAGE and device['usage'] == CONSOLE_USAGE]
+    if not devices:
+        cli.log.error('No QMK console found, is CONSOLE_ENABLE set?')
+        return
+
+    device = hid.Device(path=devices[0]['path'])
+    cli.log.info('Listening to %s %s', devices[0]['manufacturer_string'], devices[0]['product_string'])
+
+    while True:
+        yield device.read(32)
+
+
+def _file_chunks(filename):
+    """Yields the contents of a file, or of stdin for "-", as it is read.
+    """
+    file = sys.stdin.buffer if filename == '-' else normpath(filename).open('rb')
+
+    while chunk := file.read1(1024):
+        yield chunk
+
+
+@cli.argument('-i', '--input', arg_only=True, help='File holding the raw console output, "-" for stdin. Reads from the keyboard by default.')
+@cli.argument('elf', arg_only=True, type=normpath, help='The firmware ELF file, from the .build directory.')
+@cli.subcommand('Decodes the binary console log of a keyboard built with BINARY_LOG_ENABLE.')
+def console_decode(cli):
+    """Prints the text of the binary log records, using the format strings in the firmware ELF file.
+    """
+    if not cli.args.elf.exists():
+        cli.log.error('ELF file %s does not exist!', cli.args.elf)
+        return False
+
+    try:
+        formats = read_formats(cli.args.elf)
+    except ValueError as e:
+        cli.log.error(e)
+        return False
+
+    if cli.args.input:
+        lines = decode_stream(formats, _file_chunks(cli.args.input))
+    else:
+        lines = decode_stream(formats, _device_reports(), synced=False)
+
+    try:
+        for line in lines:
+            sys.stdout.write(line)
+            sys.stdout.flush()
+    except KeyboardInterrupt:
+        pass
@@ -6,6 +6,7 @@ from qmk.constants import GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE
 from qmk.commands import dump_lines
 from qmk.path import normpath
 from qmk.keycodes import load_spec
+from qmk.util import maybe_exit
 
 
 def _translate_group(group):
@@ -125,6 +126,105 @@ def _generate_aliases(lines, keycodes):
             lines.append(f'#define {alias} {value.get("key")}')
 
 
+def _flatten_ranges(keycodes):
+    """Split overlapping ranges into sorted, disjoint segments, each one classified by the narrowest range containing it
+    """
+    ranges = []
+    for key, value in keycodes["ranges"].items():
+        lo, mask = map(lambda x: int(x, 16), key.split("/"))
+        ranges.append((lo, lo + mask, value.get("define")))
+
+    bounds = sorted({lo for lo, _, _ in ranges} | {hi + 1 for _, hi, _ in ranges})
+
+    segments = []
+    for first, end in zip(bounds, bounds[1:]):
+        containing = [r for r in ranges if r[0] <= first and r[1] >= end - 1]
+        if not containing:
+            continue
+        define = min(containing, key=lambda r: r[1] - r[0])[2]
+        if segments and segments[-1][2] == define and segments[-1][1] + 1 == first:
+            segments[-1][1] = end - 1
+        else:
+            segments.append([first, end - 1, define])
+    return segments
+
+
+def _generate_string_table(lines, keycodes):
+    by_code = [(int(key, 16), value.get("key")) for key, value in keycodes["keycodes"].items()]
+    by_code.sort()
+
+    # Aliases resolve to the keycode, but only the canonical name is ever printed
+    by_name = {}
+    for code, name in by_code:
+        by_name[name] = code
+    for code, name in by_code:
+        for alias in keycodes["keycodes"][f'0x{code:04X}'].get("aliases", []):
+            by_name.setdefault(alias, code)
+
+    segments = _flatten_ranges(keycodes)
+
+    # All strings live in one pool, the tables only store 16 bit offsets into it
+    offsets = {}
+    pool = []
+    size = 0
+    for name in [name for _, name in by_code] + sorted(by_name) + [define for _, _, define in segments]:
+        if name not in offsets:
+            offsets[name] = size
+            pool.append(name)
+            size += len(name) + 1
+    if size > 0xFFFF:
+        cli.log.error('Keycode string pool is too large for 16 bit offsets (%d bytes)', size)
+        maybe_exit(1)
+
+    name_length_max = max(len('0x0000'), *map(len, by_name))
+    range_length_max = max(len(define) for _, _, define in segments)
+
+    lines.append('')
+    lines.append('#include <stdint.h>')
+    lines.append('#include "progmem.h"')
+    lines.append('')
+    lines.append(f'#define KEYCODE_STRING_NAME_LENGTH_MAX {name_length_max}')
+    lines.append(f'#define KEYCODE_STRING_RANGE_LENGTH_MAX {range_length_max}')
+    lines.append('')
+    lines.append('typedef struct {')
+    lines.append('    uint16_t keycode;')
+    lines.append('    uint16_t name; // offset into keycode_string_pool')
+    lines.append('} keycode_string_entry_t;')
+    lines.append('')
+    lines.append('typedef struct {')
+    lines.append('    uint16_t first;')
+    lines.append('    uint16_t last;')
+    lines.append('    uint16_t name; // offset into keycode_string_pool')
+    lines.append('} keycode_string_range_t;')
+
+    lines.append('')
+    lines.append('static const char keycode_string_pool[] PROGMEM =')
+    for name in pool:
+        lines.append(f'    "{name}\\0"')
+    lines.append(';')
+
+    lines.append('')
+    lines.append('// Sorted by keycode')
+    lines.append('static const keycode_string_entry_t keycode_string_by_code[] PROGMEM = {')
+    for code, name in by_code:
+        lines.append(f'    {{0x{code:04X}, {str(offsets[name]) + "}, ":<8}// {name}')
+    lines.append('};')
+
+    lines.append('')
+    lines.append('// Sorted by name in strcmp() order, including aliases')
+    lines.append('static const keycode_string_entry_t keycode_string_by_name[] PROGMEM = {')
+    for name in sorted(by_name, key=lambda n: n.encode()):
+        lines.append(f'    {{0x{by_name[name]:04X}, {str(offsets[name]) + "}, ":<8}// {name}')
+    lines.append('};')
+
+    lines.append('')
+    lines.append('// Sorted and disjoint, overlapping ranges are split and classified by the narrowest one')
+    lines.append('static const keycode_string_range_t keycode_string_ranges[] PROGMEM = {')
+    for first, last, define in segments:
+        lines.append(f'    {{0x{first:04X}, 0x{last:04X}, {str(offsets[define]) + "}, ":<8}// {define}')
+    lines.append('};')
+
+
 @cli.argument('-v', '--version', arg_only=True, required=True, help='Version of keycodes to generate.')
 @cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
 @cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
@@ -164,3 +264,22 @@ def generate_keycode_extras(cli):
 
     # Show the results
     dump_lines(cli.args.output, keycodes_h_lines, cli.args.quiet)
+
+
+@cli.argument('-v', '--version', arg_only=True, required=True, help='Version of keycodes to generate.')
+@cli.argument('-o', '--output', arg_only=True, type=normpath, help='File to write to')
+@cli.argument('-q', '--quiet', arg_only=True, action='store_true', help="Quiet mode, only output error messages")
+@cli.subcommand('Used by the make system to generate keycode_string_table.h from keycodes_{version}.json', hidden=True)
+def generate_keycode_string_table(cli):
+    """Generates the sorted keycode name and range tables.
+    """
+
+    # Build the header file.
+    keycodes_h_lines = [GPL2_HEADER_C_LIKE, GENERATED_HEADER_C_LIKE, '#pragma once', '// clang-format off']
+
+    keycodes = load_spec(cli.args.version)
+
+    _generate_string_table(keycodes_h_lines, keycodes)
+
+    # Show the results
+    dump_lines(cli.args.output, keycodes_h_lines, cli.args.quiet)
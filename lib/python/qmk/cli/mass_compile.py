@@ -3,6 +3,7 @@
 This will compile everything in parallel, for testing purposes.
 """
 import os
+import sys
 from typing import List
 from pathlib import Path
 from subprocess import DEVNULL
@@ -10,13 +11,59 @@ from milc import cli
 import shlex
 
 from qmk.constants import QMK_FIRMWARE
+from qmk.path import normpath
 from qmk.commands import find_make, get_make_parallel_args, build_environment
 from qmk.search import search_keymap_targets, search_make_targets
 from qmk.build_targets import BuildTarget, JsonKeymapBuildTarget
 from qmk.util import maybe_exit_config
+import qmk.object_cache
 
 
-def mass_compile_targets(targets: List[BuildTarget], clean: bool, dry_run: bool, no_temp: bool, parallel: int, **env):
+def _cache_affinity(target: BuildTarget):
+    """Targets for the same processor with the same extra arguments compile most core objects identically.
+    """
+    return (target.dotty.get('processor', ''), tuple(sorted(target.extra_args.items())))
+
+
+def _schedule_for_cache(targets: List[BuildTarget]):
+    """Orders targets so that each group of similar targets starts with a single seed build, which fills the object cache for the rest of its group.
+
+    Returns the ordered targets and the seed each remaining target waits for.
+    """
+    groups = {}
+    for target in sorted(targets, key=lambda t: (t.keyboard, t.keymap)):
+        groups.setdefault(_cache_affinity(target), []).append(target)
+
+    # Largest groups first, their seeds unblock the most builds
+    groups = sorted(groups.values(), key=len, reverse=True)
+    ordered = [group[0] for group in groups] + [target for group in groups for target in group[1:]]
+    seeds = {target: group[0] for group in groups for target in group[1:]}
+    return ordered, seeds
+
+
+def _report_cache_stats(stats_logs, cache: qmk.object_cache.ObjectCache, max_size: int):
+    total_hits = total_misses = 0
+    for name, stats_log in stats_logs.items():
+        hits, misses = qmk.object_cache.read_stats(stats_log)
+        Path(stats_log).unlink(missing_ok=True)
+        total_hits += hits
+        total_misses += misses
+        if hits + misses > 0:
+            cli.log.info(f'Object cache {name:<58} {hits:>4}/{hits + misses:<4} reused ({100 * hits // (hits + misses)}%)')
+
+    if total_hits + total_misses > 0:
+        cli.log.info(f'Object cache: {total_hits}/{total_hits + total_misses} objects reused ({100 * total_hits // (total_hits + total_misses)}%)')
+
+    removed = cache.trim(max_size)
+    if removed > 0:
+        cli.log.info(f'Object cache: removed {removed} least recently used objects to stay within {max_size // (1024 * 1024)} MiB')
+
+
+def mass_compile_targets(targets: List[BuildTarget], clean: bool, dry_run: bool, no_temp: bool, parallel: int, object_cache_dir: Path = None, object_cache_size: int = 2048, **env):
+    """Compiles targets in parallel, through a single generated makefile.
+
+    With `object_cache_dir` set, objects are compiled through the content-addressed object cache in that directory, and trimmed to `object_cache_size` MiB afterwards.
+    """
     if len(targets) == 0:
         return
 
@@ -36,8 +83,23 @@ def mass_compile_targets(targets: List[BuildTarget], clean: bool, dry_run: bool,
             cli.run([make_cmd, 'clean'], capture_output=False, stdin=DEVNULL)
 
         builddir.mkdir(parents=True, exist_ok=True)
+
+        seeds = {}
+        stats_logs = {}
+        if object_cache_dir:
+            cache = qmk.object_cache.ObjectCache(object_cache_dir)
+            os.environ['QMK_OBJECT_CACHE_DIR'] = str(object_cache_dir)
+            os.environ['PYTHONPATH'] = os.pathsep.join(filter(None, [str(Path(QMK_FIRMWARE) / 'lib' / 'python'), os.environ.get('PYTHONPATH')]))
+            ordered_targets, seeds = _schedule_for_cache(targets)
+        else:
+            ordered_targets = sorted(targets, key=lambda t: (t.keyboard, t.keymap))
+
+        def _rule_name(target):
+            extra_args = '_'.join([f"{k}_{v}" for k, v in target.extra_args.items()])
+            return f"{target.target_name(**env)}{'_' + extra_args if len(extra_args) > 0 else ''}_binary"
+
         with open(makefile, "w") as f:
-            for target in sorted(targets, key=lambda t: (t.keyboard, t.keymap)):
+            for target in ordered_targets:
                 keyboard_name = target.keyboard
                 keymap_name = target.keymap
                 keyboard_safe = keyboard_name.replace('/', '_')
@@ -54,6 +116,16 @@ def mass_compile_targets(targets: List[BuildTarget], clean: bool, dry_run: bool,
                     build_log += f".{extra_args}"
                     failed_log += f".{extra_args}"
                     target_suffix = f"_{extra_args}"
+                if object_cache_dir:
+                    stats_log = f"{QMK_FIRMWARE}/.build/cache_stats.{os.getpid()}.{keyboard_safe}.{keymap_name}"
+                    if len(extra_args) > 0:
+                        stats_log += f".{extra_args}"
+                    stats_logs[f'{keyboard_name}:{keymap_name}'] = stats_log
+                    command[0] = f'+@QMK_OBJECT_CACHE_STATS="{stats_log}" $(MAKE)'
+                    command.append(shlex.quote(f'CC_PREFIX={sys.executable} -m qmk.object_cache'))
+                if target in seeds:
+                    # Wait for a similar target to fill the object cache first
+                    f.write(f"{_rule_name(target)}: | {_rule_name(seeds[target])}\n")
                 # yapf: disable
                 f.write(
                     f"""\
@@ -87,6 +159,9 @@ all: {target_filename}{target_suffix}_binary
 
         cli.run([find_make(), *get_make_parallel_args(parallel), '-f', makefile.as_posix(), 'all'], capture_output=False, stdin=DEVNULL)
 
+        if object_cache_dir:
+            _report_cache_stats(stats_logs, cache, object_cache_size * 1024 * 1024)
+
         # Check for failures
         failures = [f for f in builddir.glob(f'failed.log.{os.getpid()}.*')]
         if len(failures) > 0:
@@ -109,6 +184,9 @@ all: {target_filename}{target_suffix}_binary
 )
 @cli.argument('-km', '--keymap', type=str, default='default', help="The keymap name to build. Default is 'default'.")
 @cli.argument('-e', '--env', arg_only=True, action='append', default=[], help="Set a variable to be passed to make. May be passed multiple times.")
+@cli.argument('--object-cache', action='store_true', help="Reuse object files compiled for other targets and earlier runs.")
+@cli.argument('--object-cache-dir', type=normpath, help="Directory of the object cache. Default is 'object_cache' next to the QMK configuration file.")
+@cli.argument('--object-cache-size', type=int, default=2048, help="Maximum size of the object cache in MiB. Default is 2048.")
 @cli.subcommand('Compile QMK Firmware for all keyboards.', hidden=False if cli.config.user.developer else True)
 def mass_compile(cli):
     """Compile QMK Firmware against all keyboards.
@@ -123,4 +201,8 @@ def mass_compile(cli):
     else:
         targets = search_keymap_targets([('all', cli.config.mass_compile.keymap)], cli.args.filter)
 
-    return mass_compile_targets(targets, cli.args.clean, cli.args.dry_run, cli.args.no_temp, cli.config.mass_compile.parallel, **build_environment(cli.args.env))
+    object_cache_dir = None
+    if cli.config.mass_compile.object_cache:
+        object_cache_dir = cli.config.mass_compile.object_cache_dir or Path(cli.config_file).parent / 'object_cache'
+
+    return mass_compile_targets(targets, cli.args.clean, cli.args.dry_run, cli.args.no_temp, cli.config.mass_compile.parallel, object_cache_dir, cli.config.mass_compile.object_cache_size or 2048, **build_environment(cli.args.env))
@@ -16,6 +16,10 @@ from qmk.constants import QMK_FIRMWARE, QMK_USERSPACE, HAS_QMK_USERSPACE
 from qmk.keyboard import find_keyboard_from_dir, keyboard_folder, keyboard_aliases
 from qmk.errors import CppError
 from qmk.info import info_json
+from qmk.keycodes import load_spec
+
+# Keycodes a sparse keymap leaves out
+TRANSPARENT_KEYCODES = ('KC_TRNS', 'KC_TRANSPARENT', '_______')
 
 # The `keymap.c` template to use when a keyboard doesn't have its own
 DEFAULT_KEYMAP_C = """#include QMK_KEYBOARD_H
@@ -32,6 +36,7 @@ __INCLUDES__
 
 __KEYMAP_GOES_HERE__
 __ENCODER_MAP_GOES_HERE__
+__LEADER_DICTIONARY_GOES_HERE__
 __MACRO_OUTPUT_GOES_HERE__
 
 #ifdef OTHER_KEYMAP_C
@@ -52,6 +57,59 @@ def _generate_keymap_table(keymap_json):
     return lines
 
 
+def _generate_sparse_keymap_table(keymap_json):
+    """Returns the layers as `sparse_keymap_layers` and `sparse_keymap_keycodes`, or None when the layout has no matrix positions.
+    """
+    info_data = info_json(keymap_json['keyboard'])
+    layout_name = info_data.get('layout_aliases', {}).get(keymap_json['layout'], keymap_json['layout'])
+    layout = info_data.get('layouts', {}).get(layout_name, {}).get('layout')
+    if not layout or 'matrix_size' not in info_data:
+        return None
+
+    rows = info_data['matrix_size']['rows']
+    cols = info_data['matrix_size']['cols']
+    keys = rows * cols
+    blocks = (keys + 31) // 32
+
+    keycodes = []
+    layers = []
+    for layer_num, layer in enumerate(keymap_json['layers']):
+        stored = {}
+        for key_data, keycode in zip(layout, map(_strip_any, layer)):
+            if keycode not in TRANSPARENT_KEYCODES:
+                row, col = key_data['matrix']
+                stored[row * cols + col] = keycode
+
+        # Keycodes in matrix order, the firmware finds them by counting bits
+        bitmap = [0] * blocks
+        index = [0] * blocks
+        for block in range(blocks):
+            index[block] = len(keycodes)
+            for key in range(block * 32, min(block * 32 + 32, keys)):
+                if key in stored:
+                    bitmap[block] |= 1 << (key % 32)
+                    keycodes.append(stored[key])
+
+        bitmap_txt = ', '.join(f'0x{b:08X}' for b in bitmap)
+        index_txt = ', '.join(map(str, index))
+        layers.append(f'    [{layer_num}] = {{.bitmap = {{{bitmap_txt}}}, .index = {{{index_txt}}}}},')
+
+    if not keycodes:
+        # Every layer is empty, C does not allow an empty array
+        keycodes.append('KC_NO')
+
+    lines = [
+        f'_Static_assert(MATRIX_ROWS == {rows} && MATRIX_COLS == {cols}, "The sparse keymap was generated for a {rows}x{cols} matrix");',
+        'const uint16_t PROGMEM sparse_keymap_keycodes[] = {',
+        '    ' + ', '.join(keycodes),
+        '};',
+        'const sparse_keymap_layer_t PROGMEM sparse_keymap_layers[] = {',
+        *layers,
+        '};',
+    ]
+    return lines
+
+
 def _generate_encodermap_table(keymap_json):
     lines = [
         '#if defined(ENCODER_ENABLE) && defined(ENCODER_MAP_ENABLE)',
@@ -66,6 +124,38 @@ def _generate_encodermap_table(keymap_json):
     return lines
 
 
+def _keycode_values():
+    """Returns the value of every keycode name and alias in the latest keycode spec.
+    """
+    values = {}
+    for value, keycode in load_spec('latest')['keycodes'].items():
+        for name in [keycode['key'], *keycode.get('aliases', [])]:
+            values[name] = int(value, 16)
+    return values
+
+
+def _generate_leader_dictionary_table(keymap_json):
+    sequences = keymap_json['leader_dictionary']
+
+    # Sorted by keycode value, the firmware searches the table like a trie instead of scanning it.
+    # Keys that are not plain keycodes leave it in the given order, which still works, only slower.
+    values = _keycode_values()
+    try:
+        sequences = sorted(sequences, key=lambda s: [values[_strip_any(k)] for k in s['sequence']])
+    except KeyError:
+        pass
+
+    lines = [
+        '#if defined(LEADER_ENABLE) && defined(LEADER_DICTIONARY_ENABLE)',
+        'const leader_sequence_t PROGMEM leader_dictionary[] = {',
+    ]
+    for sequence in sequences:
+        keys = ', '.join(map(_strip_any, sequence['sequence']))
+        lines.append(f'    LEADER_SEQUENCE({_strip_any(sequence["keycode"])}, {keys}),')
+    lines.extend(['};', '#endif // defined(LEADER_ENABLE) && defined(LEADER_DICTIONARY_ENABLE)'])
+    return lines
+
+
 def _generate_macros_function(keymap_json):
     macro_txt = [
         'bool process_record_user(uint16_t keycode, keyrecord_t *record) {',
@@ -269,6 +359,12 @@ def generate_c(keymap_json):
         layers
             An array of arrays describing the keymap. Each item in the inner array should be a string that is a valid QMK keycode.
 
+        config
+            Optional. When `config.features.sparse_keymap` is set the layers are also written as sparse tables, using the matrix positions of the keyboard's layout.
+
+        leader_dictionary
+            An array of leader sequences, each an object with the `sequence` of keycodes to type and the `keycode` to tap.
+
         macros
             A sequence of strings containing macros to implement for this keyboard.
     """
@@ -277,6 +373,10 @@ def generate_c(keymap_json):
     keymap = ''
     if 'layers' in keymap_json and keymap_json['layers'] is not None:
         layer_txt = _generate_keymap_table(keymap_json)
+        if keymap_json.get('config', {}).get('features', {}).get('sparse_keymap'):
+            sparse_txt = _generate_sparse_keymap_table(keymap_json)
+            if sparse_txt:
+                layer_txt = ['#ifdef SPARSE_KEYMAP_ENABLE', *sparse_txt, '#else', *layer_txt, '#endif // SPARSE_KEYMAP_ENABLE']
         keymap = '\n'.join(layer_txt)
     new_keymap = new_keymap.replace('__KEYMAP_GOES_HERE__', keymap)
 
@@ -286,6 +386,12 @@ def generate_c(keymap_json):
         encodermap = '\n'.join(encoder_txt)
     new_keymap = new_keymap.replace('__ENCODER_MAP_GOES_HERE__', encodermap)
 
+    leader_dictionary = ''
+    if 'leader_dictionary' in keymap_json and keymap_json['leader_dictionary'] is not None:
+        leader_dictionary_txt = _generate_leader_dictionary_table(keymap_json)
+        leader_dictionary = '\n'.join(leader_dictionary_txt)
+    new_keymap = new_keymap.replace('__LEADER_DICTIONARY_GOES_HERE__', leader_dictionary)
+
     macros = ''
     if 'macros' in keymap_json and keymap_json['macros'] is not None:
         macro_txt = _generate_macros_function(keymap_json)
@@ -352,6 +458,9 @@ def write(keymap_json):
         layers
             An array of arrays describing the keymap. Each item in the inner array should be a string that is a valid QMK keycode.
 
+        config
+            Optional. When `config.features.sparse_keymap` is set the layers are also written as sparse tables, using the matrix positions of the keyboard's layout.
+
         macros
             A list of macros for this keymap.
     """
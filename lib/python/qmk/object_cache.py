@@ -0,0 +1,258 @@
+"""Content-addressed object cache for compiling many targets.
+
+Used as a compiler launcher through `CC_PREFIX`, this caches object files keyed by the preprocessed translation unit, the code generation flags and the compiler. Core objects built for one keyboard are reused by every other keyboard that preprocesses them to the same code with the same flags, across targets and across runs.
+
+Only imports the standard library, as it runs once per compiled file.
+"""
+import hashlib
+import os
+import shutil
+import subprocess
+import sys
+from pathlib import Path
+
+# Bump when the key derivation changes, so stale entries are never hit
+CACHE_VERSION = 1
+
+CACHEABLE_SUFFIXES = ('.c', '.cc', '.cpp')
+
+# Flags whose effect is fully captured by the preprocessed output, mapped to whether they take a separate value
+PREPROCESSOR_FLAGS = {
+    '-D': True,
+    '-U': True,
+    '-I': True,
+    '-include': True,
+    '-imacros': True,
+    '-iquote': True,
+    '-isystem': True,
+    '-idirafter': True,
+}
+
+# Dependency generation flags, which do not affect the object, mapped to whether they take a separate value
+DEPENDENCY_FLAGS = {
+    '-M': False,
+    '-MM': False,
+    '-MD': False,
+    '-MMD': False,
+    '-MP': False,
+    '-MG': False,
+    '-MF': True,
+    '-MT': True,
+    '-MQ': True,
+}
+
+
+class ObjectCache:
+    def __init__(self, cache_dir):
+        self.cache_dir = Path(cache_dir)
+
+    def _paths(self, key):
+        base = self.cache_dir / key[:2] / key
+        return base.with_suffix('.o'), base.with_suffix('.log')
+
+    def lookup(self, key, output):
+        """Copies a cached object to `output`, returning its compiler messages, or None on a miss.
+        """
+        obj, log = self._paths(key)
+        try:
+            shutil.copyfile(obj, output)
+            messages = log.read_bytes()
+        except OSError:
+            return None
+
+        # Keep recently used entries when trimming
+        os.utime(obj)
+        return messages
+
+    def store(self, key, output, messages):
+        obj, log = self._paths(key)
+        obj.parent.mkdir(parents=True, exist_ok=True)
+
+        # Concurrent builds may store the same key, write to a private file and move it into place atomically
+        tmp_obj = obj.with_suffix(f'.o.{os.getpid()}')
+        tmp_log = log.with_suffix(f'.log.{os.getpid()}')
+        shutil.copyfile(output, tmp_obj)
+        tmp_log.write_bytes(messages)
+        os.replace(tmp_log, log)
+        os.replace(tmp_obj, obj)
+
+    def size(self):
+        return sum(f.stat().st_size for f in self.cache_dir.glob('*/*') if f.is_file())
+
+    def trim(self, max_size):
+        """Removes the least recently used objects until the cache fits in `max_size` bytes.
+        """
+        entries = []
+        total = 0
+        for obj in self.cache_dir.glob('*/*.o'):
+            log = obj.with_suffix('.log')
+            stat = obj.stat()
+            size = stat.st_size + (log.stat().st_size if log.exists() else 0)
+            entries.append((stat.st_mtime, size, obj, log))
+            total += size
+
+        entries.sort()
+        removed = 0
+        for _, size, obj, log in entries:
+            if total <= max_size:
+                break
+            obj.unlink(missing_ok=True)
+            log.unlink(missing_ok=True)
+            total -= size
+            removed += 1
+        return removed
+
+
+def _split_command(args):
+    """Splits a compiler command line into its source, output and flags, or returns None if it is not a cacheable compilation.
+    """
+    if '-c' not in args:
+        return None
+
+    source = None
+    output = None
+    flags = []
+    i = 0
+    while i < len(args):
+        arg = args[i]
+        if arg == '-o' and i + 1 < len(args):
+            output = args[i + 1]
+            i += 2
+            continue
+        if not arg.startswith('-') and arg.endswith(CACHEABLE_SUFFIXES):
+            if source is not None:
+                return None
+            source = arg
+        elif arg == '-' or arg == '-x' or arg.startswith('-Wa,-a'):
+            # Piped or explicitly typed input, or assembler listings which a cache hit would not produce
+            return None
+        else:
+            flags.append(arg)
+        i += 1
+
+    if source is None or output is None:
+        return None
+    return source, output, flags
+
+
+def _key_flags(flags):
+    """Returns the flags that affect code generation, dropping the ones the preprocessed output already accounts for.
+    """
+    key_flags = []
+    skip = False
+    for arg in flags:
+        if skip:
+            skip = False
+            continue
+        ignored = False
+        for flag, separate in {**PREPROCESSOR_FLAGS, **DEPENDENCY_FLAGS}.items():
+            if arg == flag:
+                skip = separate
+                ignored = True
+                break
+            if separate and arg.startswith(flag):
+                # Joined form, e.g. -DFOO or -Iquantum
+                ignored = True
+                break
+        if not ignored:
+            key_flags.append(arg)
+    return key_flags
+
+
+def _compiler_id(compiler):
+    path = shutil.which(compiler) or compiler
+    stat = os.stat(path)
+    return f'{os.path.realpath(path)}:{stat.st_size}:{stat.st_mtime_ns}'
+
+
+def _has_debug_info(flags):
+    return any(arg.startswith('-g') and arg != '-g0' for arg in flags)
+
+
+def _record(result):
+    stats = os.environ.get('QMK_OBJECT_CACHE_STATS')
+    if stats:
+        # Appends of a single short line are atomic, so parallel compiles can share the file
+        fd = os.open(stats, os.O_WRONLY | os.O_APPEND | os.O_CREAT, 0o644)
+        try:
+            os.write(fd, f'{result}\n'.encode())
+        finally:
+            os.close(fd)
+
+
+def compile_cached(cache, command):
+    """Runs a compiler command, reusing a cached object when an identical translation unit was compiled before.
+
+    Returns the compiler exit code.
+    """
+    compiler, args = command[0], command[1:]
+    split = _split_command(args)
+    if split is None:
+        return subprocess.call(command)
+    source, output, flags = split
+
+    # Preprocess with the same flags, which also writes the dependency file the compilation would have written.
+    # Without debug info line markers only affect diagnostics, so they are left out to share objects between targets whose generated headers live in different directories.
+    preprocess = [compiler, '-E', *[arg for arg in flags if arg != '-c'], source]
+    if any(arg in ('-MD', '-MMD') for arg in flags):
+        preprocess.extend(['-MT', output])
+    if not _has_debug_info(flags):
+        preprocess.append('-P')
+    preprocessed = subprocess.run(preprocess, stdout=subprocess.PIPE, stderr=subprocess.DEVNULL)
+    if preprocessed.returncode != 0:
+        # Let the compiler report the error
+        return subprocess.call(command)
+
+    digest = hashlib.sha256()
+    digest.update(f'{CACHE_VERSION}\0{_compiler_id(compiler)}\0{Path(source).suffix}\0'.encode())
+    digest.update('\0'.join(_key_flags(flags)).encode())
+    digest.update(b'\0')
+    digest.update(preprocessed.stdout)
+    key = digest.hexdigest()
+
+    messages = cache.lookup(key, output)
+    if messages is not None:
+        _record('hit')
+        sys.stderr.buffer.write(messages)
+        return 0
+
+    result = subprocess.run(command, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+    sys.stderr.buffer.write(result.stdout)
+    if result.returncode == 0:
+        cache.store(key, output, result.stdout)
+    _record('miss')
+    return result.returncode
+
+
+def read_stats(stats_file):
+    """Returns the number of hits and misses recorded in a stats file.
+    """
+    hits = misses = 0
+    try:
+        with open(stats_file) as f:
+            for line in f:
+                if line.strip() == 'hit':
+                    hits += 1
+                elif line.strip() == 'miss':
+                    misses += 1
+    except FileNotFoundError:
+        pass
+    return hits, misses
+
+
+def main(argv):
+    """Compiler launcher entry point: `python3 -m qmk.object_cache <compiler> <args...>`, caching into `QMK_OBJECT_CACHE_DIR`.
+    """
+    if not argv:
+        print('usage: python3 -m qmk.object_cache <compiler> [args...]', file=sys.stderr)
+        return 1
+
+    cache_dir = os.environ.get('QMK_OBJECT_CACHE_DIR')
+    if not cache_dir:
+        os.execvp(argv[0], argv)
+
+    return compile_cached(ObjectCache(cache_dir), argv)
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv[1:]))
@@ -0,0 +1,24 @@
+from qmk.binary_log import cobs_decode, decode_stream, render
+
+FORMATS = b'\0hello %d %u %5s|\n\0%02X %c %%\0'
+HELLO = 1
+HEX = 19
+
+
+def test_render():
+    record = bytes([HELLO, 0]) + (-7).to_bytes(4, 'little', signed=True) + (42).to_bytes(4, 'little') + b'\2ab'
+    assert render(FORMATS, record) == 'hello -7 42    ab|\n'
+
+
+def test_render_dropped():
+    assert render(FORMATS, b'\xff\xff\x03\x00') == '<3 dropped>\n'
+
+
+def test_cobs_decode():
+    assert cobs_decode(b'\x03\x13\x05\x01\x02a') == bytes([HEX, 5, 0, 0, ord('a')])
+
+
+def test_decode_stream():
+    record = b'\x02\x13\x01\x01\x01\x01\x02a\x00'
+    assert list(decode_stream(FORMATS, [record[:3], record[3:] + b'\0' * 24])) == ['00 a %']
+    assert list(decode_stream(FORMATS, [record[2:] + record], synced=False)) == ['00 a %']
@@ -27,12 +27,45 @@ const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
 
 
 
+
 #ifdef OTHER_KEYMAP_C
 #    include OTHER_KEYMAP_C
 #endif // OTHER_KEYMAP_C
 """
 
 
+def test_generate_c_pytest_sparse_keymap():
+    keymap_json = {
+        'keyboard': 'handwired/pytest/basic',
+        'layout': 'LAYOUT',
+        'layers': [['KC_A'], ['KC_TRNS'], ['ANY(KC_B)']],
+        'config': {
+            'features': {
+                'sparse_keymap': True
+            }
+        },
+    }
+    templ = qmk.keymap.generate_c(keymap_json)
+    assert """#ifdef SPARSE_KEYMAP_ENABLE
+_Static_assert(MATRIX_ROWS == 1 && MATRIX_COLS == 1, "The sparse keymap was generated for a 1x1 matrix");
+const uint16_t PROGMEM sparse_keymap_keycodes[] = {
+    KC_A, KC_B
+};
+const sparse_keymap_layer_t PROGMEM sparse_keymap_layers[] = {
+    [0] = {.bitmap = {0x00000001}, .index = {0}},
+    [1] = {.bitmap = {0x00000000}, .index = {1}},
+    [2] = {.bitmap = {0x00000001}, .index = {1}},
+};
+#else
+const uint16_t PROGMEM keymaps[][MATRIX_ROWS][MATRIX_COLS] = {
+    [0] = LAYOUT(KC_A),
+    [1] = LAYOUT(KC_TRNS),
+    [2] = LAYOUT(KC_B)
+};
+#endif // SPARSE_KEYMAP_ENABLE
+""" in templ
+
+
 def test_generate_json_pytest_basic():
     templ = qmk.keymap.generate_json('default', 'handwired/pytest/basic', 'LAYOUT', [['KC_A']])
     assert templ == {"keyboard": "handwired/pytest/basic", "keymap": "default", "layout": "LAYOUT", "layers": [["KC_A"]]}
@@ -0,0 +1,39 @@
+import shutil
+
+import pytest
+
+from qmk.object_cache import ObjectCache, compile_cached, read_stats, _key_flags, _split_command
+
+
+def test_split_command():
+    assert _split_command(['-c', '-Os', 'quantum/action.c', '-o', 'action.o']) == ('quantum/action.c', 'action.o', ['-c', '-Os'])
+    assert _split_command(['-Os', 'action.o', 'keyboard.o', '-o', 'firmware.elf']) is None
+    assert _split_command(['-x', 'c', '-', '-o', '/dev/null']) is None
+    assert _split_command(['-c', 'platforms/chibios/crt0.S', '-o', 'crt0.o']) is None
+
+
+def test_key_flags_drop_preprocessor_and_dependency_flags():
+    flags = ['-c', '-Os', '-DFOO=1', '-I', 'quantum', '-Iplatforms', '-include', 'config.h', '-MMD', '-MP', '-MF', 'x.td', '-mmcu=atmega32u4']
+    assert _key_flags(flags) == ['-c', '-Os', '-mmcu=atmega32u4']
+
+
+@pytest.mark.skipif(shutil.which('gcc') is None, reason='needs a host compiler')
+def test_objects_are_shared_between_targets(tmp_path, monkeypatch):
+    monkeypatch.setenv('QMK_OBJECT_CACHE_STATS', str(tmp_path / 'stats'))
+    (tmp_path / 'x.c').write_text('#include "cfg.h"\nint f(int a) { return a * VALUE; }\n')
+    for target, value in (('a', 3), ('b', 3), ('c', 4)):
+        (tmp_path / target).mkdir()
+        (tmp_path / target / 'cfg.h').write_text(f'#define VALUE {value}\n')
+
+    cache = ObjectCache(tmp_path / 'cache')
+    for target in ('a', 'b', 'c'):
+        command = ['gcc', '-c', '-Os', f'-I{tmp_path / target}', '-MMD', '-MF', str(tmp_path / target / 'x.d'), str(tmp_path / 'x.c'), '-o', str(tmp_path / target / 'x.o')]
+        assert compile_cached(cache, command) == 0
+        assert (tmp_path / target / 'x.d').exists()
+
+    # Identical headers in different directories share an object, a different value does not
+    assert read_stats(tmp_path / 'stats') == (1, 2)
+    assert (tmp_path / 'a' / 'x.o').read_bytes() == (tmp_path / 'b' / 'x.o').read_bytes()
+    assert (tmp_path / 'a' / 'x.o').read_bytes() != (tmp_path / 'c' / 'x.o').read_bytes()
+
+    assert cache.trim(0) == 2
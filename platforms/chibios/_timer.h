@@ -15,5 +15,12 @@
  */
 #pragma once
 
+#include <ch.h>
+
 // The platform is 32-bit, so prefer 32-bit timers to avoid overflow
 #define FAST_TIMER_T_SIZE 32
+
+// The realtime counter provides microsecond timestamps
+#if PORT_SUPPORTS_RT == TRUE
+#    define TIMER_US_AVAILABLE
+#endif
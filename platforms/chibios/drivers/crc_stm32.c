@@ -0,0 +1,44 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <ch.h>
+#include <hal.h>
+#include <string.h>
+
+#include "crc.h"
+
+/* Only CRC units with a programmable polynomial size can compute the 8 bit CRC
+ * used by the software implementations, older ones are fixed to CRC32. */
+#if !defined(CRC_CR_POLYSIZE)
+#    error "CRC_DRIVER = stm32 needs a CRC unit with a programmable polynomial, such as on STM32F0x1, F3, F7, G0, G4, L0, L4 or H7"
+#endif
+
+void crc_init(void) {
+    rccEnableCRC(true);
+    CRC->POL = 0x31;
+    CRC->CR  = CRC_CR_POLYSIZE_1; // 8 bit polynomial, input and output not reflected
+}
+
+uint8_t crc8_update(uint8_t initial, const void *data, size_t data_len) {
+    const uint8_t *d = (const uint8_t *)data;
+
+    // The unit is shared by the main loop and the split transport handlers
+    syssts_t status = chSysGetStatusAndLockX();
+
+    CRC->INIT = initial;
+    CRC->CR |= CRC_CR_RESET;
+
+    // A word is consumed most significant byte first, so it is fed in byte order
+    for (; data_len >= 4; data_len -= 4, d += 4) {
+        uint32_t word;
+        memcpy(&word, d, sizeof(word));
+        CRC->DR = __builtin_bswap32(word);
+    }
+    for (; data_len > 0; data_len--, d++) {
+        *(volatile uint8_t *)&CRC->DR = *d;
+    }
+    uint8_t crc = CRC->DR;
+
+    chSysRestoreStatusX(status);
+    return crc;
+}
@@ -1,3 +1,4 @@
+#include <string.h>
 #include "ws2812.h"
 #include "gpio.h"
 #include "chibios_config.h"
@@ -292,6 +293,22 @@ typedef uint8_t ws2812_buffer_t;
 
 static ws2812_buffer_t ws2812_frame_buffer[WS2812_BIT_N + 1]; /**< Buffer for a frame */
 
+/**
+ * @brief   Duty cycles of the four bits of a nibble, most significant bit first
+ */
+#define WS2812_PWM_SYMBOL(nibble, bit) (((nibble) & (8 >> (bit))) ? WS2812_DUTYCYCLE_1 : WS2812_DUTYCYCLE_0)
+#define WS2812_PWM_NIBBLE(nibble) \
+    { WS2812_PWM_SYMBOL(nibble, 0), WS2812_PWM_SYMBOL(nibble, 1), WS2812_PWM_SYMBOL(nibble, 2), WS2812_PWM_SYMBOL(nibble, 3) }
+
+static const ws2812_buffer_t ws2812_pwm_nibbles[16][4] = {
+    WS2812_PWM_NIBBLE(0),  WS2812_PWM_NIBBLE(1),  WS2812_PWM_NIBBLE(2),  WS2812_PWM_NIBBLE(3),  //
+    WS2812_PWM_NIBBLE(4),  WS2812_PWM_NIBBLE(5),  WS2812_PWM_NIBBLE(6),  WS2812_PWM_NIBBLE(7),  //
+    WS2812_PWM_NIBBLE(8),  WS2812_PWM_NIBBLE(9),  WS2812_PWM_NIBBLE(10), WS2812_PWM_NIBBLE(11), //
+    WS2812_PWM_NIBBLE(12), WS2812_PWM_NIBBLE(13), WS2812_PWM_NIBBLE(14), WS2812_PWM_NIBBLE(15), //
+};
+
+static ws2812_led_t ws2812_encoded_leds[WS2812_LED_COUNT]; /**< Colours held by the frame buffer */
+
 /* --- PUBLIC FUNCTIONS ----------------------------------------------------- */
 /*
  * Gedanke: Double-buffer type transactions: double buffer transfers using two memory pointers for
@@ -409,12 +426,20 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
     }
 }
 
+static void ws2812_encode_led(uint16_t led_number, const ws2812_led_t *led) {
+    // The fields of ws2812_led_t are laid out in the order they are sent
+    ws2812_buffer_t *dest  = &ws2812_frame_buffer[WS2812_BIT(led_number, 0, 7)];
+    const uint8_t   *bytes = (const uint8_t *)led;
+    for (uint8_t i = 0; i < sizeof(ws2812_led_t); i++) {
+        memcpy(&dest[0], ws2812_pwm_nibbles[bytes[i] >> 4], sizeof(ws2812_pwm_nibbles[0]));
+        memcpy(&dest[4], ws2812_pwm_nibbles[bytes[i] & 0x0F], sizeof(ws2812_pwm_nibbles[0]));
+        dest += 8;
+    }
+}
+
 void ws2812_flush(void) {
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
-#if defined(WS2812_RGBW)
-        ws2812_write_led_rgbw(i, ws2812_leds[i].r, ws2812_leds[i].g, ws2812_leds[i].b, ws2812_leds[i].w);
-#else
-        ws2812_write_led(i, ws2812_leds[i].r, ws2812_leds[i].g, ws2812_leds[i].b);
-#endif
+    // The DMA sends the frame buffer continuously, only rewrite the LEDs that changed
+    for (int i = 0; (i = ws2812_next_changed_led(ws2812_encoded_leds, ws2812_leds, i, WS2812_LED_COUNT)) < WS2812_LED_COUNT; i++) {
+        ws2812_encode_led(i, &ws2812_leds[i]);
     }
 }
@@ -102,66 +102,47 @@
 #    define WS2812_SCK_OUTPUT_MODE PAL_MODE_ALTERNATE(WS2812_SPI_SCK_PAL_MODE) | PAL_OUTPUT_TYPE_PUSHPULL
 #endif
 
-#define BYTES_FOR_LED_BYTE 4
-#ifdef WS2812_RGBW
-#    define WS2812_CHANNELS 4
-#else
-#    define WS2812_CHANNELS 3
-#endif
-#define BYTES_FOR_LED (BYTES_FOR_LED_BYTE * WS2812_CHANNELS)
+#define BYTES_FOR_LED (WS2812_SPI_BYTES_PER_BYTE * sizeof(ws2812_led_t))
 #define DATA_SIZE (BYTES_FOR_LED * WS2812_LED_COUNT)
 #define RESET_SIZE (1000 * WS2812_TRST_US / (2 * WS2812_TIMING))
 #define PREAMBLE_SIZE 4
+#define TXBUF_SIZE (PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE)
 
-static uint8_t txbuf[PREAMBLE_SIZE + DATA_SIZE + RESET_SIZE] = {0};
+// The next frame is encoded while the previous one is still being sent, unless the transfer is synchronous or continuous
+#if defined(WS2812_SPI_USE_CIRCULAR_BUFFER) || defined(WS2812_SPI_SYNC)
+#    define TXBUF_COUNT 1
+#else
+#    define TXBUF_COUNT 2
+#endif
 
-/*
- * As the trick here is to use the SPI to send a huge pattern of 0 and 1 to
- * the ws2812b protocol, we use this helper function to translate bytes into
- * 0s and 1s for the LED (with the appropriate timing).
- */
-static uint8_t get_protocol_eq(uint8_t data, int pos) {
-    uint8_t eq = 0;
-    if (data & (1 << (2 * (3 - pos))))
-        eq = 0b1110;
-    else
-        eq = 0b1000;
-    if (data & (2 << (2 * (3 - pos))))
-        eq += 0b11100000;
-    else
-        eq += 0b10000000;
-    return eq;
-}
+static uint8_t txbuf[TXBUF_COUNT][TXBUF_SIZE] = {0};
 
-static void set_led_color_rgb(ws2812_led_t color, int pos) {
-    uint8_t* tx_start = &txbuf[PREAMBLE_SIZE];
+// Colours each buffer was last encoded with, so only the LEDs that changed are encoded again
+static ws2812_led_t txbuf_leds[TXBUF_COUNT][WS2812_LED_COUNT];
 
-#if (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_GRB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
-#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_RGB)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.r, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.b, j);
-#elif (WS2812_BYTE_ORDER == WS2812_BYTE_ORDER_BGR)
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + j] = get_protocol_eq(color.b, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE + j] = get_protocol_eq(color.g, j);
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 2 + j] = get_protocol_eq(color.r, j);
-#endif
-#ifdef WS2812_RGBW
-    for (int j = 0; j < 4; j++)
-        tx_start[BYTES_FOR_LED * pos + BYTES_FOR_LED_BYTE * 3 + j] = get_protocol_eq(color.w, j);
+#if TXBUF_COUNT > 1
+static uint8_t *volatile tx_sending = NULL; // buffer being sent
+static uint8_t *volatile tx_pending = NULL; // encoded frame waiting for the current transfer to end
+
+static void ws2812_spi_end_cb(SPIDriver *spip) {
+    osalSysLockFromISR();
+    if (tx_pending != NULL) {
+        tx_sending = tx_pending;
+        tx_pending = NULL;
+        spiStartSendI(spip, TXBUF_SIZE, tx_sending);
+    }
+    osalSysUnlockFromISR();
+}
+#    define WS2812_SPI_END_CB ws2812_spi_end_cb
+#else
+#    define WS2812_SPI_END_CB NULL
 #endif
+
+static void ws2812_encode_frame(uint8_t index, const ws2812_led_t *leds) {
+    uint8_t *tx_start = &txbuf[index][PREAMBLE_SIZE];
+    for (int i = 0; (i = ws2812_next_changed_led(txbuf_leds[index], leds, i, WS2812_LED_COUNT)) < WS2812_LED_COUNT; i++) {
+        ws2812_spi_encode_led(&tx_start[BYTES_FOR_LED * i], &leds[i]);
+    }
 }
 
 ws2812_led_t ws2812_leds[WS2812_LED_COUNT];
@@ -180,7 +161,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_CIRCULAR == TRUE
         WS2812_SPI_BUFFER_MODE,
 #    endif
-        NULL, // end_cb
+        WS2812_SPI_END_CB, // end_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
 #    if defined(WB32F3G71xx) || defined(WB32FQ95xx)
@@ -199,7 +180,7 @@ void ws2812_init(void) {
 #    if SPI_SUPPORTS_SLAVE_MODE == TRUE
         false,
 #    endif
-        NULL, // data_cb
+        WS2812_SPI_END_CB, // data_cb
         NULL, // error_cb
         PAL_PORT(WS2812_DI_PIN),
         PAL_PAD(WS2812_DI_PIN),
@@ -216,11 +197,18 @@ void ws2812_init(void) {
 #endif
     };
 
+    // Encode all LEDs as off, as the zeroed buffers are not valid symbols
+    for (uint8_t index = 0; index < TXBUF_COUNT; index++) {
+        for (int i = 0; i < WS2812_LED_COUNT; i++) {
+            ws2812_spi_encode_led(&txbuf[index][PREAMBLE_SIZE + BYTES_FOR_LED * i], &txbuf_leds[index][i]);
+        }
+    }
+
     spiAcquireBus(&WS2812_SPI_DRIVER);     /* Acquire ownership of the bus.    */
     spiStart(&WS2812_SPI_DRIVER, &spicfg); /* Setup transfer parameters.       */
     spiSelect(&WS2812_SPI_DRIVER);         /* Slave Select assertion.          */
 #ifdef WS2812_SPI_USE_CIRCULAR_BUFFER
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiStartSend(&WS2812_SPI_DRIVER, TXBUF_SIZE, txbuf[0]);
 #endif
 }
 
@@ -240,17 +228,28 @@ void ws2812_set_color_all(uint8_t red, uint8_t green, uint8_t blue) {
 }
 
 void ws2812_flush(void) {
-    for (int i = 0; i < WS2812_LED_COUNT; i++) {
-        set_led_color_rgb(ws2812_leds[i], i);
+#if TXBUF_COUNT > 1
+    // Encode into the buffer that is not on the line, dropping any frame that has not started yet
+    osalSysLock();
+    tx_pending    = NULL;
+    uint8_t index  = tx_sending == txbuf[0] ? 1 : 0;
+    osalSysUnlock();
+
+    ws2812_encode_frame(index, ws2812_leds);
+
+    // Never wait for the previous frame, the end callback sends this one as soon as the line is free
+    osalSysLock();
+    if (WS2812_SPI_DRIVER.state == SPI_READY) {
+        tx_sending = txbuf[index];
+        spiStartSendI(&WS2812_SPI_DRIVER, TXBUF_SIZE, tx_sending);
+    } else {
+        tx_pending = txbuf[index];
     }
-
-    // Send async - each led takes ~0.03ms, 50 leds ~1.5ms, animations flushing faster than send will cause issues.
-    // Instead spiSend can be used to send synchronously (or the thread logic can be added back).
-#ifndef WS2812_SPI_USE_CIRCULAR_BUFFER
+    osalSysUnlock();
+#else
+    ws2812_encode_frame(0, ws2812_leds);
 #    ifdef WS2812_SPI_SYNC
-    spiSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
-#    else
-    spiStartSend(&WS2812_SPI_DRIVER, ARRAY_SIZE(txbuf), txbuf);
+    spiSend(&WS2812_SPI_DRIVER, TXBUF_SIZE, txbuf[0]);
 #    endif
 #endif
 }
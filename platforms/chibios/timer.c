@@ -1,6 +1,8 @@
 #include <ch.h>
+#include <hal.h>
 
 #include "timer.h"
+#include "chibios_config.h"
 
 static uint32_t ticks_offset = 0;
 static uint32_t last_ticks   = 0;
@@ -119,6 +121,35 @@ uint32_t timer_read32(void) {
     return (uint32_t)TIME_I2MS(ticks) + ms_offset_copy;
 }
 
+#ifdef TIMER_US_AVAILABLE
+#    define REALTIME_COUNTS_PER_US (REALTIME_COUNTER_CLOCK / 1000000)
+
+static rtcnt_t  last_realtime_count = 0;
+static uint32_t realtime_remainder  = 0;
+static uint32_t us_count            = 0;
+
+// The realtime counter usually runs at the CPU clock and wraps after a few seconds, so it is accumulated into a
+// microsecond count.  Time is only lost when this is not called for a whole wrap of the counter.
+uint32_t timer_read_us32(void) {
+    syssts_t status = chSysGetStatusAndLockX();
+
+    rtcnt_t  now     = chSysGetRealtimeCounterX();
+    uint32_t elapsed = (uint32_t)(now - last_realtime_count);
+    last_realtime_count = now;
+
+    us_count += elapsed / REALTIME_COUNTS_PER_US;
+    realtime_remainder += elapsed % REALTIME_COUNTS_PER_US;
+    if (realtime_remainder >= REALTIME_COUNTS_PER_US) {
+        realtime_remainder -= REALTIME_COUNTS_PER_US;
+        us_count++;
+    }
+    uint32_t us = us_count;
+
+    chSysRestoreStatusX(status);
+    return us;
+}
+#endif
+
 uint16_t timer_elapsed(uint16_t last) {
     return TIMER_DIFF_16(timer_read(), last);
 }
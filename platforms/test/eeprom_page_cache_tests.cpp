@@ -0,0 +1,202 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "eeprom.h"
+#include "eeprom_driver.h"
+#include "timer.h"
+
+void set_time(uint32_t t);
+void advance_time(uint32_t ms);
+void simulate_async_tick(uint32_t t);
+}
+
+/* Transient EEPROM parameters:
+ *
+ * size:            256 bytes
+ * page size:       16 bytes
+ * write cycle:     5ms
+ * cached pages:    2
+ */
+
+#define PAGE_SIZE TRANSIENT_EEPROM_PAGE_SIZE
+#define WRITE_TIME TRANSIENT_EEPROM_WRITE_TIME
+
+class EepromPageCacheTest : public testing::Test {
+   protected:
+    void SetUp() override {
+        timer_init();
+        // Let the timer run while busy-waiting on the simulated device
+        simulate_async_tick(1);
+        eeprom_driver_erase();
+        simulate_async_tick(0);
+        advance_time(WRITE_TIME);
+        ASSERT_FALSE(eeprom_driver_busy());
+    }
+
+    // Reads directly from the device, letting the clock run until any write cycle has completed
+    uint8_t device_byte(uintptr_t addr) {
+        uint8_t value;
+        simulate_async_tick(1);
+        eeprom_driver_read(&value, addr, 1);
+        simulate_async_tick(0);
+        return value;
+    }
+};
+
+TEST_F(EepromPageCacheTest, WritesAreDeferredToTheTask) {
+    eeprom_write_byte((uint8_t *)3, 0x42);
+
+    EXPECT_EQ(eeprom_read_byte((const uint8_t *)3), 0x42);
+    EXPECT_EQ(device_byte(3), 0x00);
+
+    eeprom_driver_task();
+    EXPECT_TRUE(eeprom_driver_busy());
+
+    advance_time(WRITE_TIME);
+    EXPECT_EQ(device_byte(3), 0x42);
+}
+
+TEST_F(EepromPageCacheTest, WritesToAPageCoalesce) {
+    eeprom_write_word((uint16_t *)0, 0x1234);
+    eeprom_driver_task();
+    EXPECT_TRUE(eeprom_driver_busy());
+
+    // The device is busy, further writes only update the cache
+    eeprom_write_byte((uint8_t *)4, 0x01);
+    eeprom_write_byte((uint8_t *)9, 0x02);
+    eeprom_write_dword((uint32_t *)10, 0xAABBCCDD);
+    eeprom_driver_task();
+    EXPECT_EQ(eeprom_read_byte((const uint8_t *)9), 0x02);
+
+    // A single page write covers all of them
+    advance_time(WRITE_TIME);
+    eeprom_driver_task();
+    EXPECT_TRUE(eeprom_driver_busy());
+    advance_time(WRITE_TIME);
+    eeprom_driver_task();
+    EXPECT_FALSE(eeprom_driver_busy());
+
+    EXPECT_EQ(device_byte(0), 0x34);
+    EXPECT_EQ(device_byte(1), 0x12);
+    EXPECT_EQ(device_byte(4), 0x01);
+    EXPECT_EQ(device_byte(9), 0x02);
+    EXPECT_EQ(device_byte(10), 0xDD);
+    EXPECT_EQ(device_byte(13), 0xAA);
+}
+
+TEST_F(EepromPageCacheTest, UnchangedDataIsNotWritten) {
+    eeprom_update_byte((uint8_t *)PAGE_SIZE, 0x00);
+    eeprom_write_byte((uint8_t *)(PAGE_SIZE + 1), 0x00);
+
+    eeprom_driver_task();
+    EXPECT_FALSE(eeprom_driver_busy());
+}
+
+TEST_F(EepromPageCacheTest, WritesAcrossPages) {
+    uint8_t data[PAGE_SIZE + 8];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = i + 1;
+    }
+
+    // Evicting a dirty page blocks until its write cycle has completed
+    simulate_async_tick(1);
+    eeprom_write_block(data, (void *)(PAGE_SIZE - 4), sizeof(data));
+    simulate_async_tick(0);
+
+    // Three pages are touched but only two fit in the cache, the oldest one is written back on eviction
+    EXPECT_EQ(device_byte(PAGE_SIZE - 4), 1);
+    EXPECT_EQ(device_byte(PAGE_SIZE), 0);
+
+    uint8_t read_back[sizeof(data)] = {0};
+    simulate_async_tick(1);
+    eeprom_read_block(read_back, (const void *)(PAGE_SIZE - 4), sizeof(read_back));
+    simulate_async_tick(0);
+    EXPECT_EQ(memcmp(data, read_back, sizeof(data)), 0);
+
+    simulate_async_tick(1);
+    eeprom_driver_flush();
+    simulate_async_tick(0);
+
+    memset(read_back, 0, sizeof(read_back));
+    simulate_async_tick(1);
+    eeprom_driver_read(read_back, PAGE_SIZE - 4, sizeof(read_back));
+    simulate_async_tick(0);
+    EXPECT_EQ(memcmp(data, read_back, sizeof(data)), 0);
+}
+
+TEST_F(EepromPageCacheTest, ReadsAreServedFromTheCache) {
+    eeprom_write_byte((uint8_t *)(2 * PAGE_SIZE), 0x55);
+    simulate_async_tick(1);
+    eeprom_driver_flush();
+    simulate_async_tick(0);
+
+    // Starts a write cycle on another page
+    eeprom_write_byte((uint8_t *)(3 * PAGE_SIZE), 0x66);
+    eeprom_driver_task();
+    ASSERT_TRUE(eeprom_driver_busy());
+
+    // A cached page is read without waiting for the device
+    EXPECT_EQ(eeprom_read_byte((const uint8_t *)(2 * PAGE_SIZE)), 0x55);
+    EXPECT_TRUE(eeprom_driver_busy());
+}
+
+TEST_F(EepromPageCacheTest, EraseDiscardsTheCache) {
+    eeprom_write_byte((uint8_t *)7, 0x77);
+
+    simulate_async_tick(1);
+    eeprom_driver_erase();
+    simulate_async_tick(0);
+
+    EXPECT_EQ(eeprom_read_byte((const uint8_t *)7), 0x00);
+    eeprom_driver_task();
+    EXPECT_FALSE(eeprom_driver_busy());
+    EXPECT_EQ(device_byte(7), 0x00);
+}
+
+TEST_F(EepromPageCacheTest, ReadsDoNotReorderWriteBacks) {
+    eeprom_write_byte((uint8_t *)0, 0x01);
+    eeprom_write_byte((uint8_t *)PAGE_SIZE, 0x02);
+    // Makes the first page the most recently used one
+    EXPECT_EQ(eeprom_read_byte((const uint8_t *)0), 0x01);
+
+    eeprom_driver_task();
+    EXPECT_EQ(device_byte(0), 0x01);
+    EXPECT_EQ(device_byte(PAGE_SIZE), 0x00);
+
+    eeprom_driver_task();
+    EXPECT_EQ(device_byte(PAGE_SIZE), 0x02);
+}
+
+TEST_F(EepromPageCacheTest, EvictionKeepsTheWriteOrder) {
+    eeprom_write_byte((uint8_t *)0, 0x01);
+    eeprom_write_byte((uint8_t *)PAGE_SIZE, 0x02);
+    EXPECT_EQ(eeprom_read_byte((const uint8_t *)0), 0x01);
+
+    // Both cached pages are dirty, loading a third one evicts the first dirtied instead of the least recently used
+    simulate_async_tick(1);
+    eeprom_write_byte((uint8_t *)(2 * PAGE_SIZE), 0x03);
+    simulate_async_tick(0);
+    EXPECT_EQ(device_byte(0), 0x01);
+    EXPECT_EQ(device_byte(PAGE_SIZE), 0x00);
+}
+
+TEST_F(EepromPageCacheTest, CommitMarkerIsWrittenLast) {
+    const uintptr_t marker = 0;
+    const uintptr_t data   = PAGE_SIZE;
+
+    eeprom_write_byte((uint8_t *)marker, 0xB5);
+    eeprom_write_byte((uint8_t *)data, 0x42);
+
+    // Clearing the marker must not reach the device along with setting it, ahead of the data
+    simulate_async_tick(1);
+    eeprom_write_byte((uint8_t *)marker, 0x00);
+    simulate_async_tick(0);
+    EXPECT_EQ(device_byte(marker), 0xB5);
+    EXPECT_EQ(device_byte(data), 0x42);
+
+    eeprom_driver_task();
+    EXPECT_EQ(device_byte(marker), 0x00);
+}
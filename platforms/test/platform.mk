@@ -1,7 +1,15 @@
 SYSTEM_TYPE := $(shell gcc -dumpmachine)
-GCC_VERSION := $(shell gcc --version 2>/dev/null)
 
+# Build with libFuzzer and AddressSanitizer instead of the Google Test main, see docs/unit_testing.md
+ifeq ($(strip $(FUZZ)), yes)
+GCC_VERSION := $(shell clang --version 2>/dev/null)
+CC = $(CC_PREFIX) clang
+COMPILEFLAGS += -fsanitize=fuzzer-no-link,address -DQMK_FUZZ
+LDFLAGS += -fsanitize=fuzzer,address
+else
+GCC_VERSION := $(shell gcc --version 2>/dev/null)
 CC = $(CC_PREFIX) gcc
+endif
 OBJCOPY =
 OBJDUMP =
 SIZE =
@@ -23,3 +23,23 @@ eeprom_legacy_emulated_flash_SRC := \
 	$(PLATFORM_PATH)/chibios/drivers/eeprom/eeprom_legacy_emulated_flash.c
 eeprom_legacy_emulated_flash_tiny_SRC := $(eeprom_legacy_emulated_flash_SRC)
 eeprom_legacy_emulated_flash_large_SRC := $(eeprom_legacy_emulated_flash_SRC)
+
+eeprom_page_cache_DEFS := -DEEPROM_DRIVER -DEEPROM_TRANSIENT \
+	-DTRANSIENT_EEPROM_SIZE=256 \
+	-DTRANSIENT_EEPROM_PAGE_SIZE=16 \
+	-DTRANSIENT_EEPROM_WRITE_TIME=5 \
+	-DEEPROM_PAGE_CACHE_COUNT=2
+eeprom_page_cache_INC := \
+	$(TOP_DIR)/drivers/eeprom
+eeprom_page_cache_SRC := \
+	$(TOP_DIR)/drivers/eeprom/eeprom_driver.c \
+	$(TOP_DIR)/drivers/eeprom/eeprom_transient.c \
+	$(TOP_DIR)/drivers/eeprom/eeprom_paged.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/eeprom_page_cache_tests.cpp \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/timer.c
+
+ws2812_encoding_INC := \
+	$(TOP_DIR)/drivers
+ws2812_encoding_SRC := \
+	$(TOP_DIR)/drivers/ws2812.c \
+	$(PLATFORM_PATH)/$(PLATFORM_KEY)/ws2812_encoding_tests.cpp
@@ -0,0 +1,178 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "ws2812.h"
+}
+
+namespace {
+
+constexpr int kLedCount    = 128;
+constexpr int kBytesPerLed = WS2812_SPI_BYTES_PER_BYTE * sizeof(ws2812_led_t);
+
+// The bit by bit expansion the SPI driver used before the lookup table
+uint8_t reference_symbol(uint8_t data, int pos) {
+    uint8_t eq = (data & (1 << (2 * (3 - pos)))) ? 0b1110 : 0b1000;
+    eq += (data & (2 << (2 * (3 - pos)))) ? 0b11100000 : 0b10000000;
+    return eq;
+}
+
+void reference_encode_led(uint8_t *dest, const ws2812_led_t *led) {
+    const uint8_t *bytes = (const uint8_t *)led;
+    for (size_t i = 0; i < sizeof(ws2812_led_t); i++) {
+        for (int pos = 0; pos < 4; pos++) {
+            *dest++ = reference_symbol(bytes[i], pos);
+        }
+    }
+}
+
+ws2812_led_t make_led(uint8_t red, uint8_t green, uint8_t blue) {
+    ws2812_led_t led = {};
+    led.r            = red;
+    led.g            = green;
+    led.b            = blue;
+    return led;
+}
+
+// Encodes the LEDs that changed since `encoded` was last updated, as the drivers do on flush
+int encode_changes(uint8_t *frame, ws2812_led_t *encoded, const ws2812_led_t *leds, int count) {
+    int changed = 0;
+    for (int i = 0; (i = ws2812_next_changed_led(encoded, leds, i, count)) < count; i++) {
+        ws2812_spi_encode_led(&frame[kBytesPerLed * i], &leds[i]);
+        changed++;
+    }
+    return changed;
+}
+
+} // namespace
+
+TEST(Ws2812Encoding, MatchesBitByBitExpansion) {
+    for (int value = 0; value < 256; value++) {
+        ws2812_led_t led = make_led(value, value, value);
+        uint8_t      expected[kBytesPerLed];
+        uint8_t      actual[kBytesPerLed];
+        reference_encode_led(expected, &led);
+        ws2812_spi_encode_led(actual, &led);
+        EXPECT_EQ(0, memcmp(expected, actual, kBytesPerLed)) << "value " << value;
+    }
+}
+
+TEST(Ws2812Encoding, SendsChannelsInByteOrder) {
+    ws2812_led_t led = make_led(0xFF, 0x00, 0x0F);
+    uint8_t      frame[kBytesPerLed];
+    ws2812_spi_encode_led(frame, &led);
+
+    const uint8_t full[] = {0xEE, 0xEE, 0xEE, 0xEE};
+    const uint8_t none[] = {0x88, 0x88, 0x88, 0x88};
+    const uint8_t low[]  = {0x88, 0x88, 0xEE, 0xEE};
+
+    const uint8_t *bytes = (const uint8_t *)&led;
+    for (size_t i = 0; i < 3; i++) {
+        const uint8_t *expected = bytes[i] == 0xFF ? full : bytes[i] == 0x0F ? low : none;
+        EXPECT_EQ(0, memcmp(expected, &frame[i * WS2812_SPI_BYTES_PER_BYTE], WS2812_SPI_BYTES_PER_BYTE)) << "channel " << i;
+    }
+}
+
+TEST(Ws2812Encoding, NoChangeIsFound) {
+    ws2812_led_t encoded[kLedCount] = {};
+    ws2812_led_t leds[kLedCount]    = {};
+    EXPECT_EQ(kLedCount, ws2812_next_changed_led(encoded, leds, 0, kLedCount));
+}
+
+TEST(Ws2812Encoding, ChangesAreFoundInOrder) {
+    ws2812_led_t encoded[kLedCount] = {};
+    ws2812_led_t leds[kLedCount]    = {};
+    leds[3]                         = make_led(1, 0, 0);
+    leds[4]                         = make_led(0, 1, 0);
+    leds[kLedCount - 1]             = make_led(0, 0, 1);
+
+    int i = ws2812_next_changed_led(encoded, leds, 0, kLedCount);
+    EXPECT_EQ(3, i);
+    i = ws2812_next_changed_led(encoded, leds, i + 1, kLedCount);
+    EXPECT_EQ(4, i);
+    i = ws2812_next_changed_led(encoded, leds, i + 1, kLedCount);
+    EXPECT_EQ(kLedCount - 1, i);
+    i = ws2812_next_changed_led(encoded, leds, i + 1, kLedCount);
+    EXPECT_EQ(kLedCount, i);
+
+    EXPECT_EQ(0, memcmp(encoded, leds, sizeof(leds)));
+    EXPECT_EQ(kLedCount, ws2812_next_changed_led(encoded, leds, 0, kLedCount));
+}
+
+TEST(Ws2812Encoding, IncrementalEncodingMatchesFullFrame) {
+    std::mt19937              rng(42);
+    std::vector<ws2812_led_t> leds(kLedCount);
+    std::vector<ws2812_led_t> encoded(kLedCount);
+    std::vector<uint8_t>      frame(kLedCount * kBytesPerLed);
+    std::vector<uint8_t>      expected(kLedCount * kBytesPerLed);
+
+    for (int i = 0; i < kLedCount; i++) {
+        ws2812_spi_encode_led(&frame[kBytesPerLed * i], &encoded[i]);
+    }
+
+    for (int round = 0; round < 50; round++) {
+        // Change a few LEDs, sometimes to the colour they already have
+        int changes = rng() % 16;
+        for (int c = 0; c < changes; c++) {
+            leds[rng() % kLedCount] = make_led(rng() % 4, rng() % 4, rng() % 4);
+        }
+        encode_changes(frame.data(), encoded.data(), leds.data(), kLedCount);
+
+        for (int i = 0; i < kLedCount; i++) {
+            reference_encode_led(&expected[kBytesPerLed * i], &leds[i]);
+        }
+        ASSERT_EQ(expected, frame) << "round " << round;
+    }
+}
+
+TEST(Ws2812Encoding, Benchmark) {
+    constexpr int kFrames = 2000;
+
+    std::mt19937              rng(1);
+    std::vector<ws2812_led_t> leds(kLedCount);
+    std::vector<ws2812_led_t> encoded(kLedCount);
+    std::vector<uint8_t>      frame(kLedCount * kBytesPerLed);
+    for (ws2812_led_t &led : leds) {
+        led = make_led(rng(), rng(), rng());
+    }
+
+    auto measure = [&](const char *name, auto &&encode_frame) {
+        auto     start    = std::chrono::steady_clock::now();
+        uint32_t checksum = 0;
+        for (int f = 0; f < kFrames; f++) {
+            encode_frame(f);
+            checksum += frame[f % frame.size()];
+        }
+        double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        std::printf("%-28s %10.1f ns/frame %8.2f ns/led %8.1f MB/s (%u)\n", name, ns / kFrames, ns / kFrames / kLedCount, frame.size() * kFrames * 1000.0 / ns, checksum & 0xFF);
+    };
+
+    std::printf("\nWS2812 SPI encoding, %d LEDs\n", kLedCount);
+    measure("bit by bit", [&](int f) {
+        leds[f % kLedCount].b++;
+        for (int i = 0; i < kLedCount; i++) {
+            reference_encode_led(&frame[kBytesPerLed * i], &leds[i]);
+        }
+    });
+    measure("lookup table", [&](int f) {
+        leds[f % kLedCount].b++;
+        for (int i = 0; i < kLedCount; i++) {
+            ws2812_spi_encode_led(&frame[kBytesPerLed * i], &leds[i]);
+        }
+    });
+    measure("lookup table, 1/8 changed", [&](int f) {
+        for (int i = f % 8; i < kLedCount; i += 8) {
+            leds[i].b++;
+        }
+        encode_changes(frame.data(), encoded.data(), leds.data(), kLedCount);
+    });
+    measure("lookup table, unchanged", [&](int f) { encode_changes(frame.data(), encoded.data(), leds.data(), kLedCount); });
+}
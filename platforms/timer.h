@@ -49,6 +49,11 @@ uint32_t timer_elapsed32(uint32_t last);
 #define timer_expired(current, future) ((uint16_t)(current - future) < UINT16_MAX / 2)
 #define timer_expired32(current, future) ((uint32_t)(current - future) < UINT32_MAX / 2)
 
+#ifdef TIMER_US_AVAILABLE
+// Microsecond timestamp, only on platforms with a fine enough counter
+uint32_t timer_read_us32(void);
+#endif
+
 // Use an appropriate timer integer size based on architecture (16-bit will overflow sooner)
 #if FAST_TIMER_T_SIZE < 32
 #    define TIMER_DIFF_FAST(a, b) TIMER_DIFF_16(a, b)
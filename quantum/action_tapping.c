@@ -1,9 +1,12 @@
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include "action.h"
 #include "action_layer.h"
 #include "action_tapping.h"
+#include "action_util.h"
+#include "keycode_config.h"
 #include "keycode.h"
 #include "timer.h"
 
@@ -64,9 +67,22 @@ static keyrecord_t waiting_buffer[WAITING_BUFFER_SIZE] = {};
 static uint8_t     waiting_buffer_head                 = 0;
 static uint8_t     waiting_buffer_tail                 = 0;
 
+/* Index of the waiting buffer, so that neither queries nor dequeues need to
+ * scan it. Counts the buffered releases and presses of every matrix key.
+ * Events of keys outside the matrix (combos, encoders, DIP switches) are only
+ * counted in total, and the buffer is scanned for them.
+ */
+static uint8_t waiting_buffer_key_counts[2][MATRIX_ROWS][MATRIX_COLS] = {}; // [pressed][row][col]
+static uint8_t waiting_buffer_pressed_count                          = 0;
+static uint8_t waiting_buffer_unindexed_count                        = 0;
+
 static bool process_tapping(keyrecord_t *record);
 static bool waiting_buffer_enq(keyrecord_t record);
+static void waiting_buffer_deq(void);
 static void waiting_buffer_clear(void);
+#    ifndef NO_ACTION_LAYER
+static void waiting_buffer_release_layers(const keyrecord_t *dropped);
+#    endif
 static bool waiting_buffer_typed(keyevent_t event);
 static bool waiting_buffer_has_anykey_pressed(void);
 static void waiting_buffer_scan_tap(void);
@@ -89,6 +105,9 @@ void action_tapping_process(keyrecord_t record) {
             // clear all in case of overflow.
             ac_dprintf("OVERFLOW: CLEAR ALL STATES\n");
             clear_keyboard();
+#    ifndef NO_ACTION_LAYER
+            waiting_buffer_release_layers(&record);
+#    endif
             waiting_buffer_clear();
             tapping_key = (keyrecord_t){0};
         }
@@ -98,7 +117,7 @@ void action_tapping_process(keyrecord_t record) {
     if (IS_EVENT(record.event) && waiting_buffer_head != waiting_buffer_tail) {
         ac_dprintf("---- action_exec: process waiting_buffer -----\n");
     }
-    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE) {
+    for (; waiting_buffer_tail != waiting_buffer_head; waiting_buffer_deq()) {
         if (process_tapping(&waiting_buffer[waiting_buffer_tail])) {
             ac_dprintf("processed: waiting_buffer[%u] =", waiting_buffer_tail);
             debug_record(waiting_buffer[waiting_buffer_tail]);
@@ -432,9 +451,25 @@ bool process_tapping(keyrecord_t *keyp) {
     }
 }
 
+static inline bool waiting_buffer_is_indexed(keypos_t key) {
+    return key.row < MATRIX_ROWS && key.col < MATRIX_COLS;
+}
+
+static inline uint8_t *waiting_buffer_key_count(keypos_t key, bool pressed) {
+    return &waiting_buffer_key_counts[pressed][key.row][key.col];
+}
+
+/** \brief Whether a press or a release of a matrix key is buffered
+ */
+static inline bool waiting_buffer_key_buffered(keypos_t key, bool pressed) {
+    return *waiting_buffer_key_count(key, pressed) > 0;
+}
+
 /** \brief Waiting buffer enq
  *
- * FIXME: Needs docs
+ * Appends a record to the waiting buffer and its index.
+ *
+ * \return false if the buffer is full
  */
 bool waiting_buffer_enq(keyrecord_t record) {
     if (IS_NOEVENT(record.event)) {
@@ -446,6 +481,16 @@ bool waiting_buffer_enq(keyrecord_t record) {
         return false;
     }
 
+    keypos_t key = record.event.key;
+    if (waiting_buffer_is_indexed(key)) {
+        (*waiting_buffer_key_count(key, record.event.pressed))++;
+    } else {
+        waiting_buffer_unindexed_count++;
+    }
+    if (record.event.pressed) {
+        waiting_buffer_pressed_count++;
+    }
+
     waiting_buffer[waiting_buffer_head] = record;
     waiting_buffer_head                 = (waiting_buffer_head + 1) % WAITING_BUFFER_SIZE;
 
@@ -454,20 +499,122 @@ bool waiting_buffer_enq(keyrecord_t record) {
     return true;
 }
 
+/** \brief Waiting buffer deq
+ *
+ * Removes the oldest record from the waiting buffer and its index.
+ */
+void waiting_buffer_deq(void) {
+    keyevent_t event    = waiting_buffer[waiting_buffer_tail].event;
+    waiting_buffer_tail = (waiting_buffer_tail + 1) % WAITING_BUFFER_SIZE;
+
+    if (event.pressed) {
+        waiting_buffer_pressed_count--;
+    }
+    if (waiting_buffer_is_indexed(event.key)) {
+        (*waiting_buffer_key_count(event.key, event.pressed))--;
+    } else {
+        waiting_buffer_unindexed_count--;
+    }
+}
+
 /** \brief Waiting buffer clear
  *
- * FIXME: Needs docs
+ * Drops all records from the waiting buffer.
  */
 void waiting_buffer_clear(void) {
     waiting_buffer_head = 0;
     waiting_buffer_tail = 0;
+    memset(waiting_buffer_key_counts, 0, sizeof(waiting_buffer_key_counts));
+    waiting_buffer_pressed_count   = 0;
+    waiting_buffer_unindexed_count = 0;
 }
 
+#    ifndef NO_ACTION_LAYER
+/** \brief Whether the press of a key was dropped unprocessed
+ *
+ * Looks at the tapping key and at the buffered records before `end`.
+ */
+static bool waiting_buffer_press_dropped(keypos_t key, uint8_t end) {
+    if (tapping_key.event.pressed && tapping_key.tap.count == 0 && KEYEQ(key, tapping_key.event.key)) {
+        return true;
+    }
+    for (uint8_t i = waiting_buffer_tail; i != end; i = (i + 1) % WAITING_BUFFER_SIZE) {
+        if (waiting_buffer[i].event.pressed && KEYEQ(key, waiting_buffer[i].event.key)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/** \brief Turns off the layer held by a key whose release was dropped
+ *
+ * Only momentary layers (MO, LM, LT, OSL) are released; layers turned on
+ * with TG, TO or TT stay on.
+ */
+static void waiting_buffer_release_layer(keypos_t key) {
+    action_t action = store_or_get_action(false, key);
+
+    switch (action.kind.id) {
+        case ACT_LAYER_MODS:
+            layer_off(action.layer_mods.layer);
+            break;
+        case ACT_LAYER_TAP:
+        case ACT_LAYER_TAP_EXT:
+            switch (action.layer_tap.code) {
+                case OP_TAP_TOGGLE:
+                case OP_OFF_ON:
+                case OP_SET_CLEAR:
+                    break;
+                case OP_ONESHOT:
+#        ifndef NO_ACTION_ONESHOT
+                    if (keymap_config.oneshot_enable) {
+                        clear_oneshot_layer_state(ONESHOT_PRESSED);
+                        break;
+                    }
+#        endif
+                    layer_off(action.layer_tap.val);
+                    break;
+                default:
+                    // MO, and LT held past its tap
+                    layer_off(action.layer_tap.val);
+                    break;
+            }
+            break;
+    }
+}
+
+/** \brief Releases the momentary layers of an overflowing buffer
+ *
+ * The buffered records and `dropped`, the record that did not fit, are
+ * about to be discarded. A layer key whose press was processed but whose
+ * release is among them would otherwise leave its layer on.
+ */
+static void waiting_buffer_release_layers(const keyrecord_t *dropped) {
+    for (uint8_t i = waiting_buffer_tail;; i = (i + 1) % WAITING_BUFFER_SIZE) {
+        const keyrecord_t *record = i == waiting_buffer_head ? dropped : &waiting_buffer[i];
+
+        if (IS_KEYEVENT(record->event) && !record->event.pressed && !waiting_buffer_press_dropped(record->event.key, i)) {
+            waiting_buffer_release_layer(record->event.key);
+        }
+        if (i == waiting_buffer_head) {
+            break;
+        }
+    }
+}
+#    endif
+
 /** \brief Waiting buffer typed
  *
- * FIXME: Needs docs
+ * \return true if the waiting buffer holds an event of the same key in the opposite state
  */
 bool waiting_buffer_typed(keyevent_t event) {
+    if (waiting_buffer_is_indexed(event.key)) {
+        return waiting_buffer_key_buffered(event.key, !event.pressed);
+    }
+    if (waiting_buffer_unindexed_count == 0) {
+        return false;
+    }
+
     for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
         if (KEYEQ(event.key, waiting_buffer[i].event.key) && event.pressed != waiting_buffer[i].event.pressed) {
             return true;
@@ -478,13 +625,10 @@ bool waiting_buffer_typed(keyevent_t event) {
 
 /** \brief Waiting buffer has anykey pressed
  *
- * FIXME: Needs docs
+ * \return true if the waiting buffer holds any press event
  */
 __attribute__((unused)) bool waiting_buffer_has_anykey_pressed(void) {
-    for (uint8_t i = waiting_buffer_tail; i != waiting_buffer_head; i = (i + 1) % WAITING_BUFFER_SIZE) {
-        if (waiting_buffer[i].event.pressed) return true;
-    }
-    return false;
+    return waiting_buffer_pressed_count > 0;
 }
 
 /** \brief Scan buffer for tapping
@@ -499,6 +643,11 @@ void waiting_buffer_scan_tap(void) {
         return;
     }
 
+    // nothing to find if the tapping key has not been released yet
+    if (waiting_buffer_is_indexed(tapping_key.event.key) && !waiting_buffer_key_buffered(tapping_key.event.key, false)) {
+        return;
+    }
+
 #    if (defined(AUTO_SHIFT_ENABLE) && defined(RETRO_SHIFT))
     TAP_DEFINE_KEYCODE;
 #    endif
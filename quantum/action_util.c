@@ -300,18 +300,57 @@ void send_6kro_report(void) {
 }
 
 #ifdef NKRO_ENABLE
+static report_nkro_t last_nkro_report;
+#    ifdef NKRO_COALESCE_REPORTS
+static report_nkro_t pending_nkro_report;
+static bool          nkro_report_pending = false;
+#    endif
+
 void send_nkro_report(void) {
     nkro_report->mods = get_mods_for_report();
 
-    static report_nkro_t last_report;
+#    ifdef NKRO_COALESCE_REPORTS
+    /* Keystrokes the host has not seen yet must not be folded away. */
+    if (nkro_report_pending && nkro_report_reverts_pending(&last_nkro_report, &pending_nkro_report, nkro_report)) {
+        flush_nkro_report();
+    }
 
+    memcpy(&pending_nkro_report, nkro_report, sizeof(report_nkro_t));
+    nkro_report_pending = memcmp(&pending_nkro_report, &last_nkro_report, sizeof(report_nkro_t)) != 0;
+#    else
     /* Only send the report if there are changes to propagate to the host. */
-    if (memcmp(nkro_report, &last_report, sizeof(report_nkro_t)) != 0) {
-        memcpy(&last_report, nkro_report, sizeof(report_nkro_t));
+    if (memcmp(nkro_report, &last_nkro_report, sizeof(report_nkro_t)) != 0) {
+        memcpy(&last_nkro_report, nkro_report, sizeof(report_nkro_t));
         host_nkro_send(nkro_report);
     }
+#    endif
 }
+
+/** \brief Sends the NKRO report coalesced during the current scan, if any
+ *
+ * Called once per keyboard task. Does nothing unless NKRO_COALESCE_REPORTS is defined.
+ */
+void flush_nkro_report(void) {
+#    ifdef NKRO_COALESCE_REPORTS
+    if (!nkro_report_pending) {
+        return;
+    }
+    nkro_report_pending = false;
+    memcpy(&last_nkro_report, &pending_nkro_report, sizeof(report_nkro_t));
+    host_nkro_send(&last_nkro_report);
+#    endif
+}
+#endif
+
+/** \brief Sends the keyboard report held back by NKRO_COALESCE_REPORTS, if any
+ *
+ * Call before a deliberate delay, so the host sees the keys as held for its whole duration.
+ */
+void flush_keyboard_report(void) {
+#ifdef NKRO_ENABLE
+    flush_nkro_report();
 #endif
+}
 
 /** \brief Send keyboard report
  *
@@ -31,6 +31,10 @@ extern report_nkro_t *nkro_report;
 #endif
 
 void send_keyboard_report(void);
+#ifdef NKRO_ENABLE
+void flush_nkro_report(void);
+#endif
+void flush_keyboard_report(void);
 
 /* key */
 inline void add_key(uint8_t key) {
@@ -15,50 +15,204 @@
  */
 
 #include "crc.h"
+#include "progmem.h"
 
 __attribute__((weak)) void crc_init(void) {
     // Software implementation nothing todo here.
 }
 
 #if defined(CRC8_USE_TABLE)
+#    ifndef CRC8_TABLE_SLICES
+#        define CRC8_TABLE_SLICES 1
+#    endif
+#    if CRC8_TABLE_SLICES != 1 && CRC8_TABLE_SLICES != 4 && CRC8_TABLE_SLICES != 8
+#        error "CRC8_TABLE_SLICES must be 1, 4 or 8"
+#    endif
+
 /**
- * Static table used for the table_driven implementation.
+ * Static tables used for the table driven implementation.
+ *
+ * `crc_table[n][x]` is the CRC of byte `x` followed by `n` zero bytes. The CRC
+ * is linear, so the bytes of a slice can be looked up independently and
+ * combined with xor, instead of each lookup waiting for the previous one.
+ * Kept in flash, so that AVR does not copy them to RAM.
  */
-static const crc_t crc_table[256] = {
-    0x00, 0x07, 0x0e, 0x09, 0x1c, 0x1b, 0x12, 0x15, 0x38, 0x3f, 0x36, 0x31, 0x24, 0x23, 0x2a, 0x2d, //
-    0x70, 0x77, 0x7e, 0x79, 0x6c, 0x6b, 0x62, 0x65, 0x48, 0x4f, 0x46, 0x41, 0x54, 0x53, 0x5a, 0x5d, //
-    0xe0, 0xe7, 0xee, 0xe9, 0xfc, 0xfb, 0xf2, 0xf5, 0xd8, 0xdf, 0xd6, 0xd1, 0xc4, 0xc3, 0xca, 0xcd, //
-    0x90, 0x97, 0x9e, 0x99, 0x8c, 0x8b, 0x82, 0x85, 0xa8, 0xaf, 0xa6, 0xa1, 0xb4, 0xb3, 0xba, 0xbd, //
-    0xc7, 0xc0, 0xc9, 0xce, 0xdb, 0xdc, 0xd5, 0xd2, 0xff, 0xf8, 0xf1, 0xf6, 0xe3, 0xe4, 0xed, 0xea, //
-    0xb7, 0xb0, 0xb9, 0xbe, 0xab, 0xac, 0xa5, 0xa2, 0x8f, 0x88, 0x81, 0x86, 0x93, 0x94, 0x9d, 0x9a, //
-    0x27, 0x20, 0x29, 0x2e, 0x3b, 0x3c, 0x35, 0x32, 0x1f, 0x18, 0x11, 0x16, 0x03, 0x04, 0x0d, 0x0a, //
-    0x57, 0x50, 0x59, 0x5e, 0x4b, 0x4c, 0x45, 0x42, 0x6f, 0x68, 0x61, 0x66, 0x73, 0x74, 0x7d, 0x7a, //
-    0x89, 0x8e, 0x87, 0x80, 0x95, 0x92, 0x9b, 0x9c, 0xb1, 0xb6, 0xbf, 0xb8, 0xad, 0xaa, 0xa3, 0xa4, //
-    0xf9, 0xfe, 0xf7, 0xf0, 0xe5, 0xe2, 0xeb, 0xec, 0xc1, 0xc6, 0xcf, 0xc8, 0xdd, 0xda, 0xd3, 0xd4, //
-    0x69, 0x6e, 0x67, 0x60, 0x75, 0x72, 0x7b, 0x7c, 0x51, 0x56, 0x5f, 0x58, 0x4d, 0x4a, 0x43, 0x44, //
-    0x19, 0x1e, 0x17, 0x10, 0x05, 0x02, 0x0b, 0x0c, 0x21, 0x26, 0x2f, 0x28, 0x3d, 0x3a, 0x33, 0x34, //
-    0x4e, 0x49, 0x40, 0x47, 0x52, 0x55, 0x5c, 0x5b, 0x76, 0x71, 0x78, 0x7f, 0x6a, 0x6d, 0x64, 0x63, //
-    0x3e, 0x39, 0x30, 0x37, 0x22, 0x25, 0x2c, 0x2b, 0x06, 0x01, 0x08, 0x0f, 0x1a, 0x1d, 0x14, 0x13, //
-    0xae, 0xa9, 0xa0, 0xa7, 0xb2, 0xb5, 0xbc, 0xbb, 0x96, 0x91, 0x98, 0x9f, 0x8a, 0x8d, 0x84, 0x83, //
-    0xde, 0xd9, 0xd0, 0xd7, 0xc2, 0xc5, 0xcc, 0xcb, 0xe6, 0xe1, 0xe8, 0xef, 0xfa, 0xfd, 0xf4, 0xf3  //
+static const uint8_t PROGMEM crc_table[CRC8_TABLE_SLICES][256] = {
+    {
+        0x00, 0x31, 0x62, 0x53, 0xc4, 0xf5, 0xa6, 0x97, 0xb9, 0x88, 0xdb, 0xea, 0x7d, 0x4c, 0x1f, 0x2e, //
+        0x43, 0x72, 0x21, 0x10, 0x87, 0xb6, 0xe5, 0xd4, 0xfa, 0xcb, 0x98, 0xa9, 0x3e, 0x0f, 0x5c, 0x6d, //
+        0x86, 0xb7, 0xe4, 0xd5, 0x42, 0x73, 0x20, 0x11, 0x3f, 0x0e, 0x5d, 0x6c, 0xfb, 0xca, 0x99, 0xa8, //
+        0xc5, 0xf4, 0xa7, 0x96, 0x01, 0x30, 0x63, 0x52, 0x7c, 0x4d, 0x1e, 0x2f, 0xb8, 0x89, 0xda, 0xeb, //
+        0x3d, 0x0c, 0x5f, 0x6e, 0xf9, 0xc8, 0x9b, 0xaa, 0x84, 0xb5, 0xe6, 0xd7, 0x40, 0x71, 0x22, 0x13, //
+        0x7e, 0x4f, 0x1c, 0x2d, 0xba, 0x8b, 0xd8, 0xe9, 0xc7, 0xf6, 0xa5, 0x94, 0x03, 0x32, 0x61, 0x50, //
+        0xbb, 0x8a, 0xd9, 0xe8, 0x7f, 0x4e, 0x1d, 0x2c, 0x02, 0x33, 0x60, 0x51, 0xc6, 0xf7, 0xa4, 0x95, //
+        0xf8, 0xc9, 0x9a, 0xab, 0x3c, 0x0d, 0x5e, 0x6f, 0x41, 0x70, 0x23, 0x12, 0x85, 0xb4, 0xe7, 0xd6, //
+        0x7a, 0x4b, 0x18, 0x29, 0xbe, 0x8f, 0xdc, 0xed, 0xc3, 0xf2, 0xa1, 0x90, 0x07, 0x36, 0x65, 0x54, //
+        0x39, 0x08, 0x5b, 0x6a, 0xfd, 0xcc, 0x9f, 0xae, 0x80, 0xb1, 0xe2, 0xd3, 0x44, 0x75, 0x26, 0x17, //
+        0xfc, 0xcd, 0x9e, 0xaf, 0x38, 0x09, 0x5a, 0x6b, 0x45, 0x74, 0x27, 0x16, 0x81, 0xb0, 0xe3, 0xd2, //
+        0xbf, 0x8e, 0xdd, 0xec, 0x7b, 0x4a, 0x19, 0x28, 0x06, 0x37, 0x64, 0x55, 0xc2, 0xf3, 0xa0, 0x91, //
+        0x47, 0x76, 0x25, 0x14, 0x83, 0xb2, 0xe1, 0xd0, 0xfe, 0xcf, 0x9c, 0xad, 0x3a, 0x0b, 0x58, 0x69, //
+        0x04, 0x35, 0x66, 0x57, 0xc0, 0xf1, 0xa2, 0x93, 0xbd, 0x8c, 0xdf, 0xee, 0x79, 0x48, 0x1b, 0x2a, //
+        0xc1, 0xf0, 0xa3, 0x92, 0x05, 0x34, 0x67, 0x56, 0x78, 0x49, 0x1a, 0x2b, 0xbc, 0x8d, 0xde, 0xef, //
+        0x82, 0xb3, 0xe0, 0xd1, 0x46, 0x77, 0x24, 0x15, 0x3b, 0x0a, 0x59, 0x68, 0xff, 0xce, 0x9d, 0xac //
+    },
+#    if CRC8_TABLE_SLICES > 1
+    {
+        0x00, 0xf4, 0xd9, 0x2d, 0x83, 0x77, 0x5a, 0xae, 0x37, 0xc3, 0xee, 0x1a, 0xb4, 0x40, 0x6d, 0x99, //
+        0x6e, 0x9a, 0xb7, 0x43, 0xed, 0x19, 0x34, 0xc0, 0x59, 0xad, 0x80, 0x74, 0xda, 0x2e, 0x03, 0xf7, //
+        0xdc, 0x28, 0x05, 0xf1, 0x5f, 0xab, 0x86, 0x72, 0xeb, 0x1f, 0x32, 0xc6, 0x68, 0x9c, 0xb1, 0x45, //
+        0xb2, 0x46, 0x6b, 0x9f, 0x31, 0xc5, 0xe8, 0x1c, 0x85, 0x71, 0x5c, 0xa8, 0x06, 0xf2, 0xdf, 0x2b, //
+        0x89, 0x7d, 0x50, 0xa4, 0x0a, 0xfe, 0xd3, 0x27, 0xbe, 0x4a, 0x67, 0x93, 0x3d, 0xc9, 0xe4, 0x10, //
+        0xe7, 0x13, 0x3e, 0xca, 0x64, 0x90, 0xbd, 0x49, 0xd0, 0x24, 0x09, 0xfd, 0x53, 0xa7, 0x8a, 0x7e, //
+        0x55, 0xa1, 0x8c, 0x78, 0xd6, 0x22, 0x0f, 0xfb, 0x62, 0x96, 0xbb, 0x4f, 0xe1, 0x15, 0x38, 0xcc, //
+        0x3b, 0xcf, 0xe2, 0x16, 0xb8, 0x4c, 0x61, 0x95, 0x0c, 0xf8, 0xd5, 0x21, 0x8f, 0x7b, 0x56, 0xa2, //
+        0x23, 0xd7, 0xfa, 0x0e, 0xa0, 0x54, 0x79, 0x8d, 0x14, 0xe0, 0xcd, 0x39, 0x97, 0x63, 0x4e, 0xba, //
+        0x4d, 0xb9, 0x94, 0x60, 0xce, 0x3a, 0x17, 0xe3, 0x7a, 0x8e, 0xa3, 0x57, 0xf9, 0x0d, 0x20, 0xd4, //
+        0xff, 0x0b, 0x26, 0xd2, 0x7c, 0x88, 0xa5, 0x51, 0xc8, 0x3c, 0x11, 0xe5, 0x4b, 0xbf, 0x92, 0x66, //
+        0x91, 0x65, 0x48, 0xbc, 0x12, 0xe6, 0xcb, 0x3f, 0xa6, 0x52, 0x7f, 0x8b, 0x25, 0xd1, 0xfc, 0x08, //
+        0xaa, 0x5e, 0x73, 0x87, 0x29, 0xdd, 0xf0, 0x04, 0x9d, 0x69, 0x44, 0xb0, 0x1e, 0xea, 0xc7, 0x33, //
+        0xc4, 0x30, 0x1d, 0xe9, 0x47, 0xb3, 0x9e, 0x6a, 0xf3, 0x07, 0x2a, 0xde, 0x70, 0x84, 0xa9, 0x5d, //
+        0x76, 0x82, 0xaf, 0x5b, 0xf5, 0x01, 0x2c, 0xd8, 0x41, 0xb5, 0x98, 0x6c, 0xc2, 0x36, 0x1b, 0xef, //
+        0x18, 0xec, 0xc1, 0x35, 0x9b, 0x6f, 0x42, 0xb6, 0x2f, 0xdb, 0xf6, 0x02, 0xac, 0x58, 0x75, 0x81 //
+    },
+    {
+        0x00, 0x46, 0x8c, 0xca, 0x29, 0x6f, 0xa5, 0xe3, 0x52, 0x14, 0xde, 0x98, 0x7b, 0x3d, 0xf7, 0xb1, //
+        0xa4, 0xe2, 0x28, 0x6e, 0x8d, 0xcb, 0x01, 0x47, 0xf6, 0xb0, 0x7a, 0x3c, 0xdf, 0x99, 0x53, 0x15, //
+        0x79, 0x3f, 0xf5, 0xb3, 0x50, 0x16, 0xdc, 0x9a, 0x2b, 0x6d, 0xa7, 0xe1, 0x02, 0x44, 0x8e, 0xc8, //
+        0xdd, 0x9b, 0x51, 0x17, 0xf4, 0xb2, 0x78, 0x3e, 0x8f, 0xc9, 0x03, 0x45, 0xa6, 0xe0, 0x2a, 0x6c, //
+        0xf2, 0xb4, 0x7e, 0x38, 0xdb, 0x9d, 0x57, 0x11, 0xa0, 0xe6, 0x2c, 0x6a, 0x89, 0xcf, 0x05, 0x43, //
+        0x56, 0x10, 0xda, 0x9c, 0x7f, 0x39, 0xf3, 0xb5, 0x04, 0x42, 0x88, 0xce, 0x2d, 0x6b, 0xa1, 0xe7, //
+        0x8b, 0xcd, 0x07, 0x41, 0xa2, 0xe4, 0x2e, 0x68, 0xd9, 0x9f, 0x55, 0x13, 0xf0, 0xb6, 0x7c, 0x3a, //
+        0x2f, 0x69, 0xa3, 0xe5, 0x06, 0x40, 0x8a, 0xcc, 0x7d, 0x3b, 0xf1, 0xb7, 0x54, 0x12, 0xd8, 0x9e, //
+        0xd5, 0x93, 0x59, 0x1f, 0xfc, 0xba, 0x70, 0x36, 0x87, 0xc1, 0x0b, 0x4d, 0xae, 0xe8, 0x22, 0x64, //
+        0x71, 0x37, 0xfd, 0xbb, 0x58, 0x1e, 0xd4, 0x92, 0x23, 0x65, 0xaf, 0xe9, 0x0a, 0x4c, 0x86, 0xc0, //
+        0xac, 0xea, 0x20, 0x66, 0x85, 0xc3, 0x09, 0x4f, 0xfe, 0xb8, 0x72, 0x34, 0xd7, 0x91, 0x5b, 0x1d, //
+        0x08, 0x4e, 0x84, 0xc2, 0x21, 0x67, 0xad, 0xeb, 0x5a, 0x1c, 0xd6, 0x90, 0x73, 0x35, 0xff, 0xb9, //
+        0x27, 0x61, 0xab, 0xed, 0x0e, 0x48, 0x82, 0xc4, 0x75, 0x33, 0xf9, 0xbf, 0x5c, 0x1a, 0xd0, 0x96, //
+        0x83, 0xc5, 0x0f, 0x49, 0xaa, 0xec, 0x26, 0x60, 0xd1, 0x97, 0x5d, 0x1b, 0xf8, 0xbe, 0x74, 0x32, //
+        0x5e, 0x18, 0xd2, 0x94, 0x77, 0x31, 0xfb, 0xbd, 0x0c, 0x4a, 0x80, 0xc6, 0x25, 0x63, 0xa9, 0xef, //
+        0xfa, 0xbc, 0x76, 0x30, 0xd3, 0x95, 0x5f, 0x19, 0xa8, 0xee, 0x24, 0x62, 0x81, 0xc7, 0x0d, 0x4b //
+    },
+    {
+        0x00, 0x9b, 0x07, 0x9c, 0x0e, 0x95, 0x09, 0x92, 0x1c, 0x87, 0x1b, 0x80, 0x12, 0x89, 0x15, 0x8e, //
+        0x38, 0xa3, 0x3f, 0xa4, 0x36, 0xad, 0x31, 0xaa, 0x24, 0xbf, 0x23, 0xb8, 0x2a, 0xb1, 0x2d, 0xb6, //
+        0x70, 0xeb, 0x77, 0xec, 0x7e, 0xe5, 0x79, 0xe2, 0x6c, 0xf7, 0x6b, 0xf0, 0x62, 0xf9, 0x65, 0xfe, //
+        0x48, 0xd3, 0x4f, 0xd4, 0x46, 0xdd, 0x41, 0xda, 0x54, 0xcf, 0x53, 0xc8, 0x5a, 0xc1, 0x5d, 0xc6, //
+        0xe0, 0x7b, 0xe7, 0x7c, 0xee, 0x75, 0xe9, 0x72, 0xfc, 0x67, 0xfb, 0x60, 0xf2, 0x69, 0xf5, 0x6e, //
+        0xd8, 0x43, 0xdf, 0x44, 0xd6, 0x4d, 0xd1, 0x4a, 0xc4, 0x5f, 0xc3, 0x58, 0xca, 0x51, 0xcd, 0x56, //
+        0x90, 0x0b, 0x97, 0x0c, 0x9e, 0x05, 0x99, 0x02, 0x8c, 0x17, 0x8b, 0x10, 0x82, 0x19, 0x85, 0x1e, //
+        0xa8, 0x33, 0xaf, 0x34, 0xa6, 0x3d, 0xa1, 0x3a, 0xb4, 0x2f, 0xb3, 0x28, 0xba, 0x21, 0xbd, 0x26, //
+        0xf1, 0x6a, 0xf6, 0x6d, 0xff, 0x64, 0xf8, 0x63, 0xed, 0x76, 0xea, 0x71, 0xe3, 0x78, 0xe4, 0x7f, //
+        0xc9, 0x52, 0xce, 0x55, 0xc7, 0x5c, 0xc0, 0x5b, 0xd5, 0x4e, 0xd2, 0x49, 0xdb, 0x40, 0xdc, 0x47, //
+        0x81, 0x1a, 0x86, 0x1d, 0x8f, 0x14, 0x88, 0x13, 0x9d, 0x06, 0x9a, 0x01, 0x93, 0x08, 0x94, 0x0f, //
+        0xb9, 0x22, 0xbe, 0x25, 0xb7, 0x2c, 0xb0, 0x2b, 0xa5, 0x3e, 0xa2, 0x39, 0xab, 0x30, 0xac, 0x37, //
+        0x11, 0x8a, 0x16, 0x8d, 0x1f, 0x84, 0x18, 0x83, 0x0d, 0x96, 0x0a, 0x91, 0x03, 0x98, 0x04, 0x9f, //
+        0x29, 0xb2, 0x2e, 0xb5, 0x27, 0xbc, 0x20, 0xbb, 0x35, 0xae, 0x32, 0xa9, 0x3b, 0xa0, 0x3c, 0xa7, //
+        0x61, 0xfa, 0x66, 0xfd, 0x6f, 0xf4, 0x68, 0xf3, 0x7d, 0xe6, 0x7a, 0xe1, 0x73, 0xe8, 0x74, 0xef, //
+        0x59, 0xc2, 0x5e, 0xc5, 0x57, 0xcc, 0x50, 0xcb, 0x45, 0xde, 0x42, 0xd9, 0x4b, 0xd0, 0x4c, 0xd7 //
+    },
+#    endif
+#    if CRC8_TABLE_SLICES > 4
+    {
+        0x00, 0xd3, 0x97, 0x44, 0x1f, 0xcc, 0x88, 0x5b, 0x3e, 0xed, 0xa9, 0x7a, 0x21, 0xf2, 0xb6, 0x65, //
+        0x7c, 0xaf, 0xeb, 0x38, 0x63, 0xb0, 0xf4, 0x27, 0x42, 0x91, 0xd5, 0x06, 0x5d, 0x8e, 0xca, 0x19, //
+        0xf8, 0x2b, 0x6f, 0xbc, 0xe7, 0x34, 0x70, 0xa3, 0xc6, 0x15, 0x51, 0x82, 0xd9, 0x0a, 0x4e, 0x9d, //
+        0x84, 0x57, 0x13, 0xc0, 0x9b, 0x48, 0x0c, 0xdf, 0xba, 0x69, 0x2d, 0xfe, 0xa5, 0x76, 0x32, 0xe1, //
+        0xc1, 0x12, 0x56, 0x85, 0xde, 0x0d, 0x49, 0x9a, 0xff, 0x2c, 0x68, 0xbb, 0xe0, 0x33, 0x77, 0xa4, //
+        0xbd, 0x6e, 0x2a, 0xf9, 0xa2, 0x71, 0x35, 0xe6, 0x83, 0x50, 0x14, 0xc7, 0x9c, 0x4f, 0x0b, 0xd8, //
+        0x39, 0xea, 0xae, 0x7d, 0x26, 0xf5, 0xb1, 0x62, 0x07, 0xd4, 0x90, 0x43, 0x18, 0xcb, 0x8f, 0x5c, //
+        0x45, 0x96, 0xd2, 0x01, 0x5a, 0x89, 0xcd, 0x1e, 0x7b, 0xa8, 0xec, 0x3f, 0x64, 0xb7, 0xf3, 0x20, //
+        0xb3, 0x60, 0x24, 0xf7, 0xac, 0x7f, 0x3b, 0xe8, 0x8d, 0x5e, 0x1a, 0xc9, 0x92, 0x41, 0x05, 0xd6, //
+        0xcf, 0x1c, 0x58, 0x8b, 0xd0, 0x03, 0x47, 0x94, 0xf1, 0x22, 0x66, 0xb5, 0xee, 0x3d, 0x79, 0xaa, //
+        0x4b, 0x98, 0xdc, 0x0f, 0x54, 0x87, 0xc3, 0x10, 0x75, 0xa6, 0xe2, 0x31, 0x6a, 0xb9, 0xfd, 0x2e, //
+        0x37, 0xe4, 0xa0, 0x73, 0x28, 0xfb, 0xbf, 0x6c, 0x09, 0xda, 0x9e, 0x4d, 0x16, 0xc5, 0x81, 0x52, //
+        0x72, 0xa1, 0xe5, 0x36, 0x6d, 0xbe, 0xfa, 0x29, 0x4c, 0x9f, 0xdb, 0x08, 0x53, 0x80, 0xc4, 0x17, //
+        0x0e, 0xdd, 0x99, 0x4a, 0x11, 0xc2, 0x86, 0x55, 0x30, 0xe3, 0xa7, 0x74, 0x2f, 0xfc, 0xb8, 0x6b, //
+        0x8a, 0x59, 0x1d, 0xce, 0x95, 0x46, 0x02, 0xd1, 0xb4, 0x67, 0x23, 0xf0, 0xab, 0x78, 0x3c, 0xef, //
+        0xf6, 0x25, 0x61, 0xb2, 0xe9, 0x3a, 0x7e, 0xad, 0xc8, 0x1b, 0x5f, 0x8c, 0xd7, 0x04, 0x40, 0x93 //
+    },
+    {
+        0x00, 0x57, 0xae, 0xf9, 0x6d, 0x3a, 0xc3, 0x94, 0xda, 0x8d, 0x74, 0x23, 0xb7, 0xe0, 0x19, 0x4e, //
+        0x85, 0xd2, 0x2b, 0x7c, 0xe8, 0xbf, 0x46, 0x11, 0x5f, 0x08, 0xf1, 0xa6, 0x32, 0x65, 0x9c, 0xcb, //
+        0x3b, 0x6c, 0x95, 0xc2, 0x56, 0x01, 0xf8, 0xaf, 0xe1, 0xb6, 0x4f, 0x18, 0x8c, 0xdb, 0x22, 0x75, //
+        0xbe, 0xe9, 0x10, 0x47, 0xd3, 0x84, 0x7d, 0x2a, 0x64, 0x33, 0xca, 0x9d, 0x09, 0x5e, 0xa7, 0xf0, //
+        0x76, 0x21, 0xd8, 0x8f, 0x1b, 0x4c, 0xb5, 0xe2, 0xac, 0xfb, 0x02, 0x55, 0xc1, 0x96, 0x6f, 0x38, //
+        0xf3, 0xa4, 0x5d, 0x0a, 0x9e, 0xc9, 0x30, 0x67, 0x29, 0x7e, 0x87, 0xd0, 0x44, 0x13, 0xea, 0xbd, //
+        0x4d, 0x1a, 0xe3, 0xb4, 0x20, 0x77, 0x8e, 0xd9, 0x97, 0xc0, 0x39, 0x6e, 0xfa, 0xad, 0x54, 0x03, //
+        0xc8, 0x9f, 0x66, 0x31, 0xa5, 0xf2, 0x0b, 0x5c, 0x12, 0x45, 0xbc, 0xeb, 0x7f, 0x28, 0xd1, 0x86, //
+        0xec, 0xbb, 0x42, 0x15, 0x81, 0xd6, 0x2f, 0x78, 0x36, 0x61, 0x98, 0xcf, 0x5b, 0x0c, 0xf5, 0xa2, //
+        0x69, 0x3e, 0xc7, 0x90, 0x04, 0x53, 0xaa, 0xfd, 0xb3, 0xe4, 0x1d, 0x4a, 0xde, 0x89, 0x70, 0x27, //
+        0xd7, 0x80, 0x79, 0x2e, 0xba, 0xed, 0x14, 0x43, 0x0d, 0x5a, 0xa3, 0xf4, 0x60, 0x37, 0xce, 0x99, //
+        0x52, 0x05, 0xfc, 0xab, 0x3f, 0x68, 0x91, 0xc6, 0x88, 0xdf, 0x26, 0x71, 0xe5, 0xb2, 0x4b, 0x1c, //
+        0x9a, 0xcd, 0x34, 0x63, 0xf7, 0xa0, 0x59, 0x0e, 0x40, 0x17, 0xee, 0xb9, 0x2d, 0x7a, 0x83, 0xd4, //
+        0x1f, 0x48, 0xb1, 0xe6, 0x72, 0x25, 0xdc, 0x8b, 0xc5, 0x92, 0x6b, 0x3c, 0xa8, 0xff, 0x06, 0x51, //
+        0xa1, 0xf6, 0x0f, 0x58, 0xcc, 0x9b, 0x62, 0x35, 0x7b, 0x2c, 0xd5, 0x82, 0x16, 0x41, 0xb8, 0xef, //
+        0x24, 0x73, 0x8a, 0xdd, 0x49, 0x1e, 0xe7, 0xb0, 0xfe, 0xa9, 0x50, 0x07, 0x93, 0xc4, 0x3d, 0x6a //
+    },
+    {
+        0x00, 0xe9, 0xe3, 0x0a, 0xf7, 0x1e, 0x14, 0xfd, 0xdf, 0x36, 0x3c, 0xd5, 0x28, 0xc1, 0xcb, 0x22, //
+        0x8f, 0x66, 0x6c, 0x85, 0x78, 0x91, 0x9b, 0x72, 0x50, 0xb9, 0xb3, 0x5a, 0xa7, 0x4e, 0x44, 0xad, //
+        0x2f, 0xc6, 0xcc, 0x25, 0xd8, 0x31, 0x3b, 0xd2, 0xf0, 0x19, 0x13, 0xfa, 0x07, 0xee, 0xe4, 0x0d, //
+        0xa0, 0x49, 0x43, 0xaa, 0x57, 0xbe, 0xb4, 0x5d, 0x7f, 0x96, 0x9c, 0x75, 0x88, 0x61, 0x6b, 0x82, //
+        0x5e, 0xb7, 0xbd, 0x54, 0xa9, 0x40, 0x4a, 0xa3, 0x81, 0x68, 0x62, 0x8b, 0x76, 0x9f, 0x95, 0x7c, //
+        0xd1, 0x38, 0x32, 0xdb, 0x26, 0xcf, 0xc5, 0x2c, 0x0e, 0xe7, 0xed, 0x04, 0xf9, 0x10, 0x1a, 0xf3, //
+        0x71, 0x98, 0x92, 0x7b, 0x86, 0x6f, 0x65, 0x8c, 0xae, 0x47, 0x4d, 0xa4, 0x59, 0xb0, 0xba, 0x53, //
+        0xfe, 0x17, 0x1d, 0xf4, 0x09, 0xe0, 0xea, 0x03, 0x21, 0xc8, 0xc2, 0x2b, 0xd6, 0x3f, 0x35, 0xdc, //
+        0xbc, 0x55, 0x5f, 0xb6, 0x4b, 0xa2, 0xa8, 0x41, 0x63, 0x8a, 0x80, 0x69, 0x94, 0x7d, 0x77, 0x9e, //
+        0x33, 0xda, 0xd0, 0x39, 0xc4, 0x2d, 0x27, 0xce, 0xec, 0x05, 0x0f, 0xe6, 0x1b, 0xf2, 0xf8, 0x11, //
+        0x93, 0x7a, 0x70, 0x99, 0x64, 0x8d, 0x87, 0x6e, 0x4c, 0xa5, 0xaf, 0x46, 0xbb, 0x52, 0x58, 0xb1, //
+        0x1c, 0xf5, 0xff, 0x16, 0xeb, 0x02, 0x08, 0xe1, 0xc3, 0x2a, 0x20, 0xc9, 0x34, 0xdd, 0xd7, 0x3e, //
+        0xe2, 0x0b, 0x01, 0xe8, 0x15, 0xfc, 0xf6, 0x1f, 0x3d, 0xd4, 0xde, 0x37, 0xca, 0x23, 0x29, 0xc0, //
+        0x6d, 0x84, 0x8e, 0x67, 0x9a, 0x73, 0x79, 0x90, 0xb2, 0x5b, 0x51, 0xb8, 0x45, 0xac, 0xa6, 0x4f, //
+        0xcd, 0x24, 0x2e, 0xc7, 0x3a, 0xd3, 0xd9, 0x30, 0x12, 0xfb, 0xf1, 0x18, 0xe5, 0x0c, 0x06, 0xef, //
+        0x42, 0xab, 0xa1, 0x48, 0xb5, 0x5c, 0x56, 0xbf, 0x9d, 0x74, 0x7e, 0x97, 0x6a, 0x83, 0x89, 0x60 //
+    },
+    {
+        0x00, 0x49, 0x92, 0xdb, 0x15, 0x5c, 0x87, 0xce, 0x2a, 0x63, 0xb8, 0xf1, 0x3f, 0x76, 0xad, 0xe4, //
+        0x54, 0x1d, 0xc6, 0x8f, 0x41, 0x08, 0xd3, 0x9a, 0x7e, 0x37, 0xec, 0xa5, 0x6b, 0x22, 0xf9, 0xb0, //
+        0xa8, 0xe1, 0x3a, 0x73, 0xbd, 0xf4, 0x2f, 0x66, 0x82, 0xcb, 0x10, 0x59, 0x97, 0xde, 0x05, 0x4c, //
+        0xfc, 0xb5, 0x6e, 0x27, 0xe9, 0xa0, 0x7b, 0x32, 0xd6, 0x9f, 0x44, 0x0d, 0xc3, 0x8a, 0x51, 0x18, //
+        0x61, 0x28, 0xf3, 0xba, 0x74, 0x3d, 0xe6, 0xaf, 0x4b, 0x02, 0xd9, 0x90, 0x5e, 0x17, 0xcc, 0x85, //
+        0x35, 0x7c, 0xa7, 0xee, 0x20, 0x69, 0xb2, 0xfb, 0x1f, 0x56, 0x8d, 0xc4, 0x0a, 0x43, 0x98, 0xd1, //
+        0xc9, 0x80, 0x5b, 0x12, 0xdc, 0x95, 0x4e, 0x07, 0xe3, 0xaa, 0x71, 0x38, 0xf6, 0xbf, 0x64, 0x2d, //
+        0x9d, 0xd4, 0x0f, 0x46, 0x88, 0xc1, 0x1a, 0x53, 0xb7, 0xfe, 0x25, 0x6c, 0xa2, 0xeb, 0x30, 0x79, //
+        0xc2, 0x8b, 0x50, 0x19, 0xd7, 0x9e, 0x45, 0x0c, 0xe8, 0xa1, 0x7a, 0x33, 0xfd, 0xb4, 0x6f, 0x26, //
+        0x96, 0xdf, 0x04, 0x4d, 0x83, 0xca, 0x11, 0x58, 0xbc, 0xf5, 0x2e, 0x67, 0xa9, 0xe0, 0x3b, 0x72, //
+        0x6a, 0x23, 0xf8, 0xb1, 0x7f, 0x36, 0xed, 0xa4, 0x40, 0x09, 0xd2, 0x9b, 0x55, 0x1c, 0xc7, 0x8e, //
+        0x3e, 0x77, 0xac, 0xe5, 0x2b, 0x62, 0xb9, 0xf0, 0x14, 0x5d, 0x86, 0xcf, 0x01, 0x48, 0x93, 0xda, //
+        0xa3, 0xea, 0x31, 0x78, 0xb6, 0xff, 0x24, 0x6d, 0x89, 0xc0, 0x1b, 0x52, 0x9c, 0xd5, 0x0e, 0x47, //
+        0xf7, 0xbe, 0x65, 0x2c, 0xe2, 0xab, 0x70, 0x39, 0xdd, 0x94, 0x4f, 0x06, 0xc8, 0x81, 0x5a, 0x13, //
+        0x0b, 0x42, 0x99, 0xd0, 0x1e, 0x57, 0x8c, 0xc5, 0x21, 0x68, 0xb3, 0xfa, 0x34, 0x7d, 0xa6, 0xef, //
+        0x5f, 0x16, 0xcd, 0x84, 0x4a, 0x03, 0xd8, 0x91, 0x75, 0x3c, 0xe7, 0xae, 0x60, 0x29, 0xf2, 0xbb //
+    },
+#    endif
 };
 
-__attribute__((weak)) uint8_t crc8(const void *data, size_t data_len) {
+#    define CRC_TABLE(slice, byte) pgm_read_byte(&crc_table[slice][byte])
+
+__attribute__((weak)) uint8_t crc8_update(uint8_t initial, const void *data, size_t data_len) {
     const uint8_t *d   = (const uint8_t *)data;
-    crc_t          crc = 0xff;
-    size_t         tbl_idx;
+    crc_t          crc = initial;
 
+#    if CRC8_TABLE_SLICES == 8
+    for (; data_len >= 8; data_len -= 8, d += 8) {
+        crc = CRC_TABLE(7, crc ^ d[0]) ^ CRC_TABLE(6, d[1]) ^ CRC_TABLE(5, d[2]) ^ CRC_TABLE(4, d[3]) ^ CRC_TABLE(3, d[4]) ^ CRC_TABLE(2, d[5]) ^ CRC_TABLE(1, d[6]) ^ CRC_TABLE(0, d[7]);
+    }
+#    elif CRC8_TABLE_SLICES == 4
+    for (; data_len >= 4; data_len -= 4, d += 4) {
+        crc = CRC_TABLE(3, crc ^ d[0]) ^ CRC_TABLE(2, d[1]) ^ CRC_TABLE(1, d[2]) ^ CRC_TABLE(0, d[3]);
+    }
+#    endif
     while (data_len--) {
-        tbl_idx = crc ^ *d;
-        crc     = crc_table[tbl_idx] & 0xff;
+        crc = CRC_TABLE(0, crc ^ *d);
         d++;
     }
-    return crc & 0xff;
+    return crc;
 }
 #else
-__attribute__((weak)) uint8_t crc8(const void *data, size_t data_len) {
+__attribute__((weak)) uint8_t crc8_update(uint8_t initial, const void *data, size_t data_len) {
     const uint8_t *d   = (const uint8_t *)data;
-    crc_t          crc = 0xff;
+    crc_t          crc = initial;
     size_t         i, j;
 
     for (i = 0; i < data_len; i++) {
@@ -73,3 +227,7 @@ __attribute__((weak)) uint8_t crc8(const void *data, size_t data_len) {
     return crc;
 }
 #endif
+
+__attribute__((weak)) uint8_t crc8(const void *data, size_t data_len) {
+    return crc8_update(0xff, data, data_len);
+}
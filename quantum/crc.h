@@ -32,6 +32,15 @@ typedef uint_least8_t crc_t;
 
 /**
  * Initialize crc subsystem.
+ *
+ * All implementations compute the same CRC8 (polynomial 0x31, no reflection),
+ * so they can be swapped without breaking compatibility:
+ *
+ * - bit by bit, the default
+ * - a 256 byte table with `CRC8_USE_TABLE`, looking up 4 or 8 bytes at a time
+ *   with `CRC8_TABLE_SLICES` set to 4 or 8 (1kB or 2kB of tables)
+ * - the MCU's CRC unit with `CRC_DRIVER = stm32`, which replaces these weak
+ *   functions
  */
 __attribute__((weak)) void crc_init(void);
 
@@ -43,3 +52,16 @@ __attribute__((weak)) void crc_init(void);
  * \return             The calculated crc value.
  */
 __attribute__((weak)) uint8_t crc8(const void *data, size_t data_len);
+
+/**
+ * Continue a CRC8 calculation over further data.
+ *
+ * `crc8(data, len)` equals `crc8_update(0xff, data, len)`, so a buffer can be
+ * checksummed in pieces as it streams in.
+ *
+ * \param[in] initial  The CRC of the preceding data, 0xff to start.
+ * \param[in] data     Pointer to a buffer of \a data_len bytes.
+ * \param[in] data_len Number of bytes in the \a data buffer.
+ * \return             The updated crc value.
+ */
+__attribute__((weak)) uint8_t crc8_update(uint8_t initial, const void *data, size_t data_len);
@@ -21,6 +21,9 @@
 #include "progmem.h"
 #include "send_string.h"
 #include "keycodes.h"
+#ifdef DYNAMIC_KEYMAP_SPARSE
+#    include "sparse_keymap.h"
+#endif
 
 #ifdef VIA_ENABLE
 #    include "via.h"
@@ -68,9 +71,28 @@
 #    define DYNAMIC_KEYMAP_EEPROM_ADDR DYNAMIC_KEYMAP_EEPROM_START
 #endif
 
+#ifdef DYNAMIC_KEYMAP_SPARSE
+// Each layer stores a bitmap of its keys that are not KC_TRNS, and a shared
+// pool after the bitmaps holds the keycodes of those keys, ordered by layer,
+// row and column. The free slots of the pool are a gap after the last
+// written keycode, so that writing the keymap in order moves nothing.
+#    ifndef DYNAMIC_KEYMAP_SPARSE_KEYCODES
+// Room for a full base layer and a quarter of every other layer
+#        define DYNAMIC_KEYMAP_SPARSE_KEYCODES (SPARSE_KEYMAP_KEYS + (DYNAMIC_KEYMAP_LAYER_COUNT - 1) * SPARSE_KEYMAP_KEYS / 4)
+#    endif
+#    define DYNAMIC_KEYMAP_BITMAP_SIZE (SPARSE_KEYMAP_BLOCKS * 4)
+#    define DYNAMIC_KEYMAP_KEYCODES_EEPROM_ADDR (DYNAMIC_KEYMAP_EEPROM_ADDR + (DYNAMIC_KEYMAP_LAYER_COUNT * DYNAMIC_KEYMAP_BITMAP_SIZE))
+// Position of the gap, then a flag set while keycodes are moved around
+#    define DYNAMIC_KEYMAP_SPARSE_GAP_EEPROM_ADDR (DYNAMIC_KEYMAP_KEYCODES_EEPROM_ADDR + (DYNAMIC_KEYMAP_SPARSE_KEYCODES * 2))
+#    define DYNAMIC_KEYMAP_SPARSE_BUSY_EEPROM_ADDR (DYNAMIC_KEYMAP_SPARSE_GAP_EEPROM_ADDR + 2)
+#    define DYNAMIC_KEYMAP_EEPROM_SIZE ((DYNAMIC_KEYMAP_LAYER_COUNT * DYNAMIC_KEYMAP_BITMAP_SIZE) + (DYNAMIC_KEYMAP_SPARSE_KEYCODES * 2) + 3)
+#else
+#    define DYNAMIC_KEYMAP_EEPROM_SIZE (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2)
+#endif
+
 // Dynamic encoders starts after dynamic keymaps
 #ifndef DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR
-#    define DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR (DYNAMIC_KEYMAP_EEPROM_ADDR + (DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2))
+#    define DYNAMIC_KEYMAP_ENCODER_EEPROM_ADDR (DYNAMIC_KEYMAP_EEPROM_ADDR + DYNAMIC_KEYMAP_EEPROM_SIZE)
 #endif
 
 // Dynamic macro starts after dynamic encoders, but only when using ENCODER_MAP
@@ -105,6 +127,253 @@ uint8_t dynamic_keymap_get_layer_count(void) {
     return DYNAMIC_KEYMAP_LAYER_COUNT;
 }
 
+#ifdef DYNAMIC_KEYMAP_SPARSE
+// Keys are numbered across all layers, so that key n + 1 is stored after key n
+#    define DYNAMIC_KEYMAP_KEY_COUNT (DYNAMIC_KEYMAP_LAYER_COUNT * SPARSE_KEYMAP_KEYS)
+
+// Number of keycodes stored before the first key of each block, rebuilt from the bitmaps after every write
+static uint16_t sparse_index[DYNAMIC_KEYMAP_LAYER_COUNT][SPARSE_KEYMAP_BLOCKS];
+static uint16_t sparse_count;
+// Keycodes from this position on are stored at the end of the pool, after the free slots
+static uint16_t sparse_gap;
+static bool     sparse_indexed = false;
+
+static void *sparse_bitmap_address(uint8_t layer, uint8_t block) {
+    return ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + (layer * DYNAMIC_KEYMAP_BITMAP_SIZE) + (block * 4);
+}
+
+static uint32_t sparse_read_bitmap(uint8_t layer, uint8_t block) {
+    uint8_t bytes[4];
+    eeprom_read_block(bytes, sparse_bitmap_address(layer, block), 4);
+    return ((uint32_t)bytes[3] << 24) | ((uint32_t)bytes[2] << 16) | ((uint32_t)bytes[1] << 8) | bytes[0];
+}
+
+static void sparse_write_bitmap(uint8_t layer, uint8_t block, uint32_t bitmap) {
+    void *address = sparse_bitmap_address(layer, block);
+    for (uint8_t i = 0; i < 4; i++) {
+        eeprom_update_byte(address + i, (uint8_t)(bitmap >> (i * 8)));
+    }
+}
+
+static bool sparse_is_stored(uint16_t key) {
+    uint16_t index = key % SPARSE_KEYMAP_KEYS;
+    return sparse_read_bitmap(key / SPARSE_KEYMAP_KEYS, index / 32) & (1UL << (index % 32));
+}
+
+static void sparse_write_gap(uint16_t gap) {
+    sparse_gap = gap;
+    eeprom_update_word((uint16_t *)DYNAMIC_KEYMAP_SPARSE_GAP_EEPROM_ADDR, gap);
+}
+
+static bool sparse_is_busy(void) {
+    return eeprom_read_byte((uint8_t *)DYNAMIC_KEYMAP_SPARSE_BUSY_EEPROM_ADDR) != 0;
+}
+
+static void sparse_set_busy(bool busy) {
+    eeprom_update_byte((uint8_t *)DYNAMIC_KEYMAP_SPARSE_BUSY_EEPROM_ADDR, busy);
+}
+
+static void sparse_update_index(void) {
+    uint16_t count = 0;
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t block = 0; block < SPARSE_KEYMAP_BLOCKS; block++) {
+            sparse_index[layer][block] = count;
+            count += __builtin_popcountl(sparse_read_bitmap(layer, block));
+        }
+    }
+    sparse_count   = count;
+    sparse_indexed = true;
+}
+
+/* Builds the index on first use. If keycodes were being moved when the
+ * keyboard lost power, the pool no longer matches the bitmaps, and the keymap
+ * is reset to the one in flash. */
+static void sparse_load(void) {
+    sparse_update_index();
+    sparse_gap = eeprom_read_word((uint16_t *)DYNAMIC_KEYMAP_SPARSE_GAP_EEPROM_ADDR);
+    if (sparse_is_busy() || sparse_count > DYNAMIC_KEYMAP_SPARSE_KEYCODES || sparse_gap > sparse_count) {
+        dynamic_keymap_reset();
+    }
+}
+
+// Position in the pool of the keycode of `key`, or of the next stored keycode if `key` is KC_TRNS
+static uint16_t sparse_position(uint16_t key) {
+    if (!sparse_indexed) {
+        sparse_load();
+    }
+    if (key >= DYNAMIC_KEYMAP_KEY_COUNT) {
+        return sparse_count;
+    }
+    uint8_t  layer = key / SPARSE_KEYMAP_KEYS;
+    uint16_t index = key % SPARSE_KEYMAP_KEYS;
+    return sparse_index[layer][index / 32] + sparse_keymap_rank(sparse_read_bitmap(layer, index / 32), index % 32);
+}
+
+// Slot of the pool that holds the keycode at `position`
+static uint16_t sparse_slot(uint16_t position) {
+    return position < sparse_gap ? position : position + (DYNAMIC_KEYMAP_SPARSE_KEYCODES - sparse_count);
+}
+
+static uint16_t sparse_read_slot(uint16_t slot) {
+    if (slot >= DYNAMIC_KEYMAP_SPARSE_KEYCODES) return KC_TRNS;
+    void *address = ((void *)DYNAMIC_KEYMAP_KEYCODES_EEPROM_ADDR) + (slot * 2);
+    // Big endian, like the dense layout
+    uint16_t keycode = eeprom_read_byte(address) << 8;
+    keycode |= eeprom_read_byte(address + 1);
+    return keycode;
+}
+
+static void sparse_write_slot(uint16_t slot, uint16_t keycode) {
+    if (slot >= DYNAMIC_KEYMAP_SPARSE_KEYCODES) return;
+    void *address = ((void *)DYNAMIC_KEYMAP_KEYCODES_EEPROM_ADDR) + (slot * 2);
+    eeprom_update_byte(address, (uint8_t)(keycode >> 8));
+    eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+}
+
+// Moves the free slots in front of the keycode at `position`, each keycode in between moves once
+static void sparse_move_gap(uint16_t position) {
+    uint16_t free = DYNAMIC_KEYMAP_SPARSE_KEYCODES - sparse_count;
+    if (free == 0) {
+        sparse_gap = position;
+        return;
+    }
+    uint16_t gap = sparse_gap;
+    for (; gap < position; gap++) {
+        sparse_write_slot(gap, sparse_read_slot(gap + free));
+    }
+    for (; gap > position; gap--) {
+        sparse_write_slot(gap - 1 + free, sparse_read_slot(gap - 1));
+    }
+    sparse_gap = gap;
+}
+
+static uint16_t sparse_get_keycode(uint16_t key) {
+    if (!sparse_indexed) {
+        sparse_load();
+    }
+    uint8_t  layer  = key / SPARSE_KEYMAP_KEYS;
+    uint16_t index  = key % SPARSE_KEYMAP_KEYS;
+    uint32_t bitmap = sparse_read_bitmap(layer, index / 32);
+    if (!(bitmap & (1UL << (index % 32)))) {
+        return KC_TRNS;
+    }
+    return sparse_read_slot(sparse_slot(sparse_index[layer][index / 32] + sparse_keymap_rank(bitmap, index % 32)));
+}
+
+// Keycode of `key` after writing `size` bytes of the dense layout at `offset`, `keycode` being the current one
+static uint16_t sparse_merge_keycode(uint16_t key, uint16_t keycode, uint16_t offset, uint16_t size, const uint8_t *data) {
+    if (key * 2 >= offset && key * 2 < offset + size) {
+        keycode = (keycode & 0x00FF) | (data[key * 2 - offset] << 8);
+    }
+    if (key * 2 + 1 >= offset && key * 2 + 1 < offset + size) {
+        keycode = (keycode & 0xFF00) | data[key * 2 + 1 - offset];
+    }
+    return keycode;
+}
+
+/* Writes `size` bytes of the dense layout at `offset`. Nothing is written,
+ * and false returned, if the keys that are not KC_TRNS would not fit in the
+ * pool.
+ *
+ * When keys change to or from KC_TRNS, the gap is moved to the written range
+ * and the new keycodes fill it, so writing the keymap in order moves each
+ * keycode at most once. The pool is marked busy until the bitmaps match it
+ * again. */
+static bool sparse_set_buffer(uint16_t offset, uint16_t size, const uint8_t *data) {
+    if (offset >= DYNAMIC_KEYMAP_KEY_COUNT * 2 || size == 0) return true;
+    if (size > DYNAMIC_KEYMAP_KEY_COUNT * 2 - offset) {
+        size = DYNAMIC_KEYMAP_KEY_COUNT * 2 - offset;
+    }
+    uint16_t first = offset / 2;
+    uint16_t last  = (offset + size + 1) / 2;
+
+    // Keys only partly written keep their other byte
+    uint16_t first_keycode = sparse_merge_keycode(first, sparse_get_keycode(first), offset, size, data);
+    uint16_t last_keycode  = sparse_merge_keycode(last - 1, sparse_get_keycode(last - 1), offset, size, data);
+
+    uint16_t start   = sparse_position(first);
+    uint16_t end     = sparse_position(last);
+    uint16_t count   = 0;
+    bool     resized = false;
+    for (uint16_t key = first; key < last; key++) {
+        uint16_t keycode = key == first ? first_keycode : key == last - 1 ? last_keycode : sparse_merge_keycode(key, 0, offset, size, data);
+        if (keycode != KC_TRNS) {
+            count++;
+        }
+        if ((keycode != KC_TRNS) != sparse_is_stored(key)) {
+            resized = true;
+        }
+    }
+    if (count > end - start + (DYNAMIC_KEYMAP_SPARSE_KEYCODES - sparse_count)) {
+        return false;
+    }
+
+    // A reset marks the pool busy until it has written every key
+    bool was_busy = sparse_is_busy();
+    if (resized) {
+        sparse_set_busy(true);
+        // The replaced keycodes are now the first ones after the gap, the new ones are written in front of them
+        sparse_move_gap(start);
+    }
+
+    uint16_t position = start;
+    uint8_t  layer    = first / SPARSE_KEYMAP_KEYS;
+    uint8_t  block    = (first % SPARSE_KEYMAP_KEYS) / 32;
+    uint32_t bitmap   = sparse_read_bitmap(layer, block);
+    for (uint16_t key = first; key < last; key++) {
+        uint16_t index = key % SPARSE_KEYMAP_KEYS;
+        if (key / SPARSE_KEYMAP_KEYS != layer || index / 32 != block) {
+            sparse_write_bitmap(layer, block, bitmap);
+            layer  = key / SPARSE_KEYMAP_KEYS;
+            block  = index / 32;
+            bitmap = sparse_read_bitmap(layer, block);
+        }
+        uint16_t keycode = key == first ? first_keycode : key == last - 1 ? last_keycode : sparse_merge_keycode(key, 0, offset, size, data);
+        if (keycode != KC_TRNS) {
+            sparse_write_slot(resized ? position : sparse_slot(position), keycode);
+            position++;
+            bitmap |= 1UL << (index % 32);
+        } else {
+            bitmap &= ~(1UL << (index % 32));
+        }
+    }
+
+    if (resized) {
+        sparse_write_bitmap(layer, block, bitmap);
+        sparse_write_gap(position);
+        sparse_update_index();
+        if (!was_busy) {
+            sparse_set_busy(false);
+        }
+    }
+    return true;
+}
+
+uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return KC_NO;
+    return sparse_get_keycode(layer * SPARSE_KEYMAP_KEYS + row * MATRIX_COLS + column);
+}
+
+bool dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return true;
+    uint16_t key = layer * SPARSE_KEYMAP_KEYS + row * MATRIX_COLS + column;
+    // Big endian, as in the dense layout
+    uint8_t data[2] = {keycode >> 8, keycode & 0xFF};
+    return sparse_set_buffer(key * 2, 2, data);
+}
+
+// Leaves the pool marked busy, for the reset to clear once every key is written
+static void sparse_clear(void) {
+    sparse_set_busy(true);
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t block = 0; block < SPARSE_KEYMAP_BLOCKS; block++) {
+            sparse_write_bitmap(layer, block, 0);
+        }
+    }
+    sparse_write_gap(0);
+    sparse_update_index();
+}
+#else
 void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column) {
     // TODO: optimize this with some left shifts
     return ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + (layer * MATRIX_ROWS * MATRIX_COLS * 2) + (row * MATRIX_COLS * 2) + (column * 2);
@@ -119,13 +388,15 @@ uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column)
     return keycode;
 }
 
-void dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
-    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return;
+bool dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode) {
+    if (layer >= DYNAMIC_KEYMAP_LAYER_COUNT || row >= MATRIX_ROWS || column >= MATRIX_COLS) return true;
     void *address = dynamic_keymap_key_to_eeprom_address(layer, row, column);
     // Big endian, so we can read/write EEPROM directly from host if we want
     eeprom_update_byte(address, (uint8_t)(keycode >> 8));
     eeprom_update_byte(address + 1, (uint8_t)(keycode & 0xFF));
+    return true;
 }
+#endif // DYNAMIC_KEYMAP_SPARSE
 
 #ifdef ENCODER_MAP_ENABLE
 void *dynamic_keymap_encoder_to_eeprom_address(uint8_t layer, uint8_t encoder_id) {
@@ -152,6 +423,10 @@ void dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwis
 
 void dynamic_keymap_reset(void) {
     // Reset the keymaps in EEPROM to what is in flash.
+#ifdef DYNAMIC_KEYMAP_SPARSE
+    // Keys are then only ever added at the gap, which stays at the end of the pool
+    sparse_clear();
+#endif
     for (int layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
         for (int row = 0; row < MATRIX_ROWS; row++) {
             for (int column = 0; column < MATRIX_COLS; column++) {
@@ -165,11 +440,36 @@ void dynamic_keymap_reset(void) {
         }
 #endif // ENCODER_MAP_ENABLE
     }
+#ifdef DYNAMIC_KEYMAP_SPARSE
+    sparse_set_busy(false);
+#endif
+}
+
+#ifdef DYNAMIC_KEYMAP_SPARSE
+// The buffer keeps the dense layout, so that hosts do not need to know how the keymap is stored
+void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    uint16_t key     = 0xFFFF;
+    uint16_t keycode = 0;
+    for (uint16_t i = 0; i < size; i++) {
+        if (offset + i < DYNAMIC_KEYMAP_KEY_COUNT * 2) {
+            if ((offset + i) / 2 != key) {
+                key     = (offset + i) / 2;
+                keycode = sparse_get_keycode(key);
+            }
+            data[i] = (offset + i) % 2 ? keycode & 0xFF : keycode >> 8;
+        } else {
+            data[i] = 0x00;
+        }
+    }
 }
 
+bool dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+    return sparse_set_buffer(offset, size, data);
+}
+#else
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   source                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    void *   source                     = ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + offset;
     uint8_t *target                     = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
@@ -182,9 +482,9 @@ void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     }
 }
 
-void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
+bool dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
     uint16_t dynamic_keymap_eeprom_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
-    void *   target                     = (void *)(DYNAMIC_KEYMAP_EEPROM_ADDR + offset);
+    void *   target                     = ((void *)DYNAMIC_KEYMAP_EEPROM_ADDR) + offset;
     uint8_t *source                     = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < dynamic_keymap_eeprom_size) {
@@ -193,7 +493,9 @@ void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
         source++;
         target++;
     }
+    return true;
 }
+#endif // DYNAMIC_KEYMAP_SPARSE
 
 uint16_t keycode_at_keymap_location(uint8_t layer_num, uint8_t row, uint8_t column) {
     if (layer_num < DYNAMIC_KEYMAP_LAYER_COUNT && row < MATRIX_ROWS && column < MATRIX_COLS) {
@@ -220,7 +522,7 @@ uint16_t dynamic_keymap_macro_get_buffer_size(void) {
 }
 
 void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   source = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   source = ((void *)DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR) + offset;
     uint8_t *target = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
@@ -234,7 +536,7 @@ void dynamic_keymap_macro_get_buffer(uint16_t offset, uint16_t size, uint8_t *da
 }
 
 void dynamic_keymap_macro_set_buffer(uint16_t offset, uint16_t size, uint8_t *data) {
-    void *   target = (void *)(DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR + offset);
+    void *   target = ((void *)DYNAMIC_KEYMAP_MACRO_EEPROM_ADDR) + offset;
     uint8_t *source = data;
     for (uint16_t i = 0; i < size; i++) {
         if (offset + i < DYNAMIC_KEYMAP_MACRO_EEPROM_SIZE) {
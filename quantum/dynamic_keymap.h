@@ -19,9 +19,12 @@
 #include <stdbool.h>
 
 uint8_t  dynamic_keymap_get_layer_count(void);
-void *   dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column);
+#ifndef DYNAMIC_KEYMAP_SPARSE
+void *dynamic_keymap_key_to_eeprom_address(uint8_t layer, uint8_t row, uint8_t column);
+#endif // DYNAMIC_KEYMAP_SPARSE
 uint16_t dynamic_keymap_get_keycode(uint8_t layer, uint8_t row, uint8_t column);
-void     dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode);
+// Returns false if the keycode was not stored, only when DYNAMIC_KEYMAP_SPARSE runs out of room
+bool     dynamic_keymap_set_keycode(uint8_t layer, uint8_t row, uint8_t column, uint16_t keycode);
 #ifdef ENCODER_MAP_ENABLE
 uint16_t dynamic_keymap_get_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise);
 void     dynamic_keymap_set_encoder(uint8_t layer, uint8_t encoder_id, bool clockwise, uint16_t keycode);
@@ -35,8 +38,11 @@ void dynamic_keymap_reset(void);
 // This is only really useful for host applications that want to get a whole keymap fast,
 // by reading 14 keycodes (28 bytes) at a time, reducing the number of raw HID transfers by
 // a factor of 14.
+// With DYNAMIC_KEYMAP_SPARSE the EEPROM holds a sparse layout instead, but the buffer
+// keeps the layout described above. A write that does not fit is then refused as a
+// whole, and dynamic_keymap_set_buffer() returns false.
 void dynamic_keymap_get_buffer(uint16_t offset, uint16_t size, uint8_t *data);
-void dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data);
+bool dynamic_keymap_set_buffer(uint16_t offset, uint16_t size, uint8_t *data);
 
 // This overrides the one in quantum/keymap_common.c
 // uint16_t keymap_key_to_keycode(uint8_t layer, keypos_t key);
@@ -0,0 +1,111 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "effect_render.h"
+#include "timer.h"
+
+// Weight of a new sample in the moving averages, as a power of two
+#define EFFECT_RENDER_AVERAGE_SHIFT 3
+
+__attribute__((weak)) uint32_t effect_render_timestamp(void) {
+#ifdef TIMER_US_AVAILABLE
+    return timer_read_us32();
+#else
+    return timer_read32() * 1000;
+#endif
+}
+
+void effect_render_init(effect_render_t *render, uint8_t led_count, uint8_t process_limit, bool adaptive, uint16_t budget_us) {
+    if (process_limit == 0 || process_limit > led_count) {
+        process_limit = led_count;
+    }
+
+#if !defined(TIMER_US_AVAILABLE) && !defined(EFFECT_RENDER_CUSTOM_TIMESTAMP)
+    // An iteration measures as either 0 or 1000us with the millisecond timer, which cannot drive the slice size
+    adaptive = false;
+#endif
+
+    render->led_count     = led_count;
+    render->process_limit = process_limit;
+    render->adaptive      = adaptive;
+    render->budget_us     = budget_us;
+    render->led_cost      = 0;
+    render->iter_start    = 0;
+    render->frame_time    = 0;
+}
+
+void effect_render_frame_begin(effect_render_t *render) {
+    render->frame_time = 0;
+
+    // Only resize the slice between frames, effects rely on a stable iter -> LED range mapping
+    if (!render->adaptive || render->led_cost == 0) {
+        return;
+    }
+
+    uint32_t limit = ((uint32_t)render->budget_us << 4) / render->led_cost;
+    if (limit < 1) {
+        limit = 1;
+    } else if (limit > render->led_count) {
+        limit = render->led_count;
+    }
+    render->process_limit = limit;
+}
+
+void effect_render_iter_begin(effect_render_t *render) {
+    render->iter_start = effect_render_timestamp();
+}
+
+void effect_render_iter_end(effect_render_t *render, uint8_t led_min, uint8_t led_max) {
+    uint32_t cost = effect_render_timestamp() - render->iter_start;
+    render->frame_time += cost;
+
+    if (led_max <= led_min) {
+        return;
+    }
+
+    uint32_t sample = (cost << 4) / (led_max - led_min);
+    if (sample > UINT16_MAX) {
+        sample = UINT16_MAX;
+    }
+
+    render->led_cost += ((int32_t)sample - (int32_t)render->led_cost) >> EFFECT_RENDER_AVERAGE_SHIFT;
+}
+
+uint32_t effect_render_frame_end(effect_render_t *render) {
+    uint32_t frame_time = render->frame_time;
+    render->frame_time  = 0;
+    return frame_time;
+}
+
+void effect_render_get_limits(const effect_render_t *render, uint8_t iter, uint8_t *led_min, uint8_t *led_max) {
+    uint16_t min = (uint16_t)render->process_limit * iter;
+    uint16_t max = min + render->process_limit;
+
+    if (min > render->led_count) min = render->led_count;
+    if (max > render->led_count) max = render->led_count;
+
+    *led_min = min;
+    *led_max = max;
+}
+
+void effect_render_stats_reset(effect_render_stats_t *stats) {
+    stats->frames  = 0;
+    stats->last    = 0;
+    stats->min     = UINT32_MAX;
+    stats->max     = 0;
+    stats->average = 0;
+}
+
+void effect_render_stats_update(effect_render_stats_t *stats, uint32_t frame_time) {
+    if (stats->frames == 0) {
+        stats->min     = frame_time;
+        stats->average = frame_time;
+    } else {
+        stats->average += ((int32_t)frame_time - (int32_t)stats->average) >> EFFECT_RENDER_AVERAGE_SHIFT;
+    }
+
+    if (frame_time < stats->min) stats->min = frame_time;
+    if (frame_time > stats->max) stats->max = frame_time;
+    stats->last = frame_time;
+    stats->frames++;
+}
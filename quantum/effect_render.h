@@ -0,0 +1,60 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Render core shared by LED Matrix and RGB Matrix.
+
+    Both subsystems render a frame over several task iterations, processing at
+    most `process_limit` LEDs per iteration. This core tracks how long each
+    iteration takes and, when adaptive slicing is enabled, resizes the slice at
+    the start of every frame so that one iteration stays within `budget_us`.
+
+    Frame times are also handed back to the caller so they can be accumulated
+    into per-effect statistics.
+*/
+
+typedef struct {
+    uint32_t frames;  // number of frames measured
+    uint32_t last;    // render time of the most recent frame, in microseconds
+    uint32_t min;     // fastest frame, in microseconds
+    uint32_t max;     // slowest frame, in microseconds
+    uint32_t average; // moving average of the frame time, in microseconds
+} effect_render_stats_t;
+
+typedef struct {
+    uint8_t  led_count;     // number of LEDs handled by the subsystem
+    uint8_t  process_limit; // number of LEDs rendered per iteration
+    bool     adaptive;      // adapt process_limit to the measured render cost
+    uint16_t budget_us;     // target render time of a single iteration
+    uint16_t led_cost;      // moving average cost of a single LED, in 1/16 microseconds
+    uint32_t iter_start;    // timestamp of the current iteration
+    uint32_t frame_time;    // accumulated render time of the current frame
+} effect_render_t;
+
+void effect_render_init(effect_render_t *render, uint8_t led_count, uint8_t process_limit, bool adaptive, uint16_t budget_us);
+
+void effect_render_frame_begin(effect_render_t *render);
+void effect_render_iter_begin(effect_render_t *render);
+void effect_render_iter_end(effect_render_t *render, uint8_t led_min, uint8_t led_max);
+uint32_t effect_render_frame_end(effect_render_t *render);
+
+void effect_render_get_limits(const effect_render_t *render, uint8_t iter, uint8_t *led_min, uint8_t *led_max);
+
+void effect_render_stats_reset(effect_render_stats_t *stats);
+void effect_render_stats_update(effect_render_stats_t *stats, uint32_t frame_time);
+
+/**
+ * \brief Monotonic timestamp used to measure render cost, in microseconds.
+ *
+ * The default implementation uses the microsecond timer on platforms that
+ * have one (`TIMER_US_AVAILABLE`), and is otherwise derived from the
+ * millisecond timer. That is too coarse for adaptive slicing, which is then
+ * turned off. Keyboards overriding this with a finer time source should define
+ * `EFFECT_RENDER_CUSTOM_TIMESTAMP` to keep it on.
+ */
+uint32_t effect_render_timestamp(void);
@@ -3,6 +3,7 @@
 
 #include <string.h>
 #include "action.h"
+#include "atomic_util.h"
 #include "encoder.h"
 #include "wait.h"
 
@@ -16,41 +17,57 @@ __attribute__((weak)) bool should_process_encoder(void) {
 
 static encoder_events_t encoder_events;
 static bool             signal_queue_drain = false;
+static uint8_t          queue_drain_until;
 
 void encoder_init(void) {
     memset(&encoder_events, 0, sizeof(encoder_events));
     encoder_driver_init();
 }
 
-static void encoder_queue_drain(void) {
-    encoder_events.tail     = encoder_events.head;
-    encoder_events.dequeued = encoder_events.enqueued;
+// Publishes the staged detents from the main loop, which must not race an encoder read from an interrupt handler
+static void encoder_publish_events(void) {
+    ATOMIC_BLOCK_FORCEON {
+        encoder_publish_events_advanced(&encoder_events);
+    }
 }
 
-static bool encoder_handle_queue(void) {
-    bool    changed = false;
-    uint8_t index;
-    bool    clockwise;
-    while (encoder_dequeue_event(&index, &clockwise)) {
+static void encoder_queue_drain(uint8_t dequeued) {
+    encoder_events.dequeued += encoder_event_ring_drop(&encoder_events.queue, dequeued - encoder_events.dequeued);
+}
+
+static void encoder_handle_detent(uint8_t index, bool clockwise) {
 #ifdef ENCODER_MAP_ENABLE
 
-        // The delays below cater for Windows and its wonderful requirements.
-        action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, true) : MAKE_ENCODER_CCW_EVENT(index, true));
+    // The delays below cater for Windows and its wonderful requirements.
+    action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, true) : MAKE_ENCODER_CCW_EVENT(index, true));
 #    if ENCODER_MAP_KEY_DELAY > 0
-        wait_ms(ENCODER_MAP_KEY_DELAY);
+    wait_ms(ENCODER_MAP_KEY_DELAY);
 #    endif // ENCODER_MAP_KEY_DELAY > 0
 
-        action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, false) : MAKE_ENCODER_CCW_EVENT(index, false));
+    action_exec(clockwise ? MAKE_ENCODER_CW_EVENT(index, false) : MAKE_ENCODER_CCW_EVENT(index, false));
 #    if ENCODER_MAP_KEY_DELAY > 0
-        wait_ms(ENCODER_MAP_KEY_DELAY);
+    wait_ms(ENCODER_MAP_KEY_DELAY);
 #    endif // ENCODER_MAP_KEY_DELAY > 0
 
 #else // ENCODER_MAP_ENABLE
 
-        encoder_update_kb(index, clockwise);
+    encoder_update_kb(index, clockwise);
 
 #endif // ENCODER_MAP_ENABLE
+}
 
+static bool encoder_handle_queue(void) {
+    bool    changed = false;
+    uint8_t index;
+    bool    clockwise;
+    uint8_t count;
+    encoder_publish_events();
+    while (encoder_dequeue_events_advanced(&encoder_events, &index, &clockwise, &count)) {
+        if (encoder_update_batch_kb(index, clockwise, count)) {
+            for (uint8_t i = 0; i < count; i++) {
+                encoder_handle_detent(index, clockwise);
+            }
+        }
         changed = true;
     }
     return changed;
@@ -68,7 +85,7 @@ bool encoder_task(void) {
 
     if (signal_queue_drain) {
         signal_queue_drain = false;
-        encoder_queue_drain();
+        encoder_queue_drain(queue_drain_until);
     }
 
     // Let the encoder driver produce events
@@ -83,7 +100,7 @@ bool encoder_task(void) {
 }
 
 bool encoder_queue_full_advanced(encoder_events_t *events) {
-    return events->tail == (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    return encoder_event_ring_full(&events->queue);
 }
 
 bool encoder_queue_full(void) {
@@ -91,63 +108,115 @@ bool encoder_queue_full(void) {
 }
 
 bool encoder_queue_empty_advanced(encoder_events_t *events) {
-    return events->head == events->tail;
+    return encoder_event_ring_empty(&events->queue) && events->staged.count == 0 && events->taking.count == 0;
 }
 
 bool encoder_queue_empty(void) {
     return encoder_queue_empty_advanced(&encoder_events);
 }
 
-bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool clockwise) {
-    // Drop out if we're full
-    if (encoder_queue_full_advanced(events)) {
+bool encoder_publish_events_advanced(encoder_events_t *events) {
+    if (events->staged.count == 0) {
+        return true;
+    }
+    if (!encoder_event_ring_enqueue(&events->queue, events->staged)) {
         return false;
     }
+    events->staged.count = 0;
+    events->enqueued++;
+    return true;
+}
 
-    // Append the event
-    encoder_event_t new_event   = {.index = index, .clockwise = clockwise ? 1 : 0};
-    events->queue[events->head] = new_event;
+bool encoder_queue_events_advanced(encoder_events_t *events, uint8_t index, bool clockwise, uint8_t count) {
+    // Add the detents to the staged event if it is for the same encoder and direction, so fast spins do not fill the queue
+    // Queued events are never updated, the consumer may be reading them from another context
+    encoder_event_t *staged = &events->staged;
+    if (staged->count > 0 && staged->index == index && staged->clockwise == (clockwise ? 1 : 0) && staged->count <= UINT8_MAX - count) {
+        staged->count += count;
+        return true;
+    }
 
-    // Increment the head index
-    events->head = (events->head + 1) % MAX_QUEUED_ENCODER_EVENTS;
-    events->enqueued++;
+    // Queue the staged event to make room for the new one, dropping out if we're full
+    if (!encoder_publish_events_advanced(events)) {
+        return false;
+    }
+    *staged = (encoder_event_t){.index = index, .clockwise = clockwise ? 1 : 0, .count = count};
 
     return true;
 }
 
-bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise) {
-    if (encoder_queue_empty_advanced(events)) {
-        return false;
+bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool clockwise) {
+    return encoder_queue_events_advanced(events, index, clockwise, 1);
+}
+
+bool encoder_dequeue_events_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise, uint8_t *count) {
+    // Finish the event whose detents are being taken one at a time first
+    encoder_event_t event = events->taking;
+    if (event.count > 0) {
+        events->taking.count = 0;
+    } else {
+        if (!encoder_event_ring_dequeue(&events->queue, &event)) {
+            return false;
+        }
+        events->dequeued++;
     }
+    *index     = event.index;
+    *clockwise = event.clockwise;
+    *count     = event.count;
 
-    // Retrieve the event
-    encoder_event_t event = events->queue[events->tail];
-    *index                = event.index;
-    *clockwise            = event.clockwise;
+    return true;
+}
 
-    // Increment the tail index
-    events->tail = (events->tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
-    events->dequeued++;
+bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise) {
+    // Take a single detent, the rest of the event is kept aside rather than updated in the queue
+    if (events->taking.count == 0) {
+        if (!encoder_event_ring_dequeue(&events->queue, &events->taking)) {
+            return false;
+        }
+        events->dequeued++;
+    }
+    *index     = events->taking.index;
+    *clockwise = events->taking.clockwise;
+    events->taking.count--;
 
     return true;
 }
 
+bool encoder_queue_events(uint8_t index, bool clockwise, uint8_t count) {
+    return encoder_queue_events_advanced(&encoder_events, index, clockwise, count);
+}
+
 bool encoder_queue_event(uint8_t index, bool clockwise) {
-    return encoder_queue_event_advanced(&encoder_events, index, clockwise);
+    return encoder_queue_events(index, clockwise, 1);
 }
 
 bool encoder_dequeue_event(uint8_t *index, bool *clockwise) {
+    encoder_publish_events();
     return encoder_dequeue_event_advanced(&encoder_events, index, clockwise);
 }
 
 void encoder_retrieve_events(encoder_events_t *events) {
+    encoder_publish_events();
     memcpy(events, &encoder_events, sizeof(encoder_events));
 }
 
 void encoder_signal_queue_drain(void) {
+    encoder_signal_queue_drain_until(encoder_events.enqueued);
+}
+
+void encoder_signal_queue_drain_until(uint8_t dequeued) {
+    queue_drain_until  = dequeued;
     signal_queue_drain = true;
 }
 
+__attribute__((weak)) bool encoder_update_batch_user(uint8_t index, bool clockwise, uint8_t count) {
+    return true;
+}
+
+__attribute__((weak)) bool encoder_update_batch_kb(uint8_t index, bool clockwise, uint8_t count) {
+    return encoder_update_batch_user(index, clockwise, count);
+}
+
 __attribute__((weak)) bool encoder_update_user(uint8_t index, bool clockwise) {
     return true;
 }
@@ -21,6 +21,7 @@
 #include <stdbool.h>
 #include "gpio.h"
 #include "util.h"
+#include "spsc_ring.h"
 
 // ======== DEPRECATED DEFINES - DO NOT USE ========
 #ifdef ENCODERS_PAD_A
@@ -49,6 +50,10 @@ bool encoder_dequeue_event(uint8_t *index, bool *clockwise);
 bool encoder_update_kb(uint8_t index, bool clockwise);
 bool encoder_update_user(uint8_t index, bool clockwise);
 
+// Called once per batch of consecutive detents, return false to skip the per detent processing
+bool encoder_update_batch_kb(uint8_t index, bool clockwise, uint8_t count);
+bool encoder_update_batch_user(uint8_t index, bool clockwise, uint8_t count);
+
 #    ifdef SPLIT_KEYBOARD
 
 #        if defined(ENCODER_A_PINS_RIGHT)
@@ -82,33 +87,45 @@ bool encoder_update_user(uint8_t index, bool clockwise);
 
 #    define NUM_ENCODERS_MAX_PER_SIDE MAX(NUM_ENCODERS_LEFT, NUM_ENCODERS_RIGHT)
 
+// Must be a power of two, consecutive detents of an encoder share an event so a few events are enough
 #    ifndef MAX_QUEUED_ENCODER_EVENTS
-#        define MAX_QUEUED_ENCODER_EVENTS MAX(4, ((NUM_ENCODERS_MAX_PER_SIDE) + 1))
+#        define MAX_QUEUED_ENCODER_EVENTS 8
 #    endif // MAX_QUEUED_ENCODER_EVENTS
 
 typedef struct encoder_event_t {
     uint8_t index : 7;
     uint8_t clockwise : 1;
+    uint8_t count; // consecutive detents of the same encoder in the same direction
 } encoder_event_t;
 
+SPSC_RING_DECLARE(encoder_event_ring, encoder_event_t, MAX_QUEUED_ENCODER_EVENTS)
+
 typedef struct encoder_events_t {
-    uint8_t         enqueued;
-    uint8_t         dequeued;
-    uint8_t         head;
-    uint8_t         tail;
-    encoder_event_t queue[MAX_QUEUED_ENCODER_EVENTS];
+    uint8_t              enqueued;
+    uint8_t              dequeued;
+    encoder_event_t      staged; // producer side, newest detents, not in the queue yet so that more can be merged into them
+    encoder_event_t      taking; // consumer side, detents of a dequeued event that are being taken one at a time
+    encoder_event_ring_t queue;
 } encoder_events_t;
 
 // Get the current queued events
 void encoder_retrieve_events(encoder_events_t *events);
 
-// Encoder event queue management
+// Encoder event queue management, consecutive detents of an encoder in the same direction share a queue entry
+// The entry is staged until detents of another encoder or direction arrive, or it is published explicitly
 bool encoder_queue_event_advanced(encoder_events_t *events, uint8_t index, bool clockwise);
+bool encoder_queue_events_advanced(encoder_events_t *events, uint8_t index, bool clockwise, uint8_t count);
+bool encoder_publish_events_advanced(encoder_events_t *events);
 bool encoder_dequeue_event_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise);
+bool encoder_dequeue_events_advanced(encoder_events_t *events, uint8_t *index, bool *clockwise, uint8_t *count);
+bool encoder_queue_events(uint8_t index, bool clockwise, uint8_t count);
 
 // Reset the queue to be empty
 void encoder_signal_queue_drain(void);
 
+// Remove the queue entries up to the given `dequeued` sequence number, once processed by the other half
+void encoder_signal_queue_drain_until(uint8_t dequeued);
+
 #    ifdef ENCODER_MAP_ENABLE
 #        define NUM_DIRECTIONS 2
 #        define ENCODER_CCW_CW(ccw, cw) \
@@ -39,12 +39,44 @@ bool encoder_update_kb(uint8_t index, bool clockwise) {
     return true;
 }
 
+struct batch {
+    int8_t  index;
+    bool    clockwise;
+    uint8_t count;
+};
+
+std::vector<batch> batches;
+
+bool encoder_update_batch_user(uint8_t index, bool clockwise, uint8_t count) {
+    batches.push_back({(int8_t)index, clockwise, count});
+    return true;
+}
+
+// Turns the encoder by whole detents, only scanning the pins, as if the keyboard was busy elsewhere
+void spin(bool clockwise, int detents) {
+    for (int i = 0; i < detents; i++) {
+        setPin(clockwise ? 0 : 1, false);
+        encoder_driver_task();
+        setPin(clockwise ? 1 : 0, false);
+        encoder_driver_task();
+        setPin(clockwise ? 0 : 1, true);
+        encoder_driver_task();
+        setPin(clockwise ? 1 : 0, true);
+        encoder_driver_task();
+    }
+}
+
 bool setAndRead(pin_t pin, bool val) {
     setPin(pin, val);
     return encoder_task();
 }
 
-class EncoderTest : public ::testing::Test {};
+class EncoderTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        batches.clear();
+    }
+};
 
 TEST_F(EncoderTest, TestInit) {
     updates_array_idx = 0;
@@ -142,3 +174,109 @@ TEST_F(EncoderTest, TestHalfway) {
     EXPECT_EQ(updates[0].index, 0);
     EXPECT_EQ(updates[0].clockwise, true);
 }
+
+TEST_F(EncoderTest, TestFastSpinIsNotDropped) {
+    updates_array_idx = 0;
+    encoder_init();
+    // more detents than the queue holds before the next encoder_task()
+    spin(true, 20);
+    encoder_task();
+
+    EXPECT_EQ(updates_array_idx, 20);
+    for (int i = 0; i < 20; i++) {
+        EXPECT_EQ(updates[i].clockwise, true);
+    }
+    ASSERT_EQ(batches.size(), 1);
+    EXPECT_EQ(batches[0].index, 0);
+    EXPECT_EQ(batches[0].clockwise, true);
+    EXPECT_EQ(batches[0].count, 20);
+}
+
+TEST_F(EncoderTest, TestBatchesKeepDirectionChanges) {
+    updates_array_idx = 0;
+    encoder_init();
+    spin(true, 3);
+    spin(false, 2);
+    spin(true, 1);
+    encoder_task();
+
+    EXPECT_EQ(updates_array_idx, 6);
+    ASSERT_EQ(batches.size(), 3);
+    EXPECT_EQ(batches[0].clockwise, true);
+    EXPECT_EQ(batches[0].count, 3);
+    EXPECT_EQ(batches[1].clockwise, false);
+    EXPECT_EQ(batches[1].count, 2);
+    EXPECT_EQ(batches[2].clockwise, true);
+    EXPECT_EQ(batches[2].count, 1);
+}
+
+TEST_F(EncoderTest, TestQueueMergesDetents) {
+    encoder_events_t events = {};
+    EXPECT_TRUE(encoder_queue_event_advanced(&events, 0, true));
+    EXPECT_TRUE(encoder_queue_event_advanced(&events, 0, true));
+    EXPECT_TRUE(encoder_queue_events_advanced(&events, 0, true, 3));
+    EXPECT_TRUE(encoder_queue_event_advanced(&events, 1, true));
+    // The last event stays staged until it is published
+    EXPECT_EQ(events.enqueued, 1);
+
+    // Single detents are taken one at a time
+    uint8_t index;
+    bool    clockwise;
+    for (int i = 0; i < 5; i++) {
+        EXPECT_TRUE(encoder_dequeue_event_advanced(&events, &index, &clockwise));
+        EXPECT_EQ(index, 0);
+        EXPECT_EQ(clockwise, true);
+    }
+    EXPECT_EQ(events.dequeued, 1);
+
+    uint8_t count;
+    EXPECT_FALSE(encoder_dequeue_events_advanced(&events, &index, &clockwise, &count));
+    EXPECT_TRUE(encoder_publish_events_advanced(&events));
+    EXPECT_EQ(events.enqueued, 2);
+    EXPECT_TRUE(encoder_dequeue_events_advanced(&events, &index, &clockwise, &count));
+    EXPECT_EQ(index, 1);
+    EXPECT_EQ(count, 1);
+    EXPECT_FALSE(encoder_dequeue_events_advanced(&events, &index, &clockwise, &count));
+}
+
+TEST_F(EncoderTest, TestQueuedEventsAreNotUpdated) {
+    encoder_events_t events = {};
+    EXPECT_TRUE(encoder_queue_events_advanced(&events, 0, true, 2));
+    EXPECT_TRUE(encoder_publish_events_advanced(&events));
+
+    // Detents arriving after publishing are staged separately, the consumer may already be reading the queued event
+    EXPECT_TRUE(encoder_queue_event_advanced(&events, 0, true));
+    const encoder_event_t *queued = encoder_event_ring_peek(&events.queue, 0);
+    ASSERT_NE(queued, nullptr);
+    EXPECT_EQ(queued->count, 2);
+
+    // Taking a single detent removes the event from the queue instead of updating it
+    uint8_t index;
+    bool    clockwise;
+    EXPECT_TRUE(encoder_dequeue_event_advanced(&events, &index, &clockwise));
+    EXPECT_TRUE(encoder_event_ring_empty(&events.queue));
+    EXPECT_EQ(events.taking.count, 1);
+
+    uint8_t count;
+    EXPECT_TRUE(encoder_dequeue_events_advanced(&events, &index, &clockwise, &count));
+    EXPECT_EQ(count, 1);
+    EXPECT_TRUE(encoder_publish_events_advanced(&events));
+    EXPECT_TRUE(encoder_dequeue_events_advanced(&events, &index, &clockwise, &count));
+    EXPECT_EQ(count, 1);
+    EXPECT_FALSE(encoder_dequeue_events_advanced(&events, &index, &clockwise, &count));
+}
+
+TEST_F(EncoderTest, TestQueueSplitsFullCounts) {
+    encoder_events_t events = {};
+    EXPECT_TRUE(encoder_queue_events_advanced(&events, 0, false, 250));
+    EXPECT_TRUE(encoder_queue_events_advanced(&events, 0, false, 10));
+    EXPECT_TRUE(encoder_publish_events_advanced(&events));
+    EXPECT_EQ(events.enqueued, 2);
+
+    uint8_t index, count;
+    bool    clockwise;
+    EXPECT_TRUE(encoder_dequeue_events_advanced(&events, &index, &clockwise, &count));
+    EXPECT_EQ(count, 250);
+    EXPECT_TRUE(encoder_dequeue_events_advanced(&events, &index, &clockwise, &count));
+    EXPECT_EQ(count, 10);
+}
@@ -116,8 +116,8 @@ TEST_F(EncoderSplitTestLeftEqRight, TestOneClockwiseLeftMaster) {
     int              events_queued = 0;
     encoder_events_t events;
     encoder_retrieve_events(&events);
-    while (events.tail != events.head) {
-        events.tail = (events.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    while (events.queue.tail != events.queue.head) {
+        events.queue.tail = (events.queue.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
         ++events_queued;
     }
     EXPECT_EQ(events_queued, 0); // No events should be queued on master
@@ -140,8 +140,8 @@ TEST_F(EncoderSplitTestLeftEqRight, TestOneClockwiseRightMaster) {
     int              events_queued = 0;
     encoder_events_t events;
     encoder_retrieve_events(&events);
-    while (events.tail != events.head) {
-        events.tail = (events.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    while (events.queue.tail != events.queue.head) {
+        events.queue.tail = (events.queue.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
         ++events_queued;
     }
     EXPECT_EQ(events_queued, 0); // No events should be queued on master
@@ -162,8 +162,8 @@ TEST_F(EncoderSplitTestLeftEqRight, TestOneClockwiseLeftSlave) {
     int              events_queued = 0;
     encoder_events_t events;
     encoder_retrieve_events(&events);
-    while (events.tail != events.head) {
-        events.tail = (events.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    while (events.queue.tail != events.queue.head) {
+        events.queue.tail = (events.queue.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
         ++events_queued;
     }
     EXPECT_EQ(events_queued, 1); // One event should be queued on slave
@@ -184,9 +184,46 @@ TEST_F(EncoderSplitTestLeftEqRight, TestOneClockwiseRightSlave) {
     int              events_queued = 0;
     encoder_events_t events;
     encoder_retrieve_events(&events);
-    while (events.tail != events.head) {
-        events.tail = (events.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    while (events.queue.tail != events.queue.head) {
+        events.queue.tail = (events.queue.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
         ++events_queued;
     }
     EXPECT_EQ(events_queued, 1); // One event should be queued on slave
 }
+
+TEST_F(EncoderSplitTestLeftEqRight, TestSlaveKeepsDetentsAfterMasterRead) {
+    isMaster   = false;
+    isLeftHand = true;
+    encoder_init();
+    for (int i = 0; i < 2; i++) {
+        setAndRead(0, false);
+        setAndRead(1, false);
+        setAndRead(0, true);
+        setAndRead(1, true);
+    }
+
+    // the master reads the queue, and the encoder turns further before the master acknowledges it
+    encoder_events_t read;
+    encoder_retrieve_events(&read);
+    for (int i = 0; i < 3; i++) {
+        setAndRead(0, false);
+        setAndRead(1, false);
+        setAndRead(0, true);
+        setAndRead(1, true);
+    }
+    encoder_signal_queue_drain_until(read.enqueued);
+    encoder_task();
+
+    encoder_events_t events;
+    encoder_retrieve_events(&events);
+    uint8_t index, count;
+    bool    clockwise;
+    ASSERT_TRUE(encoder_dequeue_events_advanced(&read, &index, &clockwise, &count));
+    EXPECT_EQ(count, 2);
+    ASSERT_TRUE(encoder_dequeue_events_advanced(&events, &index, &clockwise, &count));
+    EXPECT_EQ(index, 0);
+    EXPECT_EQ(clockwise, true);
+    EXPECT_EQ(count, 3); // Only the detents after the read should remain
+    EXPECT_FALSE(encoder_dequeue_events_advanced(&events, &index, &clockwise, &count));
+    EXPECT_EQ(updates_array_idx, 0);
+}
@@ -118,8 +118,8 @@ TEST_F(EncoderSplitTestLeftGreaterThanRight, TestOneClockwiseLeftMaster) {
     int              events_queued = 0;
     encoder_events_t events;
     encoder_retrieve_events(&events);
-    while (events.tail != events.head) {
-        events.tail = (events.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    while (events.queue.tail != events.queue.head) {
+        events.queue.tail = (events.queue.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
         ++events_queued;
     }
     EXPECT_EQ(events_queued, 0); // No events should be queued on master
@@ -142,8 +142,8 @@ TEST_F(EncoderSplitTestLeftGreaterThanRight, TestOneClockwiseRightMaster) {
     int              events_queued = 0;
     encoder_events_t events;
     encoder_retrieve_events(&events);
-    while (events.tail != events.head) {
-        events.tail = (events.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    while (events.queue.tail != events.queue.head) {
+        events.queue.tail = (events.queue.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
         ++events_queued;
     }
     EXPECT_EQ(events_queued, 0); // No events should be queued on master
@@ -164,8 +164,8 @@ TEST_F(EncoderSplitTestLeftGreaterThanRight, TestOneClockwiseLeftSlave) {
     int              events_queued = 0;
     encoder_events_t events;
     encoder_retrieve_events(&events);
-    while (events.tail != events.head) {
-        events.tail = (events.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    while (events.queue.tail != events.queue.head) {
+        events.queue.tail = (events.queue.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
         ++events_queued;
     }
     EXPECT_EQ(events_queued, 1); // One event should be queued on slave
@@ -186,8 +186,8 @@ TEST_F(EncoderSplitTestLeftGreaterThanRight, TestOneClockwiseRightSlave) {
     int              events_queued = 0;
     encoder_events_t events;
     encoder_retrieve_events(&events);
-    while (events.tail != events.head) {
-        events.tail = (events.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    while (events.queue.tail != events.queue.head) {
+        events.queue.tail = (events.queue.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
         ++events_queued;
     }
     EXPECT_EQ(events_queued, 1); // One event should be queued on slave
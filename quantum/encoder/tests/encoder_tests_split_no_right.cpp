@@ -106,8 +106,8 @@ TEST_F(EncoderSplitTestNoRight, TestOneClockwiseLeftMaster) {
     int              events_queued = 0;
     encoder_events_t events;
     encoder_retrieve_events(&events);
-    while (events.tail != events.head) {
-        events.tail = (events.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    while (events.queue.tail != events.queue.head) {
+        events.queue.tail = (events.queue.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
         ++events_queued;
     }
     EXPECT_EQ(events_queued, 0); // No events should be queued on master
@@ -128,8 +128,8 @@ TEST_F(EncoderSplitTestNoRight, TestOneClockwiseRightSlave) {
     int              events_queued = 0;
     encoder_events_t events;
     encoder_retrieve_events(&events);
-    while (events.tail != events.head) {
-        events.tail = (events.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
+    while (events.queue.tail != events.queue.head) {
+        events.queue.tail = (events.queue.tail + 1) % MAX_QUEUED_ENCODER_EVENTS;
         ++events_queued;
     }
     EXPECT_EQ(events_queued, 1); // One event should be queued on slave
@@ -0,0 +1,77 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "key_event_queue.h"
+#include <string.h>
+#include "action.h"
+#include "timer.h"
+
+#define KEY_EVENT_QUEUE_MASK (KEY_EVENT_QUEUE_SIZE - 1)
+
+// Only accessed from the main loop, so no locking is needed
+static keyevent_t              queue[KEY_EVENT_QUEUE_SIZE];
+static uint8_t                 queue_head = 0; // next slot to write
+static uint8_t                 queue_tail = 0; // next event to process
+static key_event_queue_stats_t queue_stats;
+
+uint8_t key_event_queue_count(void) {
+    return (uint8_t)(queue_head - queue_tail);
+}
+
+static void key_event_queue_process_one(void) {
+    keyevent_t event = queue[queue_tail & KEY_EVENT_QUEUE_MASK];
+    queue_tail++;
+
+    uint16_t latency = timer_elapsed(event.time);
+    if (latency > queue_stats.max_latency) {
+        queue_stats.max_latency = latency;
+    }
+
+    action_exec(event);
+}
+
+void key_event_queue_push(keyevent_t event) {
+    if (key_event_queue_count() == KEY_EVENT_QUEUE_SIZE) {
+        queue_stats.overflows++;
+        key_event_queue_process_one();
+    }
+
+    queue[queue_head & KEY_EVENT_QUEUE_MASK] = event;
+    queue_head++;
+
+    queue_stats.pushed++;
+    if (key_event_queue_count() > queue_stats.max_depth) {
+        queue_stats.max_depth = key_event_queue_count();
+    }
+}
+
+bool key_event_queue_task(void) {
+    if (key_event_queue_count() == 0) {
+        return true;
+    }
+
+    const uint16_t start = timer_read();
+    do {
+        key_event_queue_process_one();
+    } while (key_event_queue_count() > 0 && timer_elapsed(start) < KEY_EVENT_QUEUE_TIME_BUDGET);
+
+    return key_event_queue_count() == 0;
+}
+
+void key_event_queue_flush(void) {
+    while (key_event_queue_count() > 0) {
+        key_event_queue_process_one();
+    }
+}
+
+void key_event_queue_clear(void) {
+    queue_tail = queue_head;
+}
+
+const key_event_queue_stats_t *key_event_queue_get_stats(void) {
+    return &queue_stats;
+}
+
+void key_event_queue_reset_stats(void) {
+    memset(&queue_stats, 0, sizeof(queue_stats));
+}
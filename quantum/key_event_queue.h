@@ -0,0 +1,72 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "keyboard.h"
+
+/*
+    Key event queue, decoupling the matrix scan from action processing.
+
+    The matrix scan pushes key events, stamped with the time the change was
+    scanned, instead of processing them straight away. The queue is then
+    processed in order, for at most KEY_EVENT_QUEUE_TIME_BUDGET milliseconds
+    per scan, so a slow process_record handler delays the following events
+    rather than the scan, and every event keeps its original timestamp for
+    the tapping logic.
+
+    Tick events are only generated once the queue is empty, so they never
+    overtake a queued key event.
+*/
+
+#ifndef KEY_EVENT_QUEUE_SIZE
+#    define KEY_EVENT_QUEUE_SIZE 16
+#endif
+
+#if KEY_EVENT_QUEUE_SIZE < 2 || KEY_EVENT_QUEUE_SIZE > 128 || (KEY_EVENT_QUEUE_SIZE & (KEY_EVENT_QUEUE_SIZE - 1)) != 0
+#    error "KEY_EVENT_QUEUE_SIZE must be a power of two between 2 and 128"
+#endif
+
+#ifndef KEY_EVENT_QUEUE_TIME_BUDGET
+#    define KEY_EVENT_QUEUE_TIME_BUDGET 1
+#endif
+
+typedef struct {
+    uint32_t pushed;      // events pushed by the matrix scan
+    uint32_t overflows;   // events that had to be processed early because the queue was full
+    uint16_t max_latency; // longest time between the scan and the processing of an event, in milliseconds
+    uint8_t  max_depth;   // largest number of queued events
+} key_event_queue_stats_t;
+
+/**
+ * \brief Queues a key event for processing.
+ *
+ * If the queue is full, the oldest event is processed first to make room.
+ */
+void key_event_queue_push(keyevent_t event);
+
+/**
+ * \brief Processes queued events in order until the queue is empty or the time budget is exhausted.
+ *
+ * At least one event is processed per call.
+ *
+ * \return true if the queue is empty
+ */
+bool key_event_queue_task(void);
+
+/**
+ * \brief Processes all queued events.
+ */
+void key_event_queue_flush(void);
+
+/**
+ * \brief Drops all queued events without processing them.
+ */
+void key_event_queue_clear(void);
+
+uint8_t key_event_queue_count(void);
+
+const key_event_queue_stats_t *key_event_queue_get_stats(void);
+void                           key_event_queue_reset_stats(void);
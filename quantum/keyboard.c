@@ -32,6 +32,7 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #include "sendchar.h"
 #include "eeconfig.h"
 #include "action_layer.h"
+#include "action_util.h"
 #ifdef BOOTMAGIC_ENABLE
 #    include "bootmagic.h"
 #endif
@@ -143,6 +144,9 @@ along with this program.  If not, see <http://www.gnu.org/licenses/>.
 #ifdef LAYER_LOCK_ENABLE
 #    include "layer_lock.h"
 #endif
+#ifdef KEY_EVENT_QUEUE_ENABLE
+#    include "key_event_queue.h"
+#endif
 
 static uint32_t last_input_modification_time = 0;
 uint32_t        last_input_activity_time(void) {
@@ -374,6 +378,9 @@ __attribute__((weak)) void housekeeping_task_user(void) {}
  * Invokes hooks for executing code after QMK is done after each loop iteration.
  */
 void housekeeping_task(void) {
+#ifdef EEPROM_DRIVER
+    eeprom_driver_task();
+#endif
     housekeeping_task_kb();
     housekeeping_task_user();
 }
@@ -515,6 +522,12 @@ void switch_events(uint8_t row, uint8_t col, bool pressed) {
  * internal QMK state machine.
  */
 static inline void generate_tick_event(void) {
+#ifdef KEY_EVENT_QUEUE_ENABLE
+    // Ticks must not overtake queued key events
+    if (!key_event_queue_task()) {
+        return;
+    }
+#endif
     static uint16_t last_tick = 0;
     const uint16_t  now       = timer_read();
     if (TIMER_DIFF_16(now, last_tick) != 0) {
@@ -572,7 +585,11 @@ static bool matrix_task(void) {
                 const bool key_pressed = current_row & col_mask;
 
                 if (process_keypress) {
+#ifdef KEY_EVENT_QUEUE_ENABLE
+                    key_event_queue_push(MAKE_KEYEVENT(row, col, key_pressed));
+#else
                     action_exec(MAKE_KEYEVENT(row, col, key_pressed));
+#endif
                 }
 
                 switch_events(row, col, key_pressed);
@@ -582,6 +599,10 @@ static bool matrix_task(void) {
         matrix_previous[row] = current_row;
     }
 
+#ifdef KEY_EVENT_QUEUE_ENABLE
+    key_event_queue_task();
+#endif
+
     return matrix_changed;
 }
 
@@ -755,4 +776,9 @@ void keyboard_task(void) {
 #ifdef OS_DETECTION_ENABLE
     os_detection_task();
 #endif
+
+#ifdef NKRO_ENABLE
+    // send the keyboard report coalesced during this task, if any
+    flush_nkro_report();
+#endif
 }
@@ -0,0 +1,84 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keycode_string.h"
+#include <stddef.h>
+#include "keycode_string_table.h"
+#include "util.h"
+
+static char keycode_name[KEYCODE_STRING_NAME_LENGTH_MAX + 1];
+static char keycode_range_name[KEYCODE_STRING_RANGE_LENGTH_MAX + 1];
+
+const char *get_keycode_name(uint16_t keycode) {
+    uint16_t lo = 0;
+    uint16_t hi = ARRAY_SIZE(keycode_string_by_code);
+    while (lo < hi) {
+        uint16_t mid   = lo + (hi - lo) / 2;
+        uint16_t entry = pgm_read_word(&keycode_string_by_code[mid].keycode);
+        if (entry == keycode) {
+            strcpy_P(keycode_name, &keycode_string_pool[pgm_read_word(&keycode_string_by_code[mid].name)]);
+            return keycode_name;
+        }
+        if (entry < keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return NULL;
+}
+
+const char *get_keycode_string(uint16_t keycode) {
+    const char *name = get_keycode_name(keycode);
+    if (name) {
+        return name;
+    }
+
+    static const char hex[] PROGMEM = "0123456789ABCDEF";
+    keycode_name[0] = '0';
+    keycode_name[1] = 'x';
+    for (uint8_t i = 0; i < 4; i++) {
+        keycode_name[2 + i] = pgm_read_byte(&hex[(keycode >> (12 - 4 * i)) & 0xF]);
+    }
+    keycode_name[6] = '\0';
+    return keycode_name;
+}
+
+bool get_keycode_by_name(const char *name, uint16_t *keycode) {
+    uint16_t lo = 0;
+    uint16_t hi = ARRAY_SIZE(keycode_string_by_name);
+    while (lo < hi) {
+        uint16_t mid = lo + (hi - lo) / 2;
+        int      cmp = strcmp_P(name, &keycode_string_pool[pgm_read_word(&keycode_string_by_name[mid].name)]);
+        if (cmp == 0) {
+            *keycode = pgm_read_word(&keycode_string_by_name[mid].keycode);
+            return true;
+        }
+        if (cmp > 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return false;
+}
+
+const char *get_keycode_range_name(uint16_t keycode) {
+    // Find the last range starting at or before the keycode
+    uint8_t lo = 0;
+    uint8_t hi = ARRAY_SIZE(keycode_string_ranges);
+    while (lo < hi) {
+        uint8_t mid = lo + (hi - lo) / 2;
+        if (pgm_read_word(&keycode_string_ranges[mid].first) <= keycode) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    if (lo == 0 || keycode > pgm_read_word(&keycode_string_ranges[lo - 1].last)) {
+        return NULL;
+    }
+
+    strcpy_P(keycode_range_name, &keycode_string_pool[pgm_read_word(&keycode_string_ranges[lo - 1].name)]);
+    return keycode_range_name;
+}
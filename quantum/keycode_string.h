@@ -0,0 +1,48 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Keycode names, for console debugging and host tools.
+
+    The names come from tables generated from the keycode specification
+    (see `qmk generate-keycode-string-table`), sorted so that every lookup
+    is a binary search. The strings are stored once in a shared pool, the
+    tables only hold 16 bit offsets into it.
+*/
+
+/**
+ * \brief Gets the name of a keycode, e.g. "KC_A" or "QK_BOOTLOADER".
+ *
+ * Aliases are never returned, only the name the keycode is defined with.
+ *
+ * \return the name, or NULL if the keycode has no name. The string is overwritten by the next call.
+ */
+const char *get_keycode_name(uint16_t keycode);
+
+/**
+ * \brief Gets the name of a keycode, falling back to its hexadecimal value, e.g. "0x2104".
+ *
+ * \return the name. The string is overwritten by the next call to this function or get_keycode_name().
+ */
+const char *get_keycode_string(uint16_t keycode);
+
+/**
+ * \brief Looks up a keycode by name or alias, e.g. "KC_SPACE" or "KC_SPC".
+ *
+ * \return true if the name was found
+ */
+bool get_keycode_by_name(const char *name, uint16_t *keycode);
+
+/**
+ * \brief Gets the name of the range a keycode belongs to, e.g. "QK_MOD_TAP".
+ *
+ * Where ranges overlap, the narrowest one is returned.
+ *
+ * \return the name, or NULL if the keycode is outside all ranges. The string is overwritten by the next call.
+ */
+const char *get_keycode_range_name(uint16_t keycode);
@@ -0,0 +1,3557 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/*******************************************************************************
+  88888888888 888      d8b                .d888 d8b 888               d8b
+      888     888      Y8P               d88P"  Y8P 888               Y8P
+      888     888                        888        888
+      888     88888b.  888 .d8888b       888888 888 888  .d88b.       888 .d8888b
+      888     888 "88b 888 88K           888    888 888 d8P  Y8b      888 88K
+      888     888  888 888 "Y8888b.      888    888 888 88888888      888 "Y8888b.
+      888     888  888 888      X88      888    888 888 Y8b.          888      X88
+      888     888  888 888  88888P'      888    888 888  "Y8888       888  88888P'
+                                                        888                 888
+                                                        888                 888
+                                                        888                 888
+     .d88b.   .d88b.  88888b.   .d88b.  888d888 8888b.  888888 .d88b.   .d88888
+    d88P"88b d8P  Y8b 888 "88b d8P  Y8b 888P"      "88b 888   d8P  Y8b d88" 888
+    888  888 88888888 888  888 88888888 888    .d888888 888   88888888 888  888
+    Y88b 888 Y8b.     888  888 Y8b.     888    888  888 Y88b. Y8b.     Y88b 888
+     "Y88888  "Y8888  888  888  "Y8888  888    "Y888888  "Y888 "Y8888   "Y88888
+         888
+    Y8b d88P
+     "Y88P"
+*******************************************************************************/
+
+#pragma once
+// clang-format off
+
+#include <stdint.h>
+#include "progmem.h"
+
+#define KEYCODE_STRING_NAME_LENGTH_MAX 44
+#define KEYCODE_STRING_RANGE_LENGTH_MAX 23
+
+typedef struct {
+    uint16_t keycode;
+    uint16_t name; // offset into keycode_string_pool
+} keycode_string_entry_t;
+
+typedef struct {
+    uint16_t first;
+    uint16_t last;
+    uint16_t name; // offset into keycode_string_pool
+} keycode_string_range_t;
+
+static const char keycode_string_pool[] PROGMEM =
+    "KC_NO\0"
+    "KC_TRANSPARENT\0"
+    "KC_A\0"
+    "KC_B\0"
+    "KC_C\0"
+    "KC_D\0"
+    "KC_E\0"
+    "KC_F\0"
+    "KC_G\0"
+    "KC_H\0"
+    "KC_I\0"
+    "KC_J\0"
+    "KC_K\0"
+    "KC_L\0"
+    "KC_M\0"
+    "KC_N\0"
+    "KC_O\0"
+    "KC_P\0"
+    "KC_Q\0"
+    "KC_R\0"
+    "KC_S\0"
+    "KC_T\0"
+    "KC_U\0"
+    "KC_V\0"
+    "KC_W\0"
+    "KC_X\0"
+    "KC_Y\0"
+    "KC_Z\0"
+    "KC_1\0"
+    "KC_2\0"
+    "KC_3\0"
+    "KC_4\0"
+    "KC_5\0"
+    "KC_6\0"
+    "KC_7\0"
+    "KC_8\0"
+    "KC_9\0"
+    "KC_0\0"
+    "KC_ENTER\0"
+    "KC_ESCAPE\0"
+    "KC_BACKSPACE\0"
+    "KC_TAB\0"
+    "KC_SPACE\0"
+    "KC_MINUS\0"
+    "KC_EQUAL\0"
+    "KC_LEFT_BRACKET\0"
+    "KC_RIGHT_BRACKET\0"
+    "KC_BACKSLASH\0"
+    "KC_NONUS_HASH\0"
+    "KC_SEMICOLON\0"
+    "KC_QUOTE\0"
+    "KC_GRAVE\0"
+    "KC_COMMA\0"
+    "KC_DOT\0"
+    "KC_SLASH\0"
+    "KC_CAPS_LOCK\0"
+    "KC_F1\0"
+    "KC_F2\0"
+    "KC_F3\0"
+    "KC_F4\0"
+    "KC_F5\0"
+    "KC_F6\0"
+    "KC_F7\0"
+    "KC_F8\0"
+    "KC_F9\0"
+    "KC_F10\0"
+    "KC_F11\0"
+    "KC_F12\0"
+    "KC_PRINT_SCREEN\0"
+    "KC_SCROLL_LOCK\0"
+    "KC_PAUSE\0"
+    "KC_INSERT\0"
+    "KC_HOME\0"
+    "KC_PAGE_UP\0"
+    "KC_DELETE\0"
+    "KC_END\0"
+    "KC_PAGE_DOWN\0"
+    "KC_RIGHT\0"
+    "KC_LEFT\0"
+    "KC_DOWN\0"
+    "KC_UP\0"
+    "KC_NUM_LOCK\0"
+    "KC_KP_SLASH\0"
+    "KC_KP_ASTERISK\0"
+    "KC_KP_MINUS\0"
+    "KC_KP_PLUS\0"
+    "KC_KP_ENTER\0"
+    "KC_KP_1\0"
+    "KC_KP_2\0"
+    "KC_KP_3\0"
+    "KC_KP_4\0"
+    "KC_KP_5\0"
+    "KC_KP_6\0"
+    "KC_KP_7\0"
+    "KC_KP_8\0"
+    "KC_KP_9\0"
+    "KC_KP_0\0"
+    "KC_KP_DOT\0"
+    "KC_NONUS_BACKSLASH\0"
+    "KC_APPLICATION\0"
+    "KC_KB_POWER\0"
+    "KC_KP_EQUAL\0"
+    "KC_F13\0"
+    "KC_F14\0"
+    "KC_F15\0"
+    "KC_F16\0"
+    "KC_F17\0"
+    "KC_F18\0"
+    "KC_F19\0"
+    "KC_F20\0"
+    "KC_F21\0"
+    "KC_F22\0"
+    "KC_F23\0"
+    "KC_F24\0"
+    "KC_EXECUTE\0"
+    "KC_HELP\0"
+    "KC_MENU\0"
+    "KC_SELECT\0"
+    "KC_STOP\0"
+    "KC_AGAIN\0"
+    "KC_UNDO\0"
+    "KC_CUT\0"
+    "KC_COPY\0"
+    "KC_PASTE\0"
+    "KC_FIND\0"
+    "KC_KB_MUTE\0"
+    "KC_KB_VOLUME_UP\0"
+    "KC_KB_VOLUME_DOWN\0"
+    "KC_LOCKING_CAPS_LOCK\0"
+    "KC_LOCKING_NUM_LOCK\0"
+    "KC_LOCKING_SCROLL_LOCK\0"
+    "KC_KP_COMMA\0"
+    "KC_KP_EQUAL_AS400\0"
+    "KC_INTERNATIONAL_1\0"
+    "KC_INTERNATIONAL_2\0"
+    "KC_INTERNATIONAL_3\0"
+    "KC_INTERNATIONAL_4\0"
+    "KC_INTERNATIONAL_5\0"
+    "KC_INTERNATIONAL_6\0"
+    "KC_INTERNATIONAL_7\0"
+    "KC_INTERNATIONAL_8\0"
+    "KC_INTERNATIONAL_9\0"
+    "KC_LANGUAGE_1\0"
+    "KC_LANGUAGE_2\0"
+    "KC_LANGUAGE_3\0"
+    "KC_LANGUAGE_4\0"
+    "KC_LANGUAGE_5\0"
+    "KC_LANGUAGE_6\0"
+    "KC_LANGUAGE_7\0"
+    "KC_LANGUAGE_8\0"
+    "KC_LANGUAGE_9\0"
+    "KC_ALTERNATE_ERASE\0"
+    "KC_SYSTEM_REQUEST\0"
+    "KC_CANCEL\0"
+    "KC_CLEAR\0"
+    "KC_PRIOR\0"
+    "KC_RETURN\0"
+    "KC_SEPARATOR\0"
+    "KC_OUT\0"
+    "KC_OPER\0"
+    "KC_CLEAR_AGAIN\0"
+    "KC_CRSEL\0"
+    "KC_EXSEL\0"
+    "KC_SYSTEM_POWER\0"
+    "KC_SYSTEM_SLEEP\0"
+    "KC_SYSTEM_WAKE\0"
+    "KC_AUDIO_MUTE\0"
+    "KC_AUDIO_VOL_UP\0"
+    "KC_AUDIO_VOL_DOWN\0"
+    "KC_MEDIA_NEXT_TRACK\0"
+    "KC_MEDIA_PREV_TRACK\0"
+    "KC_MEDIA_STOP\0"
+    "KC_MEDIA_PLAY_PAUSE\0"
+    "KC_MEDIA_SELECT\0"
+    "KC_MEDIA_EJECT\0"
+    "KC_MAIL\0"
+    "KC_CALCULATOR\0"
+    "KC_MY_COMPUTER\0"
+    "KC_WWW_SEARCH\0"
+    "KC_WWW_HOME\0"
+    "KC_WWW_BACK\0"
+    "KC_WWW_FORWARD\0"
+    "KC_WWW_STOP\0"
+    "KC_WWW_REFRESH\0"
+    "KC_WWW_FAVORITES\0"
+    "KC_MEDIA_FAST_FORWARD\0"
+    "KC_MEDIA_REWIND\0"
+    "KC_BRIGHTNESS_UP\0"
+    "KC_BRIGHTNESS_DOWN\0"
+    "KC_CONTROL_PANEL\0"
+    "KC_ASSISTANT\0"
+    "KC_MISSION_CONTROL\0"
+    "KC_LAUNCHPAD\0"
+    "QK_MOUSE_CURSOR_UP\0"
+    "QK_MOUSE_CURSOR_DOWN\0"
+    "QK_MOUSE_CURSOR_LEFT\0"
+    "QK_MOUSE_CURSOR_RIGHT\0"
+    "QK_MOUSE_BUTTON_1\0"
+    "QK_MOUSE_BUTTON_2\0"
+    "QK_MOUSE_BUTTON_3\0"
+    "QK_MOUSE_BUTTON_4\0"
+    "QK_MOUSE_BUTTON_5\0"
+    "QK_MOUSE_BUTTON_6\0"
+    "QK_MOUSE_BUTTON_7\0"
+    "QK_MOUSE_BUTTON_8\0"
+    "QK_MOUSE_WHEEL_UP\0"
+    "QK_MOUSE_WHEEL_DOWN\0"
+    "QK_MOUSE_WHEEL_LEFT\0"
+    "QK_MOUSE_WHEEL_RIGHT\0"
+    "QK_MOUSE_ACCELERATION_0\0"
+    "QK_MOUSE_ACCELERATION_1\0"
+    "QK_MOUSE_ACCELERATION_2\0"
+    "KC_LEFT_CTRL\0"
+    "KC_LEFT_SHIFT\0"
+    "KC_LEFT_ALT\0"
+    "KC_LEFT_GUI\0"
+    "KC_RIGHT_CTRL\0"
+    "KC_RIGHT_SHIFT\0"
+    "KC_RIGHT_ALT\0"
+    "KC_RIGHT_GUI\0"
+    "QK_SWAP_HANDS_TOGGLE\0"
+    "QK_SWAP_HANDS_TAP_TOGGLE\0"
+    "QK_SWAP_HANDS_MOMENTARY_ON\0"
+    "QK_SWAP_HANDS_MOMENTARY_OFF\0"
+    "QK_SWAP_HANDS_OFF\0"
+    "QK_SWAP_HANDS_ON\0"
+    "QK_SWAP_HANDS_ONE_SHOT\0"
+    "QK_MAGIC_SWAP_CONTROL_CAPS_LOCK\0"
+    "QK_MAGIC_UNSWAP_CONTROL_CAPS_LOCK\0"
+    "QK_MAGIC_TOGGLE_CONTROL_CAPS_LOCK\0"
+    "QK_MAGIC_CAPS_LOCK_AS_CONTROL_OFF\0"
+    "QK_MAGIC_CAPS_LOCK_AS_CONTROL_ON\0"
+    "QK_MAGIC_SWAP_LALT_LGUI\0"
+    "QK_MAGIC_UNSWAP_LALT_LGUI\0"
+    "QK_MAGIC_SWAP_RALT_RGUI\0"
+    "QK_MAGIC_UNSWAP_RALT_RGUI\0"
+    "QK_MAGIC_GUI_ON\0"
+    "QK_MAGIC_GUI_OFF\0"
+    "QK_MAGIC_TOGGLE_GUI\0"
+    "QK_MAGIC_SWAP_GRAVE_ESC\0"
+    "QK_MAGIC_UNSWAP_GRAVE_ESC\0"
+    "QK_MAGIC_SWAP_BACKSLASH_BACKSPACE\0"
+    "QK_MAGIC_UNSWAP_BACKSLASH_BACKSPACE\0"
+    "QK_MAGIC_TOGGLE_BACKSLASH_BACKSPACE\0"
+    "QK_MAGIC_NKRO_ON\0"
+    "QK_MAGIC_NKRO_OFF\0"
+    "QK_MAGIC_TOGGLE_NKRO\0"
+    "QK_MAGIC_SWAP_ALT_GUI\0"
+    "QK_MAGIC_UNSWAP_ALT_GUI\0"
+    "QK_MAGIC_TOGGLE_ALT_GUI\0"
+    "QK_MAGIC_SWAP_LCTL_LGUI\0"
+    "QK_MAGIC_UNSWAP_LCTL_LGUI\0"
+    "QK_MAGIC_SWAP_RCTL_RGUI\0"
+    "QK_MAGIC_UNSWAP_RCTL_RGUI\0"
+    "QK_MAGIC_SWAP_CTL_GUI\0"
+    "QK_MAGIC_UNSWAP_CTL_GUI\0"
+    "QK_MAGIC_TOGGLE_CTL_GUI\0"
+    "QK_MAGIC_EE_HANDS_LEFT\0"
+    "QK_MAGIC_EE_HANDS_RIGHT\0"
+    "QK_MAGIC_SWAP_ESCAPE_CAPS_LOCK\0"
+    "QK_MAGIC_UNSWAP_ESCAPE_CAPS_LOCK\0"
+    "QK_MAGIC_TOGGLE_ESCAPE_CAPS_LOCK\0"
+    "QK_MIDI_ON\0"
+    "QK_MIDI_OFF\0"
+    "QK_MIDI_TOGGLE\0"
+    "QK_MIDI_NOTE_C_0\0"
+    "QK_MIDI_NOTE_C_SHARP_0\0"
+    "QK_MIDI_NOTE_D_0\0"
+    "QK_MIDI_NOTE_D_SHARP_0\0"
+    "QK_MIDI_NOTE_E_0\0"
+    "QK_MIDI_NOTE_F_0\0"
+    "QK_MIDI_NOTE_F_SHARP_0\0"
+    "QK_MIDI_NOTE_G_0\0"
+    "QK_MIDI_NOTE_G_SHARP_0\0"
+    "QK_MIDI_NOTE_A_0\0"
+    "QK_MIDI_NOTE_A_SHARP_0\0"
+    "QK_MIDI_NOTE_B_0\0"
+    "QK_MIDI_NOTE_C_1\0"
+    "QK_MIDI_NOTE_C_SHARP_1\0"
+    "QK_MIDI_NOTE_D_1\0"
+    "QK_MIDI_NOTE_D_SHARP_1\0"
+    "QK_MIDI_NOTE_E_1\0"
+    "QK_MIDI_NOTE_F_1\0"
+    "QK_MIDI_NOTE_F_SHARP_1\0"
+    "QK_MIDI_NOTE_G_1\0"
+    "QK_MIDI_NOTE_G_SHARP_1\0"
+    "QK_MIDI_NOTE_A_1\0"
+    "QK_MIDI_NOTE_A_SHARP_1\0"
+    "QK_MIDI_NOTE_B_1\0"
+    "QK_MIDI_NOTE_C_2\0"
+    "QK_MIDI_NOTE_C_SHARP_2\0"
+    "QK_MIDI_NOTE_D_2\0"
+    "QK_MIDI_NOTE_D_SHARP_2\0"
+    "QK_MIDI_NOTE_E_2\0"
+    "QK_MIDI_NOTE_F_2\0"
+    "QK_MIDI_NOTE_F_SHARP_2\0"
+    "QK_MIDI_NOTE_G_2\0"
+    "QK_MIDI_NOTE_G_SHARP_2\0"
+    "QK_MIDI_NOTE_A_2\0"
+    "QK_MIDI_NOTE_A_SHARP_2\0"
+    "QK_MIDI_NOTE_B_2\0"
+    "QK_MIDI_NOTE_C_3\0"
+    "QK_MIDI_NOTE_C_SHARP_3\0"
+    "QK_MIDI_NOTE_D_3\0"
+    "QK_MIDI_NOTE_D_SHARP_3\0"
+    "QK_MIDI_NOTE_E_3\0"
+    "QK_MIDI_NOTE_F_3\0"
+    "QK_MIDI_NOTE_F_SHARP_3\0"
+    "QK_MIDI_NOTE_G_3\0"
+    "QK_MIDI_NOTE_G_SHARP_3\0"
+    "QK_MIDI_NOTE_A_3\0"
+    "QK_MIDI_NOTE_A_SHARP_3\0"
+    "QK_MIDI_NOTE_B_3\0"
+    "QK_MIDI_NOTE_C_4\0"
+    "QK_MIDI_NOTE_C_SHARP_4\0"
+    "QK_MIDI_NOTE_D_4\0"
+    "QK_MIDI_NOTE_D_SHARP_4\0"
+    "QK_MIDI_NOTE_E_4\0"
+    "QK_MIDI_NOTE_F_4\0"
+    "QK_MIDI_NOTE_F_SHARP_4\0"
+    "QK_MIDI_NOTE_G_4\0"
+    "QK_MIDI_NOTE_G_SHARP_4\0"
+    "QK_MIDI_NOTE_A_4\0"
+    "QK_MIDI_NOTE_A_SHARP_4\0"
+    "QK_MIDI_NOTE_B_4\0"
+    "QK_MIDI_NOTE_C_5\0"
+    "QK_MIDI_NOTE_C_SHARP_5\0"
+    "QK_MIDI_NOTE_D_5\0"
+    "QK_MIDI_NOTE_D_SHARP_5\0"
+    "QK_MIDI_NOTE_E_5\0"
+    "QK_MIDI_NOTE_F_5\0"
+    "QK_MIDI_NOTE_F_SHARP_5\0"
+    "QK_MIDI_NOTE_G_5\0"
+    "QK_MIDI_NOTE_G_SHARP_5\0"
+    "QK_MIDI_NOTE_A_5\0"
+    "QK_MIDI_NOTE_A_SHARP_5\0"
+    "QK_MIDI_NOTE_B_5\0"
+    "QK_MIDI_OCTAVE_N2\0"
+    "QK_MIDI_OCTAVE_N1\0"
+    "QK_MIDI_OCTAVE_0\0"
+    "QK_MIDI_OCTAVE_1\0"
+    "QK_MIDI_OCTAVE_2\0"
+    "QK_MIDI_OCTAVE_3\0"
+    "QK_MIDI_OCTAVE_4\0"
+    "QK_MIDI_OCTAVE_5\0"
+    "QK_MIDI_OCTAVE_6\0"
+    "QK_MIDI_OCTAVE_7\0"
+    "QK_MIDI_OCTAVE_DOWN\0"
+    "QK_MIDI_OCTAVE_UP\0"
+    "QK_MIDI_TRANSPOSE_N6\0"
+    "QK_MIDI_TRANSPOSE_N5\0"
+    "QK_MIDI_TRANSPOSE_N4\0"
+    "QK_MIDI_TRANSPOSE_N3\0"
+    "QK_MIDI_TRANSPOSE_N2\0"
+    "QK_MIDI_TRANSPOSE_N1\0"
+    "QK_MIDI_TRANSPOSE_0\0"
+    "QK_MIDI_TRANSPOSE_1\0"
+    "QK_MIDI_TRANSPOSE_2\0"
+    "QK_MIDI_TRANSPOSE_3\0"
+    "QK_MIDI_TRANSPOSE_4\0"
+    "QK_MIDI_TRANSPOSE_5\0"
+    "QK_MIDI_TRANSPOSE_6\0"
+    "QK_MIDI_TRANSPOSE_DOWN\0"
+    "QK_MIDI_TRANSPOSE_UP\0"
+    "QK_MIDI_VELOCITY_0\0"
+    "QK_MIDI_VELOCITY_1\0"
+    "QK_MIDI_VELOCITY_2\0"
+    "QK_MIDI_VELOCITY_3\0"
+    "QK_MIDI_VELOCITY_4\0"
+    "QK_MIDI_VELOCITY_5\0"
+    "QK_MIDI_VELOCITY_6\0"
+    "QK_MIDI_VELOCITY_7\0"
+    "QK_MIDI_VELOCITY_8\0"
+    "QK_MIDI_VELOCITY_9\0"
+    "QK_MIDI_VELOCITY_10\0"
+    "QK_MIDI_VELOCITY_DOWN\0"
+    "QK_MIDI_VELOCITY_UP\0"
+    "QK_MIDI_CHANNEL_1\0"
+    "QK_MIDI_CHANNEL_2\0"
+    "QK_MIDI_CHANNEL_3\0"
+    "QK_MIDI_CHANNEL_4\0"
+    "QK_MIDI_CHANNEL_5\0"
+    "QK_MIDI_CHANNEL_6\0"
+    "QK_MIDI_CHANNEL_7\0"
+    "QK_MIDI_CHANNEL_8\0"
+    "QK_MIDI_CHANNEL_9\0"
+    "QK_MIDI_CHANNEL_10\0"
+    "QK_MIDI_CHANNEL_11\0"
+    "QK_MIDI_CHANNEL_12\0"
+    "QK_MIDI_CHANNEL_13\0"
+    "QK_MIDI_CHANNEL_14\0"
+    "QK_MIDI_CHANNEL_15\0"
+    "QK_MIDI_CHANNEL_16\0"
+    "QK_MIDI_CHANNEL_DOWN\0"
+    "QK_MIDI_CHANNEL_UP\0"
+    "QK_MIDI_ALL_NOTES_OFF\0"
+    "QK_MIDI_SUSTAIN\0"
+    "QK_MIDI_PORTAMENTO\0"
+    "QK_MIDI_SOSTENUTO\0"
+    "QK_MIDI_SOFT\0"
+    "QK_MIDI_LEGATO\0"
+    "QK_MIDI_MODULATION\0"
+    "QK_MIDI_MODULATION_SPEED_DOWN\0"
+    "QK_MIDI_MODULATION_SPEED_UP\0"
+    "QK_MIDI_PITCH_BEND_DOWN\0"
+    "QK_MIDI_PITCH_BEND_UP\0"
+    "QK_SEQUENCER_ON\0"
+    "QK_SEQUENCER_OFF\0"
+    "QK_SEQUENCER_TOGGLE\0"
+    "QK_SEQUENCER_TEMPO_DOWN\0"
+    "QK_SEQUENCER_TEMPO_UP\0"
+    "QK_SEQUENCER_RESOLUTION_DOWN\0"
+    "QK_SEQUENCER_RESOLUTION_UP\0"
+    "QK_SEQUENCER_STEPS_ALL\0"
+    "QK_SEQUENCER_STEPS_CLEAR\0"
+    "QK_JOYSTICK_BUTTON_0\0"
+    "QK_JOYSTICK_BUTTON_1\0"
+    "QK_JOYSTICK_BUTTON_2\0"
+    "QK_JOYSTICK_BUTTON_3\0"
+    "QK_JOYSTICK_BUTTON_4\0"
+    "QK_JOYSTICK_BUTTON_5\0"
+    "QK_JOYSTICK_BUTTON_6\0"
+    "QK_JOYSTICK_BUTTON_7\0"
+    "QK_JOYSTICK_BUTTON_8\0"
+    "QK_JOYSTICK_BUTTON_9\0"
+    "QK_JOYSTICK_BUTTON_10\0"
+    "QK_JOYSTICK_BUTTON_11\0"
+    "QK_JOYSTICK_BUTTON_12\0"
+    "QK_JOYSTICK_BUTTON_13\0"
+    "QK_JOYSTICK_BUTTON_14\0"
+    "QK_JOYSTICK_BUTTON_15\0"
+    "QK_JOYSTICK_BUTTON_16\0"
+    "QK_JOYSTICK_BUTTON_17\0"
+    "QK_JOYSTICK_BUTTON_18\0"
+    "QK_JOYSTICK_BUTTON_19\0"
+    "QK_JOYSTICK_BUTTON_20\0"
+    "QK_JOYSTICK_BUTTON_21\0"
+    "QK_JOYSTICK_BUTTON_22\0"
+    "QK_JOYSTICK_BUTTON_23\0"
+    "QK_JOYSTICK_BUTTON_24\0"
+    "QK_JOYSTICK_BUTTON_25\0"
+    "QK_JOYSTICK_BUTTON_26\0"
+    "QK_JOYSTICK_BUTTON_27\0"
+    "QK_JOYSTICK_BUTTON_28\0"
+    "QK_JOYSTICK_BUTTON_29\0"
+    "QK_JOYSTICK_BUTTON_30\0"
+    "QK_JOYSTICK_BUTTON_31\0"
+    "QK_PROGRAMMABLE_BUTTON_1\0"
+    "QK_PROGRAMMABLE_BUTTON_2\0"
+    "QK_PROGRAMMABLE_BUTTON_3\0"
+    "QK_PROGRAMMABLE_BUTTON_4\0"
+    "QK_PROGRAMMABLE_BUTTON_5\0"
+    "QK_PROGRAMMABLE_BUTTON_6\0"
+    "QK_PROGRAMMABLE_BUTTON_7\0"
+    "QK_PROGRAMMABLE_BUTTON_8\0"
+    "QK_PROGRAMMABLE_BUTTON_9\0"
+    "QK_PROGRAMMABLE_BUTTON_10\0"
+    "QK_PROGRAMMABLE_BUTTON_11\0"
+    "QK_PROGRAMMABLE_BUTTON_12\0"
+    "QK_PROGRAMMABLE_BUTTON_13\0"
+    "QK_PROGRAMMABLE_BUTTON_14\0"
+    "QK_PROGRAMMABLE_BUTTON_15\0"
+    "QK_PROGRAMMABLE_BUTTON_16\0"
+    "QK_PROGRAMMABLE_BUTTON_17\0"
+    "QK_PROGRAMMABLE_BUTTON_18\0"
+    "QK_PROGRAMMABLE_BUTTON_19\0"
+    "QK_PROGRAMMABLE_BUTTON_20\0"
+    "QK_PROGRAMMABLE_BUTTON_21\0"
+    "QK_PROGRAMMABLE_BUTTON_22\0"
+    "QK_PROGRAMMABLE_BUTTON_23\0"
+    "QK_PROGRAMMABLE_BUTTON_24\0"
+    "QK_PROGRAMMABLE_BUTTON_25\0"
+    "QK_PROGRAMMABLE_BUTTON_26\0"
+    "QK_PROGRAMMABLE_BUTTON_27\0"
+    "QK_PROGRAMMABLE_BUTTON_28\0"
+    "QK_PROGRAMMABLE_BUTTON_29\0"
+    "QK_PROGRAMMABLE_BUTTON_30\0"
+    "QK_PROGRAMMABLE_BUTTON_31\0"
+    "QK_PROGRAMMABLE_BUTTON_32\0"
+    "QK_AUDIO_ON\0"
+    "QK_AUDIO_OFF\0"
+    "QK_AUDIO_TOGGLE\0"
+    "QK_AUDIO_CLICKY_TOGGLE\0"
+    "QK_AUDIO_CLICKY_ON\0"
+    "QK_AUDIO_CLICKY_OFF\0"
+    "QK_AUDIO_CLICKY_UP\0"
+    "QK_AUDIO_CLICKY_DOWN\0"
+    "QK_AUDIO_CLICKY_RESET\0"
+    "QK_MUSIC_ON\0"
+    "QK_MUSIC_OFF\0"
+    "QK_MUSIC_TOGGLE\0"
+    "QK_MUSIC_MODE_NEXT\0"
+    "QK_AUDIO_VOICE_NEXT\0"
+    "QK_AUDIO_VOICE_PREVIOUS\0"
+    "QK_STENO_BOLT\0"
+    "QK_STENO_GEMINI\0"
+    "QK_STENO_COMB\0"
+    "QK_STENO_COMB_MAX\0"
+    "QK_MACRO_0\0"
+    "QK_MACRO_1\0"
+    "QK_MACRO_2\0"
+    "QK_MACRO_3\0"
+    "QK_MACRO_4\0"
+    "QK_MACRO_5\0"
+    "QK_MACRO_6\0"
+    "QK_MACRO_7\0"
+    "QK_MACRO_8\0"
+    "QK_MACRO_9\0"
+    "QK_MACRO_10\0"
+    "QK_MACRO_11\0"
+    "QK_MACRO_12\0"
+    "QK_MACRO_13\0"
+    "QK_MACRO_14\0"
+    "QK_MACRO_15\0"
+    "QK_MACRO_16\0"
+    "QK_MACRO_17\0"
+    "QK_MACRO_18\0"
+    "QK_MACRO_19\0"
+    "QK_MACRO_20\0"
+    "QK_MACRO_21\0"
+    "QK_MACRO_22\0"
+    "QK_MACRO_23\0"
+    "QK_MACRO_24\0"
+    "QK_MACRO_25\0"
+    "QK_MACRO_26\0"
+    "QK_MACRO_27\0"
+    "QK_MACRO_28\0"
+    "QK_MACRO_29\0"
+    "QK_MACRO_30\0"
+    "QK_MACRO_31\0"
+    "QK_OUTPUT_AUTO\0"
+    "QK_OUTPUT_NEXT\0"
+    "QK_OUTPUT_PREV\0"
+    "QK_OUTPUT_NONE\0"
+    "QK_OUTPUT_USB\0"
+    "QK_OUTPUT_2P4GHZ\0"
+    "QK_OUTPUT_BLUETOOTH\0"
+    "QK_BLUETOOTH_PROFILE_NEXT\0"
+    "QK_BLUETOOTH_PROFILE_PREV\0"
+    "QK_BLUETOOTH_UNPAIR\0"
+    "QK_BLUETOOTH_PROFILE1\0"
+    "QK_BLUETOOTH_PROFILE2\0"
+    "QK_BLUETOOTH_PROFILE3\0"
+    "QK_BLUETOOTH_PROFILE4\0"
+    "QK_BLUETOOTH_PROFILE5\0"
+    "QK_BACKLIGHT_ON\0"
+    "QK_BACKLIGHT_OFF\0"
+    "QK_BACKLIGHT_TOGGLE\0"
+    "QK_BACKLIGHT_DOWN\0"
+    "QK_BACKLIGHT_UP\0"
+    "QK_BACKLIGHT_STEP\0"
+    "QK_BACKLIGHT_TOGGLE_BREATHING\0"
+    "QK_LED_MATRIX_ON\0"
+    "QK_LED_MATRIX_OFF\0"
+    "QK_LED_MATRIX_TOGGLE\0"
+    "QK_LED_MATRIX_MODE_NEXT\0"
+    "QK_LED_MATRIX_MODE_PREVIOUS\0"
+    "QK_LED_MATRIX_BRIGHTNESS_UP\0"
+    "QK_LED_MATRIX_BRIGHTNESS_DOWN\0"
+    "QK_LED_MATRIX_SPEED_UP\0"
+    "QK_LED_MATRIX_SPEED_DOWN\0"
+    "QK_UNDERGLOW_TOGGLE\0"
+    "QK_UNDERGLOW_MODE_NEXT\0"
+    "QK_UNDERGLOW_MODE_PREVIOUS\0"
+    "QK_UNDERGLOW_HUE_UP\0"
+    "QK_UNDERGLOW_HUE_DOWN\0"
+    "QK_UNDERGLOW_SATURATION_UP\0"
+    "QK_UNDERGLOW_SATURATION_DOWN\0"
+    "QK_UNDERGLOW_VALUE_UP\0"
+    "QK_UNDERGLOW_VALUE_DOWN\0"
+    "QK_UNDERGLOW_SPEED_UP\0"
+    "QK_UNDERGLOW_SPEED_DOWN\0"
+    "RGB_MODE_PLAIN\0"
+    "RGB_MODE_BREATHE\0"
+    "RGB_MODE_RAINBOW\0"
+    "RGB_MODE_SWIRL\0"
+    "RGB_MODE_SNAKE\0"
+    "RGB_MODE_KNIGHT\0"
+    "RGB_MODE_XMAS\0"
+    "RGB_MODE_GRADIENT\0"
+    "RGB_MODE_RGBTEST\0"
+    "RGB_MODE_TWINKLE\0"
+    "QK_RGB_MATRIX_ON\0"
+    "QK_RGB_MATRIX_OFF\0"
+    "QK_RGB_MATRIX_TOGGLE\0"
+    "QK_RGB_MATRIX_MODE_NEXT\0"
+    "QK_RGB_MATRIX_MODE_PREVIOUS\0"
+    "QK_RGB_MATRIX_HUE_UP\0"
+    "QK_RGB_MATRIX_HUE_DOWN\0"
+    "QK_RGB_MATRIX_SATURATION_UP\0"
+    "QK_RGB_MATRIX_SATURATION_DOWN\0"
+    "QK_RGB_MATRIX_VALUE_UP\0"
+    "QK_RGB_MATRIX_VALUE_DOWN\0"
+    "QK_RGB_MATRIX_SPEED_UP\0"
+    "QK_RGB_MATRIX_SPEED_DOWN\0"
+    "QK_BOOTLOADER\0"
+    "QK_REBOOT\0"
+    "QK_DEBUG_TOGGLE\0"
+    "QK_CLEAR_EEPROM\0"
+    "QK_MAKE\0"
+    "QK_AUTO_SHIFT_DOWN\0"
+    "QK_AUTO_SHIFT_UP\0"
+    "QK_AUTO_SHIFT_REPORT\0"
+    "QK_AUTO_SHIFT_ON\0"
+    "QK_AUTO_SHIFT_OFF\0"
+    "QK_AUTO_SHIFT_TOGGLE\0"
+    "QK_GRAVE_ESCAPE\0"
+    "QK_VELOCIKEY_TOGGLE\0"
+    "QK_SPACE_CADET_LEFT_CTRL_PARENTHESIS_OPEN\0"
+    "QK_SPACE_CADET_RIGHT_CTRL_PARENTHESIS_CLOSE\0"
+    "QK_SPACE_CADET_LEFT_SHIFT_PARENTHESIS_OPEN\0"
+    "QK_SPACE_CADET_RIGHT_SHIFT_PARENTHESIS_CLOSE\0"
+    "QK_SPACE_CADET_LEFT_ALT_PARENTHESIS_OPEN\0"
+    "QK_SPACE_CADET_RIGHT_ALT_PARENTHESIS_CLOSE\0"
+    "QK_SPACE_CADET_RIGHT_SHIFT_ENTER\0"
+    "QK_UNICODE_MODE_NEXT\0"
+    "QK_UNICODE_MODE_PREVIOUS\0"
+    "QK_UNICODE_MODE_MACOS\0"
+    "QK_UNICODE_MODE_LINUX\0"
+    "QK_UNICODE_MODE_WINDOWS\0"
+    "QK_UNICODE_MODE_BSD\0"
+    "QK_UNICODE_MODE_WINCOMPOSE\0"
+    "QK_UNICODE_MODE_EMACS\0"
+    "QK_HAPTIC_ON\0"
+    "QK_HAPTIC_OFF\0"
+    "QK_HAPTIC_TOGGLE\0"
+    "QK_HAPTIC_RESET\0"
+    "QK_HAPTIC_FEEDBACK_TOGGLE\0"
+    "QK_HAPTIC_BUZZ_TOGGLE\0"
+    "QK_HAPTIC_MODE_NEXT\0"
+    "QK_HAPTIC_MODE_PREVIOUS\0"
+    "QK_HAPTIC_CONTINUOUS_TOGGLE\0"
+    "QK_HAPTIC_CONTINUOUS_UP\0"
+    "QK_HAPTIC_CONTINUOUS_DOWN\0"
+    "QK_HAPTIC_DWELL_UP\0"
+    "QK_HAPTIC_DWELL_DOWN\0"
+    "QK_COMBO_ON\0"
+    "QK_COMBO_OFF\0"
+    "QK_COMBO_TOGGLE\0"
+    "QK_DYNAMIC_MACRO_RECORD_START_1\0"
+    "QK_DYNAMIC_MACRO_RECORD_START_2\0"
+    "QK_DYNAMIC_MACRO_RECORD_STOP\0"
+    "QK_DYNAMIC_MACRO_PLAY_1\0"
+    "QK_DYNAMIC_MACRO_PLAY_2\0"
+    "QK_LEADER\0"
+    "QK_LOCK\0"
+    "QK_ONE_SHOT_ON\0"
+    "QK_ONE_SHOT_OFF\0"
+    "QK_ONE_SHOT_TOGGLE\0"
+    "QK_KEY_OVERRIDE_TOGGLE\0"
+    "QK_KEY_OVERRIDE_ON\0"
+    "QK_KEY_OVERRIDE_OFF\0"
+    "QK_SECURE_LOCK\0"
+    "QK_SECURE_UNLOCK\0"
+    "QK_SECURE_TOGGLE\0"
+    "QK_SECURE_REQUEST\0"
+    "QK_DYNAMIC_TAPPING_TERM_PRINT\0"
+    "QK_DYNAMIC_TAPPING_TERM_UP\0"
+    "QK_DYNAMIC_TAPPING_TERM_DOWN\0"
+    "QK_CAPS_WORD_TOGGLE\0"
+    "QK_AUTOCORRECT_ON\0"
+    "QK_AUTOCORRECT_OFF\0"
+    "QK_AUTOCORRECT_TOGGLE\0"
+    "QK_TRI_LAYER_LOWER\0"
+    "QK_TRI_LAYER_UPPER\0"
+    "QK_REPEAT_KEY\0"
+    "QK_ALT_REPEAT_KEY\0"
+    "QK_LAYER_LOCK\0"
+    "QK_KB_0\0"
+    "QK_KB_1\0"
+    "QK_KB_2\0"
+    "QK_KB_3\0"
+    "QK_KB_4\0"
+    "QK_KB_5\0"
+    "QK_KB_6\0"
+    "QK_KB_7\0"
+    "QK_KB_8\0"
+    "QK_KB_9\0"
+    "QK_KB_10\0"
+    "QK_KB_11\0"
+    "QK_KB_12\0"
+    "QK_KB_13\0"
+    "QK_KB_14\0"
+    "QK_KB_15\0"
+    "QK_KB_16\0"
+    "QK_KB_17\0"
+    "QK_KB_18\0"
+    "QK_KB_19\0"
+    "QK_KB_20\0"
+    "QK_KB_21\0"
+    "QK_KB_22\0"
+    "QK_KB_23\0"
+    "QK_KB_24\0"
+    "QK_KB_25\0"
+    "QK_KB_26\0"
+    "QK_KB_27\0"
+    "QK_KB_28\0"
+    "QK_KB_29\0"
+    "QK_KB_30\0"
+    "QK_KB_31\0"
+    "QK_USER_0\0"
+    "QK_USER_1\0"
+    "QK_USER_2\0"
+    "QK_USER_3\0"
+    "QK_USER_4\0"
+    "QK_USER_5\0"
+    "QK_USER_6\0"
+    "QK_USER_7\0"
+    "QK_USER_8\0"
+    "QK_USER_9\0"
+    "QK_USER_10\0"
+    "QK_USER_11\0"
+    "QK_USER_12\0"
+    "QK_USER_13\0"
+    "QK_USER_14\0"
+    "QK_USER_15\0"
+    "QK_USER_16\0"
+    "QK_USER_17\0"
+    "QK_USER_18\0"
+    "QK_USER_19\0"
+    "QK_USER_20\0"
+    "QK_USER_21\0"
+    "QK_USER_22\0"
+    "QK_USER_23\0"
+    "QK_USER_24\0"
+    "QK_USER_25\0"
+    "QK_USER_26\0"
+    "QK_USER_27\0"
+    "QK_USER_28\0"
+    "QK_USER_29\0"
+    "QK_USER_30\0"
+    "QK_USER_31\0"
+    "AC_OFF\0"
+    "AC_ON\0"
+    "AC_TOGG\0"
+    "AG_LNRM\0"
+    "AG_LSWP\0"
+    "AG_NORM\0"
+    "AG_RNRM\0"
+    "AG_RSWP\0"
+    "AG_SWAP\0"
+    "AG_TOGG\0"
+    "AS_DOWN\0"
+    "AS_OFF\0"
+    "AS_ON\0"
+    "AS_RPT\0"
+    "AS_TOGG\0"
+    "AS_UP\0"
+    "AU_NEXT\0"
+    "AU_OFF\0"
+    "AU_ON\0"
+    "AU_PREV\0"
+    "AU_TOGG\0"
+    "BL_BRTG\0"
+    "BL_DOWN\0"
+    "BL_OFF\0"
+    "BL_ON\0"
+    "BL_STEP\0"
+    "BL_TOGG\0"
+    "BL_UP\0"
+    "BS_NORM\0"
+    "BS_SWAP\0"
+    "BS_TOGG\0"
+    "BT_NEXT\0"
+    "BT_PREV\0"
+    "BT_PRF1\0"
+    "BT_PRF2\0"
+    "BT_PRF3\0"
+    "BT_PRF4\0"
+    "BT_PRF5\0"
+    "BT_UNPR\0"
+    "CG_LNRM\0"
+    "CG_LSWP\0"
+    "CG_NORM\0"
+    "CG_RNRM\0"
+    "CG_RSWP\0"
+    "CG_SWAP\0"
+    "CG_TOGG\0"
+    "CK_DOWN\0"
+    "CK_OFF\0"
+    "CK_ON\0"
+    "CK_RST\0"
+    "CK_TOGG\0"
+    "CK_UP\0"
+    "CL_CAPS\0"
+    "CL_CTRL\0"
+    "CL_NORM\0"
+    "CL_SWAP\0"
+    "CL_TOGG\0"
+    "CM_OFF\0"
+    "CM_ON\0"
+    "CM_TOGG\0"
+    "CW_TOGG\0"
+    "DB_TOGG\0"
+    "DM_PLY1\0"
+    "DM_PLY2\0"
+    "DM_REC1\0"
+    "DM_REC2\0"
+    "DM_RSTP\0"
+    "DT_DOWN\0"
+    "DT_PRNT\0"
+    "DT_UP\0"
+    "EC_NORM\0"
+    "EC_SWAP\0"
+    "EC_TOGG\0"
+    "EE_CLR\0"
+    "EH_LEFT\0"
+    "EH_RGHT\0"
+    "GE_NORM\0"
+    "GE_SWAP\0"
+    "GU_OFF\0"
+    "GU_ON\0"
+    "GU_TOGG\0"
+    "HF_BUZZ\0"
+    "HF_COND\0"
+    "HF_CONT\0"
+    "HF_CONU\0"
+    "HF_DWLD\0"
+    "HF_DWLU\0"
+    "HF_FDBK\0"
+    "HF_NEXT\0"
+    "HF_OFF\0"
+    "HF_ON\0"
+    "HF_PREV\0"
+    "HF_RST\0"
+    "HF_TOGG\0"
+    "JS_0\0"
+    "JS_1\0"
+    "JS_10\0"
+    "JS_11\0"
+    "JS_12\0"
+    "JS_13\0"
+    "JS_14\0"
+    "JS_15\0"
+    "JS_16\0"
+    "JS_17\0"
+    "JS_18\0"
+    "JS_19\0"
+    "JS_2\0"
+    "JS_20\0"
+    "JS_21\0"
+    "JS_22\0"
+    "JS_23\0"
+    "JS_24\0"
+    "JS_25\0"
+    "JS_26\0"
+    "JS_27\0"
+    "JS_28\0"
+    "JS_29\0"
+    "JS_3\0"
+    "JS_30\0"
+    "JS_31\0"
+    "JS_4\0"
+    "JS_5\0"
+    "JS_6\0"
+    "JS_7\0"
+    "JS_8\0"
+    "JS_9\0"
+    "KC_AGIN\0"
+    "KC_ALGR\0"
+    "KC_APP\0"
+    "KC_ASST\0"
+    "KC_BRID\0"
+    "KC_BRIU\0"
+    "KC_BRK\0"
+    "KC_BRMD\0"
+    "KC_BRMU\0"
+    "KC_BSLS\0"
+    "KC_BSPC\0"
+    "KC_CALC\0"
+    "KC_CAPS\0"
+    "KC_CLAG\0"
+    "KC_CLR\0"
+    "KC_CNCL\0"
+    "KC_COMM\0"
+    "KC_CPNL\0"
+    "KC_CRSL\0"
+    "KC_DEL\0"
+    "KC_EJCT\0"
+    "KC_ENT\0"
+    "KC_EQL\0"
+    "KC_ERAS\0"
+    "KC_ESC\0"
+    "KC_EXEC\0"
+    "KC_EXSL\0"
+    "KC_GRV\0"
+    "KC_INS\0"
+    "KC_INT1\0"
+    "KC_INT2\0"
+    "KC_INT3\0"
+    "KC_INT4\0"
+    "KC_INT5\0"
+    "KC_INT6\0"
+    "KC_INT7\0"
+    "KC_INT8\0"
+    "KC_INT9\0"
+    "KC_LALT\0"
+    "KC_LBRC\0"
+    "KC_LCAP\0"
+    "KC_LCMD\0"
+    "KC_LCTL\0"
+    "KC_LGUI\0"
+    "KC_LNG1\0"
+    "KC_LNG2\0"
+    "KC_LNG3\0"
+    "KC_LNG4\0"
+    "KC_LNG5\0"
+    "KC_LNG6\0"
+    "KC_LNG7\0"
+    "KC_LNG8\0"
+    "KC_LNG9\0"
+    "KC_LNUM\0"
+    "KC_LOPT\0"
+    "KC_LPAD\0"
+    "KC_LSCR\0"
+    "KC_LSFT\0"
+    "KC_LWIN\0"
+    "KC_MCTL\0"
+    "KC_MFFD\0"
+    "KC_MINS\0"
+    "KC_MNXT\0"
+    "KC_MPLY\0"
+    "KC_MPRV\0"
+    "KC_MRWD\0"
+    "KC_MSEL\0"
+    "KC_MSTP\0"
+    "KC_MUTE\0"
+    "KC_MYCM\0"
+    "KC_NUBS\0"
+    "KC_NUHS\0"
+    "KC_NUM\0"
+    "KC_P0\0"
+    "KC_P1\0"
+    "KC_P2\0"
+    "KC_P3\0"
+    "KC_P4\0"
+    "KC_P5\0"
+    "KC_P6\0"
+    "KC_P7\0"
+    "KC_P8\0"
+    "KC_P9\0"
+    "KC_PAST\0"
+    "KC_PAUS\0"
+    "KC_PCMM\0"
+    "KC_PDOT\0"
+    "KC_PENT\0"
+    "KC_PEQL\0"
+    "KC_PGDN\0"
+    "KC_PGUP\0"
+    "KC_PMNS\0"
+    "KC_PPLS\0"
+    "KC_PRIR\0"
+    "KC_PSCR\0"
+    "KC_PSLS\0"
+    "KC_PSTE\0"
+    "KC_PWR\0"
+    "KC_QUOT\0"
+    "KC_RALT\0"
+    "KC_RBRC\0"
+    "KC_RCMD\0"
+    "KC_RCTL\0"
+    "KC_RETN\0"
+    "KC_RGHT\0"
+    "KC_RGUI\0"
+    "KC_ROPT\0"
+    "KC_RSFT\0"
+    "KC_RWIN\0"
+    "KC_SCLN\0"
+    "KC_SCRL\0"
+    "KC_SEPR\0"
+    "KC_SLCT\0"
+    "KC_SLEP\0"
+    "KC_SLSH\0"
+    "KC_SPC\0"
+    "KC_SYRQ\0"
+    "KC_TRNS\0"
+    "KC_VOLD\0"
+    "KC_VOLU\0"
+    "KC_WAKE\0"
+    "KC_WBAK\0"
+    "KC_WFAV\0"
+    "KC_WFWD\0"
+    "KC_WHOM\0"
+    "KC_WREF\0"
+    "KC_WSCH\0"
+    "KC_WSTP\0"
+    "KO_OFF\0"
+    "KO_ON\0"
+    "KO_TOGG\0"
+    "LM_BRID\0"
+    "LM_BRIU\0"
+    "LM_NEXT\0"
+    "LM_OFF\0"
+    "LM_ON\0"
+    "LM_PREV\0"
+    "LM_SPDD\0"
+    "LM_SPDU\0"
+    "LM_TOGG\0"
+    "MC_0\0"
+    "MC_1\0"
+    "MC_10\0"
+    "MC_11\0"
+    "MC_12\0"
+    "MC_13\0"
+    "MC_14\0"
+    "MC_15\0"
+    "MC_16\0"
+    "MC_17\0"
+    "MC_18\0"
+    "MC_19\0"
+    "MC_2\0"
+    "MC_20\0"
+    "MC_21\0"
+    "MC_22\0"
+    "MC_23\0"
+    "MC_24\0"
+    "MC_25\0"
+    "MC_26\0"
+    "MC_27\0"
+    "MC_28\0"
+    "MC_29\0"
+    "MC_3\0"
+    "MC_30\0"
+    "MC_31\0"
+    "MC_4\0"
+    "MC_5\0"
+    "MC_6\0"
+    "MC_7\0"
+    "MC_8\0"
+    "MC_9\0"
+    "MI_A\0"
+    "MI_A1\0"
+    "MI_A2\0"
+    "MI_A3\0"
+    "MI_A4\0"
+    "MI_A5\0"
+    "MI_AOFF\0"
+    "MI_Ab\0"
+    "MI_Ab1\0"
+    "MI_Ab2\0"
+    "MI_Ab3\0"
+    "MI_Ab4\0"
+    "MI_Ab5\0"
+    "MI_As\0"
+    "MI_As1\0"
+    "MI_As2\0"
+    "MI_As3\0"
+    "MI_As4\0"
+    "MI_As5\0"
+    "MI_B\0"
+    "MI_B1\0"
+    "MI_B2\0"
+    "MI_B3\0"
+    "MI_B4\0"
+    "MI_B5\0"
+    "MI_BNDD\0"
+    "MI_BNDU\0"
+    "MI_Bb\0"
+    "MI_Bb1\0"
+    "MI_Bb2\0"
+    "MI_Bb3\0"
+    "MI_Bb4\0"
+    "MI_Bb5\0"
+    "MI_C\0"
+    "MI_C1\0"
+    "MI_C2\0"
+    "MI_C3\0"
+    "MI_C4\0"
+    "MI_C5\0"
+    "MI_CH1\0"
+    "MI_CH10\0"
+    "MI_CH11\0"
+    "MI_CH12\0"
+    "MI_CH13\0"
+    "MI_CH14\0"
+    "MI_CH15\0"
+    "MI_CH16\0"
+    "MI_CH2\0"
+    "MI_CH3\0"
+    "MI_CH4\0"
+    "MI_CH5\0"
+    "MI_CH6\0"
+    "MI_CH7\0"
+    "MI_CH8\0"
+    "MI_CH9\0"
+    "MI_CHND\0"
+    "MI_CHNU\0"
+    "MI_Cs\0"
+    "MI_Cs1\0"
+    "MI_Cs2\0"
+    "MI_Cs3\0"
+    "MI_Cs4\0"
+    "MI_Cs5\0"
+    "MI_D\0"
+    "MI_D1\0"
+    "MI_D2\0"
+    "MI_D3\0"
+    "MI_D4\0"
+    "MI_D5\0"
+    "MI_Db\0"
+    "MI_Db1\0"
+    "MI_Db2\0"
+    "MI_Db3\0"
+    "MI_Db4\0"
+    "MI_Db5\0"
+    "MI_Ds\0"
+    "MI_Ds1\0"
+    "MI_Ds2\0"
+    "MI_Ds3\0"
+    "MI_Ds4\0"
+    "MI_Ds5\0"
+    "MI_E\0"
+    "MI_E1\0"
+    "MI_E2\0"
+    "MI_E3\0"
+    "MI_E4\0"
+    "MI_E5\0"
+    "MI_Eb\0"
+    "MI_Eb1\0"
+    "MI_Eb2\0"
+    "MI_Eb3\0"
+    "MI_Eb4\0"
+    "MI_Eb5\0"
+    "MI_F\0"
+    "MI_F1\0"
+    "MI_F2\0"
+    "MI_F3\0"
+    "MI_F4\0"
+    "MI_F5\0"
+    "MI_Fs\0"
+    "MI_Fs1\0"
+    "MI_Fs2\0"
+    "MI_Fs3\0"
+    "MI_Fs4\0"
+    "MI_Fs5\0"
+    "MI_G\0"
+    "MI_G1\0"
+    "MI_G2\0"
+    "MI_G3\0"
+    "MI_G4\0"
+    "MI_G5\0"
+    "MI_Gb\0"
+    "MI_Gb1\0"
+    "MI_Gb2\0"
+    "MI_Gb3\0"
+    "MI_Gb4\0"
+    "MI_Gb5\0"
+    "MI_Gs\0"
+    "MI_Gs1\0"
+    "MI_Gs2\0"
+    "MI_Gs3\0"
+    "MI_Gs4\0"
+    "MI_Gs5\0"
+    "MI_LEG\0"
+    "MI_MOD\0"
+    "MI_MODD\0"
+    "MI_MODU\0"
+    "MI_OC0\0"
+    "MI_OC1\0"
+    "MI_OC2\0"
+    "MI_OC3\0"
+    "MI_OC4\0"
+    "MI_OC5\0"
+    "MI_OC6\0"
+    "MI_OC7\0"
+    "MI_OCN1\0"
+    "MI_OCN2\0"
+    "MI_OCTD\0"
+    "MI_OCTU\0"
+    "MI_OFF\0"
+    "MI_ON\0"
+    "MI_PORT\0"
+    "MI_SOFT\0"
+    "MI_SOST\0"
+    "MI_SUST\0"
+    "MI_TOGG\0"
+    "MI_TR0\0"
+    "MI_TR1\0"
+    "MI_TR2\0"
+    "MI_TR3\0"
+    "MI_TR4\0"
+    "MI_TR5\0"
+    "MI_TR6\0"
+    "MI_TRN1\0"
+    "MI_TRN2\0"
+    "MI_TRN3\0"
+    "MI_TRN4\0"
+    "MI_TRN5\0"
+    "MI_TRN6\0"
+    "MI_TRSD\0"
+    "MI_TRSU\0"
+    "MI_VELD\0"
+    "MI_VELU\0"
+    "MI_VL0\0"
+    "MI_VL1\0"
+    "MI_VL10\0"
+    "MI_VL2\0"
+    "MI_VL3\0"
+    "MI_VL4\0"
+    "MI_VL5\0"
+    "MI_VL6\0"
+    "MI_VL7\0"
+    "MI_VL8\0"
+    "MI_VL9\0"
+    "MS_ACL0\0"
+    "MS_ACL1\0"
+    "MS_ACL2\0"
+    "MS_BTN1\0"
+    "MS_BTN2\0"
+    "MS_BTN3\0"
+    "MS_BTN4\0"
+    "MS_BTN5\0"
+    "MS_BTN6\0"
+    "MS_BTN7\0"
+    "MS_BTN8\0"
+    "MS_DOWN\0"
+    "MS_LEFT\0"
+    "MS_RGHT\0"
+    "MS_UP\0"
+    "MS_WHLD\0"
+    "MS_WHLL\0"
+    "MS_WHLR\0"
+    "MS_WHLU\0"
+    "MU_NEXT\0"
+    "MU_OFF\0"
+    "MU_ON\0"
+    "MU_TOGG\0"
+    "NK_OFF\0"
+    "NK_ON\0"
+    "NK_TOGG\0"
+    "OS_OFF\0"
+    "OS_ON\0"
+    "OS_TOGG\0"
+    "OU_2P4G\0"
+    "OU_AUTO\0"
+    "OU_BT\0"
+    "OU_NEXT\0"
+    "OU_NONE\0"
+    "OU_PREV\0"
+    "OU_USB\0"
+    "PB_1\0"
+    "PB_10\0"
+    "PB_11\0"
+    "PB_12\0"
+    "PB_13\0"
+    "PB_14\0"
+    "PB_15\0"
+    "PB_16\0"
+    "PB_17\0"
+    "PB_18\0"
+    "PB_19\0"
+    "PB_2\0"
+    "PB_20\0"
+    "PB_21\0"
+    "PB_22\0"
+    "PB_23\0"
+    "PB_24\0"
+    "PB_25\0"
+    "PB_26\0"
+    "PB_27\0"
+    "PB_28\0"
+    "PB_29\0"
+    "PB_3\0"
+    "PB_30\0"
+    "PB_31\0"
+    "PB_32\0"
+    "PB_4\0"
+    "PB_5\0"
+    "PB_6\0"
+    "PB_7\0"
+    "PB_8\0"
+    "PB_9\0"
+    "QK_AREP\0"
+    "QK_BOOT\0"
+    "QK_GESC\0"
+    "QK_LEAD\0"
+    "QK_LLCK\0"
+    "QK_RBT\0"
+    "QK_REP\0"
+    "RGB_M_B\0"
+    "RGB_M_G\0"
+    "RGB_M_K\0"
+    "RGB_M_P\0"
+    "RGB_M_R\0"
+    "RGB_M_SN\0"
+    "RGB_M_SW\0"
+    "RGB_M_T\0"
+    "RGB_M_TW\0"
+    "RGB_M_X\0"
+    "RM_HUED\0"
+    "RM_HUEU\0"
+    "RM_NEXT\0"
+    "RM_OFF\0"
+    "RM_ON\0"
+    "RM_PREV\0"
+    "RM_SATD\0"
+    "RM_SATU\0"
+    "RM_SPDD\0"
+    "RM_SPDU\0"
+    "RM_TOGG\0"
+    "RM_VALD\0"
+    "RM_VALU\0"
+    "SC_LAPO\0"
+    "SC_LCPO\0"
+    "SC_LSPO\0"
+    "SC_RAPC\0"
+    "SC_RCPC\0"
+    "SC_RSPC\0"
+    "SC_SENT\0"
+    "SE_LOCK\0"
+    "SE_REQ\0"
+    "SE_TOGG\0"
+    "SE_UNLK\0"
+    "SH_MOFF\0"
+    "SH_MON\0"
+    "SH_OFF\0"
+    "SH_ON\0"
+    "SH_OS\0"
+    "SH_TOGG\0"
+    "SH_TT\0"
+    "SQ_OFF\0"
+    "SQ_ON\0"
+    "SQ_RESD\0"
+    "SQ_RESU\0"
+    "SQ_SALL\0"
+    "SQ_SCLR\0"
+    "SQ_TMPD\0"
+    "SQ_TMPU\0"
+    "SQ_TOGG\0"
+    "TL_LOWR\0"
+    "TL_UPPR\0"
+    "UC_BSD\0"
+    "UC_EMAC\0"
+    "UC_LINX\0"
+    "UC_MAC\0"
+    "UC_NEXT\0"
+    "UC_PREV\0"
+    "UC_WIN\0"
+    "UC_WINC\0"
+    "UG_HUED\0"
+    "UG_HUEU\0"
+    "UG_NEXT\0"
+    "UG_PREV\0"
+    "UG_SATD\0"
+    "UG_SATU\0"
+    "UG_SPDD\0"
+    "UG_SPDU\0"
+    "UG_TOGG\0"
+    "UG_VALD\0"
+    "UG_VALU\0"
+    "VK_TOGG\0"
+    "XXXXXXX\0"
+    "_______\0"
+    "QK_BASIC\0"
+    "QK_MODS\0"
+    "QK_MOD_TAP\0"
+    "QK_LAYER_TAP\0"
+    "QK_LAYER_MOD\0"
+    "QK_TO\0"
+    "QK_MOMENTARY\0"
+    "QK_DEF_LAYER\0"
+    "QK_TOGGLE_LAYER\0"
+    "QK_ONE_SHOT_LAYER\0"
+    "QK_ONE_SHOT_MOD\0"
+    "QK_LAYER_TAP_TOGGLE\0"
+    "QK_PERSISTENT_DEF_LAYER\0"
+    "QK_SWAP_HANDS\0"
+    "QK_TAP_DANCE\0"
+    "QK_MAGIC\0"
+    "QK_MIDI\0"
+    "QK_SEQUENCER\0"
+    "QK_JOYSTICK\0"
+    "QK_PROGRAMMABLE_BUTTON\0"
+    "QK_AUDIO\0"
+    "QK_STENO\0"
+    "QK_MACRO\0"
+    "QK_CONNECTION\0"
+    "QK_LIGHTING\0"
+    "QK_QUANTUM\0"
+    "QK_KB\0"
+    "QK_USER\0"
+    "QK_UNICODEMAP\0"
+    "QK_UNICODEMAP_PAIR\0"
+;
+
+// Sorted by keycode
+static const keycode_string_entry_t keycode_string_by_code[] PROGMEM = {
+    {0x0000, 0},     // KC_NO
+    {0x0001, 6},     // KC_TRANSPARENT
+    {0x0004, 21},    // KC_A
+    {0x0005, 26},    // KC_B
+    {0x0006, 31},    // KC_C
+    {0x0007, 36},    // KC_D
+    {0x0008, 41},    // KC_E
+    {0x0009, 46},    // KC_F
+    {0x000A, 51},    // KC_G
+    {0x000B, 56},    // KC_H
+    {0x000C, 61},    // KC_I
+    {0x000D, 66},    // KC_J
+    {0x000E, 71},    // KC_K
+    {0x000F, 76},    // KC_L
+    {0x0010, 81},    // KC_M
+    {0x0011, 86},    // KC_N
+    {0x0012, 91},    // KC_O
+    {0x0013, 96},    // KC_P
+    {0x0014, 101},   // KC_Q
+    {0x0015, 106},   // KC_R
+    {0x0016, 111},   // KC_S
+    {0x0017, 116},   // KC_T
+    {0x0018, 121},   // KC_U
+    {0x0019, 126},   // KC_V
+    {0x001A, 131},   // KC_W
+    {0x001B, 136},   // KC_X
+    {0x001C, 141},   // KC_Y
+    {0x001D, 146},   // KC_Z
+    {0x001E, 151},   // KC_1
+    {0x001F, 156},   // KC_2
+    {0x0020, 161},   // KC_3
+    {0x0021, 166},   // KC_4
+    {0x0022, 171},   // KC_5
+    {0x0023, 176},   // KC_6
+    {0x0024, 181},   // KC_7
+    {0x0025, 186},   // KC_8
+    {0x0026, 191},   // KC_9
+    {0x0027, 196},   // KC_0
+    {0x0028, 201},   // KC_ENTER
+    {0x0029, 210},   // KC_ESCAPE
+    {0x002A, 220},   // KC_BACKSPACE
+    {0x002B, 233},   // KC_TAB
+    {0x002C, 240},   // KC_SPACE
+    {0x002D, 249},   // KC_MINUS
+    {0x002E, 258},   // KC_EQUAL
+    {0x002F, 267},   // KC_LEFT_BRACKET
+    {0x0030, 283},   // KC_RIGHT_BRACKET
+    {0x0031, 300},   // KC_BACKSLASH
+    {0x0032, 313},   // KC_NONUS_HASH
+    {0x0033, 327},   // KC_SEMICOLON
+    {0x0034, 340},   // KC_QUOTE
+    {0x0035, 349},   // KC_GRAVE
+    {0x0036, 358},   // KC_COMMA
+    {0x0037, 367},   // KC_DOT
+    {0x0038, 374},   // KC_SLASH
+    {0x0039, 383},   // KC_CAPS_LOCK
+    {0x003A, 396},   // KC_F1
+    {0x003B, 402},   // KC_F2
+    {0x003C, 408},   // KC_F3
+    {0x003D, 414},   // KC_F4
+    {0x003E, 420},   // KC_F5
+    {0x003F, 426},   // KC_F6
+    {0x0040, 432},   // KC_F7
+    {0x0041, 438},   // KC_F8
+    {0x0042, 444},   // KC_F9
+    {0x0043, 450},   // KC_F10
+    {0x0044, 457},   // KC_F11
+    {0x0045, 464},   // KC_F12
+    {0x0046, 471},   // KC_PRINT_SCREEN
+    {0x0047, 487},   // KC_SCROLL_LOCK
+    {0x0048, 502},   // KC_PAUSE
+    {0x0049, 511},   // KC_INSERT
+    {0x004A, 521},   // KC_HOME
+    {0x004B, 529},   // KC_PAGE_UP
+    {0x004C, 540},   // KC_DELETE
+    {0x004D, 550},   // KC_END
+    {0x004E, 557},   // KC_PAGE_DOWN
+    {0x004F, 570},   // KC_RIGHT
+    {0x0050, 579},   // KC_LEFT
+    {0x0051, 587},   // KC_DOWN
+    {0x0052, 595},   // KC_UP
+    {0x0053, 601},   // KC_NUM_LOCK
+    {0x0054, 613},   // KC_KP_SLASH
+    {0x0055, 625},   // KC_KP_ASTERISK
+    {0x0056, 640},   // KC_KP_MINUS
+    {0x0057, 652},   // KC_KP_PLUS
+    {0x0058, 663},   // KC_KP_ENTER
+    {0x0059, 675},   // KC_KP_1
+    {0x005A, 683},   // KC_KP_2
+    {0x005B, 691},   // KC_KP_3
+    {0x005C, 699},   // KC_KP_4
+    {0x005D, 707},   // KC_KP_5
+    {0x005E, 715},   // KC_KP_6
+    {0x005F, 723},   // KC_KP_7
+    {0x0060, 731},   // KC_KP_8
+    {0x0061, 739},   // KC_KP_9
+    {0x0062, 747},   // KC_KP_0
+    {0x0063, 755},   // KC_KP_DOT
+    {0x0064, 765},   // KC_NONUS_BACKSLASH
+    {0x0065, 784},   // KC_APPLICATION
+    {0x0066, 799},   // KC_KB_POWER
+    {0x0067, 811},   // KC_KP_EQUAL
+    {0x0068, 823},   // KC_F13
+    {0x0069, 830},   // KC_F14
+    {0x006A, 837},   // KC_F15
+    {0x006B, 844},   // KC_F16
+    {0x006C, 851},   // KC_F17
+    {0x006D, 858},   // KC_F18
+    {0x006E, 865},   // KC_F19
+    {0x006F, 872},   // KC_F20
+    {0x0070, 879},   // KC_F21
+    {0x0071, 886},   // KC_F22
+    {0x0072, 893},   // KC_F23
+    {0x0073, 900},   // KC_F24
+    {0x0074, 907},   // KC_EXECUTE
+    {0x0075, 918},   // KC_HELP
+    {0x0076, 926},   // KC_MENU
+    {0x0077, 934},   // KC_SELECT
+    {0x0078, 944},   // KC_STOP
+    {0x0079, 952},   // KC_AGAIN
+    {0x007A, 961},   // KC_UNDO
+    {0x007B, 969},   // KC_CUT
+    {0x007C, 976},   // KC_COPY
+    {0x007D, 984},   // KC_PASTE
+    {0x007E, 993},   // KC_FIND
+    {0x007F, 1001},  // KC_KB_MUTE
+    {0x0080, 1012},  // KC_KB_VOLUME_UP
+    {0x0081, 1028},  // KC_KB_VOLUME_DOWN
+    {0x0082, 1046},  // KC_LOCKING_CAPS_LOCK
+    {0x0083, 1067},  // KC_LOCKING_NUM_LOCK
+    {0x0084, 1087},  // KC_LOCKING_SCROLL_LOCK
+    {0x0085, 1110},  // KC_KP_COMMA
+    {0x0086, 1122},  // KC_KP_EQUAL_AS400
+    {0x0087, 1140},  // KC_INTERNATIONAL_1
+    {0x0088, 1159},  // KC_INTERNATIONAL_2
+    {0x0089, 1178},  // KC_INTERNATIONAL_3
+    {0x008A, 1197},  // KC_INTERNATIONAL_4
+    {0x008B, 1216},  // KC_INTERNATIONAL_5
+    {0x008C, 1235},  // KC_INTERNATIONAL_6
+    {0x008D, 1254},  // KC_INTERNATIONAL_7
+    {0x008E, 1273},  // KC_INTERNATIONAL_8
+    {0x008F, 1292},  // KC_INTERNATIONAL_9
+    {0x0090, 1311},  // KC_LANGUAGE_1
+    {0x0091, 1325},  // KC_LANGUAGE_2
+    {0x0092, 1339},  // KC_LANGUAGE_3
+    {0x0093, 1353},  // KC_LANGUAGE_4
+    {0x0094, 1367},  // KC_LANGUAGE_5
+    {0x0095, 1381},  // KC_LANGUAGE_6
+    {0x0096, 1395},  // KC_LANGUAGE_7
+    {0x0097, 1409},  // KC_LANGUAGE_8
+    {0x0098, 1423},  // KC_LANGUAGE_9
+    {0x0099, 1437},  // KC_ALTERNATE_ERASE
+    {0x009A, 1456},  // KC_SYSTEM_REQUEST
+    {0x009B, 1474},  // KC_CANCEL
+    {0x009C, 1484},  // KC_CLEAR
+    {0x009D, 1493},  // KC_PRIOR
+    {0x009E, 1502},  // KC_RETURN
+    {0x009F, 1512},  // KC_SEPARATOR
+    {0x00A0, 1525},  // KC_OUT
+    {0x00A1, 1532},  // KC_OPER
+    {0x00A2, 1540},  // KC_CLEAR_AGAIN
+    {0x00A3, 1555},  // KC_CRSEL
+    {0x00A4, 1564},  // KC_EXSEL
+    {0x00A5, 1573},  // KC_SYSTEM_POWER
+    {0x00A6, 1589},  // KC_SYSTEM_SLEEP
+    {0x00A7, 1605},  // KC_SYSTEM_WAKE
+    {0x00A8, 1620},  // KC_AUDIO_MUTE
+    {0x00A9, 1634},  // KC_AUDIO_VOL_UP
+    {0x00AA, 1650},  // KC_AUDIO_VOL_DOWN
+    {0x00AB, 1668},  // KC_MEDIA_NEXT_TRACK
+    {0x00AC, 1688},  // KC_MEDIA_PREV_TRACK
+    {0x00AD, 1708},  // KC_MEDIA_STOP
+    {0x00AE, 1722},  // KC_MEDIA_PLAY_PAUSE
+    {0x00AF, 1742},  // KC_MEDIA_SELECT
+    {0x00B0, 1758},  // KC_MEDIA_EJECT
+    {0x00B1, 1773},  // KC_MAIL
+    {0x00B2, 1781},  // KC_CALCULATOR
+    {0x00B3, 1795},  // KC_MY_COMPUTER
+    {0x00B4, 1810},  // KC_WWW_SEARCH
+    {0x00B5, 1824},  // KC_WWW_HOME
+    {0x00B6, 1836},  // KC_WWW_BACK
+    {0x00B7, 1848},  // KC_WWW_FORWARD
+    {0x00B8, 1863},  // KC_WWW_STOP
+    {0x00B9, 1875},  // KC_WWW_REFRESH
+    {0x00BA, 1890},  // KC_WWW_FAVORITES
+    {0x00BB, 1907},  // KC_MEDIA_FAST_FORWARD
+    {0x00BC, 1929},  // KC_MEDIA_REWIND
+    {0x00BD, 1945},  // KC_BRIGHTNESS_UP
+    {0x00BE, 1962},  // KC_BRIGHTNESS_DOWN
+    {0x00BF, 1981},  // KC_CONTROL_PANEL
+    {0x00C0, 1998},  // KC_ASSISTANT
+    {0x00C1, 2011},  // KC_MISSION_CONTROL
+    {0x00C2, 2030},  // KC_LAUNCHPAD
+    {0x00CD, 2043},  // QK_MOUSE_CURSOR_UP
+    {0x00CE, 2062},  // QK_MOUSE_CURSOR_DOWN
+    {0x00CF, 2083},  // QK_MOUSE_CURSOR_LEFT
+    {0x00D0, 2104},  // QK_MOUSE_CURSOR_RIGHT
+    {0x00D1, 2126},  // QK_MOUSE_BUTTON_1
+    {0x00D2, 2144},  // QK_MOUSE_BUTTON_2
+    {0x00D3, 2162},  // QK_MOUSE_BUTTON_3
+    {0x00D4, 2180},  // QK_MOUSE_BUTTON_4
+    {0x00D5, 2198},  // QK_MOUSE_BUTTON_5
+    {0x00D6, 2216},  // QK_MOUSE_BUTTON_6
+    {0x00D7, 2234},  // QK_MOUSE_BUTTON_7
+    {0x00D8, 2252},  // QK_MOUSE_BUTTON_8
+    {0x00D9, 2270},  // QK_MOUSE_WHEEL_UP
+    {0x00DA, 2288},  // QK_MOUSE_WHEEL_DOWN
+    {0x00DB, 2308},  // QK_MOUSE_WHEEL_LEFT
+    {0x00DC, 2328},  // QK_MOUSE_WHEEL_RIGHT
+    {0x00DD, 2349},  // QK_MOUSE_ACCELERATION_0
+    {0x00DE, 2373},  // QK_MOUSE_ACCELERATION_1
+    {0x00DF, 2397},  // QK_MOUSE_ACCELERATION_2
+    {0x00E0, 2421},  // KC_LEFT_CTRL
+    {0x00E1, 2434},  // KC_LEFT_SHIFT
+    {0x00E2, 2448},  // KC_LEFT_ALT
+    {0x00E3, 2460},  // KC_LEFT_GUI
+    {0x00E4, 2472},  // KC_RIGHT_CTRL
+    {0x00E5, 2486},  // KC_RIGHT_SHIFT
+    {0x00E6, 2501},  // KC_RIGHT_ALT
+    {0x00E7, 2514},  // KC_RIGHT_GUI
+    {0x56F0, 2527},  // QK_SWAP_HANDS_TOGGLE
+    {0x56F1, 2548},  // QK_SWAP_HANDS_TAP_TOGGLE
+    {0x56F2, 2573},  // QK_SWAP_HANDS_MOMENTARY_ON
+    {0x56F3, 2600},  // QK_SWAP_HANDS_MOMENTARY_OFF
+    {0x56F4, 2628},  // QK_SWAP_HANDS_OFF
+    {0x56F5, 2646},  // QK_SWAP_HANDS_ON
+    {0x56F6, 2663},  // QK_SWAP_HANDS_ONE_SHOT
+    {0x7000, 2686},  // QK_MAGIC_SWAP_CONTROL_CAPS_LOCK
+    {0x7001, 2718},  // QK_MAGIC_UNSWAP_CONTROL_CAPS_LOCK
+    {0x7002, 2752},  // QK_MAGIC_TOGGLE_CONTROL_CAPS_LOCK
+    {0x7003, 2786},  // QK_MAGIC_CAPS_LOCK_AS_CONTROL_OFF
+    {0x7004, 2820},  // QK_MAGIC_CAPS_LOCK_AS_CONTROL_ON
+    {0x7005, 2853},  // QK_MAGIC_SWAP_LALT_LGUI
+    {0x7006, 2877},  // QK_MAGIC_UNSWAP_LALT_LGUI
+    {0x7007, 2903},  // QK_MAGIC_SWAP_RALT_RGUI
+    {0x7008, 2927},  // QK_MAGIC_UNSWAP_RALT_RGUI
+    {0x7009, 2953},  // QK_MAGIC_GUI_ON
+    {0x700A, 2969},  // QK_MAGIC_GUI_OFF
+    {0x700B, 2986},  // QK_MAGIC_TOGGLE_GUI
+    {0x700C, 3006},  // QK_MAGIC_SWAP_GRAVE_ESC
+    {0x700D, 3030},  // QK_MAGIC_UNSWAP_GRAVE_ESC
+    {0x700E, 3056},  // QK_MAGIC_SWAP_BACKSLASH_BACKSPACE
+    {0x700F, 3090},  // QK_MAGIC_UNSWAP_BACKSLASH_BACKSPACE
+    {0x7010, 3126},  // QK_MAGIC_TOGGLE_BACKSLASH_BACKSPACE
+    {0x7011, 3162},  // QK_MAGIC_NKRO_ON
+    {0x7012, 3179},  // QK_MAGIC_NKRO_OFF
+    {0x7013, 3197},  // QK_MAGIC_TOGGLE_NKRO
+    {0x7014, 3218},  // QK_MAGIC_SWAP_ALT_GUI
+    {0x7015, 3240},  // QK_MAGIC_UNSWAP_ALT_GUI
+    {0x7016, 3264},  // QK_MAGIC_TOGGLE_ALT_GUI
+    {0x7017, 3288},  // QK_MAGIC_SWAP_LCTL_LGUI
+    {0x7018, 3312},  // QK_MAGIC_UNSWAP_LCTL_LGUI
+    {0x7019, 3338},  // QK_MAGIC_SWAP_RCTL_RGUI
+    {0x701A, 3362},  // QK_MAGIC_UNSWAP_RCTL_RGUI
+    {0x701B, 3388},  // QK_MAGIC_SWAP_CTL_GUI
+    {0x701C, 3410},  // QK_MAGIC_UNSWAP_CTL_GUI
+    {0x701D, 3434},  // QK_MAGIC_TOGGLE_CTL_GUI
+    {0x701E, 3458},  // QK_MAGIC_EE_HANDS_LEFT
+    {0x701F, 3481},  // QK_MAGIC_EE_HANDS_RIGHT
+    {0x7020, 3505},  // QK_MAGIC_SWAP_ESCAPE_CAPS_LOCK
+    {0x7021, 3536},  // QK_MAGIC_UNSWAP_ESCAPE_CAPS_LOCK
+    {0x7022, 3569},  // QK_MAGIC_TOGGLE_ESCAPE_CAPS_LOCK
+    {0x7100, 3602},  // QK_MIDI_ON
+    {0x7101, 3613},  // QK_MIDI_OFF
+    {0x7102, 3625},  // QK_MIDI_TOGGLE
+    {0x7103, 3640},  // QK_MIDI_NOTE_C_0
+    {0x7104, 3657},  // QK_MIDI_NOTE_C_SHARP_0
+    {0x7105, 3680},  // QK_MIDI_NOTE_D_0
+    {0x7106, 3697},  // QK_MIDI_NOTE_D_SHARP_0
+    {0x7107, 3720},  // QK_MIDI_NOTE_E_0
+    {0x7108, 3737},  // QK_MIDI_NOTE_F_0
+    {0x7109, 3754},  // QK_MIDI_NOTE_F_SHARP_0
+    {0x710A, 3777},  // QK_MIDI_NOTE_G_0
+    {0x710B, 3794},  // QK_MIDI_NOTE_G_SHARP_0
+    {0x710C, 3817},  // QK_MIDI_NOTE_A_0
+    {0x710D, 3834},  // QK_MIDI_NOTE_A_SHARP_0
+    {0x710E, 3857},  // QK_MIDI_NOTE_B_0
+    {0x710F, 3874},  // QK_MIDI_NOTE_C_1
+    {0x7110, 3891},  // QK_MIDI_NOTE_C_SHARP_1
+    {0x7111, 3914},  // QK_MIDI_NOTE_D_1
+    {0x7112, 3931},  // QK_MIDI_NOTE_D_SHARP_1
+    {0x7113, 3954},  // QK_MIDI_NOTE_E_1
+    {0x7114, 3971},  // QK_MIDI_NOTE_F_1
+    {0x7115, 3988},  // QK_MIDI_NOTE_F_SHARP_1
+    {0x7116, 4011},  // QK_MIDI_NOTE_G_1
+    {0x7117, 4028},  // QK_MIDI_NOTE_G_SHARP_1
+    {0x7118, 4051},  // QK_MIDI_NOTE_A_1
+    {0x7119, 4068},  // QK_MIDI_NOTE_A_SHARP_1
+    {0x711A, 4091},  // QK_MIDI_NOTE_B_1
+    {0x711B, 4108},  // QK_MIDI_NOTE_C_2
+    {0x711C, 4125},  // QK_MIDI_NOTE_C_SHARP_2
+    {0x711D, 4148},  // QK_MIDI_NOTE_D_2
+    {0x711E, 4165},  // QK_MIDI_NOTE_D_SHARP_2
+    {0x711F, 4188},  // QK_MIDI_NOTE_E_2
+    {0x7120, 4205},  // QK_MIDI_NOTE_F_2
+    {0x7121, 4222},  // QK_MIDI_NOTE_F_SHARP_2
+    {0x7122, 4245},  // QK_MIDI_NOTE_G_2
+    {0x7123, 4262},  // QK_MIDI_NOTE_G_SHARP_2
+    {0x7124, 4285},  // QK_MIDI_NOTE_A_2
+    {0x7125, 4302},  // QK_MIDI_NOTE_A_SHARP_2
+    {0x7126, 4325},  // QK_MIDI_NOTE_B_2
+    {0x7127, 4342},  // QK_MIDI_NOTE_C_3
+    {0x7128, 4359},  // QK_MIDI_NOTE_C_SHARP_3
+    {0x7129, 4382},  // QK_MIDI_NOTE_D_3
+    {0x712A, 4399},  // QK_MIDI_NOTE_D_SHARP_3
+    {0x712B, 4422},  // QK_MIDI_NOTE_E_3
+    {0x712C, 4439},  // QK_MIDI_NOTE_F_3
+    {0x712D, 4456},  // QK_MIDI_NOTE_F_SHARP_3
+    {0x712E, 4479},  // QK_MIDI_NOTE_G_3
+    {0x712F, 4496},  // QK_MIDI_NOTE_G_SHARP_3
+    {0x7130, 4519},  // QK_MIDI_NOTE_A_3
+    {0x7131, 4536},  // QK_MIDI_NOTE_A_SHARP_3
+    {0x7132, 4559},  // QK_MIDI_NOTE_B_3
+    {0x7133, 4576},  // QK_MIDI_NOTE_C_4
+    {0x7134, 4593},  // QK_MIDI_NOTE_C_SHARP_4
+    {0x7135, 4616},  // QK_MIDI_NOTE_D_4
+    {0x7136, 4633},  // QK_MIDI_NOTE_D_SHARP_4
+    {0x7137, 4656},  // QK_MIDI_NOTE_E_4
+    {0x7138, 4673},  // QK_MIDI_NOTE_F_4
+    {0x7139, 4690},  // QK_MIDI_NOTE_F_SHARP_4
+    {0x713A, 4713},  // QK_MIDI_NOTE_G_4
+    {0x713B, 4730},  // QK_MIDI_NOTE_G_SHARP_4
+    {0x713C, 4753},  // QK_MIDI_NOTE_A_4
+    {0x713D, 4770},  // QK_MIDI_NOTE_A_SHARP_4
+    {0x713E, 4793},  // QK_MIDI_NOTE_B_4
+    {0x713F, 4810},  // QK_MIDI_NOTE_C_5
+    {0x7140, 4827},  // QK_MIDI_NOTE_C_SHARP_5
+    {0x7141, 4850},  // QK_MIDI_NOTE_D_5
+    {0x7142, 4867},  // QK_MIDI_NOTE_D_SHARP_5
+    {0x7143, 4890},  // QK_MIDI_NOTE_E_5
+    {0x7144, 4907},  // QK_MIDI_NOTE_F_5
+    {0x7145, 4924},  // QK_MIDI_NOTE_F_SHARP_5
+    {0x7146, 4947},  // QK_MIDI_NOTE_G_5
+    {0x7147, 4964},  // QK_MIDI_NOTE_G_SHARP_5
+    {0x7148, 4987},  // QK_MIDI_NOTE_A_5
+    {0x7149, 5004},  // QK_MIDI_NOTE_A_SHARP_5
+    {0x714A, 5027},  // QK_MIDI_NOTE_B_5
+    {0x714B, 5044},  // QK_MIDI_OCTAVE_N2
+    {0x714C, 5062},  // QK_MIDI_OCTAVE_N1
+    {0x714D, 5080},  // QK_MIDI_OCTAVE_0
+    {0x714E, 5097},  // QK_MIDI_OCTAVE_1
+    {0x714F, 5114},  // QK_MIDI_OCTAVE_2
+    {0x7150, 5131},  // QK_MIDI_OCTAVE_3
+    {0x7151, 5148},  // QK_MIDI_OCTAVE_4
+    {0x7152, 5165},  // QK_MIDI_OCTAVE_5
+    {0x7153, 5182},  // QK_MIDI_OCTAVE_6
+    {0x7154, 5199},  // QK_MIDI_OCTAVE_7
+    {0x7155, 5216},  // QK_MIDI_OCTAVE_DOWN
+    {0x7156, 5236},  // QK_MIDI_OCTAVE_UP
+    {0x7157, 5254},  // QK_MIDI_TRANSPOSE_N6
+    {0x7158, 5275},  // QK_MIDI_TRANSPOSE_N5
+    {0x7159, 5296},  // QK_MIDI_TRANSPOSE_N4
+    {0x715A, 5317},  // QK_MIDI_TRANSPOSE_N3
+    {0x715B, 5338},  // QK_MIDI_TRANSPOSE_N2
+    {0x715C, 5359},  // QK_MIDI_TRANSPOSE_N1
+    {0x715D, 5380},  // QK_MIDI_TRANSPOSE_0
+    {0x715E, 5400},  // QK_MIDI_TRANSPOSE_1
+    {0x715F, 5420},  // QK_MIDI_TRANSPOSE_2
+    {0x7160, 5440},  // QK_MIDI_TRANSPOSE_3
+    {0x7161, 5460},  // QK_MIDI_TRANSPOSE_4
+    {0x7162, 5480},  // QK_MIDI_TRANSPOSE_5
+    {0x7163, 5500},  // QK_MIDI_TRANSPOSE_6
+    {0x7164, 5520},  // QK_MIDI_TRANSPOSE_DOWN
+    {0x7165, 5543},  // QK_MIDI_TRANSPOSE_UP
+    {0x7166, 5564},  // QK_MIDI_VELOCITY_0
+    {0x7167, 5583},  // QK_MIDI_VELOCITY_1
+    {0x7168, 5602},  // QK_MIDI_VELOCITY_2
+    {0x7169, 5621},  // QK_MIDI_VELOCITY_3
+    {0x716A, 5640},  // QK_MIDI_VELOCITY_4
+    {0x716B, 5659},  // QK_MIDI_VELOCITY_5
+    {0x716C, 5678},  // QK_MIDI_VELOCITY_6
+    {0x716D, 5697},  // QK_MIDI_VELOCITY_7
+    {0x716E, 5716},  // QK_MIDI_VELOCITY_8
+    {0x716F, 5735},  // QK_MIDI_VELOCITY_9
+    {0x7170, 5754},  // QK_MIDI_VELOCITY_10
+    {0x7171, 5774},  // QK_MIDI_VELOCITY_DOWN
+    {0x7172, 5796},  // QK_MIDI_VELOCITY_UP
+    {0x7173, 5816},  // QK_MIDI_CHANNEL_1
+    {0x7174, 5834},  // QK_MIDI_CHANNEL_2
+    {0x7175, 5852},  // QK_MIDI_CHANNEL_3
+    {0x7176, 5870},  // QK_MIDI_CHANNEL_4
+    {0x7177, 5888},  // QK_MIDI_CHANNEL_5
+    {0x7178, 5906},  // QK_MIDI_CHANNEL_6
+    {0x7179, 5924},  // QK_MIDI_CHANNEL_7
+    {0x717A, 5942},  // QK_MIDI_CHANNEL_8
+    {0x717B, 5960},  // QK_MIDI_CHANNEL_9
+    {0x717C, 5978},  // QK_MIDI_CHANNEL_10
+    {0x717D, 5997},  // QK_MIDI_CHANNEL_11
+    {0x717E, 6016},  // QK_MIDI_CHANNEL_12
+    {0x717F, 6035},  // QK_MIDI_CHANNEL_13
+    {0x7180, 6054},  // QK_MIDI_CHANNEL_14
+    {0x7181, 6073},  // QK_MIDI_CHANNEL_15
+    {0x7182, 6092},  // QK_MIDI_CHANNEL_16
+    {0x7183, 6111},  // QK_MIDI_CHANNEL_DOWN
+    {0x7184, 6132},  // QK_MIDI_CHANNEL_UP
+    {0x7185, 6151},  // QK_MIDI_ALL_NOTES_OFF
+    {0x7186, 6173},  // QK_MIDI_SUSTAIN
+    {0x7187, 6189},  // QK_MIDI_PORTAMENTO
+    {0x7188, 6208},  // QK_MIDI_SOSTENUTO
+    {0x7189, 6226},  // QK_MIDI_SOFT
+    {0x718A, 6239},  // QK_MIDI_LEGATO
+    {0x718B, 6254},  // QK_MIDI_MODULATION
+    {0x718C, 6273},  // QK_MIDI_MODULATION_SPEED_DOWN
+    {0x718D, 6303},  // QK_MIDI_MODULATION_SPEED_UP
+    {0x718E, 6331},  // QK_MIDI_PITCH_BEND_DOWN
+    {0x718F, 6355},  // QK_MIDI_PITCH_BEND_UP
+    {0x7200, 6377},  // QK_SEQUENCER_ON
+    {0x7201, 6393},  // QK_SEQUENCER_OFF
+    {0x7202, 6410},  // QK_SEQUENCER_TOGGLE
+    {0x7203, 6430},  // QK_SEQUENCER_TEMPO_DOWN
+    {0x7204, 6454},  // QK_SEQUENCER_TEMPO_UP
+    {0x7205, 6476},  // QK_SEQUENCER_RESOLUTION_DOWN
+    {0x7206, 6505},  // QK_SEQUENCER_RESOLUTION_UP
+    {0x7207, 6532},  // QK_SEQUENCER_STEPS_ALL
+    {0x7208, 6555},  // QK_SEQUENCER_STEPS_CLEAR
+    {0x7400, 6580},  // QK_JOYSTICK_BUTTON_0
+    {0x7401, 6601},  // QK_JOYSTICK_BUTTON_1
+    {0x7402, 6622},  // QK_JOYSTICK_BUTTON_2
+    {0x7403, 6643},  // QK_JOYSTICK_BUTTON_3
+    {0x7404, 6664},  // QK_JOYSTICK_BUTTON_4
+    {0x7405, 6685},  // QK_JOYSTICK_BUTTON_5
+    {0x7406, 6706},  // QK_JOYSTICK_BUTTON_6
+    {0x7407, 6727},  // QK_JOYSTICK_BUTTON_7
+    {0x7408, 6748},  // QK_JOYSTICK_BUTTON_8
+    {0x7409, 6769},  // QK_JOYSTICK_BUTTON_9
+    {0x740A, 6790},  // QK_JOYSTICK_BUTTON_10
+    {0x740B, 6812},  // QK_JOYSTICK_BUTTON_11
+    {0x740C, 6834},  // QK_JOYSTICK_BUTTON_12
+    {0x740D, 6856},  // QK_JOYSTICK_BUTTON_13
+    {0x740E, 6878},  // QK_JOYSTICK_BUTTON_14
+    {0x740F, 6900},  // QK_JOYSTICK_BUTTON_15
+    {0x7410, 6922},  // QK_JOYSTICK_BUTTON_16
+    {0x7411, 6944},  // QK_JOYSTICK_BUTTON_17
+    {0x7412, 6966},  // QK_JOYSTICK_BUTTON_18
+    {0x7413, 6988},  // QK_JOYSTICK_BUTTON_19
+    {0x7414, 7010},  // QK_JOYSTICK_BUTTON_20
+    {0x7415, 7032},  // QK_JOYSTICK_BUTTON_21
+    {0x7416, 7054},  // QK_JOYSTICK_BUTTON_22
+    {0x7417, 7076},  // QK_JOYSTICK_BUTTON_23
+    {0x7418, 7098},  // QK_JOYSTICK_BUTTON_24
+    {0x7419, 7120},  // QK_JOYSTICK_BUTTON_25
+    {0x741A, 7142},  // QK_JOYSTICK_BUTTON_26
+    {0x741B, 7164},  // QK_JOYSTICK_BUTTON_27
+    {0x741C, 7186},  // QK_JOYSTICK_BUTTON_28
+    {0x741D, 7208},  // QK_JOYSTICK_BUTTON_29
+    {0x741E, 7230},  // QK_JOYSTICK_BUTTON_30
+    {0x741F, 7252},  // QK_JOYSTICK_BUTTON_31
+    {0x7440, 7274},  // QK_PROGRAMMABLE_BUTTON_1
+    {0x7441, 7299},  // QK_PROGRAMMABLE_BUTTON_2
+    {0x7442, 7324},  // QK_PROGRAMMABLE_BUTTON_3
+    {0x7443, 7349},  // QK_PROGRAMMABLE_BUTTON_4
+    {0x7444, 7374},  // QK_PROGRAMMABLE_BUTTON_5
+    {0x7445, 7399},  // QK_PROGRAMMABLE_BUTTON_6
+    {0x7446, 7424},  // QK_PROGRAMMABLE_BUTTON_7
+    {0x7447, 7449},  // QK_PROGRAMMABLE_BUTTON_8
+    {0x7448, 7474},  // QK_PROGRAMMABLE_BUTTON_9
+    {0x7449, 7499},  // QK_PROGRAMMABLE_BUTTON_10
+    {0x744A, 7525},  // QK_PROGRAMMABLE_BUTTON_11
+    {0x744B, 7551},  // QK_PROGRAMMABLE_BUTTON_12
+    {0x744C, 7577},  // QK_PROGRAMMABLE_BUTTON_13
+    {0x744D, 7603},  // QK_PROGRAMMABLE_BUTTON_14
+    {0x744E, 7629},  // QK_PROGRAMMABLE_BUTTON_15
+    {0x744F, 7655},  // QK_PROGRAMMABLE_BUTTON_16
+    {0x7450, 7681},  // QK_PROGRAMMABLE_BUTTON_17
+    {0x7451, 7707},  // QK_PROGRAMMABLE_BUTTON_18
+    {0x7452, 7733},  // QK_PROGRAMMABLE_BUTTON_19
+    {0x7453, 7759},  // QK_PROGRAMMABLE_BUTTON_20
+    {0x7454, 7785},  // QK_PROGRAMMABLE_BUTTON_21
+    {0x7455, 7811},  // QK_PROGRAMMABLE_BUTTON_22
+    {0x7456, 7837},  // QK_PROGRAMMABLE_BUTTON_23
+    {0x7457, 7863},  // QK_PROGRAMMABLE_BUTTON_24
+    {0x7458, 7889},  // QK_PROGRAMMABLE_BUTTON_25
+    {0x7459, 7915},  // QK_PROGRAMMABLE_BUTTON_26
+    {0x745A, 7941},  // QK_PROGRAMMABLE_BUTTON_27
+    {0x745B, 7967},  // QK_PROGRAMMABLE_BUTTON_28
+    {0x745C, 7993},  // QK_PROGRAMMABLE_BUTTON_29
+    {0x745D, 8019},  // QK_PROGRAMMABLE_BUTTON_30
+    {0x745E, 8045},  // QK_PROGRAMMABLE_BUTTON_31
+    {0x745F, 8071},  // QK_PROGRAMMABLE_BUTTON_32
+    {0x7480, 8097},  // QK_AUDIO_ON
+    {0x7481, 8109},  // QK_AUDIO_OFF
+    {0x7482, 8122},  // QK_AUDIO_TOGGLE
+    {0x748A, 8138},  // QK_AUDIO_CLICKY_TOGGLE
+    {0x748B, 8161},  // QK_AUDIO_CLICKY_ON
+    {0x748C, 8180},  // QK_AUDIO_CLICKY_OFF
+    {0x748D, 8200},  // QK_AUDIO_CLICKY_UP
+    {0x748E, 8219},  // QK_AUDIO_CLICKY_DOWN
+    {0x748F, 8240},  // QK_AUDIO_CLICKY_RESET
+    {0x7490, 8262},  // QK_MUSIC_ON
+    {0x7491, 8274},  // QK_MUSIC_OFF
+    {0x7492, 8287},  // QK_MUSIC_TOGGLE
+    {0x7493, 8303},  // QK_MUSIC_MODE_NEXT
+    {0x7494, 8322},  // QK_AUDIO_VOICE_NEXT
+    {0x7495, 8342},  // QK_AUDIO_VOICE_PREVIOUS
+    {0x74F0, 8366},  // QK_STENO_BOLT
+    {0x74F1, 8380},  // QK_STENO_GEMINI
+    {0x74F2, 8396},  // QK_STENO_COMB
+    {0x74FC, 8410},  // QK_STENO_COMB_MAX
+    {0x7700, 8428},  // QK_MACRO_0
+    {0x7701, 8439},  // QK_MACRO_1
+    {0x7702, 8450},  // QK_MACRO_2
+    {0x7703, 8461},  // QK_MACRO_3
+    {0x7704, 8472},  // QK_MACRO_4
+    {0x7705, 8483},  // QK_MACRO_5
+    {0x7706, 8494},  // QK_MACRO_6
+    {0x7707, 8505},  // QK_MACRO_7
+    {0x7708, 8516},  // QK_MACRO_8
+    {0x7709, 8527},  // QK_MACRO_9
+    {0x770A, 8538},  // QK_MACRO_10
+    {0x770B, 8550},  // QK_MACRO_11
+    {0x770C, 8562},  // QK_MACRO_12
+    {0x770D, 8574},  // QK_MACRO_13
+    {0x770E, 8586},  // QK_MACRO_14
+    {0x770F, 8598},  // QK_MACRO_15
+    {0x7710, 8610},  // QK_MACRO_16
+    {0x7711, 8622},  // QK_MACRO_17
+    {0x7712, 8634},  // QK_MACRO_18
+    {0x7713, 8646},  // QK_MACRO_19
+    {0x7714, 8658},  // QK_MACRO_20
+    {0x7715, 8670},  // QK_MACRO_21
+    {0x7716, 8682},  // QK_MACRO_22
+    {0x7717, 8694},  // QK_MACRO_23
+    {0x7718, 8706},  // QK_MACRO_24
+    {0x7719, 8718},  // QK_MACRO_25
+    {0x771A, 8730},  // QK_MACRO_26
+    {0x771B, 8742},  // QK_MACRO_27
+    {0x771C, 8754},  // QK_MACRO_28
+    {0x771D, 8766},  // QK_MACRO_29
+    {0x771E, 8778},  // QK_MACRO_30
+    {0x771F, 8790},  // QK_MACRO_31
+    {0x7780, 8802},  // QK_OUTPUT_AUTO
+    {0x7781, 8817},  // QK_OUTPUT_NEXT
+    {0x7782, 8832},  // QK_OUTPUT_PREV
+    {0x7783, 8847},  // QK_OUTPUT_NONE
+    {0x7784, 8862},  // QK_OUTPUT_USB
+    {0x7785, 8876},  // QK_OUTPUT_2P4GHZ
+    {0x7786, 8893},  // QK_OUTPUT_BLUETOOTH
+    {0x7790, 8913},  // QK_BLUETOOTH_PROFILE_NEXT
+    {0x7791, 8939},  // QK_BLUETOOTH_PROFILE_PREV
+    {0x7792, 8965},  // QK_BLUETOOTH_UNPAIR
+    {0x7793, 8985},  // QK_BLUETOOTH_PROFILE1
+    {0x7794, 9007},  // QK_BLUETOOTH_PROFILE2
+    {0x7795, 9029},  // QK_BLUETOOTH_PROFILE3
+    {0x7796, 9051},  // QK_BLUETOOTH_PROFILE4
+    {0x7797, 9073},  // QK_BLUETOOTH_PROFILE5
+    {0x7800, 9095},  // QK_BACKLIGHT_ON
+    {0x7801, 9111},  // QK_BACKLIGHT_OFF
+    {0x7802, 9128},  // QK_BACKLIGHT_TOGGLE
+    {0x7803, 9148},  // QK_BACKLIGHT_DOWN
+    {0x7804, 9166},  // QK_BACKLIGHT_UP
+    {0x7805, 9182},  // QK_BACKLIGHT_STEP
+    {0x7806, 9200},  // QK_BACKLIGHT_TOGGLE_BREATHING
+    {0x7810, 9230},  // QK_LED_MATRIX_ON
+    {0x7811, 9247},  // QK_LED_MATRIX_OFF
+    {0x7812, 9265},  // QK_LED_MATRIX_TOGGLE
+    {0x7813, 9286},  // QK_LED_MATRIX_MODE_NEXT
+    {0x7814, 9310},  // QK_LED_MATRIX_MODE_PREVIOUS
+    {0x7815, 9338},  // QK_LED_MATRIX_BRIGHTNESS_UP
+    {0x7816, 9366},  // QK_LED_MATRIX_BRIGHTNESS_DOWN
+    {0x7817, 9396},  // QK_LED_MATRIX_SPEED_UP
+    {0x7818, 9419},  // QK_LED_MATRIX_SPEED_DOWN
+    {0x7820, 9444},  // QK_UNDERGLOW_TOGGLE
+    {0x7821, 9464},  // QK_UNDERGLOW_MODE_NEXT
+    {0x7822, 9487},  // QK_UNDERGLOW_MODE_PREVIOUS
+    {0x7823, 9514},  // QK_UNDERGLOW_HUE_UP
+    {0x7824, 9534},  // QK_UNDERGLOW_HUE_DOWN
+    {0x7825, 9556},  // QK_UNDERGLOW_SATURATION_UP
+    {0x7826, 9583},  // QK_UNDERGLOW_SATURATION_DOWN
+    {0x7827, 9612},  // QK_UNDERGLOW_VALUE_UP
+    {0x7828, 9634},  // QK_UNDERGLOW_VALUE_DOWN
+    {0x7829, 9658},  // QK_UNDERGLOW_SPEED_UP
+    {0x782A, 9680},  // QK_UNDERGLOW_SPEED_DOWN
+    {0x782B, 9704},  // RGB_MODE_PLAIN
+    {0x782C, 9719},  // RGB_MODE_BREATHE
+    {0x782D, 9736},  // RGB_MODE_RAINBOW
+    {0x782E, 9753},  // RGB_MODE_SWIRL
+    {0x782F, 9768},  // RGB_MODE_SNAKE
+    {0x7830, 9783},  // RGB_MODE_KNIGHT
+    {0x7831, 9799},  // RGB_MODE_XMAS
+    {0x7832, 9813},  // RGB_MODE_GRADIENT
+    {0x7833, 9831},  // RGB_MODE_RGBTEST
+    {0x7834, 9848},  // RGB_MODE_TWINKLE
+    {0x7840, 9865},  // QK_RGB_MATRIX_ON
+    {0x7841, 9882},  // QK_RGB_MATRIX_OFF
+    {0x7842, 9900},  // QK_RGB_MATRIX_TOGGLE
+    {0x7843, 9921},  // QK_RGB_MATRIX_MODE_NEXT
+    {0x7844, 9945},  // QK_RGB_MATRIX_MODE_PREVIOUS
+    {0x7845, 9973},  // QK_RGB_MATRIX_HUE_UP
+    {0x7846, 9994},  // QK_RGB_MATRIX_HUE_DOWN
+    {0x7847, 10017}, // QK_RGB_MATRIX_SATURATION_UP
+    {0x7848, 10045}, // QK_RGB_MATRIX_SATURATION_DOWN
+    {0x7849, 10075}, // QK_RGB_MATRIX_VALUE_UP
+    {0x784A, 10098}, // QK_RGB_MATRIX_VALUE_DOWN
+    {0x784B, 10123}, // QK_RGB_MATRIX_SPEED_UP
+    {0x784C, 10146}, // QK_RGB_MATRIX_SPEED_DOWN
+    {0x7C00, 10171}, // QK_BOOTLOADER
+    {0x7C01, 10185}, // QK_REBOOT
+    {0x7C02, 10195}, // QK_DEBUG_TOGGLE
+    {0x7C03, 10211}, // QK_CLEAR_EEPROM
+    {0x7C04, 10227}, // QK_MAKE
+    {0x7C10, 10235}, // QK_AUTO_SHIFT_DOWN
+    {0x7C11, 10254}, // QK_AUTO_SHIFT_UP
+    {0x7C12, 10271}, // QK_AUTO_SHIFT_REPORT
+    {0x7C13, 10292}, // QK_AUTO_SHIFT_ON
+    {0x7C14, 10309}, // QK_AUTO_SHIFT_OFF
+    {0x7C15, 10327}, // QK_AUTO_SHIFT_TOGGLE
+    {0x7C16, 10348}, // QK_GRAVE_ESCAPE
+    {0x7C17, 10364}, // QK_VELOCIKEY_TOGGLE
+    {0x7C18, 10384}, // QK_SPACE_CADET_LEFT_CTRL_PARENTHESIS_OPEN
+    {0x7C19, 10426}, // QK_SPACE_CADET_RIGHT_CTRL_PARENTHESIS_CLOSE
+    {0x7C1A, 10470}, // QK_SPACE_CADET_LEFT_SHIFT_PARENTHESIS_OPEN
+    {0x7C1B, 10513}, // QK_SPACE_CADET_RIGHT_SHIFT_PARENTHESIS_CLOSE
+    {0x7C1C, 10558}, // QK_SPACE_CADET_LEFT_ALT_PARENTHESIS_OPEN
+    {0x7C1D, 10599}, // QK_SPACE_CADET_RIGHT_ALT_PARENTHESIS_CLOSE
+    {0x7C1E, 10642}, // QK_SPACE_CADET_RIGHT_SHIFT_ENTER
+    {0x7C30, 10675}, // QK_UNICODE_MODE_NEXT
+    {0x7C31, 10696}, // QK_UNICODE_MODE_PREVIOUS
+    {0x7C32, 10721}, // QK_UNICODE_MODE_MACOS
+    {0x7C33, 10743}, // QK_UNICODE_MODE_LINUX
+    {0x7C34, 10765}, // QK_UNICODE_MODE_WINDOWS
+    {0x7C35, 10789}, // QK_UNICODE_MODE_BSD
+    {0x7C36, 10809}, // QK_UNICODE_MODE_WINCOMPOSE
+    {0x7C37, 10836}, // QK_UNICODE_MODE_EMACS
+    {0x7C40, 10858}, // QK_HAPTIC_ON
+    {0x7C41, 10871}, // QK_HAPTIC_OFF
+    {0x7C42, 10885}, // QK_HAPTIC_TOGGLE
+    {0x7C43, 10902}, // QK_HAPTIC_RESET
+    {0x7C44, 10918}, // QK_HAPTIC_FEEDBACK_TOGGLE
+    {0x7C45, 10944}, // QK_HAPTIC_BUZZ_TOGGLE
+    {0x7C46, 10966}, // QK_HAPTIC_MODE_NEXT
+    {0x7C47, 10986}, // QK_HAPTIC_MODE_PREVIOUS
+    {0x7C48, 11010}, // QK_HAPTIC_CONTINUOUS_TOGGLE
+    {0x7C49, 11038}, // QK_HAPTIC_CONTINUOUS_UP
+    {0x7C4A, 11062}, // QK_HAPTIC_CONTINUOUS_DOWN
+    {0x7C4B, 11088}, // QK_HAPTIC_DWELL_UP
+    {0x7C4C, 11107}, // QK_HAPTIC_DWELL_DOWN
+    {0x7C50, 11128}, // QK_COMBO_ON
+    {0x7C51, 11140}, // QK_COMBO_OFF
+    {0x7C52, 11153}, // QK_COMBO_TOGGLE
+    {0x7C53, 11169}, // QK_DYNAMIC_MACRO_RECORD_START_1
+    {0x7C54, 11201}, // QK_DYNAMIC_MACRO_RECORD_START_2
+    {0x7C55, 11233}, // QK_DYNAMIC_MACRO_RECORD_STOP
+    {0x7C56, 11262}, // QK_DYNAMIC_MACRO_PLAY_1
+    {0x7C57, 11286}, // QK_DYNAMIC_MACRO_PLAY_2
+    {0x7C58, 11310}, // QK_LEADER
+    {0x7C59, 11320}, // QK_LOCK
+    {0x7C5A, 11328}, // QK_ONE_SHOT_ON
+    {0x7C5B, 11343}, // QK_ONE_SHOT_OFF
+    {0x7C5C, 11359}, // QK_ONE_SHOT_TOGGLE
+    {0x7C5D, 11378}, // QK_KEY_OVERRIDE_TOGGLE
+    {0x7C5E, 11401}, // QK_KEY_OVERRIDE_ON
+    {0x7C5F, 11420}, // QK_KEY_OVERRIDE_OFF
+    {0x7C60, 11440}, // QK_SECURE_LOCK
+    {0x7C61, 11455}, // QK_SECURE_UNLOCK
+    {0x7C62, 11472}, // QK_SECURE_TOGGLE
+    {0x7C63, 11489}, // QK_SECURE_REQUEST
+    {0x7C70, 11507}, // QK_DYNAMIC_TAPPING_TERM_PRINT
+    {0x7C71, 11537}, // QK_DYNAMIC_TAPPING_TERM_UP
+    {0x7C72, 11564}, // QK_DYNAMIC_TAPPING_TERM_DOWN
+    {0x7C73, 11593}, // QK_CAPS_WORD_TOGGLE
+    {0x7C74, 11613}, // QK_AUTOCORRECT_ON
+    {0x7C75, 11631}, // QK_AUTOCORRECT_OFF
+    {0x7C76, 11650}, // QK_AUTOCORRECT_TOGGLE
+    {0x7C77, 11672}, // QK_TRI_LAYER_LOWER
+    {0x7C78, 11691}, // QK_TRI_LAYER_UPPER
+    {0x7C79, 11710}, // QK_REPEAT_KEY
+    {0x7C7A, 11724}, // QK_ALT_REPEAT_KEY
+    {0x7C7B, 11742}, // QK_LAYER_LOCK
+    {0x7E00, 11756}, // QK_KB_0
+    {0x7E01, 11764}, // QK_KB_1
+    {0x7E02, 11772}, // QK_KB_2
+    {0x7E03, 11780}, // QK_KB_3
+    {0x7E04, 11788}, // QK_KB_4
+    {0x7E05, 11796}, // QK_KB_5
+    {0x7E06, 11804}, // QK_KB_6
+    {0x7E07, 11812}, // QK_KB_7
+    {0x7E08, 11820}, // QK_KB_8
+    {0x7E09, 11828}, // QK_KB_9
+    {0x7E0A, 11836}, // QK_KB_10
+    {0x7E0B, 11845}, // QK_KB_11
+    {0x7E0C, 11854}, // QK_KB_12
+    {0x7E0D, 11863}, // QK_KB_13
+    {0x7E0E, 11872}, // QK_KB_14
+    {0x7E0F, 11881}, // QK_KB_15
+    {0x7E10, 11890}, // QK_KB_16
+    {0x7E11, 11899}, // QK_KB_17
+    {0x7E12, 11908}, // QK_KB_18
+    {0x7E13, 11917}, // QK_KB_19
+    {0x7E14, 11926}, // QK_KB_20
+    {0x7E15, 11935}, // QK_KB_21
+    {0x7E16, 11944}, // QK_KB_22
+    {0x7E17, 11953}, // QK_KB_23
+    {0x7E18, 11962}, // QK_KB_24
+    {0x7E19, 11971}, // QK_KB_25
+    {0x7E1A, 11980}, // QK_KB_26
+    {0x7E1B, 11989}, // QK_KB_27
+    {0x7E1C, 11998}, // QK_KB_28
+    {0x7E1D, 12007}, // QK_KB_29
+    {0x7E1E, 12016}, // QK_KB_30
+    {0x7E1F, 12025}, // QK_KB_31
+    {0x7E40, 12034}, // QK_USER_0
+    {0x7E41, 12044}, // QK_USER_1
+    {0x7E42, 12054}, // QK_USER_2
+    {0x7E43, 12064}, // QK_USER_3
+    {0x7E44, 12074}, // QK_USER_4
+    {0x7E45, 12084}, // QK_USER_5
+    {0x7E46, 12094}, // QK_USER_6
+    {0x7E47, 12104}, // QK_USER_7
+    {0x7E48, 12114}, // QK_USER_8
+    {0x7E49, 12124}, // QK_USER_9
+    {0x7E4A, 12134}, // QK_USER_10
+    {0x7E4B, 12145}, // QK_USER_11
+    {0x7E4C, 12156}, // QK_USER_12
+    {0x7E4D, 12167}, // QK_USER_13
+    {0x7E4E, 12178}, // QK_USER_14
+    {0x7E4F, 12189}, // QK_USER_15
+    {0x7E50, 12200}, // QK_USER_16
+    {0x7E51, 12211}, // QK_USER_17
+    {0x7E52, 12222}, // QK_USER_18
+    {0x7E53, 12233}, // QK_USER_19
+    {0x7E54, 12244}, // QK_USER_20
+    {0x7E55, 12255}, // QK_USER_21
+    {0x7E56, 12266}, // QK_USER_22
+    {0x7E57, 12277}, // QK_USER_23
+    {0x7E58, 12288}, // QK_USER_24
+    {0x7E59, 12299}, // QK_USER_25
+    {0x7E5A, 12310}, // QK_USER_26
+    {0x7E5B, 12321}, // QK_USER_27
+    {0x7E5C, 12332}, // QK_USER_28
+    {0x7E5D, 12343}, // QK_USER_29
+    {0x7E5E, 12354}, // QK_USER_30
+    {0x7E5F, 12365}, // QK_USER_31
+};
+
+// Sorted by name in strcmp() order, including aliases
+static const keycode_string_entry_t keycode_string_by_name[] PROGMEM = {
+    {0x7C75, 12376}, // AC_OFF
+    {0x7C74, 12383}, // AC_ON
+    {0x7C76, 12389}, // AC_TOGG
+    {0x7006, 12397}, // AG_LNRM
+    {0x7005, 12405}, // AG_LSWP
+    {0x7015, 12413}, // AG_NORM
+    {0x7008, 12421}, // AG_RNRM
+    {0x7007, 12429}, // AG_RSWP
+    {0x7014, 12437}, // AG_SWAP
+    {0x7016, 12445}, // AG_TOGG
+    {0x7C10, 12453}, // AS_DOWN
+    {0x7C14, 12461}, // AS_OFF
+    {0x7C13, 12468}, // AS_ON
+    {0x7C12, 12474}, // AS_RPT
+    {0x7C15, 12481}, // AS_TOGG
+    {0x7C11, 12489}, // AS_UP
+    {0x7494, 12495}, // AU_NEXT
+    {0x7481, 12503}, // AU_OFF
+    {0x7480, 12510}, // AU_ON
+    {0x7495, 12516}, // AU_PREV
+    {0x7482, 12524}, // AU_TOGG
+    {0x7806, 12532}, // BL_BRTG
+    {0x7803, 12540}, // BL_DOWN
+    {0x7801, 12548}, // BL_OFF
+    {0x7800, 12555}, // BL_ON
+    {0x7805, 12561}, // BL_STEP
+    {0x7802, 12569}, // BL_TOGG
+    {0x7804, 12577}, // BL_UP
+    {0x700F, 12583}, // BS_NORM
+    {0x700E, 12591}, // BS_SWAP
+    {0x7010, 12599}, // BS_TOGG
+    {0x7790, 12607}, // BT_NEXT
+    {0x7791, 12615}, // BT_PREV
+    {0x7793, 12623}, // BT_PRF1
+    {0x7794, 12631}, // BT_PRF2
+    {0x7795, 12639}, // BT_PRF3
+    {0x7796, 12647}, // BT_PRF4
+    {0x7797, 12655}, // BT_PRF5
+    {0x7792, 12663}, // BT_UNPR
+    {0x7018, 12671}, // CG_LNRM
+    {0x7017, 12679}, // CG_LSWP
+    {0x701C, 12687}, // CG_NORM
+    {0x701A, 12695}, // CG_RNRM
+    {0x7019, 12703}, // CG_RSWP
+    {0x701B, 12711}, // CG_SWAP
+    {0x701D, 12719}, // CG_TOGG
+    {0x748E, 12727}, // CK_DOWN
+    {0x748C, 12735}, // CK_OFF
+    {0x748B, 12742}, // CK_ON
+    {0x748F, 12748}, // CK_RST
+    {0x748A, 12755}, // CK_TOGG
+    {0x748D, 12763}, // CK_UP
+    {0x7003, 12769}, // CL_CAPS
+    {0x7004, 12777}, // CL_CTRL
+    {0x7001, 12785}, // CL_NORM
+    {0x7000, 12793}, // CL_SWAP
+    {0x7002, 12801}, // CL_TOGG
+    {0x7C51, 12809}, // CM_OFF
+    {0x7C50, 12816}, // CM_ON
+    {0x7C52, 12822}, // CM_TOGG
+    {0x7C73, 12830}, // CW_TOGG
+    {0x7C02, 12838}, // DB_TOGG
+    {0x7C56, 12846}, // DM_PLY1
+    {0x7C57, 12854}, // DM_PLY2
+    {0x7C53, 12862}, // DM_REC1
+    {0x7C54, 12870}, // DM_REC2
+    {0x7C55, 12878}, // DM_RSTP
+    {0x7C72, 12886}, // DT_DOWN
+    {0x7C70, 12894}, // DT_PRNT
+    {0x7C71, 12902}, // DT_UP
+    {0x7021, 12908}, // EC_NORM
+    {0x7020, 12916}, // EC_SWAP
+    {0x7022, 12924}, // EC_TOGG
+    {0x7C03, 12932}, // EE_CLR
+    {0x701E, 12939}, // EH_LEFT
+    {0x701F, 12947}, // EH_RGHT
+    {0x700D, 12955}, // GE_NORM
+    {0x700C, 12963}, // GE_SWAP
+    {0x700A, 12971}, // GU_OFF
+    {0x7009, 12978}, // GU_ON
+    {0x700B, 12984}, // GU_TOGG
+    {0x7C45, 12992}, // HF_BUZZ
+    {0x7C4A, 13000}, // HF_COND
+    {0x7C48, 13008}, // HF_CONT
+    {0x7C49, 13016}, // HF_CONU
+    {0x7C4C, 13024}, // HF_DWLD
+    {0x7C4B, 13032}, // HF_DWLU
+    {0x7C44, 13040}, // HF_FDBK
+    {0x7C46, 13048}, // HF_NEXT
+    {0x7C41, 13056}, // HF_OFF
+    {0x7C40, 13063}, // HF_ON
+    {0x7C47, 13069}, // HF_PREV
+    {0x7C43, 13077}, // HF_RST
+    {0x7C42, 13084}, // HF_TOGG
+    {0x7400, 13092}, // JS_0
+    {0x7401, 13097}, // JS_1
+    {0x740A, 13102}, // JS_10
+    {0x740B, 13108}, // JS_11
+    {0x740C, 13114}, // JS_12
+    {0x740D, 13120}, // JS_13
+    {0x740E, 13126}, // JS_14
+    {0x740F, 13132}, // JS_15
+    {0x7410, 13138}, // JS_16
+    {0x7411, 13144}, // JS_17
+    {0x7412, 13150}, // JS_18
+    {0x7413, 13156}, // JS_19
+    {0x7402, 13162}, // JS_2
+    {0x7414, 13167}, // JS_20
+    {0x7415, 13173}, // JS_21
+    {0x7416, 13179}, // JS_22
+    {0x7417, 13185}, // JS_23
+    {0x7418, 13191}, // JS_24
+    {0x7419, 13197}, // JS_25
+    {0x741A, 13203}, // JS_26
+    {0x741B, 13209}, // JS_27
+    {0x741C, 13215}, // JS_28
+    {0x741D, 13221}, // JS_29
+    {0x7403, 13227}, // JS_3
+    {0x741E, 13232}, // JS_30
+    {0x741F, 13238}, // JS_31
+    {0x7404, 13244}, // JS_4
+    {0x7405, 13249}, // JS_5
+    {0x7406, 13254}, // JS_6
+    {0x7407, 13259}, // JS_7
+    {0x7408, 13264}, // JS_8
+    {0x7409, 13269}, // JS_9
+    {0x0027, 196},   // KC_0
+    {0x001E, 151},   // KC_1
+    {0x001F, 156},   // KC_2
+    {0x0020, 161},   // KC_3
+    {0x0021, 166},   // KC_4
+    {0x0022, 171},   // KC_5
+    {0x0023, 176},   // KC_6
+    {0x0024, 181},   // KC_7
+    {0x0025, 186},   // KC_8
+    {0x0026, 191},   // KC_9
+    {0x0004, 21},    // KC_A
+    {0x0079, 952},   // KC_AGAIN
+    {0x0079, 13274}, // KC_AGIN
+    {0x00E6, 13282}, // KC_ALGR
+    {0x0099, 1437},  // KC_ALTERNATE_ERASE
+    {0x0065, 13290}, // KC_APP
+    {0x0065, 784},   // KC_APPLICATION
+    {0x00C0, 1998},  // KC_ASSISTANT
+    {0x00C0, 13297}, // KC_ASST
+    {0x00A8, 1620},  // KC_AUDIO_MUTE
+    {0x00AA, 1650},  // KC_AUDIO_VOL_DOWN
+    {0x00A9, 1634},  // KC_AUDIO_VOL_UP
+    {0x0005, 26},    // KC_B
+    {0x0031, 300},   // KC_BACKSLASH
+    {0x002A, 220},   // KC_BACKSPACE
+    {0x00BE, 13305}, // KC_BRID
+    {0x00BE, 1962},  // KC_BRIGHTNESS_DOWN
+    {0x00BD, 1945},  // KC_BRIGHTNESS_UP
+    {0x00BD, 13313}, // KC_BRIU
+    {0x0048, 13321}, // KC_BRK
+    {0x0047, 13328}, // KC_BRMD
+    {0x0048, 13336}, // KC_BRMU
+    {0x0031, 13344}, // KC_BSLS
+    {0x002A, 13352}, // KC_BSPC
+    {0x0006, 31},    // KC_C
+    {0x00B2, 13360}, // KC_CALC
+    {0x00B2, 1781},  // KC_CALCULATOR
+    {0x009B, 1474},  // KC_CANCEL
+    {0x0039, 13368}, // KC_CAPS
+    {0x0039, 383},   // KC_CAPS_LOCK
+    {0x00A2, 13376}, // KC_CLAG
+    {0x009C, 1484},  // KC_CLEAR
+    {0x00A2, 1540},  // KC_CLEAR_AGAIN
+    {0x009C, 13384}, // KC_CLR
+    {0x009B, 13391}, // KC_CNCL
+    {0x0036, 13399}, // KC_COMM
+    {0x0036, 358},   // KC_COMMA
+    {0x00BF, 1981},  // KC_CONTROL_PANEL
+    {0x007C, 976},   // KC_COPY
+    {0x00BF, 13407}, // KC_CPNL
+    {0x00A3, 1555},  // KC_CRSEL
+    {0x00A3, 13415}, // KC_CRSL
+    {0x007B, 969},   // KC_CUT
+    {0x0007, 36},    // KC_D
+    {0x004C, 13423}, // KC_DEL
+    {0x004C, 540},   // KC_DELETE
+    {0x0037, 367},   // KC_DOT
+    {0x0051, 587},   // KC_DOWN
+    {0x0008, 41},    // KC_E
+    {0x00B0, 13430}, // KC_EJCT
+    {0x004D, 550},   // KC_END
+    {0x0028, 13438}, // KC_ENT
+    {0x0028, 201},   // KC_ENTER
+    {0x002E, 13445}, // KC_EQL
+    {0x002E, 258},   // KC_EQUAL
+    {0x0099, 13452}, // KC_ERAS
+    {0x0029, 13460}, // KC_ESC
+    {0x0029, 210},   // KC_ESCAPE
+    {0x0074, 13467}, // KC_EXEC
+    {0x0074, 907},   // KC_EXECUTE
+    {0x00A4, 1564},  // KC_EXSEL
+    {0x00A4, 13475}, // KC_EXSL
+    {0x0009, 46},    // KC_F
+    {0x003A, 396},   // KC_F1
+    {0x0043, 450},   // KC_F10
+    {0x0044, 457},   // KC_F11
+    {0x0045, 464},   // KC_F12
+    {0x0068, 823},   // KC_F13
+    {0x0069, 830},   // KC_F14
+    {0x006A, 837},   // KC_F15
+    {0x006B, 844},   // KC_F16
+    {0x006C, 851},   // KC_F17
+    {0x006D, 858},   // KC_F18
+    {0x006E, 865},   // KC_F19
+    {0x003B, 402},   // KC_F2
+    {0x006F, 872},   // KC_F20
+    {0x0070, 879},   // KC_F21
+    {0x0071, 886},   // KC_F22
+    {0x0072, 893},   // KC_F23
+    {0x0073, 900},   // KC_F24
+    {0x003C, 408},   // KC_F3
+    {0x003D, 414},   // KC_F4
+    {0x003E, 420},   // KC_F5
+    {0x003F, 426},   // KC_F6
+    {0x0040, 432},   // KC_F7
+    {0x0041, 438},   // KC_F8
+    {0x0042, 444},   // KC_F9
+    {0x007E, 993},   // KC_FIND
+    {0x000A, 51},    // KC_G
+    {0x0035, 349},   // KC_GRAVE
+    {0x0035, 13483}, // KC_GRV
+    {0x000B, 56},    // KC_H
+    {0x0075, 918},   // KC_HELP
+    {0x004A, 521},   // KC_HOME
+    {0x000C, 61},    // KC_I
+    {0x0049, 13490}, // KC_INS
+    {0x0049, 511},   // KC_INSERT
+    {0x0087, 13497}, // KC_INT1
+    {0x0088, 13505}, // KC_INT2
+    {0x0089, 13513}, // KC_INT3
+    {0x008A, 13521}, // KC_INT4
+    {0x008B, 13529}, // KC_INT5
+    {0x008C, 13537}, // KC_INT6
+    {0x008D, 13545}, // KC_INT7
+    {0x008E, 13553}, // KC_INT8
+    {0x008F, 13561}, // KC_INT9
+    {0x0087, 1140},  // KC_INTERNATIONAL_1
+    {0x0088, 1159},  // KC_INTERNATIONAL_2
+    {0x0089, 1178},  // KC_INTERNATIONAL_3
+    {0x008A, 1197},  // KC_INTERNATIONAL_4
+    {0x008B, 1216},  // KC_INTERNATIONAL_5
+    {0x008C, 1235},  // KC_INTERNATIONAL_6
+    {0x008D, 1254},  // KC_INTERNATIONAL_7
+    {0x008E, 1273},  // KC_INTERNATIONAL_8
+    {0x008F, 1292},  // KC_INTERNATIONAL_9
+    {0x000D, 66},    // KC_J
+    {0x000E, 71},    // KC_K
+    {0x007F, 1001},  // KC_KB_MUTE
+    {0x0066, 799},   // KC_KB_POWER
+    {0x0081, 1028},  // KC_KB_VOLUME_DOWN
+    {0x0080, 1012},  // KC_KB_VOLUME_UP
+    {0x0062, 747},   // KC_KP_0
+    {0x0059, 675},   // KC_KP_1
+    {0x005A, 683},   // KC_KP_2
+    {0x005B, 691},   // KC_KP_3
+    {0x005C, 699},   // KC_KP_4
+    {0x005D, 707},   // KC_KP_5
+    {0x005E, 715},   // KC_KP_6
+    {0x005F, 723},   // KC_KP_7
+    {0x0060, 731},   // KC_KP_8
+    {0x0061, 739},   // KC_KP_9
+    {0x0055, 625},   // KC_KP_ASTERISK
+    {0x0085, 1110},  // KC_KP_COMMA
+    {0x0063, 755},   // KC_KP_DOT
+    {0x0058, 663},   // KC_KP_ENTER
+    {0x0067, 811},   // KC_KP_EQUAL
+    {0x0086, 1122},  // KC_KP_EQUAL_AS400
+    {0x0056, 640},   // KC_KP_MINUS
+    {0x0057, 652},   // KC_KP_PLUS
+    {0x0054, 613},   // KC_KP_SLASH
+    {0x000F, 76},    // KC_L
+    {0x00E2, 13569}, // KC_LALT
+    {0x0090, 1311},  // KC_LANGUAGE_1
+    {0x0091, 1325},  // KC_LANGUAGE_2
+    {0x0092, 1339},  // KC_LANGUAGE_3
+    {0x0093, 1353},  // KC_LANGUAGE_4
+    {0x0094, 1367},  // KC_LANGUAGE_5
+    {0x0095, 1381},  // KC_LANGUAGE_6
+    {0x0096, 1395},  // KC_LANGUAGE_7
+    {0x0097, 1409},  // KC_LANGUAGE_8
+    {0x0098, 1423},  // KC_LANGUAGE_9
+    {0x00C2, 2030},  // KC_LAUNCHPAD
+    {0x002F, 13577}, // KC_LBRC
+    {0x0082, 13585}, // KC_LCAP
+    {0x00E3, 13593}, // KC_LCMD
+    {0x00E0, 13601}, // KC_LCTL
+    {0x0050, 579},   // KC_LEFT
+    {0x00E2, 2448},  // KC_LEFT_ALT
+    {0x002F, 267},   // KC_LEFT_BRACKET
+    {0x00E0, 2421},  // KC_LEFT_CTRL
+    {0x00E3, 2460},  // KC_LEFT_GUI
+    {0x00E1, 2434},  // KC_LEFT_SHIFT
+    {0x00E3, 13609}, // KC_LGUI
+    {0x0090, 13617}, // KC_LNG1
+    {0x0091, 13625}, // KC_LNG2
+    {0x0092, 13633}, // KC_LNG3
+    {0x0093, 13641}, // KC_LNG4
+    {0x0094, 13649}, // KC_LNG5
+    {0x0095, 13657}, // KC_LNG6
+    {0x0096, 13665}, // KC_LNG7
+    {0x0097, 13673}, // KC_LNG8
+    {0x0098, 13681}, // KC_LNG9
+    {0x0083, 13689}, // KC_LNUM
+    {0x0082, 1046},  // KC_LOCKING_CAPS_LOCK
+    {0x0083, 1067},  // KC_LOCKING_NUM_LOCK
+    {0x0084, 1087},  // KC_LOCKING_SCROLL_LOCK
+    {0x00E2, 13697}, // KC_LOPT
+    {0x00C2, 13705}, // KC_LPAD
+    {0x0084, 13713}, // KC_LSCR
+    {0x00E1, 13721}, // KC_LSFT
+    {0x00E3, 13729}, // KC_LWIN
+    {0x0010, 81},    // KC_M
+    {0x00B1, 1773},  // KC_MAIL
+    {0x00C1, 13737}, // KC_MCTL
+    {0x00B0, 1758},  // KC_MEDIA_EJECT
+    {0x00BB, 1907},  // KC_MEDIA_FAST_FORWARD
+    {0x00AB, 1668},  // KC_MEDIA_NEXT_TRACK
+    {0x00AE, 1722},  // KC_MEDIA_PLAY_PAUSE
+    {0x00AC, 1688},  // KC_MEDIA_PREV_TRACK
+    {0x00BC, 1929},  // KC_MEDIA_REWIND
+    {0x00AF, 1742},  // KC_MEDIA_SELECT
+    {0x00AD, 1708},  // KC_MEDIA_STOP
+    {0x0076, 926},   // KC_MENU
+    {0x00BB, 13745}, // KC_MFFD
+    {0x002D, 13753}, // KC_MINS
+    {0x002D, 249},   // KC_MINUS
+    {0x00C1, 2011},  // KC_MISSION_CONTROL
+    {0x00AB, 13761}, // KC_MNXT
+    {0x00AE, 13769}, // KC_MPLY
+    {0x00AC, 13777}, // KC_MPRV
+    {0x00BC, 13785}, // KC_MRWD
+    {0x00AF, 13793}, // KC_MSEL
+    {0x00AD, 13801}, // KC_MSTP
+    {0x00A8, 13809}, // KC_MUTE
+    {0x00B3, 13817}, // KC_MYCM
+    {0x00B3, 1795},  // KC_MY_COMPUTER
+    {0x0011, 86},    // KC_N
+    {0x0000, 0},     // KC_NO
+    {0x0064, 765},   // KC_NONUS_BACKSLASH
+    {0x0032, 313},   // KC_NONUS_HASH
+    {0x0064, 13825}, // KC_NUBS
+    {0x0032, 13833}, // KC_NUHS
+    {0x0053, 13841}, // KC_NUM
+    {0x0053, 601},   // KC_NUM_LOCK
+    {0x0012, 91},    // KC_O
+    {0x00A1, 1532},  // KC_OPER
+    {0x00A0, 1525},  // KC_OUT
+    {0x0013, 96},    // KC_P
+    {0x0062, 13848}, // KC_P0
+    {0x0059, 13854}, // KC_P1
+    {0x005A, 13860}, // KC_P2
+    {0x005B, 13866}, // KC_P3
+    {0x005C, 13872}, // KC_P4
+    {0x005D, 13878}, // KC_P5
+    {0x005E, 13884}, // KC_P6
+    {0x005F, 13890}, // KC_P7
+    {0x0060, 13896}, // KC_P8
+    {0x0061, 13902}, // KC_P9
+    {0x004E, 557},   // KC_PAGE_DOWN
+    {0x004B, 529},   // KC_PAGE_UP
+    {0x0055, 13908}, // KC_PAST
+    {0x007D, 984},   // KC_PASTE
+    {0x0048, 13916}, // KC_PAUS
+    {0x0048, 502},   // KC_PAUSE
+    {0x0085, 13924}, // KC_PCMM
+    {0x0063, 13932}, // KC_PDOT
+    {0x0058, 13940}, // KC_PENT
+    {0x0067, 13948}, // KC_PEQL
+    {0x004E, 13956}, // KC_PGDN
+    {0x004B, 13964}, // KC_PGUP
+    {0x0056, 13972}, // KC_PMNS
+    {0x0057, 13980}, // KC_PPLS
+    {0x0046, 471},   // KC_PRINT_SCREEN
+    {0x009D, 1493},  // KC_PRIOR
+    {0x009D, 13988}, // KC_PRIR
+    {0x0046, 13996}, // KC_PSCR
+    {0x0054, 14004}, // KC_PSLS
+    {0x007D, 14012}, // KC_PSTE
+    {0x00A5, 14020}, // KC_PWR
+    {0x0014, 101},   // KC_Q
+    {0x0034, 14027}, // KC_QUOT
+    {0x0034, 340},   // KC_QUOTE
+    {0x0015, 106},   // KC_R
+    {0x00E6, 14035}, // KC_RALT
+    {0x0030, 14043}, // KC_RBRC
+    {0x00E7, 14051}, // KC_RCMD
+    {0x00E4, 14059}, // KC_RCTL
+    {0x009E, 14067}, // KC_RETN
+    {0x009E, 1502},  // KC_RETURN
+    {0x004F, 14075}, // KC_RGHT
+    {0x00E7, 14083}, // KC_RGUI
+    {0x004F, 570},   // KC_RIGHT
+    {0x00E6, 2501},  // KC_RIGHT_ALT
+    {0x0030, 283},   // KC_RIGHT_BRACKET
+    {0x00E4, 2472},  // KC_RIGHT_CTRL
+    {0x00E7, 2514},  // KC_RIGHT_GUI
+    {0x00E5, 2486},  // KC_RIGHT_SHIFT
+    {0x00E6, 14091}, // KC_ROPT
+    {0x00E5, 14099}, // KC_RSFT
+    {0x00E7, 14107}, // KC_RWIN
+    {0x0016, 111},   // KC_S
+    {0x0033, 14115}, // KC_SCLN
+    {0x0047, 14123}, // KC_SCRL
+    {0x0047, 487},   // KC_SCROLL_LOCK
+    {0x0077, 934},   // KC_SELECT
+    {0x0033, 327},   // KC_SEMICOLON
+    {0x009F, 1512},  // KC_SEPARATOR
+    {0x009F, 14131}, // KC_SEPR
+    {0x0038, 374},   // KC_SLASH
+    {0x0077, 14139}, // KC_SLCT
+    {0x00A6, 14147}, // KC_SLEP
+    {0x0038, 14155}, // KC_SLSH
+    {0x002C, 240},   // KC_SPACE
+    {0x002C, 14163}, // KC_SPC
+    {0x0078, 944},   // KC_STOP
+    {0x009A, 14170}, // KC_SYRQ
+    {0x00A5, 1573},  // KC_SYSTEM_POWER
+    {0x009A, 1456},  // KC_SYSTEM_REQUEST
+    {0x00A6, 1589},  // KC_SYSTEM_SLEEP
+    {0x00A7, 1605},  // KC_SYSTEM_WAKE
+    {0x0017, 116},   // KC_T
+    {0x002B, 233},   // KC_TAB
+    {0x0001, 6},     // KC_TRANSPARENT
+    {0x0001, 14178}, // KC_TRNS
+    {0x0018, 121},   // KC_U
+    {0x007A, 961},   // KC_UNDO
+    {0x0052, 595},   // KC_UP
+    {0x0019, 126},   // KC_V
+    {0x00AA, 14186}, // KC_VOLD
+    {0x00A9, 14194}, // KC_VOLU
+    {0x001A, 131},   // KC_W
+    {0x00A7, 14202}, // KC_WAKE
+    {0x00B6, 14210}, // KC_WBAK
+    {0x00BA, 14218}, // KC_WFAV
+    {0x00B7, 14226}, // KC_WFWD
+    {0x00B5, 14234}, // KC_WHOM
+    {0x00B9, 14242}, // KC_WREF
+    {0x00B4, 14250}, // KC_WSCH
+    {0x00B8, 14258}, // KC_WSTP
+    {0x00B6, 1836},  // KC_WWW_BACK
+    {0x00BA, 1890},  // KC_WWW_FAVORITES
+    {0x00B7, 1848},  // KC_WWW_FORWARD
+    {0x00B5, 1824},  // KC_WWW_HOME
+    {0x00B9, 1875},  // KC_WWW_REFRESH
+    {0x00B4, 1810},  // KC_WWW_SEARCH
+    {0x00B8, 1863},  // KC_WWW_STOP
+    {0x001B, 136},   // KC_X
+    {0x001C, 141},   // KC_Y
+    {0x001D, 146},   // KC_Z
+    {0x7C5F, 14266}, // KO_OFF
+    {0x7C5E, 14273}, // KO_ON
+    {0x7C5D, 14279}, // KO_TOGG
+    {0x7816, 14287}, // LM_BRID
+    {0x7815, 14295}, // LM_BRIU
+    {0x7813, 14303}, // LM_NEXT
+    {0x7811, 14311}, // LM_OFF
+    {0x7810, 14318}, // LM_ON
+    {0x7814, 14324}, // LM_PREV
+    {0x7818, 14332}, // LM_SPDD
+    {0x7817, 14340}, // LM_SPDU
+    {0x7812, 14348}, // LM_TOGG
+    {0x7700, 14356}, // MC_0
+    {0x7701, 14361}, // MC_1
+    {0x770A, 14366}, // MC_10
+    {0x770B, 14372}, // MC_11
+    {0x770C, 14378}, // MC_12
+    {0x770D, 14384}, // MC_13
+    {0x770E, 14390}, // MC_14
+    {0x770F, 14396}, // MC_15
+    {0x7710, 14402}, // MC_16
+    {0x7711, 14408}, // MC_17
+    {0x7712, 14414}, // MC_18
+    {0x7713, 14420}, // MC_19
+    {0x7702, 14426}, // MC_2
+    {0x7714, 14431}, // MC_20
+    {0x7715, 14437}, // MC_21
+    {0x7716, 14443}, // MC_22
+    {0x7717, 14449}, // MC_23
+    {0x7718, 14455}, // MC_24
+    {0x7719, 14461}, // MC_25
+    {0x771A, 14467}, // MC_26
+    {0x771B, 14473}, // MC_27
+    {0x771C, 14479}, // MC_28
+    {0x771D, 14485}, // MC_29
+    {0x7703, 14491}, // MC_3
+    {0x771E, 14496}, // MC_30
+    {0x771F, 14502}, // MC_31
+    {0x7704, 14508}, // MC_4
+    {0x7705, 14513}, // MC_5
+    {0x7706, 14518}, // MC_6
+    {0x7707, 14523}, // MC_7
+    {0x7708, 14528}, // MC_8
+    {0x7709, 14533}, // MC_9
+    {0x710C, 14538}, // MI_A
+    {0x7118, 14543}, // MI_A1
+    {0x7124, 14549}, // MI_A2
+    {0x7130, 14555}, // MI_A3
+    {0x713C, 14561}, // MI_A4
+    {0x7148, 14567}, // MI_A5
+    {0x7185, 14573}, // MI_AOFF
+    {0x710B, 14581}, // MI_Ab
+    {0x7117, 14587}, // MI_Ab1
+    {0x7123, 14594}, // MI_Ab2
+    {0x712F, 14601}, // MI_Ab3
+    {0x713B, 14608}, // MI_Ab4
+    {0x7147, 14615}, // MI_Ab5
+    {0x710D, 14622}, // MI_As
+    {0x7119, 14628}, // MI_As1
+    {0x7125, 14635}, // MI_As2
+    {0x7131, 14642}, // MI_As3
+    {0x713D, 14649}, // MI_As4
+    {0x7149, 14656}, // MI_As5
+    {0x710E, 14663}, // MI_B
+    {0x711A, 14668}, // MI_B1
+    {0x7126, 14674}, // MI_B2
+    {0x7132, 14680}, // MI_B3
+    {0x713E, 14686}, // MI_B4
+    {0x714A, 14692}, // MI_B5
+    {0x718E, 14698}, // MI_BNDD
+    {0x718F, 14706}, // MI_BNDU
+    {0x710D, 14714}, // MI_Bb
+    {0x7119, 14720}, // MI_Bb1
+    {0x7125, 14727}, // MI_Bb2
+    {0x7131, 14734}, // MI_Bb3
+    {0x713D, 14741}, // MI_Bb4
+    {0x7149, 14748}, // MI_Bb5
+    {0x7103, 14755}, // MI_C
+    {0x710F, 14760}, // MI_C1
+    {0x711B, 14766}, // MI_C2
+    {0x7127, 14772}, // MI_C3
+    {0x7133, 14778}, // MI_C4
+    {0x713F, 14784}, // MI_C5
+    {0x7173, 14790}, // MI_CH1
+    {0x717C, 14797}, // MI_CH10
+    {0x717D, 14805}, // MI_CH11
+    {0x717E, 14813}, // MI_CH12
+    {0x717F, 14821}, // MI_CH13
+    {0x7180, 14829}, // MI_CH14
+    {0x7181, 14837}, // MI_CH15
+    {0x7182, 14845}, // MI_CH16
+    {0x7174, 14853}, // MI_CH2
+    {0x7175, 14860}, // MI_CH3
+    {0x7176, 14867}, // MI_CH4
+    {0x7177, 14874}, // MI_CH5
+    {0x7178, 14881}, // MI_CH6
+    {0x7179, 14888}, // MI_CH7
+    {0x717A, 14895}, // MI_CH8
+    {0x717B, 14902}, // MI_CH9
+    {0x7183, 14909}, // MI_CHND
+    {0x7184, 14917}, // MI_CHNU
+    {0x7104, 14925}, // MI_Cs
+    {0x7110, 14931}, // MI_Cs1
+    {0x711C, 14938}, // MI_Cs2
+    {0x7128, 14945}, // MI_Cs3
+    {0x7134, 14952}, // MI_Cs4
+    {0x7140, 14959}, // MI_Cs5
+    {0x7105, 14966}, // MI_D
+    {0x7111, 14971}, // MI_D1
+    {0x711D, 14977}, // MI_D2
+    {0x7129, 14983}, // MI_D3
+    {0x7135, 14989}, // MI_D4
+    {0x7141, 14995}, // MI_D5
+    {0x7104, 15001}, // MI_Db
+    {0x7110, 15007}, // MI_Db1
+    {0x711C, 15014}, // MI_Db2
+    {0x7128, 15021}, // MI_Db3
+    {0x7134, 15028}, // MI_Db4
+    {0x7140, 15035}, // MI_Db5
+    {0x7106, 15042}, // MI_Ds
+    {0x7112, 15048}, // MI_Ds1
+    {0x711E, 15055}, // MI_Ds2
+    {0x712A, 15062}, // MI_Ds3
+    {0x7136, 15069}, // MI_Ds4
+    {0x7142, 15076}, // MI_Ds5
+    {0x7107, 15083}, // MI_E
+    {0x7113, 15088}, // MI_E1
+    {0x711F, 15094}, // MI_E2
+    {0x712B, 15100}, // MI_E3
+    {0x7137, 15106}, // MI_E4
+    {0x7143, 15112}, // MI_E5
+    {0x7106, 15118}, // MI_Eb
+    {0x7112, 15124}, // MI_Eb1
+    {0x711E, 15131}, // MI_Eb2
+    {0x712A, 15138}, // MI_Eb3
+    {0x7136, 15145}, // MI_Eb4
+    {0x7142, 15152}, // MI_Eb5
+    {0x7108, 15159}, // MI_F
+    {0x7114, 15164}, // MI_F1
+    {0x7120, 15170}, // MI_F2
+    {0x712C, 15176}, // MI_F3
+    {0x7138, 15182}, // MI_F4
+    {0x7144, 15188}, // MI_F5
+    {0x7109, 15194}, // MI_Fs
+    {0x7115, 15200}, // MI_Fs1
+    {0x7121, 15207}, // MI_Fs2
+    {0x712D, 15214}, // MI_Fs3
+    {0x7139, 15221}, // MI_Fs4
+    {0x7145, 15228}, // MI_Fs5
+    {0x710A, 15235}, // MI_G
+    {0x7116, 15240}, // MI_G1
+    {0x7122, 15246}, // MI_G2
+    {0x712E, 15252}, // MI_G3
+    {0x713A, 15258}, // MI_G4
+    {0x7146, 15264}, // MI_G5
+    {0x7109, 15270}, // MI_Gb
+    {0x7115, 15276}, // MI_Gb1
+    {0x7121, 15283}, // MI_Gb2
+    {0x712D, 15290}, // MI_Gb3
+    {0x7139, 15297}, // MI_Gb4
+    {0x7145, 15304}, // MI_Gb5
+    {0x710B, 15311}, // MI_Gs
+    {0x7117, 15317}, // MI_Gs1
+    {0x7123, 15324}, // MI_Gs2
+    {0x712F, 15331}, // MI_Gs3
+    {0x713B, 15338}, // MI_Gs4
+    {0x7147, 15345}, // MI_Gs5
+    {0x718A, 15352}, // MI_LEG
+    {0x718B, 15359}, // MI_MOD
+    {0x718C, 15366}, // MI_MODD
+    {0x718D, 15374}, // MI_MODU
+    {0x714D, 15382}, // MI_OC0
+    {0x714E, 15389}, // MI_OC1
+    {0x714F, 15396}, // MI_OC2
+    {0x7150, 15403}, // MI_OC3
+    {0x7151, 15410}, // MI_OC4
+    {0x7152, 15417}, // MI_OC5
+    {0x7153, 15424}, // MI_OC6
+    {0x7154, 15431}, // MI_OC7
+    {0x714C, 15438}, // MI_OCN1
+    {0x714B, 15446}, // MI_OCN2
+    {0x7155, 15454}, // MI_OCTD
+    {0x7156, 15462}, // MI_OCTU
+    {0x7101, 15470}, // MI_OFF
+    {0x7100, 15477}, // MI_ON
+    {0x7187, 15483}, // MI_PORT
+    {0x7189, 15491}, // MI_SOFT
+    {0x7188, 15499}, // MI_SOST
+    {0x7186, 15507}, // MI_SUST
+    {0x7102, 15515}, // MI_TOGG
+    {0x715D, 15523}, // MI_TR0
+    {0x715E, 15530}, // MI_TR1
+    {0x715F, 15537}, // MI_TR2
+    {0x7160, 15544}, // MI_TR3
+    {0x7161, 15551}, // MI_TR4
+    {0x7162, 15558}, // MI_TR5
+    {0x7163, 15565}, // MI_TR6
+    {0x715C, 15572}, // MI_TRN1
+    {0x715B, 15580}, // MI_TRN2
+    {0x715A, 15588}, // MI_TRN3
+    {0x7159, 15596}, // MI_TRN4
+    {0x7158, 15604}, // MI_TRN5
+    {0x7157, 15612}, // MI_TRN6
+    {0x7164, 15620}, // MI_TRSD
+    {0x7165, 15628}, // MI_TRSU
+    {0x7171, 15636}, // MI_VELD
+    {0x7172, 15644}, // MI_VELU
+    {0x7166, 15652}, // MI_VL0
+    {0x7167, 15659}, // MI_VL1
+    {0x7170, 15666}, // MI_VL10
+    {0x7168, 15674}, // MI_VL2
+    {0x7169, 15681}, // MI_VL3
+    {0x716A, 15688}, // MI_VL4
+    {0x716B, 15695}, // MI_VL5
+    {0x716C, 15702}, // MI_VL6
+    {0x716D, 15709}, // MI_VL7
+    {0x716E, 15716}, // MI_VL8
+    {0x716F, 15723}, // MI_VL9
+    {0x00DD, 15730}, // MS_ACL0
+    {0x00DE, 15738}, // MS_ACL1
+    {0x00DF, 15746}, // MS_ACL2
+    {0x00D1, 15754}, // MS_BTN1
+    {0x00D2, 15762}, // MS_BTN2
+    {0x00D3, 15770}, // MS_BTN3
+    {0x00D4, 15778}, // MS_BTN4
+    {0x00D5, 15786}, // MS_BTN5
+    {0x00D6, 15794}, // MS_BTN6
+    {0x00D7, 15802}, // MS_BTN7
+    {0x00D8, 15810}, // MS_BTN8
+    {0x00CE, 15818}, // MS_DOWN
+    {0x00CF, 15826}, // MS_LEFT
+    {0x00D0, 15834}, // MS_RGHT
+    {0x00CD, 15842}, // MS_UP
+    {0x00DA, 15848}, // MS_WHLD
+    {0x00DB, 15856}, // MS_WHLL
+    {0x00DC, 15864}, // MS_WHLR
+    {0x00D9, 15872}, // MS_WHLU
+    {0x7493, 15880}, // MU_NEXT
+    {0x7491, 15888}, // MU_OFF
+    {0x7490, 15895}, // MU_ON
+    {0x7492, 15901}, // MU_TOGG
+    {0x7012, 15909}, // NK_OFF
+    {0x7011, 15916}, // NK_ON
+    {0x7013, 15922}, // NK_TOGG
+    {0x7C5B, 15930}, // OS_OFF
+    {0x7C5A, 15937}, // OS_ON
+    {0x7C5C, 15943}, // OS_TOGG
+    {0x7785, 15951}, // OU_2P4G
+    {0x7780, 15959}, // OU_AUTO
+    {0x7786, 15967}, // OU_BT
+    {0x7781, 15973}, // OU_NEXT
+    {0x7783, 15981}, // OU_NONE
+    {0x7782, 15989}, // OU_PREV
+    {0x7784, 15997}, // OU_USB
+    {0x7440, 16004}, // PB_1
+    {0x7449, 16009}, // PB_10
+    {0x744A, 16015}, // PB_11
+    {0x744B, 16021}, // PB_12
+    {0x744C, 16027}, // PB_13
+    {0x744D, 16033}, // PB_14
+    {0x744E, 16039}, // PB_15
+    {0x744F, 16045}, // PB_16
+    {0x7450, 16051}, // PB_17
+    {0x7451, 16057}, // PB_18
+    {0x7452, 16063}, // PB_19
+    {0x7441, 16069}, // PB_2
+    {0x7453, 16074}, // PB_20
+    {0x7454, 16080}, // PB_21
+    {0x7455, 16086}, // PB_22
+    {0x7456, 16092}, // PB_23
+    {0x7457, 16098}, // PB_24
+    {0x7458, 16104}, // PB_25
+    {0x7459, 16110}, // PB_26
+    {0x745A, 16116}, // PB_27
+    {0x745B, 16122}, // PB_28
+    {0x745C, 16128}, // PB_29
+    {0x7442, 16134}, // PB_3
+    {0x745D, 16139}, // PB_30
+    {0x745E, 16145}, // PB_31
+    {0x745F, 16151}, // PB_32
+    {0x7443, 16157}, // PB_4
+    {0x7444, 16162}, // PB_5
+    {0x7445, 16167}, // PB_6
+    {0x7446, 16172}, // PB_7
+    {0x7447, 16177}, // PB_8
+    {0x7448, 16182}, // PB_9
+    {0x7C7A, 11724}, // QK_ALT_REPEAT_KEY
+    {0x7C7A, 16187}, // QK_AREP
+    {0x748E, 8219},  // QK_AUDIO_CLICKY_DOWN
+    {0x748C, 8180},  // QK_AUDIO_CLICKY_OFF
+    {0x748B, 8161},  // QK_AUDIO_CLICKY_ON
+    {0x748F, 8240},  // QK_AUDIO_CLICKY_RESET
+    {0x748A, 8138},  // QK_AUDIO_CLICKY_TOGGLE
+    {0x748D, 8200},  // QK_AUDIO_CLICKY_UP
+    {0x7481, 8109},  // QK_AUDIO_OFF
+    {0x7480, 8097},  // QK_AUDIO_ON
+    {0x7482, 8122},  // QK_AUDIO_TOGGLE
+    {0x7494, 8322},  // QK_AUDIO_VOICE_NEXT
+    {0x7495, 8342},  // QK_AUDIO_VOICE_PREVIOUS
+    {0x7C75, 11631}, // QK_AUTOCORRECT_OFF
+    {0x7C74, 11613}, // QK_AUTOCORRECT_ON
+    {0x7C76, 11650}, // QK_AUTOCORRECT_TOGGLE
+    {0x7C10, 10235}, // QK_AUTO_SHIFT_DOWN
+    {0x7C14, 10309}, // QK_AUTO_SHIFT_OFF
+    {0x7C13, 10292}, // QK_AUTO_SHIFT_ON
+    {0x7C12, 10271}, // QK_AUTO_SHIFT_REPORT
+    {0x7C15, 10327}, // QK_AUTO_SHIFT_TOGGLE
+    {0x7C11, 10254}, // QK_AUTO_SHIFT_UP
+    {0x7803, 9148},  // QK_BACKLIGHT_DOWN
+    {0x7801, 9111},  // QK_BACKLIGHT_OFF
+    {0x7800, 9095},  // QK_BACKLIGHT_ON
+    {0x7805, 9182},  // QK_BACKLIGHT_STEP
+    {0x7802, 9128},  // QK_BACKLIGHT_TOGGLE
+    {0x7806, 9200},  // QK_BACKLIGHT_TOGGLE_BREATHING
+    {0x7804, 9166},  // QK_BACKLIGHT_UP
+    {0x7793, 8985},  // QK_BLUETOOTH_PROFILE1
+    {0x7794, 9007},  // QK_BLUETOOTH_PROFILE2
+    {0x7795, 9029},  // QK_BLUETOOTH_PROFILE3
+    {0x7796, 9051},  // QK_BLUETOOTH_PROFILE4
+    {0x7797, 9073},  // QK_BLUETOOTH_PROFILE5
+    {0x7790, 8913},  // QK_BLUETOOTH_PROFILE_NEXT
+    {0x7791, 8939},  // QK_BLUETOOTH_PROFILE_PREV
+    {0x7792, 8965},  // QK_BLUETOOTH_UNPAIR
+    {0x7C00, 16195}, // QK_BOOT
+    {0x7C00, 10171}, // QK_BOOTLOADER
+    {0x7C73, 11593}, // QK_CAPS_WORD_TOGGLE
+    {0x7C03, 10211}, // QK_CLEAR_EEPROM
+    {0x7C51, 11140}, // QK_COMBO_OFF
+    {0x7C50, 11128}, // QK_COMBO_ON
+    {0x7C52, 11153}, // QK_COMBO_TOGGLE
+    {0x7C02, 10195}, // QK_DEBUG_TOGGLE
+    {0x7C56, 11262}, // QK_DYNAMIC_MACRO_PLAY_1
+    {0x7C57, 11286}, // QK_DYNAMIC_MACRO_PLAY_2
+    {0x7C53, 11169}, // QK_DYNAMIC_MACRO_RECORD_START_1
+    {0x7C54, 11201}, // QK_DYNAMIC_MACRO_RECORD_START_2
+    {0x7C55, 11233}, // QK_DYNAMIC_MACRO_RECORD_STOP
+    {0x7C72, 11564}, // QK_DYNAMIC_TAPPING_TERM_DOWN
+    {0x7C70, 11507}, // QK_DYNAMIC_TAPPING_TERM_PRINT
+    {0x7C71, 11537}, // QK_DYNAMIC_TAPPING_TERM_UP
+    {0x7C16, 16203}, // QK_GESC
+    {0x7C16, 10348}, // QK_GRAVE_ESCAPE
+    {0x7C45, 10944}, // QK_HAPTIC_BUZZ_TOGGLE
+    {0x7C4A, 11062}, // QK_HAPTIC_CONTINUOUS_DOWN
+    {0x7C48, 11010}, // QK_HAPTIC_CONTINUOUS_TOGGLE
+    {0x7C49, 11038}, // QK_HAPTIC_CONTINUOUS_UP
+    {0x7C4C, 11107}, // QK_HAPTIC_DWELL_DOWN
+    {0x7C4B, 11088}, // QK_HAPTIC_DWELL_UP
+    {0x7C44, 10918}, // QK_HAPTIC_FEEDBACK_TOGGLE
+    {0x7C46, 10966}, // QK_HAPTIC_MODE_NEXT
+    {0x7C47, 10986}, // QK_HAPTIC_MODE_PREVIOUS
+    {0x7C41, 10871}, // QK_HAPTIC_OFF
+    {0x7C40, 10858}, // QK_HAPTIC_ON
+    {0x7C43, 10902}, // QK_HAPTIC_RESET
+    {0x7C42, 10885}, // QK_HAPTIC_TOGGLE
+    {0x7400, 6580},  // QK_JOYSTICK_BUTTON_0
+    {0x7401, 6601},  // QK_JOYSTICK_BUTTON_1
+    {0x740A, 6790},  // QK_JOYSTICK_BUTTON_10
+    {0x740B, 6812},  // QK_JOYSTICK_BUTTON_11
+    {0x740C, 6834},  // QK_JOYSTICK_BUTTON_12
+    {0x740D, 6856},  // QK_JOYSTICK_BUTTON_13
+    {0x740E, 6878},  // QK_JOYSTICK_BUTTON_14
+    {0x740F, 6900},  // QK_JOYSTICK_BUTTON_15
+    {0x7410, 6922},  // QK_JOYSTICK_BUTTON_16
+    {0x7411, 6944},  // QK_JOYSTICK_BUTTON_17
+    {0x7412, 6966},  // QK_JOYSTICK_BUTTON_18
+    {0x7413, 6988},  // QK_JOYSTICK_BUTTON_19
+    {0x7402, 6622},  // QK_JOYSTICK_BUTTON_2
+    {0x7414, 7010},  // QK_JOYSTICK_BUTTON_20
+    {0x7415, 7032},  // QK_JOYSTICK_BUTTON_21
+    {0x7416, 7054},  // QK_JOYSTICK_BUTTON_22
+    {0x7417, 7076},  // QK_JOYSTICK_BUTTON_23
+    {0x7418, 7098},  // QK_JOYSTICK_BUTTON_24
+    {0x7419, 7120},  // QK_JOYSTICK_BUTTON_25
+    {0x741A, 7142},  // QK_JOYSTICK_BUTTON_26
+    {0x741B, 7164},  // QK_JOYSTICK_BUTTON_27
+    {0x741C, 7186},  // QK_JOYSTICK_BUTTON_28
+    {0x741D, 7208},  // QK_JOYSTICK_BUTTON_29
+    {0x7403, 6643},  // QK_JOYSTICK_BUTTON_3
+    {0x741E, 7230},  // QK_JOYSTICK_BUTTON_30
+    {0x741F, 7252},  // QK_JOYSTICK_BUTTON_31
+    {0x7404, 6664},  // QK_JOYSTICK_BUTTON_4
+    {0x7405, 6685},  // QK_JOYSTICK_BUTTON_5
+    {0x7406, 6706},  // QK_JOYSTICK_BUTTON_6
+    {0x7407, 6727},  // QK_JOYSTICK_BUTTON_7
+    {0x7408, 6748},  // QK_JOYSTICK_BUTTON_8
+    {0x7409, 6769},  // QK_JOYSTICK_BUTTON_9
+    {0x7E00, 11756}, // QK_KB_0
+    {0x7E01, 11764}, // QK_KB_1
+    {0x7E0A, 11836}, // QK_KB_10
+    {0x7E0B, 11845}, // QK_KB_11
+    {0x7E0C, 11854}, // QK_KB_12
+    {0x7E0D, 11863}, // QK_KB_13
+    {0x7E0E, 11872}, // QK_KB_14
+    {0x7E0F, 11881}, // QK_KB_15
+    {0x7E10, 11890}, // QK_KB_16
+    {0x7E11, 11899}, // QK_KB_17
+    {0x7E12, 11908}, // QK_KB_18
+    {0x7E13, 11917}, // QK_KB_19
+    {0x7E02, 11772}, // QK_KB_2
+    {0x7E14, 11926}, // QK_KB_20
+    {0x7E15, 11935}, // QK_KB_21
+    {0x7E16, 11944}, // QK_KB_22
+    {0x7E17, 11953}, // QK_KB_23
+    {0x7E18, 11962}, // QK_KB_24
+    {0x7E19, 11971}, // QK_KB_25
+    {0x7E1A, 11980}, // QK_KB_26
+    {0x7E1B, 11989}, // QK_KB_27
+    {0x7E1C, 11998}, // QK_KB_28
+    {0x7E1D, 12007}, // QK_KB_29
+    {0x7E03, 11780}, // QK_KB_3
+    {0x7E1E, 12016}, // QK_KB_30
+    {0x7E1F, 12025}, // QK_KB_31
+    {0x7E04, 11788}, // QK_KB_4
+    {0x7E05, 11796}, // QK_KB_5
+    {0x7E06, 11804}, // QK_KB_6
+    {0x7E07, 11812}, // QK_KB_7
+    {0x7E08, 11820}, // QK_KB_8
+    {0x7E09, 11828}, // QK_KB_9
+    {0x7C5F, 11420}, // QK_KEY_OVERRIDE_OFF
+    {0x7C5E, 11401}, // QK_KEY_OVERRIDE_ON
+    {0x7C5D, 11378}, // QK_KEY_OVERRIDE_TOGGLE
+    {0x7C7B, 11742}, // QK_LAYER_LOCK
+    {0x7C58, 16211}, // QK_LEAD
+    {0x7C58, 11310}, // QK_LEADER
+    {0x7816, 9366},  // QK_LED_MATRIX_BRIGHTNESS_DOWN
+    {0x7815, 9338},  // QK_LED_MATRIX_BRIGHTNESS_UP
+    {0x7813, 9286},  // QK_LED_MATRIX_MODE_NEXT
+    {0x7814, 9310},  // QK_LED_MATRIX_MODE_PREVIOUS
+    {0x7811, 9247},  // QK_LED_MATRIX_OFF
+    {0x7810, 9230},  // QK_LED_MATRIX_ON
+    {0x7818, 9419},  // QK_LED_MATRIX_SPEED_DOWN
+    {0x7817, 9396},  // QK_LED_MATRIX_SPEED_UP
+    {0x7812, 9265},  // QK_LED_MATRIX_TOGGLE
+    {0x7C7B, 16219}, // QK_LLCK
+    {0x7C59, 11320}, // QK_LOCK
+    {0x7700, 8428},  // QK_MACRO_0
+    {0x7701, 8439},  // QK_MACRO_1
+    {0x770A, 8538},  // QK_MACRO_10
+    {0x770B, 8550},  // QK_MACRO_11
+    {0x770C, 8562},  // QK_MACRO_12
+    {0x770D, 8574},  // QK_MACRO_13
+    {0x770E, 8586},  // QK_MACRO_14
+    {0x770F, 8598},  // QK_MACRO_15
+    {0x7710, 8610},  // QK_MACRO_16
+    {0x7711, 8622},  // QK_MACRO_17
+    {0x7712, 8634},  // QK_MACRO_18
+    {0x7713, 8646},  // QK_MACRO_19
+    {0x7702, 8450},  // QK_MACRO_2
+    {0x7714, 8658},  // QK_MACRO_20
+    {0x7715, 8670},  // QK_MACRO_21
+    {0x7716, 8682},  // QK_MACRO_22
+    {0x7717, 8694},  // QK_MACRO_23
+    {0x7718, 8706},  // QK_MACRO_24
+    {0x7719, 8718},  // QK_MACRO_25
+    {0x771A, 8730},  // QK_MACRO_26
+    {0x771B, 8742},  // QK_MACRO_27
+    {0x771C, 8754},  // QK_MACRO_28
+    {0x771D, 8766},  // QK_MACRO_29
+    {0x7703, 8461},  // QK_MACRO_3
+    {0x771E, 8778},  // QK_MACRO_30
+    {0x771F, 8790},  // QK_MACRO_31
+    {0x7704, 8472},  // QK_MACRO_4
+    {0x7705, 8483},  // QK_MACRO_5
+    {0x7706, 8494},  // QK_MACRO_6
+    {0x7707, 8505},  // QK_MACRO_7
+    {0x7708, 8516},  // QK_MACRO_8
+    {0x7709, 8527},  // QK_MACRO_9
+    {0x7003, 2786},  // QK_MAGIC_CAPS_LOCK_AS_CONTROL_OFF
+    {0x7004, 2820},  // QK_MAGIC_CAPS_LOCK_AS_CONTROL_ON
+    {0x701E, 3458},  // QK_MAGIC_EE_HANDS_LEFT
+    {0x701F, 3481},  // QK_MAGIC_EE_HANDS_RIGHT
+    {0x700A, 2969},  // QK_MAGIC_GUI_OFF
+    {0x7009, 2953},  // QK_MAGIC_GUI_ON
+    {0x7012, 3179},  // QK_MAGIC_NKRO_OFF
+    {0x7011, 3162},  // QK_MAGIC_NKRO_ON
+    {0x7014, 3218},  // QK_MAGIC_SWAP_ALT_GUI
+    {0x700E, 3056},  // QK_MAGIC_SWAP_BACKSLASH_BACKSPACE
+    {0x7000, 2686},  // QK_MAGIC_SWAP_CONTROL_CAPS_LOCK
+    {0x701B, 3388},  // QK_MAGIC_SWAP_CTL_GUI
+    {0x7020, 3505},  // QK_MAGIC_SWAP_ESCAPE_CAPS_LOCK
+    {0x700C, 3006},  // QK_MAGIC_SWAP_GRAVE_ESC
+    {0x7005, 2853},  // QK_MAGIC_SWAP_LALT_LGUI
+    {0x7017, 3288},  // QK_MAGIC_SWAP_LCTL_LGUI
+    {0x7007, 2903},  // QK_MAGIC_SWAP_RALT_RGUI
+    {0x7019, 3338},  // QK_MAGIC_SWAP_RCTL_RGUI
+    {0x7016, 3264},  // QK_MAGIC_TOGGLE_ALT_GUI
+    {0x7010, 3126},  // QK_MAGIC_TOGGLE_BACKSLASH_BACKSPACE
+    {0x7002, 2752},  // QK_MAGIC_TOGGLE_CONTROL_CAPS_LOCK
+    {0x701D, 3434},  // QK_MAGIC_TOGGLE_CTL_GUI
+    {0x7022, 3569},  // QK_MAGIC_TOGGLE_ESCAPE_CAPS_LOCK
+    {0x700B, 2986},  // QK_MAGIC_TOGGLE_GUI
+    {0x7013, 3197},  // QK_MAGIC_TOGGLE_NKRO
+    {0x7015, 3240},  // QK_MAGIC_UNSWAP_ALT_GUI
+    {0x700F, 3090},  // QK_MAGIC_UNSWAP_BACKSLASH_BACKSPACE
+    {0x7001, 2718},  // QK_MAGIC_UNSWAP_CONTROL_CAPS_LOCK
+    {0x701C, 3410},  // QK_MAGIC_UNSWAP_CTL_GUI
+    {0x7021, 3536},  // QK_MAGIC_UNSWAP_ESCAPE_CAPS_LOCK
+    {0x700D, 3030},  // QK_MAGIC_UNSWAP_GRAVE_ESC
+    {0x7006, 2877},  // QK_MAGIC_UNSWAP_LALT_LGUI
+    {0x7018, 3312},  // QK_MAGIC_UNSWAP_LCTL_LGUI
+    {0x7008, 2927},  // QK_MAGIC_UNSWAP_RALT_RGUI
+    {0x701A, 3362},  // QK_MAGIC_UNSWAP_RCTL_RGUI
+    {0x7C04, 10227}, // QK_MAKE
+    {0x7185, 6151},  // QK_MIDI_ALL_NOTES_OFF
+    {0x7173, 5816},  // QK_MIDI_CHANNEL_1
+    {0x717C, 5978},  // QK_MIDI_CHANNEL_10
+    {0x717D, 5997},  // QK_MIDI_CHANNEL_11
+    {0x717E, 6016},  // QK_MIDI_CHANNEL_12
+    {0x717F, 6035},  // QK_MIDI_CHANNEL_13
+    {0x7180, 6054},  // QK_MIDI_CHANNEL_14
+    {0x7181, 6073},  // QK_MIDI_CHANNEL_15
+    {0x7182, 6092},  // QK_MIDI_CHANNEL_16
+    {0x7174, 5834},  // QK_MIDI_CHANNEL_2
+    {0x7175, 5852},  // QK_MIDI_CHANNEL_3
+    {0x7176, 5870},  // QK_MIDI_CHANNEL_4
+    {0x7177, 5888},  // QK_MIDI_CHANNEL_5
+    {0x7178, 5906},  // QK_MIDI_CHANNEL_6
+    {0x7179, 5924},  // QK_MIDI_CHANNEL_7
+    {0x717A, 5942},  // QK_MIDI_CHANNEL_8
+    {0x717B, 5960},  // QK_MIDI_CHANNEL_9
+    {0x7183, 6111},  // QK_MIDI_CHANNEL_DOWN
+    {0x7184, 6132},  // QK_MIDI_CHANNEL_UP
+    {0x718A, 6239},  // QK_MIDI_LEGATO
+    {0x718B, 6254},  // QK_MIDI_MODULATION
+    {0x718C, 6273},  // QK_MIDI_MODULATION_SPEED_DOWN
+    {0x718D, 6303},  // QK_MIDI_MODULATION_SPEED_UP
+    {0x710C, 3817},  // QK_MIDI_NOTE_A_0
+    {0x7118, 4051},  // QK_MIDI_NOTE_A_1
+    {0x7124, 4285},  // QK_MIDI_NOTE_A_2
+    {0x7130, 4519},  // QK_MIDI_NOTE_A_3
+    {0x713C, 4753},  // QK_MIDI_NOTE_A_4
+    {0x7148, 4987},  // QK_MIDI_NOTE_A_5
+    {0x710D, 3834},  // QK_MIDI_NOTE_A_SHARP_0
+    {0x7119, 4068},  // QK_MIDI_NOTE_A_SHARP_1
+    {0x7125, 4302},  // QK_MIDI_NOTE_A_SHARP_2
+    {0x7131, 4536},  // QK_MIDI_NOTE_A_SHARP_3
+    {0x713D, 4770},  // QK_MIDI_NOTE_A_SHARP_4
+    {0x7149, 5004},  // QK_MIDI_NOTE_A_SHARP_5
+    {0x710E, 3857},  // QK_MIDI_NOTE_B_0
+    {0x711A, 4091},  // QK_MIDI_NOTE_B_1
+    {0x7126, 4325},  // QK_MIDI_NOTE_B_2
+    {0x7132, 4559},  // QK_MIDI_NOTE_B_3
+    {0x713E, 4793},  // QK_MIDI_NOTE_B_4
+    {0x714A, 5027},  // QK_MIDI_NOTE_B_5
+    {0x7103, 3640},  // QK_MIDI_NOTE_C_0
+    {0x710F, 3874},  // QK_MIDI_NOTE_C_1
+    {0x711B, 4108},  // QK_MIDI_NOTE_C_2
+    {0x7127, 4342},  // QK_MIDI_NOTE_C_3
+    {0x7133, 4576},  // QK_MIDI_NOTE_C_4
+    {0x713F, 4810},  // QK_MIDI_NOTE_C_5
+    {0x7104, 3657},  // QK_MIDI_NOTE_C_SHARP_0
+    {0x7110, 3891},  // QK_MIDI_NOTE_C_SHARP_1
+    {0x711C, 4125},  // QK_MIDI_NOTE_C_SHARP_2
+    {0x7128, 4359},  // QK_MIDI_NOTE_C_SHARP_3
+    {0x7134, 4593},  // QK_MIDI_NOTE_C_SHARP_4
+    {0x7140, 4827},  // QK_MIDI_NOTE_C_SHARP_5
+    {0x7105, 3680},  // QK_MIDI_NOTE_D_0
+    {0x7111, 3914},  // QK_MIDI_NOTE_D_1
+    {0x711D, 4148},  // QK_MIDI_NOTE_D_2
+    {0x7129, 4382},  // QK_MIDI_NOTE_D_3
+    {0x7135, 4616},  // QK_MIDI_NOTE_D_4
+    {0x7141, 4850},  // QK_MIDI_NOTE_D_5
+    {0x7106, 3697},  // QK_MIDI_NOTE_D_SHARP_0
+    {0x7112, 3931},  // QK_MIDI_NOTE_D_SHARP_1
+    {0x711E, 4165},  // QK_MIDI_NOTE_D_SHARP_2
+    {0x712A, 4399},  // QK_MIDI_NOTE_D_SHARP_3
+    {0x7136, 4633},  // QK_MIDI_NOTE_D_SHARP_4
+    {0x7142, 4867},  // QK_MIDI_NOTE_D_SHARP_5
+    {0x7107, 3720},  // QK_MIDI_NOTE_E_0
+    {0x7113, 3954},  // QK_MIDI_NOTE_E_1
+    {0x711F, 4188},  // QK_MIDI_NOTE_E_2
+    {0x712B, 4422},  // QK_MIDI_NOTE_E_3
+    {0x7137, 4656},  // QK_MIDI_NOTE_E_4
+    {0x7143, 4890},  // QK_MIDI_NOTE_E_5
+    {0x7108, 3737},  // QK_MIDI_NOTE_F_0
+    {0x7114, 3971},  // QK_MIDI_NOTE_F_1
+    {0x7120, 4205},  // QK_MIDI_NOTE_F_2
+    {0x712C, 4439},  // QK_MIDI_NOTE_F_3
+    {0x7138, 4673},  // QK_MIDI_NOTE_F_4
+    {0x7144, 4907},  // QK_MIDI_NOTE_F_5
+    {0x7109, 3754},  // QK_MIDI_NOTE_F_SHARP_0
+    {0x7115, 3988},  // QK_MIDI_NOTE_F_SHARP_1
+    {0x7121, 4222},  // QK_MIDI_NOTE_F_SHARP_2
+    {0x712D, 4456},  // QK_MIDI_NOTE_F_SHARP_3
+    {0x7139, 4690},  // QK_MIDI_NOTE_F_SHARP_4
+    {0x7145, 4924},  // QK_MIDI_NOTE_F_SHARP_5
+    {0x710A, 3777},  // QK_MIDI_NOTE_G_0
+    {0x7116, 4011},  // QK_MIDI_NOTE_G_1
+    {0x7122, 4245},  // QK_MIDI_NOTE_G_2
+    {0x712E, 4479},  // QK_MIDI_NOTE_G_3
+    {0x713A, 4713},  // QK_MIDI_NOTE_G_4
+    {0x7146, 4947},  // QK_MIDI_NOTE_G_5
+    {0x710B, 3794},  // QK_MIDI_NOTE_G_SHARP_0
+    {0x7117, 4028},  // QK_MIDI_NOTE_G_SHARP_1
+    {0x7123, 4262},  // QK_MIDI_NOTE_G_SHARP_2
+    {0x712F, 4496},  // QK_MIDI_NOTE_G_SHARP_3
+    {0x713B, 4730},  // QK_MIDI_NOTE_G_SHARP_4
+    {0x7147, 4964},  // QK_MIDI_NOTE_G_SHARP_5
+    {0x714D, 5080},  // QK_MIDI_OCTAVE_0
+    {0x714E, 5097},  // QK_MIDI_OCTAVE_1
+    {0x714F, 5114},  // QK_MIDI_OCTAVE_2
+    {0x7150, 5131},  // QK_MIDI_OCTAVE_3
+    {0x7151, 5148},  // QK_MIDI_OCTAVE_4
+    {0x7152, 5165},  // QK_MIDI_OCTAVE_5
+    {0x7153, 5182},  // QK_MIDI_OCTAVE_6
+    {0x7154, 5199},  // QK_MIDI_OCTAVE_7
+    {0x7155, 5216},  // QK_MIDI_OCTAVE_DOWN
+    {0x714C, 5062},  // QK_MIDI_OCTAVE_N1
+    {0x714B, 5044},  // QK_MIDI_OCTAVE_N2
+    {0x7156, 5236},  // QK_MIDI_OCTAVE_UP
+    {0x7101, 3613},  // QK_MIDI_OFF
+    {0x7100, 3602},  // QK_MIDI_ON
+    {0x718E, 6331},  // QK_MIDI_PITCH_BEND_DOWN
+    {0x718F, 6355},  // QK_MIDI_PITCH_BEND_UP
+    {0x7187, 6189},  // QK_MIDI_PORTAMENTO
+    {0x7189, 6226},  // QK_MIDI_SOFT
+    {0x7188, 6208},  // QK_MIDI_SOSTENUTO
+    {0x7186, 6173},  // QK_MIDI_SUSTAIN
+    {0x7102, 3625},  // QK_MIDI_TOGGLE
+    {0x715D, 5380},  // QK_MIDI_TRANSPOSE_0
+    {0x715E, 5400},  // QK_MIDI_TRANSPOSE_1
+    {0x715F, 5420},  // QK_MIDI_TRANSPOSE_2
+    {0x7160, 5440},  // QK_MIDI_TRANSPOSE_3
+    {0x7161, 5460},  // QK_MIDI_TRANSPOSE_4
+    {0x7162, 5480},  // QK_MIDI_TRANSPOSE_5
+    {0x7163, 5500},  // QK_MIDI_TRANSPOSE_6
+    {0x7164, 5520},  // QK_MIDI_TRANSPOSE_DOWN
+    {0x715C, 5359},  // QK_MIDI_TRANSPOSE_N1
+    {0x715B, 5338},  // QK_MIDI_TRANSPOSE_N2
+    {0x715A, 5317},  // QK_MIDI_TRANSPOSE_N3
+    {0x7159, 5296},  // QK_MIDI_TRANSPOSE_N4
+    {0x7158, 5275},  // QK_MIDI_TRANSPOSE_N5
+    {0x7157, 5254},  // QK_MIDI_TRANSPOSE_N6
+    {0x7165, 5543},  // QK_MIDI_TRANSPOSE_UP
+    {0x7166, 5564},  // QK_MIDI_VELOCITY_0
+    {0x7167, 5583},  // QK_MIDI_VELOCITY_1
+    {0x7170, 5754},  // QK_MIDI_VELOCITY_10
+    {0x7168, 5602},  // QK_MIDI_VELOCITY_2
+    {0x7169, 5621},  // QK_MIDI_VELOCITY_3
+    {0x716A, 5640},  // QK_MIDI_VELOCITY_4
+    {0x716B, 5659},  // QK_MIDI_VELOCITY_5
+    {0x716C, 5678},  // QK_MIDI_VELOCITY_6
+    {0x716D, 5697},  // QK_MIDI_VELOCITY_7
+    {0x716E, 5716},  // QK_MIDI_VELOCITY_8
+    {0x716F, 5735},  // QK_MIDI_VELOCITY_9
+    {0x7171, 5774},  // QK_MIDI_VELOCITY_DOWN
+    {0x7172, 5796},  // QK_MIDI_VELOCITY_UP
+    {0x00DD, 2349},  // QK_MOUSE_ACCELERATION_0
+    {0x00DE, 2373},  // QK_MOUSE_ACCELERATION_1
+    {0x00DF, 2397},  // QK_MOUSE_ACCELERATION_2
+    {0x00D1, 2126},  // QK_MOUSE_BUTTON_1
+    {0x00D2, 2144},  // QK_MOUSE_BUTTON_2
+    {0x00D3, 2162},  // QK_MOUSE_BUTTON_3
+    {0x00D4, 2180},  // QK_MOUSE_BUTTON_4
+    {0x00D5, 2198},  // QK_MOUSE_BUTTON_5
+    {0x00D6, 2216},  // QK_MOUSE_BUTTON_6
+    {0x00D7, 2234},  // QK_MOUSE_BUTTON_7
+    {0x00D8, 2252},  // QK_MOUSE_BUTTON_8
+    {0x00CE, 2062},  // QK_MOUSE_CURSOR_DOWN
+    {0x00CF, 2083},  // QK_MOUSE_CURSOR_LEFT
+    {0x00D0, 2104},  // QK_MOUSE_CURSOR_RIGHT
+    {0x00CD, 2043},  // QK_MOUSE_CURSOR_UP
+    {0x00DA, 2288},  // QK_MOUSE_WHEEL_DOWN
+    {0x00DB, 2308},  // QK_MOUSE_WHEEL_LEFT
+    {0x00DC, 2328},  // QK_MOUSE_WHEEL_RIGHT
+    {0x00D9, 2270},  // QK_MOUSE_WHEEL_UP
+    {0x7493, 8303},  // QK_MUSIC_MODE_NEXT
+    {0x7491, 8274},  // QK_MUSIC_OFF
+    {0x7490, 8262},  // QK_MUSIC_ON
+    {0x7492, 8287},  // QK_MUSIC_TOGGLE
+    {0x7C5B, 11343}, // QK_ONE_SHOT_OFF
+    {0x7C5A, 11328}, // QK_ONE_SHOT_ON
+    {0x7C5C, 11359}, // QK_ONE_SHOT_TOGGLE
+    {0x7785, 8876},  // QK_OUTPUT_2P4GHZ
+    {0x7780, 8802},  // QK_OUTPUT_AUTO
+    {0x7786, 8893},  // QK_OUTPUT_BLUETOOTH
+    {0x7781, 8817},  // QK_OUTPUT_NEXT
+    {0x7783, 8847},  // QK_OUTPUT_NONE
+    {0x7782, 8832},  // QK_OUTPUT_PREV
+    {0x7784, 8862},  // QK_OUTPUT_USB
+    {0x7440, 7274},  // QK_PROGRAMMABLE_BUTTON_1
+    {0x7449, 7499},  // QK_PROGRAMMABLE_BUTTON_10
+    {0x744A, 7525},  // QK_PROGRAMMABLE_BUTTON_11
+    {0x744B, 7551},  // QK_PROGRAMMABLE_BUTTON_12
+    {0x744C, 7577},  // QK_PROGRAMMABLE_BUTTON_13
+    {0x744D, 7603},  // QK_PROGRAMMABLE_BUTTON_14
+    {0x744E, 7629},  // QK_PROGRAMMABLE_BUTTON_15
+    {0x744F, 7655},  // QK_PROGRAMMABLE_BUTTON_16
+    {0x7450, 7681},  // QK_PROGRAMMABLE_BUTTON_17
+    {0x7451, 7707},  // QK_PROGRAMMABLE_BUTTON_18
+    {0x7452, 7733},  // QK_PROGRAMMABLE_BUTTON_19
+    {0x7441, 7299},  // QK_PROGRAMMABLE_BUTTON_2
+    {0x7453, 7759},  // QK_PROGRAMMABLE_BUTTON_20
+    {0x7454, 7785},  // QK_PROGRAMMABLE_BUTTON_21
+    {0x7455, 7811},  // QK_PROGRAMMABLE_BUTTON_22
+    {0x7456, 7837},  // QK_PROGRAMMABLE_BUTTON_23
+    {0x7457, 7863},  // QK_PROGRAMMABLE_BUTTON_24
+    {0x7458, 7889},  // QK_PROGRAMMABLE_BUTTON_25
+    {0x7459, 7915},  // QK_PROGRAMMABLE_BUTTON_26
+    {0x745A, 7941},  // QK_PROGRAMMABLE_BUTTON_27
+    {0x745B, 7967},  // QK_PROGRAMMABLE_BUTTON_28
+    {0x745C, 7993},  // QK_PROGRAMMABLE_BUTTON_29
+    {0x7442, 7324},  // QK_PROGRAMMABLE_BUTTON_3
+    {0x745D, 8019},  // QK_PROGRAMMABLE_BUTTON_30
+    {0x745E, 8045},  // QK_PROGRAMMABLE_BUTTON_31
+    {0x745F, 8071},  // QK_PROGRAMMABLE_BUTTON_32
+    {0x7443, 7349},  // QK_PROGRAMMABLE_BUTTON_4
+    {0x7444, 7374},  // QK_PROGRAMMABLE_BUTTON_5
+    {0x7445, 7399},  // QK_PROGRAMMABLE_BUTTON_6
+    {0x7446, 7424},  // QK_PROGRAMMABLE_BUTTON_7
+    {0x7447, 7449},  // QK_PROGRAMMABLE_BUTTON_8
+    {0x7448, 7474},  // QK_PROGRAMMABLE_BUTTON_9
+    {0x7C01, 16227}, // QK_RBT
+    {0x7C01, 10185}, // QK_REBOOT
+    {0x7C79, 16234}, // QK_REP
+    {0x7C79, 11710}, // QK_REPEAT_KEY
+    {0x7846, 9994},  // QK_RGB_MATRIX_HUE_DOWN
+    {0x7845, 9973},  // QK_RGB_MATRIX_HUE_UP
+    {0x7843, 9921},  // QK_RGB_MATRIX_MODE_NEXT
+    {0x7844, 9945},  // QK_RGB_MATRIX_MODE_PREVIOUS
+    {0x7841, 9882},  // QK_RGB_MATRIX_OFF
+    {0x7840, 9865},  // QK_RGB_MATRIX_ON
+    {0x7848, 10045}, // QK_RGB_MATRIX_SATURATION_DOWN
+    {0x7847, 10017}, // QK_RGB_MATRIX_SATURATION_UP
+    {0x784C, 10146}, // QK_RGB_MATRIX_SPEED_DOWN
+    {0x784B, 10123}, // QK_RGB_MATRIX_SPEED_UP
+    {0x7842, 9900},  // QK_RGB_MATRIX_TOGGLE
+    {0x784A, 10098}, // QK_RGB_MATRIX_VALUE_DOWN
+    {0x7849, 10075}, // QK_RGB_MATRIX_VALUE_UP
+    {0x7C60, 11440}, // QK_SECURE_LOCK
+    {0x7C63, 11489}, // QK_SECURE_REQUEST
+    {0x7C62, 11472}, // QK_SECURE_TOGGLE
+    {0x7C61, 11455}, // QK_SECURE_UNLOCK
+    {0x7201, 6393},  // QK_SEQUENCER_OFF
+    {0x7200, 6377},  // QK_SEQUENCER_ON
+    {0x7205, 6476},  // QK_SEQUENCER_RESOLUTION_DOWN
+    {0x7206, 6505},  // QK_SEQUENCER_RESOLUTION_UP
+    {0x7207, 6532},  // QK_SEQUENCER_STEPS_ALL
+    {0x7208, 6555},  // QK_SEQUENCER_STEPS_CLEAR
+    {0x7203, 6430},  // QK_SEQUENCER_TEMPO_DOWN
+    {0x7204, 6454},  // QK_SEQUENCER_TEMPO_UP
+    {0x7202, 6410},  // QK_SEQUENCER_TOGGLE
+    {0x7C1C, 10558}, // QK_SPACE_CADET_LEFT_ALT_PARENTHESIS_OPEN
+    {0x7C18, 10384}, // QK_SPACE_CADET_LEFT_CTRL_PARENTHESIS_OPEN
+    {0x7C1A, 10470}, // QK_SPACE_CADET_LEFT_SHIFT_PARENTHESIS_OPEN
+    {0x7C1D, 10599}, // QK_SPACE_CADET_RIGHT_ALT_PARENTHESIS_CLOSE
+    {0x7C19, 10426}, // QK_SPACE_CADET_RIGHT_CTRL_PARENTHESIS_CLOSE
+    {0x7C1E, 10642}, // QK_SPACE_CADET_RIGHT_SHIFT_ENTER
+    {0x7C1B, 10513}, // QK_SPACE_CADET_RIGHT_SHIFT_PARENTHESIS_CLOSE
+    {0x74F0, 8366},  // QK_STENO_BOLT
+    {0x74F2, 8396},  // QK_STENO_COMB
+    {0x74FC, 8410},  // QK_STENO_COMB_MAX
+    {0x74F1, 8380},  // QK_STENO_GEMINI
+    {0x56F3, 2600},  // QK_SWAP_HANDS_MOMENTARY_OFF
+    {0x56F2, 2573},  // QK_SWAP_HANDS_MOMENTARY_ON
+    {0x56F4, 2628},  // QK_SWAP_HANDS_OFF
+    {0x56F5, 2646},  // QK_SWAP_HANDS_ON
+    {0x56F6, 2663},  // QK_SWAP_HANDS_ONE_SHOT
+    {0x56F1, 2548},  // QK_SWAP_HANDS_TAP_TOGGLE
+    {0x56F0, 2527},  // QK_SWAP_HANDS_TOGGLE
+    {0x7C77, 11672}, // QK_TRI_LAYER_LOWER
+    {0x7C78, 11691}, // QK_TRI_LAYER_UPPER
+    {0x7824, 9534},  // QK_UNDERGLOW_HUE_DOWN
+    {0x7823, 9514},  // QK_UNDERGLOW_HUE_UP
+    {0x7821, 9464},  // QK_UNDERGLOW_MODE_NEXT
+    {0x7822, 9487},  // QK_UNDERGLOW_MODE_PREVIOUS
+    {0x7826, 9583},  // QK_UNDERGLOW_SATURATION_DOWN
+    {0x7825, 9556},  // QK_UNDERGLOW_SATURATION_UP
+    {0x782A, 9680},  // QK_UNDERGLOW_SPEED_DOWN
+    {0x7829, 9658},  // QK_UNDERGLOW_SPEED_UP
+    {0x7820, 9444},  // QK_UNDERGLOW_TOGGLE
+    {0x7828, 9634},  // QK_UNDERGLOW_VALUE_DOWN
+    {0x7827, 9612},  // QK_UNDERGLOW_VALUE_UP
+    {0x7C35, 10789}, // QK_UNICODE_MODE_BSD
+    {0x7C37, 10836}, // QK_UNICODE_MODE_EMACS
+    {0x7C33, 10743}, // QK_UNICODE_MODE_LINUX
+    {0x7C32, 10721}, // QK_UNICODE_MODE_MACOS
+    {0x7C30, 10675}, // QK_UNICODE_MODE_NEXT
+    {0x7C31, 10696}, // QK_UNICODE_MODE_PREVIOUS
+    {0x7C36, 10809}, // QK_UNICODE_MODE_WINCOMPOSE
+    {0x7C34, 10765}, // QK_UNICODE_MODE_WINDOWS
+    {0x7E40, 12034}, // QK_USER_0
+    {0x7E41, 12044}, // QK_USER_1
+    {0x7E4A, 12134}, // QK_USER_10
+    {0x7E4B, 12145}, // QK_USER_11
+    {0x7E4C, 12156}, // QK_USER_12
+    {0x7E4D, 12167}, // QK_USER_13
+    {0x7E4E, 12178}, // QK_USER_14
+    {0x7E4F, 12189}, // QK_USER_15
+    {0x7E50, 12200}, // QK_USER_16
+    {0x7E51, 12211}, // QK_USER_17
+    {0x7E52, 12222}, // QK_USER_18
+    {0x7E53, 12233}, // QK_USER_19
+    {0x7E42, 12054}, // QK_USER_2
+    {0x7E54, 12244}, // QK_USER_20
+    {0x7E55, 12255}, // QK_USER_21
+    {0x7E56, 12266}, // QK_USER_22
+    {0x7E57, 12277}, // QK_USER_23
+    {0x7E58, 12288}, // QK_USER_24
+    {0x7E59, 12299}, // QK_USER_25
+    {0x7E5A, 12310}, // QK_USER_26
+    {0x7E5B, 12321}, // QK_USER_27
+    {0x7E5C, 12332}, // QK_USER_28
+    {0x7E5D, 12343}, // QK_USER_29
+    {0x7E43, 12064}, // QK_USER_3
+    {0x7E5E, 12354}, // QK_USER_30
+    {0x7E5F, 12365}, // QK_USER_31
+    {0x7E44, 12074}, // QK_USER_4
+    {0x7E45, 12084}, // QK_USER_5
+    {0x7E46, 12094}, // QK_USER_6
+    {0x7E47, 12104}, // QK_USER_7
+    {0x7E48, 12114}, // QK_USER_8
+    {0x7E49, 12124}, // QK_USER_9
+    {0x7C17, 10364}, // QK_VELOCIKEY_TOGGLE
+    {0x782C, 9719},  // RGB_MODE_BREATHE
+    {0x7832, 9813},  // RGB_MODE_GRADIENT
+    {0x7830, 9783},  // RGB_MODE_KNIGHT
+    {0x782B, 9704},  // RGB_MODE_PLAIN
+    {0x782D, 9736},  // RGB_MODE_RAINBOW
+    {0x7833, 9831},  // RGB_MODE_RGBTEST
+    {0x782F, 9768},  // RGB_MODE_SNAKE
+    {0x782E, 9753},  // RGB_MODE_SWIRL
+    {0x7834, 9848},  // RGB_MODE_TWINKLE
+    {0x7831, 9799},  // RGB_MODE_XMAS
+    {0x782C, 16241}, // RGB_M_B
+    {0x7832, 16249}, // RGB_M_G
+    {0x7830, 16257}, // RGB_M_K
+    {0x782B, 16265}, // RGB_M_P
+    {0x782D, 16273}, // RGB_M_R
+    {0x782F, 16281}, // RGB_M_SN
+    {0x782E, 16290}, // RGB_M_SW
+    {0x7833, 16299}, // RGB_M_T
+    {0x7834, 16307}, // RGB_M_TW
+    {0x7831, 16316}, // RGB_M_X
+    {0x7846, 16324}, // RM_HUED
+    {0x7845, 16332}, // RM_HUEU
+    {0x7843, 16340}, // RM_NEXT
+    {0x7841, 16348}, // RM_OFF
+    {0x7840, 16355}, // RM_ON
+    {0x7844, 16361}, // RM_PREV
+    {0x7848, 16369}, // RM_SATD
+    {0x7847, 16377}, // RM_SATU
+    {0x784C, 16385}, // RM_SPDD
+    {0x784B, 16393}, // RM_SPDU
+    {0x7842, 16401}, // RM_TOGG
+    {0x784A, 16409}, // RM_VALD
+    {0x7849, 16417}, // RM_VALU
+    {0x7C1C, 16425}, // SC_LAPO
+    {0x7C18, 16433}, // SC_LCPO
+    {0x7C1A, 16441}, // SC_LSPO
+    {0x7C1D, 16449}, // SC_RAPC
+    {0x7C19, 16457}, // SC_RCPC
+    {0x7C1B, 16465}, // SC_RSPC
+    {0x7C1E, 16473}, // SC_SENT
+    {0x7C60, 16481}, // SE_LOCK
+    {0x7C63, 16489}, // SE_REQ
+    {0x7C62, 16496}, // SE_TOGG
+    {0x7C61, 16504}, // SE_UNLK
+    {0x56F3, 16512}, // SH_MOFF
+    {0x56F2, 16520}, // SH_MON
+    {0x56F4, 16527}, // SH_OFF
+    {0x56F5, 16534}, // SH_ON
+    {0x56F6, 16540}, // SH_OS
+    {0x56F0, 16546}, // SH_TOGG
+    {0x56F1, 16554}, // SH_TT
+    {0x7201, 16560}, // SQ_OFF
+    {0x7200, 16567}, // SQ_ON
+    {0x7205, 16573}, // SQ_RESD
+    {0x7206, 16581}, // SQ_RESU
+    {0x7207, 16589}, // SQ_SALL
+    {0x7208, 16597}, // SQ_SCLR
+    {0x7203, 16605}, // SQ_TMPD
+    {0x7204, 16613}, // SQ_TMPU
+    {0x7202, 16621}, // SQ_TOGG
+    {0x7C77, 16629}, // TL_LOWR
+    {0x7C78, 16637}, // TL_UPPR
+    {0x7C35, 16645}, // UC_BSD
+    {0x7C37, 16652}, // UC_EMAC
+    {0x7C33, 16660}, // UC_LINX
+    {0x7C32, 16668}, // UC_MAC
+    {0x7C30, 16675}, // UC_NEXT
+    {0x7C31, 16683}, // UC_PREV
+    {0x7C34, 16691}, // UC_WIN
+    {0x7C36, 16698}, // UC_WINC
+    {0x7824, 16706}, // UG_HUED
+    {0x7823, 16714}, // UG_HUEU
+    {0x7821, 16722}, // UG_NEXT
+    {0x7822, 16730}, // UG_PREV
+    {0x7826, 16738}, // UG_SATD
+    {0x7825, 16746}, // UG_SATU
+    {0x782A, 16754}, // UG_SPDD
+    {0x7829, 16762}, // UG_SPDU
+    {0x7820, 16770}, // UG_TOGG
+    {0x7828, 16778}, // UG_VALD
+    {0x7827, 16786}, // UG_VALU
+    {0x7C17, 16794}, // VK_TOGG
+    {0x0000, 16802}, // XXXXXXX
+    {0x0001, 16810}, // _______
+};
+
+// Sorted and disjoint, overlapping ranges are split and classified by the narrowest one
+static const keycode_string_range_t keycode_string_ranges[] PROGMEM = {
+    {0x0000, 0x00FF, 16818}, // QK_BASIC
+    {0x0100, 0x1FFF, 16827}, // QK_MODS
+    {0x2000, 0x3FFF, 16835}, // QK_MOD_TAP
+    {0x4000, 0x4FFF, 16846}, // QK_LAYER_TAP
+    {0x5000, 0x51FF, 16859}, // QK_LAYER_MOD
+    {0x5200, 0x521F, 16872}, // QK_TO
+    {0x5220, 0x523F, 16878}, // QK_MOMENTARY
+    {0x5240, 0x525F, 16891}, // QK_DEF_LAYER
+    {0x5260, 0x527F, 16904}, // QK_TOGGLE_LAYER
+    {0x5280, 0x529F, 16920}, // QK_ONE_SHOT_LAYER
+    {0x52A0, 0x52BF, 16938}, // QK_ONE_SHOT_MOD
+    {0x52C0, 0x52DF, 16954}, // QK_LAYER_TAP_TOGGLE
+    {0x52E0, 0x52FF, 16974}, // QK_PERSISTENT_DEF_LAYER
+    {0x5600, 0x56FF, 16998}, // QK_SWAP_HANDS
+    {0x5700, 0x57FF, 17012}, // QK_TAP_DANCE
+    {0x7000, 0x70FF, 17025}, // QK_MAGIC
+    {0x7100, 0x71FF, 17034}, // QK_MIDI
+    {0x7200, 0x73FF, 17042}, // QK_SEQUENCER
+    {0x7400, 0x743F, 17055}, // QK_JOYSTICK
+    {0x7440, 0x747F, 17067}, // QK_PROGRAMMABLE_BUTTON
+    {0x7480, 0x74BF, 17090}, // QK_AUDIO
+    {0x74C0, 0x74FF, 17099}, // QK_STENO
+    {0x7700, 0x777F, 17108}, // QK_MACRO
+    {0x7780, 0x77BF, 17117}, // QK_CONNECTION
+    {0x7800, 0x78FF, 17131}, // QK_LIGHTING
+    {0x7C00, 0x7DFF, 17143}, // QK_QUANTUM
+    {0x7E00, 0x7E3F, 17154}, // QK_KB
+    {0x7E40, 0x7FFF, 17160}, // QK_USER
+    {0x8000, 0xBFFF, 17168}, // QK_UNICODEMAP
+    {0xC000, 0xFFFF, 17182}, // QK_UNICODEMAP_PAIR
+};
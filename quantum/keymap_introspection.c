@@ -15,7 +15,11 @@
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Key mapping
 
-#define NUM_KEYMAP_LAYERS_RAW ((uint8_t)(sizeof(keymaps) / ((MATRIX_ROWS) * (MATRIX_COLS) * sizeof(uint16_t))))
+#ifdef SPARSE_KEYMAP_ENABLE
+#    define NUM_KEYMAP_LAYERS_RAW ((uint8_t)(sizeof(sparse_keymap_layers) / sizeof(sparse_keymap_layer_t)))
+#else
+#    define NUM_KEYMAP_LAYERS_RAW ((uint8_t)(sizeof(keymaps) / ((MATRIX_ROWS) * (MATRIX_COLS) * sizeof(uint16_t))))
+#endif
 
 uint8_t keymap_layer_count_raw(void) {
     return NUM_KEYMAP_LAYERS_RAW;
@@ -33,7 +37,11 @@ _Static_assert(NUM_KEYMAP_LAYERS_RAW <= MAX_LAYER, "Number of keymap layers exce
 
 uint16_t keycode_at_keymap_location_raw(uint8_t layer_num, uint8_t row, uint8_t column) {
     if (layer_num < NUM_KEYMAP_LAYERS_RAW && row < MATRIX_ROWS && column < MATRIX_COLS) {
+#ifdef SPARSE_KEYMAP_ENABLE
+        return sparse_keymap_keycode(layer_num, row, column);
+#else
         return pgm_read_word(&keymaps[layer_num][row][column]);
+#endif
     }
     return KC_TRNS;
 }
@@ -130,15 +138,16 @@ __attribute__((weak)) uint16_t tap_dance_count(void) {
 }
 
 _Static_assert(ARRAY_SIZE(tap_dance_actions) <= (QK_TAP_DANCE_MAX - QK_TAP_DANCE), "Number of tap dance actions exceeds maximum. Are you using SAFE_RANGE in tap dance enum?");
+_Static_assert(__builtin_types_compatible_p(__typeof__(&tap_dance_actions[0]), const tap_dance_action_t*), "tap_dance_actions must be declared as `const tap_dance_action_t PROGMEM tap_dance_actions[]`, it is read with memcpy_P().");
 
-tap_dance_action_t* tap_dance_get_raw(uint16_t tap_dance_idx) {
+const tap_dance_action_t* tap_dance_get_raw(uint16_t tap_dance_idx) {
     if (tap_dance_idx >= tap_dance_count_raw()) {
         return NULL;
     }
     return &tap_dance_actions[tap_dance_idx];
 }
 
-__attribute__((weak)) tap_dance_action_t* tap_dance_get(uint16_t tap_dance_idx) {
+__attribute__((weak)) const tap_dance_action_t* tap_dance_get(uint16_t tap_dance_idx) {
     return tap_dance_get_raw(tap_dance_idx);
 }
 
@@ -171,3 +180,29 @@ __attribute__((weak)) const key_override_t* key_override_get(uint16_t key_overri
 }
 
 #endif // defined(KEY_OVERRIDE_ENABLE)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader Dictionary
+
+#if defined(LEADER_ENABLE) && defined(LEADER_DICTIONARY_ENABLE)
+
+uint16_t leader_dictionary_count_raw(void) {
+    return ARRAY_SIZE(leader_dictionary);
+}
+
+__attribute__((weak)) uint16_t leader_dictionary_count(void) {
+    return leader_dictionary_count_raw();
+}
+
+const leader_sequence_t* leader_dictionary_get_raw(uint16_t sequence_idx) {
+    if (sequence_idx >= leader_dictionary_count_raw()) {
+        return NULL;
+    }
+    return &leader_dictionary[sequence_idx];
+}
+
+__attribute__((weak)) const leader_sequence_t* leader_dictionary_get(uint16_t sequence_idx) {
+    return leader_dictionary_get_raw(sequence_idx);
+}
+
+#endif // defined(LEADER_ENABLE) && defined(LEADER_DICTIONARY_ENABLE)
@@ -82,10 +82,10 @@ uint16_t tap_dance_count_raw(void);
 // Get the number of tap dances defined in the user's keymap, potentially stored dynamically
 uint16_t tap_dance_count(void);
 
-// Get the tap dance definitions, stored in firmware rather than any other persistent storage
-tap_dance_action_t* tap_dance_get_raw(uint16_t tap_dance_idx);
-// Get the tap dance definitions, potentially stored dynamically
-tap_dance_action_t* tap_dance_get(uint16_t tap_dance_idx);
+// Get the tap dance definitions, stored in firmware rather than any other persistent storage. The result points to PROGMEM.
+const tap_dance_action_t* tap_dance_get_raw(uint16_t tap_dance_idx);
+// Get the tap dance definitions, potentially stored dynamically. The result must point to PROGMEM.
+const tap_dance_action_t* tap_dance_get(uint16_t tap_dance_idx);
 
 #endif // defined(TAP_DANCE_ENABLE)
 
@@ -109,3 +109,24 @@ const key_override_t* key_override_get_raw(uint16_t key_override_idx);
 const key_override_t* key_override_get(uint16_t key_override_idx);
 
 #endif // defined(KEY_OVERRIDE_ENABLE)
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Leader Dictionary
+
+#if defined(LEADER_ENABLE) && defined(LEADER_DICTIONARY_ENABLE)
+
+// Forward declaration of leader_sequence_t so we don't need to deal with header reordering
+struct leader_sequence_t;
+typedef struct leader_sequence_t leader_sequence_t;
+
+// Get the number of leader sequences defined in the user's keymap, stored in firmware rather than any other persistent storage
+uint16_t leader_dictionary_count_raw(void);
+// Get the number of leader sequences defined in the user's keymap, potentially stored dynamically
+uint16_t leader_dictionary_count(void);
+
+// Get the leader sequence definition, stored in firmware rather than any other persistent storage. The result points to PROGMEM.
+const leader_sequence_t* leader_dictionary_get_raw(uint16_t sequence_idx);
+// Get the leader sequence definition, potentially stored dynamically. The result must point to PROGMEM.
+const leader_sequence_t* leader_dictionary_get(uint16_t sequence_idx);
+
+#endif // defined(LEADER_ENABLE) && defined(LEADER_DICTIONARY_ENABLE)
@@ -7,6 +7,12 @@
 
 #include <string.h>
 
+#ifdef LEADER_DICTIONARY_ENABLE
+#    include "keymap_introspection.h"
+#    include "progmem.h"
+#    include "quantum.h"
+#endif
+
 #ifndef LEADER_TIMEOUT
 #    define LEADER_TIMEOUT 300
 #endif
@@ -14,13 +20,107 @@
 // Leader key stuff
 bool     leading              = false;
 uint16_t leader_time          = 0;
-uint16_t leader_sequence[5]   = {0, 0, 0, 0, 0};
-uint8_t  leader_sequence_size = 0;
+uint16_t leader_sequence[LEADER_SEQUENCE_MAX_KEYS] = {0, 0, 0, 0, 0};
+uint8_t  leader_sequence_size                      = 0;
 
 __attribute__((weak)) void leader_start_user(void) {}
 
 __attribute__((weak)) void leader_end_user(void) {}
 
+#ifdef LEADER_DICTIONARY_ENABLE
+__attribute__((weak)) bool leader_dictionary_matched_user(uint16_t index) {
+    return true;
+}
+
+static uint16_t leader_dictionary_key(uint16_t index, uint8_t position) {
+    return pgm_read_word(&leader_dictionary_get(index)->keys[position]);
+}
+
+/**
+ * Compare the first `leader_sequence_size` keys of a dictionary entry with the sequence buffer.
+ *
+ * \return negative, zero or positive if the entry sorts before, the same as or after the buffer.
+ */
+static int8_t leader_dictionary_compare(uint16_t index) {
+    for (uint8_t i = 0; i < leader_sequence_size; i++) {
+        uint16_t key = leader_dictionary_key(index, i);
+        if (key != leader_sequence[i]) {
+            return key < leader_sequence[i] ? -1 : 1;
+        }
+    }
+    return 0;
+}
+
+static bool leader_dictionary_extends_buffer(uint16_t index) {
+    return leader_sequence_size < LEADER_SEQUENCE_MAX_KEYS && leader_dictionary_key(index, leader_sequence_size) != KC_NO;
+}
+
+/**
+ * Whether the dictionary is sorted, so that it can be searched like a trie: the entries starting with the
+ * buffer are contiguous, and the one matching it exactly comes first since unused keys are KC_NO.
+ */
+static bool leader_dictionary_is_sorted(void) {
+    static enum { UNKNOWN, SORTED, UNSORTED } order = UNKNOWN;
+    if (order == UNKNOWN) {
+        order = SORTED;
+        for (uint16_t i = 1; i < leader_dictionary_count() && order == SORTED; i++) {
+            for (uint8_t j = 0; j < LEADER_SEQUENCE_MAX_KEYS; j++) {
+                uint16_t previous = leader_dictionary_key(i - 1, j);
+                uint16_t current  = leader_dictionary_key(i, j);
+                if (previous != current) {
+                    order = previous < current ? SORTED : UNSORTED;
+                    break;
+                }
+            }
+        }
+    }
+    return order == SORTED;
+}
+
+/**
+ * Look up the sequence buffer in the leader dictionary.
+ *
+ * \param extendable Set to whether a longer entry starts with the buffer.
+ *
+ * \return The index of the entry matching the buffer exactly, or `leader_dictionary_count()` if there is none.
+ */
+static uint16_t leader_dictionary_lookup(bool *extendable) {
+    uint16_t count = leader_dictionary_count();
+    uint16_t match = count;
+    *extendable    = false;
+
+    if (leader_dictionary_is_sorted()) {
+        // Binary search for the first entry not sorting before the buffer
+        uint16_t lo = 0;
+        uint16_t hi = count;
+        while (lo < hi) {
+            uint16_t mid = lo + (hi - lo) / 2;
+            if (leader_dictionary_compare(mid) < 0) {
+                lo = mid + 1;
+            } else {
+                hi = mid;
+            }
+        }
+        if (lo < count && leader_dictionary_compare(lo) == 0 && !leader_dictionary_extends_buffer(lo)) {
+            match = lo++;
+        }
+        *extendable = lo < count && leader_dictionary_compare(lo) == 0 && leader_dictionary_extends_buffer(lo);
+    } else {
+        for (uint16_t i = 0; i < count; i++) {
+            if (leader_dictionary_compare(i) != 0) {
+                continue;
+            }
+            if (leader_dictionary_extends_buffer(i)) {
+                *extendable = true;
+            } else if (match == count) {
+                match = i;
+            }
+        }
+    }
+    return match;
+}
+#endif
+
 void leader_start(void) {
     if (leading) {
         return;
@@ -34,6 +134,15 @@ void leader_start(void) {
 
 void leader_end(void) {
     leading = false;
+
+#ifdef LEADER_DICTIONARY_ENABLE
+    bool     extendable;
+    uint16_t index = leader_dictionary_lookup(&extendable);
+    if (index < leader_dictionary_count() && leader_dictionary_matched_user(index)) {
+        tap_code16(pgm_read_word(&leader_dictionary_get(index)->keycode));
+    }
+#endif
+
     leader_end_user();
 }
 
@@ -61,6 +170,14 @@ bool leader_sequence_add(uint16_t keycode) {
     leader_sequence[leader_sequence_size] = keycode;
     leader_sequence_size++;
 
+#ifdef LEADER_DICTIONARY_ENABLE
+    // Nothing more can be typed to change the outcome
+    bool extendable;
+    if (leader_dictionary_lookup(&extendable) < leader_dictionary_count() && !extendable) {
+        leader_end();
+    }
+#endif
+
     return true;
 }
 
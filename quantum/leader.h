@@ -1,6 +1,8 @@
 // Copyright 2023 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#pragma once
+
 #include <stdbool.h>
 #include <stdint.h>
 
@@ -11,6 +13,27 @@
  * \{
  */
 
+/**
+ * The maximum number of keys in a leader sequence.
+ */
+#define LEADER_SEQUENCE_MAX_KEYS 5
+
+/**
+ * \brief An entry of the leader dictionary.
+ *
+ * Unused trailing keys are `KC_NO`.
+ */
+typedef struct leader_sequence_t {
+    uint16_t keys[LEADER_SEQUENCE_MAX_KEYS];
+    uint16_t keycode;
+} leader_sequence_t;
+
+/**
+ * Define a leader dictionary entry tapping `kc` when the given keys are typed.
+ */
+#define LEADER_SEQUENCE(kc, ...) \
+    { .keys = {__VA_ARGS__}, .keycode = (kc) }
+
 /**
  * \brief User callback, invoked when the leader sequence begins.
  */
@@ -21,6 +44,15 @@ void leader_start_user(void);
  */
 void leader_end_user(void);
 
+/**
+ * \brief User callback, invoked when the leader sequence matches an entry of the leader dictionary, before `leader_end_user()`.
+ *
+ * \param index The index of the entry in `leader_dictionary`.
+ *
+ * \return `true` to tap the keycode of the entry, `false` if it was handled.
+ */
+bool leader_dictionary_matched_user(uint16_t index);
+
 /**
  * Begin the leader sequence, resetting the buffer and timer.
  */
@@ -43,6 +75,8 @@ bool leader_sequence_active(void);
  *
  * If `LEADER_NO_TIMEOUT` is defined, the timer is reset if the buffer is empty.
  *
+ * If `LEADER_DICTIONARY_ENABLE` is defined, the sequence ends straight away once the buffer matches an entry of the leader dictionary that no longer entry starts with.
+ *
  * \param keycode The keycode to add.
  *
  * \return `true` if the keycode was added, `false` if the buffer is full.
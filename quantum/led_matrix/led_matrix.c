@@ -23,6 +23,7 @@
 #include "eeconfig.h"
 #include "keyboard.h"
 #include "sync_timer.h"
+#include "effect_render.h"
 #include "debug.h"
 #include <string.h>
 #include <math.h>
@@ -74,6 +75,10 @@ static uint8_t         led_last_enable   = UINT8_MAX;
 static uint8_t         led_last_effect   = UINT8_MAX;
 static effect_params_t led_effect_params = {0, LED_FLAG_ALL, false};
 static led_task_states led_task_state    = SYNCING;
+static effect_render_t led_render;
+#ifdef LED_MATRIX_RENDER_STATS
+static effect_render_stats_t led_render_stats[LED_MATRIX_EFFECT_MAX];
+#endif // LED_MATRIX_RENDER_STATS
 
 // double buffers
 static uint32_t led_timer_buffer;
@@ -248,6 +253,7 @@ static void led_task_sync(void) {
 static void led_task_start(void) {
     // reset iter
     led_effect_params.iter = 0;
+    effect_render_frame_begin(&led_render);
 
     // update double buffers
     g_led_timer = led_timer_buffer;
@@ -267,6 +273,8 @@ static void led_task_render(uint8_t effect) {
         led_matrix_set_value_all(0);
     }
 
+    effect_render_iter_begin(&led_render);
+
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
     switch (effect) {
@@ -300,6 +308,9 @@ static void led_task_render(uint8_t effect) {
             // ---------------------------------------------
     }
 
+    struct led_matrix_limits_t limits = led_matrix_get_limits(led_effect_params.iter);
+    effect_render_iter_end(&led_render, limits.led_min_index, limits.led_max_index);
+
     led_effect_params.iter++;
 
     // next task
@@ -317,6 +328,15 @@ static void led_task_flush(uint8_t effect) {
     led_last_effect = effect;
     led_last_enable = led_matrix_eeconfig.enable;
 
+    uint32_t frame_time = effect_render_frame_end(&led_render);
+#ifdef LED_MATRIX_RENDER_STATS
+    if (effect < LED_MATRIX_EFFECT_MAX) {
+        effect_render_stats_update(&led_render_stats[effect], frame_time);
+    }
+#else
+    (void)frame_time;
+#endif // LED_MATRIX_RENDER_STATS
+
     // update pwm buffers
     led_matrix_update_pwm_buffers();
 
@@ -391,35 +411,45 @@ __attribute__((weak)) bool led_matrix_indicators_advanced_user(uint8_t led_min,
 
 struct led_matrix_limits_t led_matrix_get_limits(uint8_t iter) {
     struct led_matrix_limits_t limits = {0};
-#if defined(LED_MATRIX_LED_PROCESS_LIMIT) && LED_MATRIX_LED_PROCESS_LIMIT > 0 && LED_MATRIX_LED_PROCESS_LIMIT < LED_MATRIX_LED_COUNT
-#    if defined(LED_MATRIX_SPLIT)
-    limits.led_min_index = LED_MATRIX_LED_PROCESS_LIMIT * (iter);
-    limits.led_max_index = limits.led_min_index + LED_MATRIX_LED_PROCESS_LIMIT;
-    if (limits.led_max_index > LED_MATRIX_LED_COUNT) limits.led_max_index = LED_MATRIX_LED_COUNT;
-    if (is_keyboard_left() && (limits.led_max_index > k_led_matrix_split[0])) limits.led_max_index = k_led_matrix_split[0];
-    if (!(is_keyboard_left()) && (limits.led_min_index < k_led_matrix_split[0])) limits.led_min_index = k_led_matrix_split[0];
-#    else
-    limits.led_min_index = LED_MATRIX_LED_PROCESS_LIMIT * (iter);
-    limits.led_max_index = limits.led_min_index + LED_MATRIX_LED_PROCESS_LIMIT;
-    if (limits.led_max_index > LED_MATRIX_LED_COUNT) limits.led_max_index = LED_MATRIX_LED_COUNT;
-#    endif
-#else
-#    if defined(LED_MATRIX_SPLIT)
-    limits.led_min_index = 0;
-    limits.led_max_index = LED_MATRIX_LED_COUNT;
+    effect_render_get_limits(&led_render, iter, &limits.led_min_index, &limits.led_max_index);
+#if defined(LED_MATRIX_SPLIT)
     if (is_keyboard_left() && (limits.led_max_index > k_led_matrix_split[0])) limits.led_max_index = k_led_matrix_split[0];
     if (!(is_keyboard_left()) && (limits.led_min_index < k_led_matrix_split[0])) limits.led_min_index = k_led_matrix_split[0];
-#    else
-    limits.led_min_index = 0;
-    limits.led_max_index = LED_MATRIX_LED_COUNT;
-#    endif
 #endif
     return limits;
 }
 
+uint8_t led_matrix_get_process_limit(void) {
+    return led_render.process_limit;
+}
+
+#ifdef LED_MATRIX_RENDER_STATS
+const effect_render_stats_t *led_matrix_get_render_stats(uint8_t mode) {
+    if (mode >= LED_MATRIX_EFFECT_MAX) {
+        return NULL;
+    }
+    return &led_render_stats[mode];
+}
+
+void led_matrix_reset_render_stats(void) {
+    for (uint8_t i = 0; i < LED_MATRIX_EFFECT_MAX; i++) {
+        effect_render_stats_reset(&led_render_stats[i]);
+    }
+}
+#endif // LED_MATRIX_RENDER_STATS
+
 void led_matrix_init(void) {
     led_matrix_driver.init();
 
+#ifdef LED_MATRIX_ADAPTIVE_PROCESS_LIMIT
+    effect_render_init(&led_render, LED_MATRIX_LED_COUNT, LED_MATRIX_LED_PROCESS_LIMIT, true, LED_MATRIX_RENDER_BUDGET_US);
+#else
+    effect_render_init(&led_render, LED_MATRIX_LED_COUNT, LED_MATRIX_LED_PROCESS_LIMIT, false, LED_MATRIX_RENDER_BUDGET_US);
+#endif
+#ifdef LED_MATRIX_RENDER_STATS
+    led_matrix_reset_render_stats();
+#endif
+
 #ifdef LED_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
@@ -25,6 +25,7 @@
 #include "led_matrix_types.h"
 #include "led_matrix_drivers.h"
 #include "keyboard.h"
+#include "effect_render.h"
 
 #ifndef LED_MATRIX_TIMEOUT
 #    define LED_MATRIX_TIMEOUT 0
@@ -70,12 +71,22 @@
 #    define LED_MATRIX_LED_PROCESS_LIMIT ((LED_MATRIX_LED_COUNT + 4) / 5)
 #endif
 
+#ifndef LED_MATRIX_RENDER_BUDGET_US
+#    define LED_MATRIX_RENDER_BUDGET_US 1000
+#endif
+
 struct led_matrix_limits_t {
     uint8_t led_min_index;
     uint8_t led_max_index;
 };
 
 struct led_matrix_limits_t led_matrix_get_limits(uint8_t iter);
+uint8_t                    led_matrix_get_process_limit(void);
+
+#ifdef LED_MATRIX_RENDER_STATS
+const effect_render_stats_t *led_matrix_get_render_stats(uint8_t mode);
+void                         led_matrix_reset_render_stats(void);
+#endif
 
 #define LED_MATRIX_USE_LIMITS_ITER(min, max, iter)                   \
     struct led_matrix_limits_t limits = led_matrix_get_limits(iter); \
@@ -0,0 +1,174 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "binary_log.h"
+
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "spsc_ring.h"
+
+_Static_assert(BINARY_LOG_RECORD_SIZE >= 4 && BINARY_LOG_RECORD_SIZE <= 253, "BINARY_LOG_RECORD_SIZE must be between 4 and 253");
+_Static_assert(BINARY_LOG_RECORD_SIZE + 2 < BINARY_LOG_BUFFER_SIZE, "BINARY_LOG_BUFFER_SIZE must hold at least one record");
+
+SPSC_RING_DECLARE(binary_log_ring, uint8_t, BINARY_LOG_BUFFER_SIZE)
+
+// Provided by the linker for the section holding the format strings
+extern const char __start_binary_log_formats[];
+
+static binary_log_ring_t ring;
+static uint16_t          dropped;
+static sendchar_func_t   send = sendchar;
+
+typedef struct {
+    uint8_t size;
+    bool    overflow;
+    uint8_t data[BINARY_LOG_RECORD_SIZE];
+} record_t;
+
+static void record_append(record_t *record, uint32_t value, uint8_t size) {
+    if (record->size + size > BINARY_LOG_RECORD_SIZE) {
+        record->overflow = true;
+        return;
+    }
+    for (uint8_t i = 0; i < size; i++, value >>= 8) {
+        record->data[record->size++] = value & 0xFF;
+    }
+}
+
+static void record_append_string(record_t *record, const char *string) {
+    if (record->size >= BINARY_LOG_RECORD_SIZE) {
+        record->overflow = true;
+        return;
+    }
+
+    // Long strings are cut to the space left
+    uint8_t length = 0;
+    uint8_t space  = BINARY_LOG_RECORD_SIZE - record->size - 1;
+    while (length < space && string[length] != '\0') {
+        length++;
+    }
+    record->data[record->size++] = length;
+    for (uint8_t i = 0; i < length; i++) {
+        record->data[record->size++] = string[i];
+    }
+}
+
+// COBS encodes the record and its zero delimiter, returns the encoded size
+static uint8_t record_encode(const record_t *record, uint8_t *encoded) {
+    uint8_t code_index = 0;
+    uint8_t size       = 1;
+
+    for (uint8_t i = 0; i < record->size; i++) {
+        if (record->data[i] == 0) {
+            encoded[code_index] = size - code_index;
+            code_index          = size++;
+        } else {
+            encoded[size++] = record->data[i];
+        }
+    }
+    encoded[code_index] = size - code_index;
+    encoded[size++]     = 0;
+    return size;
+}
+
+static uint8_t ring_space(void) {
+    return (BINARY_LOG_BUFFER_SIZE - 1) - binary_log_ring_count(&ring);
+}
+
+void binary_log_write(const char *format, ...) {
+    record_t record = {0};
+    record_append(&record, (uint16_t)(format - __start_binary_log_formats), 2);
+
+    va_list args;
+    va_start(args, format);
+    for (const char *c = format; *c != '\0' && !record.overflow; c++) {
+        if (*c != '%') {
+            continue;
+        }
+
+        // Flags, width and precision, a `*` takes an argument
+        for (c++; *c == '-' || *c == '+' || *c == ' ' || *c == '#' || *c == '.' || *c == '*' || (*c >= '0' && *c <= '9'); c++) {
+            if (*c == '*') {
+                record_append(&record, va_arg(args, int), 4);
+            }
+        }
+
+        bool is_long = false, is_size = false;
+        for (; *c == 'l' || *c == 'h' || *c == 'z'; c++) {
+            is_long |= *c == 'l';
+            is_size |= *c == 'z';
+        }
+
+        switch (*c) {
+            case 'd':
+            case 'i':
+                record_append(&record, is_long ? va_arg(args, long) : is_size ? (long)va_arg(args, size_t) : va_arg(args, int), 4);
+                break;
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+            case 'b':
+                record_append(&record, is_long ? va_arg(args, unsigned long) : is_size ? va_arg(args, size_t) : va_arg(args, unsigned int), 4);
+                break;
+            case 'c':
+                record_append(&record, va_arg(args, int), 1);
+                break;
+            case 'p':
+                record_append(&record, (uintptr_t)va_arg(args, void *), 4);
+                break;
+            case 's':
+                record_append_string(&record, va_arg(args, const char *));
+                break;
+            case '\0':
+                c--;
+                break;
+            default:
+                // `%%`, and conversions the firmware's printf does not support either
+                break;
+        }
+    }
+    va_end(args);
+
+    uint8_t encoded[BINARY_LOG_RECORD_SIZE + 2];
+    uint8_t size = record_encode(&record, encoded);
+    if (record.overflow || ring_space() < size) {
+        dropped += dropped < UINT16_MAX;
+        return;
+    }
+
+    // Reports the dropped records first, only if the new one fits after the note
+    if (dropped > 0) {
+        record_t note = {0};
+        uint8_t  note_encoded[8];
+        record_append(&note, BINARY_LOG_DROPPED, 2);
+        record_append(&note, dropped, 2);
+        uint8_t note_size = record_encode(&note, note_encoded);
+        if (ring_space() < note_size + size) {
+            dropped += dropped < UINT16_MAX;
+            return;
+        }
+        binary_log_ring_enqueue_n(&ring, note_encoded, note_size);
+        dropped = 0;
+    }
+
+    binary_log_ring_enqueue_n(&ring, encoded, size);
+}
+
+void binary_log_task(void) {
+    uint8_t pending = binary_log_ring_count(&ring);
+    uint8_t chunk[16];
+
+    while (pending > 0) {
+        uint8_t count = binary_log_ring_dequeue_n(&ring, chunk, pending < sizeof(chunk) ? pending : sizeof(chunk));
+        for (uint8_t i = 0; i < count; i++) {
+            send(chunk[i]);
+        }
+        pending -= count;
+    }
+}
+
+void binary_log_set_sendchar(sendchar_func_t func) {
+    send = func;
+}
@@ -0,0 +1,83 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "sendchar.h"
+
+/**
+ * \file
+ *
+ * \defgroup binary_log Binary console log
+ *
+ * With `BINARY_LOG_ENABLE`, the print functions no longer format text.
+ * Each call queues a record holding the offset of its format string in the
+ * `binary_log_formats` section and the raw values of its arguments. The
+ * records are sent over the console from the main loop, and
+ * `qmk console-decode` rebuilds the text using the format strings in the
+ * firmware's ELF file.
+ *
+ * Records are COBS encoded and end with a zero byte, so the zero padding of
+ * console reports is skipped and the decoder can start reading at any point.
+ * Before COBS encoding, a record is:
+ *
+ * - the format string offset, 2 bytes little endian
+ * - each argument in the order of the format: 4 bytes little endian for
+ *   integers and pointers, 1 byte for `%c`, and a length byte followed by the
+ *   characters for `%s`
+ *
+ * Offset `BINARY_LOG_DROPPED` is followed by the number of records that were
+ * dropped because the buffer was full, 2 bytes little endian.
+ * \{
+ */
+
+#ifndef BINARY_LOG_BUFFER_SIZE
+#    define BINARY_LOG_BUFFER_SIZE 256
+#endif
+
+#ifndef BINARY_LOG_RECORD_SIZE
+#    define BINARY_LOG_RECORD_SIZE 48
+#endif
+
+#define BINARY_LOG_DROPPED 0xFFFF
+
+#if defined(__AVR__)
+#    error "The binary log is not supported on AVR"
+#endif
+
+// Only there for the compiler to check the arguments against the format, never called
+static inline __attribute__((format(__printf__, 1, 2))) void binary_log_check_format(const char *format, ...) {}
+
+/**
+ * \brief Queues a log record, in place of `printf()`.
+ *
+ * `fmt` must be a string literal, which is stored in the `binary_log_formats`
+ * section instead of being sent.
+ */
+#define binary_log_printf(fmt, ...)                                                                             \
+    do {                                                                                                        \
+        if (0) binary_log_check_format(fmt, ##__VA_ARGS__);                                                     \
+        static const char binary_log_format[] __attribute__((section("binary_log_formats"), used)) = fmt;     \
+        binary_log_write(binary_log_format, ##__VA_ARGS__);                                                     \
+    } while (0)
+
+/**
+ * \brief Queues a record for a format string in the `binary_log_formats` section.
+ *
+ * Records that do not fit in `BINARY_LOG_RECORD_SIZE` bytes, or in the
+ * buffer, are dropped and counted. Only one context may write records.
+ */
+void binary_log_write(const char *format, ...);
+
+/**
+ * \brief Sends the queued records, called from the main loop before `console_task()`.
+ */
+void binary_log_task(void);
+
+/**
+ * \brief Sets where `binary_log_task()` sends the records, `sendchar()` by default.
+ */
+void binary_log_set_sendchar(sendchar_func_t func);
+
+/** \} */
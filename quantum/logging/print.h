@@ -55,6 +55,11 @@ void print_set_sendchar(sendchar_func_t func);
 #        include "printf.h" // // Fall back to lib/printf/printf.h
 #        define xprintf printf
 #    endif
+#    ifdef BINARY_LOG_ENABLE
+#        include "binary_log.h"
+#        undef xprintf
+#        define xprintf binary_log_printf
+#    endif
 #else
 // Remove print defines
 #    undef xprintf
@@ -56,6 +56,10 @@ int main(void) {
 #endif
 
 #ifdef CONSOLE_ENABLE
+#    ifdef BINARY_LOG_ENABLE
+        void binary_log_task(void);
+        binary_log_task();
+#    endif
         void console_task(void);
         console_task();
 #endif
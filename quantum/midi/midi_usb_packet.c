@@ -0,0 +1,68 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "midi_usb_packet.h"
+
+bool midi_usb_packet_encode(midi_usb_packet_t* packet, uint8_t cable, uint16_t cnt, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
+    uint8_t cin;
+
+    packet->data[0] = byte0;
+    packet->data[1] = byte1;
+    packet->data[2] = byte2;
+
+    // if the length is undefined we assume it is a SYSEX message
+    if (midi_packet_length(byte0) == UNDEFINED) {
+        if (cnt < 1 || cnt > 3) {
+            return false;
+        }
+        if (packet->data[cnt - 1] == SYSEX_END) {
+            cin = MIDI_USB_CIN_SYSEX_ENDS_IN_1 + cnt - 1;
+        } else {
+            cin = MIDI_USB_CIN_SYSEX_START_OR_CONT;
+        }
+    } else {
+        switch (byte0) {
+            case MIDI_SONGPOSITION:
+                cin = MIDI_USB_CIN_SYS_COMMON_3;
+                break;
+            case MIDI_SONGSELECT:
+            case MIDI_TC_QUARTERFRAME:
+                cin = MIDI_USB_CIN_SYS_COMMON_2;
+                break;
+            case MIDI_TUNEREQUEST:
+                cin = MIDI_USB_CIN_SYS_COMMON_1;
+                break;
+            default:
+                // channel messages use their status nibble, real time ones are single bytes
+                cin = byte0 >> 4;
+                break;
+        }
+    }
+
+    packet->header = MIDI_USB_PACKET_HEADER(cable, cin);
+    return true;
+}
+
+uint8_t midi_usb_packet_length(const midi_usb_packet_t* packet) {
+    static const uint8_t lengths[16] = {0, 0, 2, 3, 3, 1, 2, 3, 3, 3, 3, 3, 2, 2, 3, 1};
+    return lengths[packet->header & 0x0F];
+}
+
+void midi_usb_batch_init(midi_usb_batch_t* batch, midi_usb_send_func_t send_func) {
+    batch->send_func = send_func;
+    batch->count     = 0;
+}
+
+void midi_usb_batch_add(midi_usb_batch_t* batch, midi_usb_packet_t packet) {
+    batch->packets[batch->count++] = packet;
+    if (batch->count == MIDI_USB_BATCH_SIZE) {
+        midi_usb_batch_flush(batch);
+    }
+}
+
+void midi_usb_batch_flush(midi_usb_batch_t* batch) {
+    if (batch->count > 0) {
+        batch->send_func(batch->packets, batch->count);
+        batch->count = 0;
+    }
+}
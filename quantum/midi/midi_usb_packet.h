@@ -0,0 +1,133 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+/**
+ * @file
+ * @brief USB-MIDI event packets
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "midi.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup midi_usb_packet USB-MIDI event packets
+ *
+ * Builds the 4 byte event packets the USB-MIDI class sends over its bulk
+ * endpoints, and collects them so that whole endpoint transfers are sent
+ * instead of one transfer per message.
+ *
+ * The midi_send_* functions keep working on top of this: the QMK device's
+ * send function encodes each message with midi_usb_packet_encode. Code that
+ * sends a lot of notes can build the packets directly with the
+ * midi_usb_packet_* constructors instead.
+ *
+ * @{
+ */
+
+// Code index numbers, the low nibble of the packet header
+#define MIDI_USB_CIN_SYS_COMMON_2 0x2
+#define MIDI_USB_CIN_SYS_COMMON_3 0x3
+#define MIDI_USB_CIN_SYSEX_START_OR_CONT 0x4
+#define MIDI_USB_CIN_SYSEX_ENDS_IN_1 0x5
+#define MIDI_USB_CIN_SYS_COMMON_1 0x5
+#define MIDI_USB_CIN_SYSEX_ENDS_IN_2 0x6
+#define MIDI_USB_CIN_SYSEX_ENDS_IN_3 0x7
+#define MIDI_USB_CIN_SINGLE_BYTE 0xF
+
+#define MIDI_USB_PACKET_HEADER(cable, cin) ((uint8_t)(((cable) << 4) | ((cin)&0x0F)))
+
+// Packets collected before they are sent, 16 packets fill a 64 byte full speed transfer
+#ifndef MIDI_USB_BATCH_SIZE
+#    define MIDI_USB_BATCH_SIZE 16
+#endif
+
+/**
+ * @brief A USB-MIDI event packet, laid out as it is sent on the wire.
+ */
+typedef struct {
+    uint8_t header; // cable number in the high nibble, code index number in the low one
+    uint8_t data[3];
+} midi_usb_packet_t;
+
+typedef void (*midi_usb_send_func_t)(const midi_usb_packet_t* packets, uint8_t count);
+
+/**
+ * @brief Packets waiting to be sent together.
+ */
+typedef struct {
+    midi_usb_send_func_t send_func;
+    uint8_t              count;
+    midi_usb_packet_t    packets[MIDI_USB_BATCH_SIZE];
+} midi_usb_batch_t;
+
+/**
+ * @brief Packet for a channel voice message.
+ *
+ * @param cable the virtual cable number
+ * @param status the message type, for instance MIDI_NOTEON
+ * @param chan the channel [0-15]
+ * @param data1 the first data byte [0-127]
+ * @param data2 the second data byte [0-127], ignored by two byte messages
+ */
+static inline midi_usb_packet_t midi_usb_packet_channel(uint8_t cable, uint8_t status, uint8_t chan, uint8_t data1, uint8_t data2) {
+    midi_usb_packet_t packet;
+    packet.header  = MIDI_USB_PACKET_HEADER(cable, status >> 4);
+    packet.data[0] = status | (chan & MIDI_CHANMASK);
+    packet.data[1] = data1 & 0x7F;
+    packet.data[2] = data2 & 0x7F;
+    return packet;
+}
+
+static inline midi_usb_packet_t midi_usb_packet_noteon(uint8_t cable, uint8_t chan, uint8_t num, uint8_t vel) {
+    return midi_usb_packet_channel(cable, MIDI_NOTEON, chan, num, vel);
+}
+
+static inline midi_usb_packet_t midi_usb_packet_noteoff(uint8_t cable, uint8_t chan, uint8_t num, uint8_t vel) {
+    return midi_usb_packet_channel(cable, MIDI_NOTEOFF, chan, num, vel);
+}
+
+static inline midi_usb_packet_t midi_usb_packet_cc(uint8_t cable, uint8_t chan, uint8_t num, uint8_t val) {
+    return midi_usb_packet_channel(cable, MIDI_CC, chan, num, val);
+}
+
+/**
+ * @brief Encode a message, or a chunk of a sysex message, as passed to a
+ * device's send function.
+ *
+ * @param packet the packet to fill in
+ * @param cable the virtual cable number
+ * @param cnt the number of bytes [1-3]
+ * @return false if the bytes cannot be sent in a packet
+ */
+bool midi_usb_packet_encode(midi_usb_packet_t* packet, uint8_t cable, uint16_t cnt, uint8_t byte0, uint8_t byte1, uint8_t byte2);
+
+/**
+ * @brief Number of MIDI bytes carried by a packet, 0 for reserved code index
+ * numbers.
+ */
+uint8_t midi_usb_packet_length(const midi_usb_packet_t* packet);
+
+void midi_usb_batch_init(midi_usb_batch_t* batch, midi_usb_send_func_t send_func);
+
+/**
+ * @brief Add a packet to the batch, sending the batch as soon as it is full.
+ */
+void midi_usb_batch_add(midi_usb_batch_t* batch, midi_usb_packet_t packet);
+
+/**
+ * @brief Send the packets added since the last flush, if any.
+ */
+void midi_usb_batch_flush(midi_usb_batch_t* batch);
+
+/**@}*/
+
+#ifdef __cplusplus
+}
+#endif
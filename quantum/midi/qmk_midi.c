@@ -16,93 +16,34 @@
 
 MidiDevice midi_device;
 
-#define SYSEX_START_OR_CONT 0x40
-#define SYSEX_ENDS_IN_1 0x50
-#define SYSEX_ENDS_IN_2 0x60
-#define SYSEX_ENDS_IN_3 0x70
-
-#define SYS_COMMON_1 0x50
-#define SYS_COMMON_2 0x20
-#define SYS_COMMON_3 0x30
+static midi_usb_batch_t usb_batch;
 
 static void usb_send_func(MidiDevice* device, uint16_t cnt, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
-    MIDI_EventPacket_t event;
-    event.Data1 = byte0;
-    event.Data2 = byte1;
-    event.Data3 = byte2;
-
-    uint8_t cable = 0;
-
-    // if the length is undefined we assume it is a SYSEX message
-    if (midi_packet_length(byte0) == UNDEFINED) {
-        switch (cnt) {
-            case 3:
-                if (byte2 == SYSEX_END)
-                    event.Event = MIDI_EVENT(cable, SYSEX_ENDS_IN_3);
-                else
-                    event.Event = MIDI_EVENT(cable, SYSEX_START_OR_CONT);
-                break;
-            case 2:
-                if (byte1 == SYSEX_END)
-                    event.Event = MIDI_EVENT(cable, SYSEX_ENDS_IN_2);
-                else
-                    event.Event = MIDI_EVENT(cable, SYSEX_START_OR_CONT);
-                break;
-            case 1:
-                if (byte0 == SYSEX_END)
-                    event.Event = MIDI_EVENT(cable, SYSEX_ENDS_IN_1);
-                else
-                    event.Event = MIDI_EVENT(cable, SYSEX_START_OR_CONT);
-                break;
-            default:
-                return; // invalid cnt
-        }
-    } else {
-        // deal with 'system common' messages
-        // TODO are there any more?
-        switch (byte0 & 0xF0) {
-            case MIDI_SONGPOSITION:
-                event.Event = MIDI_EVENT(cable, SYS_COMMON_3);
-                break;
-            case MIDI_SONGSELECT:
-            case MIDI_TC_QUARTERFRAME:
-                event.Event = MIDI_EVENT(cable, SYS_COMMON_2);
-                break;
-            default:
-                event.Event = MIDI_EVENT(cable, byte0);
-                break;
-        }
+    midi_usb_packet_t packet;
+    if (midi_usb_packet_encode(&packet, 0, cnt, byte0, byte1, byte2)) {
+        midi_send_usb_packet(packet);
     }
-
-    send_midi_packet(&event);
 }
 
 static void usb_get_midi(MidiDevice* device) {
     MIDI_EventPacket_t event;
     while (recv_midi_packet(&event)) {
-        midi_packet_length_t length = midi_packet_length(event.Data1);
-        uint8_t              input[3];
-        input[0] = event.Data1;
-        input[1] = event.Data2;
-        input[2] = event.Data3;
-        if (length == UNDEFINED) {
-            // sysex
-            if (event.Event == MIDI_EVENT(0, SYSEX_START_OR_CONT) || event.Event == MIDI_EVENT(0, SYSEX_ENDS_IN_3)) {
-                length = 3;
-            } else if (event.Event == MIDI_EVENT(0, SYSEX_ENDS_IN_2)) {
-                length = 2;
-            } else if (event.Event == MIDI_EVENT(0, SYSEX_ENDS_IN_1)) {
-                length = 1;
-            } else {
-                // XXX what to do?
-            }
-        }
+        midi_usb_packet_t packet = {event.Event, {event.Data1, event.Data2, event.Data3}};
+        uint8_t           length = midi_usb_packet_length(&packet);
 
         // pass the data to the device input function
-        if (length != UNDEFINED) midi_device_input(device, length, input);
+        if (length) midi_device_input(device, length, packet.data);
     }
 }
 
+void midi_send_usb_packet(midi_usb_packet_t packet) {
+    midi_usb_batch_add(&usb_batch, packet);
+}
+
+void midi_flush_usb_packets(void) {
+    midi_usb_batch_flush(&usb_batch);
+}
+
 static void fallthrough_callback(MidiDevice* device, uint16_t cnt, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
 #ifdef AUDIO_ENABLE
     if (cnt == 3) {
@@ -133,6 +74,7 @@ void setup_midi(void) {
     midi_init();
 #endif
     midi_device_init(&midi_device);
+    midi_usb_batch_init(&usb_batch, send_midi_packets);
     midi_device_set_send_func(&midi_device, usb_send_func);
     midi_device_set_pre_input_process_func(&midi_device, usb_get_midi);
     midi_register_fallthrough_callback(&midi_device, fallthrough_callback);
@@ -2,9 +2,13 @@
 
 #ifdef MIDI_ENABLE
 #    include "midi.h"
+#    include "midi_usb_packet.h"
 #    include <LUFA/Drivers/USB/USB.h>
 extern MidiDevice midi_device;
 void              setup_midi(void);
 void              send_midi_packet(MIDI_EventPacket_t* event);
 bool              recv_midi_packet(MIDI_EventPacket_t* const event);
+void              send_midi_packets(const midi_usb_packet_t* packets, uint8_t count);
+void              midi_send_usb_packet(midi_usb_packet_t packet);
+void              midi_flush_usb_packets(void);
 #endif
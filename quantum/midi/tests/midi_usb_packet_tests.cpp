@@ -0,0 +1,239 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "midi.h"
+#include "midi_usb_packet.h"
+}
+
+namespace {
+
+std::vector<std::vector<midi_usb_packet_t>> transfers;
+midi_usb_batch_t                            batch;
+
+void capture_transfer(const midi_usb_packet_t* packets, uint8_t count) {
+    transfers.emplace_back(packets, packets + count);
+}
+
+// The QMK device's send function: the byte API on top of packets
+void batched_send_func(MidiDevice* device, uint16_t cnt, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
+    midi_usb_packet_t packet;
+    if (midi_usb_packet_encode(&packet, 0, cnt, byte0, byte1, byte2)) {
+        midi_usb_batch_add(&batch, packet);
+    }
+}
+
+std::vector<midi_usb_packet_t> sent_packets() {
+    std::vector<midi_usb_packet_t> packets;
+    for (auto& transfer : transfers) {
+        packets.insert(packets.end(), transfer.begin(), transfer.end());
+    }
+    return packets;
+}
+
+void expect_packet(const midi_usb_packet_t& packet, uint8_t header, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
+    EXPECT_EQ(packet.header, header);
+    EXPECT_EQ(packet.data[0], byte0);
+    EXPECT_EQ(packet.data[1], byte1);
+    EXPECT_EQ(packet.data[2], byte2);
+}
+
+} // namespace
+
+class MidiUsbPacket : public ::testing::Test {
+   protected:
+    MidiDevice device;
+
+    void SetUp() override {
+        transfers.clear();
+        midi_usb_batch_init(&batch, capture_transfer);
+        midi_device_init(&device);
+        midi_device_set_send_func(&device, batched_send_func);
+    }
+};
+
+TEST_F(MidiUsbPacket, ChannelMessagesMatchTheConstructors) {
+    midi_send_noteon(&device, 3, 60, 100);
+    midi_send_noteoff(&device, 3, 60, 0);
+    midi_send_cc(&device, 15, 7, 127);
+    midi_send_pitchbend(&device, 0, 0);
+    midi_send_programchange(&device, 1, 5);
+    midi_usb_batch_flush(&batch);
+
+    auto packets = sent_packets();
+    ASSERT_EQ(packets.size(), 5);
+    const midi_usb_packet_t expected[] = {
+        midi_usb_packet_noteon(0, 3, 60, 100),
+        midi_usb_packet_noteoff(0, 3, 60, 0),
+        midi_usb_packet_cc(0, 15, 7, 127),
+    };
+    EXPECT_EQ(0, memcmp(packets.data(), expected, sizeof(expected)));
+    expect_packet(packets[0], 0x09, 0x93, 60, 100);
+    expect_packet(packets[3], 0x0E, 0xE0, 0x00, 0x40);
+    expect_packet(packets[4], 0x0C, 0xC1, 5, 0);
+}
+
+TEST_F(MidiUsbPacket, SystemMessagesUseTheirCodeIndex) {
+    midi_send_clock(&device);
+    midi_send_songposition(&device, 0x81);
+    midi_send_songselect(&device, 2);
+    midi_send_tcquarterframe(&device, 9);
+    midi_send_tunerequest(&device);
+    midi_usb_batch_flush(&batch);
+
+    auto packets = sent_packets();
+    ASSERT_EQ(packets.size(), 5);
+    expect_packet(packets[0], 0x0F, MIDI_CLOCK, 0, 0);
+    expect_packet(packets[1], 0x03, MIDI_SONGPOSITION, 0x01, 0x01);
+    expect_packet(packets[2], 0x02, MIDI_SONGSELECT, 2, 0);
+    expect_packet(packets[3], 0x02, MIDI_TC_QUARTERFRAME, 9, 0);
+    expect_packet(packets[4], 0x05, MIDI_TUNEREQUEST, 0, 0);
+}
+
+TEST_F(MidiUsbPacket, SysexEndsInEachPosition) {
+    uint8_t ends_in_1[] = {SYSEX_BEGIN, 1, 2, SYSEX_END};
+    uint8_t ends_in_2[] = {SYSEX_BEGIN, 1, 2, 3, SYSEX_END};
+    uint8_t ends_in_3[] = {SYSEX_BEGIN, 1, SYSEX_END};
+    midi_send_array(&device, sizeof(ends_in_1), ends_in_1);
+    midi_send_array(&device, sizeof(ends_in_2), ends_in_2);
+    midi_send_array(&device, sizeof(ends_in_3), ends_in_3);
+    midi_usb_batch_flush(&batch);
+
+    auto packets = sent_packets();
+    ASSERT_EQ(packets.size(), 5);
+    expect_packet(packets[0], 0x04, SYSEX_BEGIN, 1, 2);
+    expect_packet(packets[1], 0x05, SYSEX_END, 0, 0);
+    expect_packet(packets[2], 0x04, SYSEX_BEGIN, 1, 2);
+    expect_packet(packets[3], 0x06, 3, SYSEX_END, 0);
+    expect_packet(packets[4], 0x07, SYSEX_BEGIN, 1, SYSEX_END);
+
+    const uint8_t lengths[] = {3, 1, 3, 2, 3};
+    for (size_t i = 0; i < packets.size(); i++) {
+        EXPECT_EQ(midi_usb_packet_length(&packets[i]), lengths[i]) << "packet " << i;
+    }
+}
+
+TEST_F(MidiUsbPacket, CableNumberIsKept) {
+    midi_usb_packet_t packet;
+    ASSERT_TRUE(midi_usb_packet_encode(&packet, 2, 3, 0x91, 64, 1));
+    expect_packet(packet, 0x29, 0x91, 64, 1);
+    EXPECT_FALSE(midi_usb_packet_encode(&packet, 0, 4, SYSEX_BEGIN, 1, 2));
+}
+
+TEST_F(MidiUsbPacket, BatchesFillWholeTransfers) {
+    for (int i = 0; i < 2 * MIDI_USB_BATCH_SIZE + 3; i++) {
+        midi_usb_batch_add(&batch, midi_usb_packet_noteon(0, 0, i, 1));
+    }
+    ASSERT_EQ(transfers.size(), 2);
+    EXPECT_EQ(transfers[0].size(), MIDI_USB_BATCH_SIZE);
+    EXPECT_EQ(transfers[1].size(), MIDI_USB_BATCH_SIZE);
+
+    midi_usb_batch_flush(&batch);
+    ASSERT_EQ(transfers.size(), 3);
+    EXPECT_EQ(transfers[2].size(), 3);
+
+    // Nothing left to send
+    midi_usb_batch_flush(&batch);
+    EXPECT_EQ(transfers.size(), 3);
+
+    auto packets = sent_packets();
+    for (size_t i = 0; i < packets.size(); i++) {
+        EXPECT_EQ(packets[i].data[1], i);
+    }
+}
+
+namespace {
+
+uint8_t received_notes;
+
+void count_noteon(MidiDevice* device, uint8_t chan, uint8_t num, uint8_t vel) {
+    received_notes++;
+}
+
+} // namespace
+
+TEST_F(MidiUsbPacket, ReceivedPacketsReachTheCallbacks) {
+    received_notes = 0;
+    midi_register_noteon_callback(&device, count_noteon);
+
+    midi_usb_packet_t packets[] = {
+        midi_usb_packet_noteon(0, 0, 60, 100),
+        midi_usb_packet_noteon(0, 1, 62, 100),
+        {0x00, {0x90, 1, 1}}, // reserved code index, dropped
+    };
+    for (auto& packet : packets) {
+        uint8_t length = midi_usb_packet_length(&packet);
+        if (length) midi_device_input(&device, length, packet.data);
+    }
+    midi_device_process(&device);
+    EXPECT_EQ(received_notes, 2);
+}
+
+namespace {
+
+// Stands in for an endpoint: every transfer costs a copy and a flush
+uint8_t  endpoint[64];
+uint32_t endpoint_transfers;
+
+void endpoint_transfer(const midi_usb_packet_t* packets, uint8_t count) {
+    memcpy(endpoint, packets, count * sizeof(midi_usb_packet_t));
+    endpoint_transfers++;
+}
+
+// The previous send function, one transfer per message
+void unbatched_send_func(MidiDevice* device, uint16_t cnt, uint8_t byte0, uint8_t byte1, uint8_t byte2) {
+    midi_usb_packet_t packet;
+    if (midi_usb_packet_encode(&packet, 0, cnt, byte0, byte1, byte2)) {
+        endpoint_transfer(&packet, 1);
+    }
+}
+
+} // namespace
+
+TEST_F(MidiUsbPacket, Benchmark) {
+    // A dense sequencer step: 8 tracks switching notes every pass of the main loop
+    constexpr int kPasses = 50000;
+    constexpr int kTracks = 8;
+
+    auto measure = [&](const char* name, auto&& pass) {
+        endpoint_transfers = 0;
+        midi_usb_batch_init(&batch, endpoint_transfer);
+        auto start = std::chrono::steady_clock::now();
+        for (int p = 0; p < kPasses; p++) {
+            pass(p);
+            midi_usb_batch_flush(&batch);
+        }
+        double ns    = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+        int    notes = kPasses * kTracks * 2;
+        std::printf("%-22s %8.1f ns/message %8.3f transfers/message\n", name, ns / notes, (double)endpoint_transfers / notes);
+    };
+
+    std::printf("\nUSB-MIDI output, %d tracks\n", kTracks);
+    midi_device_set_send_func(&device, unbatched_send_func);
+    measure("bytes, per message", [&](int p) {
+        for (int t = 0; t < kTracks; t++) {
+            midi_send_noteoff(&device, t, (p + t) & 0x7F, 0);
+            midi_send_noteon(&device, t, (p + t + 1) & 0x7F, 100);
+        }
+    });
+    midi_device_set_send_func(&device, batched_send_func);
+    measure("bytes, batched", [&](int p) {
+        for (int t = 0; t < kTracks; t++) {
+            midi_send_noteoff(&device, t, (p + t) & 0x7F, 0);
+            midi_send_noteon(&device, t, (p + t + 1) & 0x7F, 100);
+        }
+    });
+    measure("packets, batched", [&](int p) {
+        for (int t = 0; t < kTracks; t++) {
+            midi_usb_batch_add(&batch, midi_usb_packet_noteoff(0, t, (p + t) & 0x7F, 0));
+            midi_usb_batch_add(&batch, midi_usb_packet_noteon(0, t, (p + t + 1) & 0x7F, 100));
+        }
+    });
+}
@@ -0,0 +1,8 @@
+midi_usb_packet_DEFS := -DNO_DEBUG
+midi_usb_packet_INC := $(QUANTUM_PATH)/midi
+
+midi_usb_packet_SRC := \
+	$(QUANTUM_PATH)/midi/tests/midi_usb_packet_tests.cpp \
+	$(QUANTUM_PATH)/midi/midi_usb_packet.c \
+	$(QUANTUM_PATH)/midi/midi.c \
+	$(QUANTUM_PATH)/midi/midi_device.c
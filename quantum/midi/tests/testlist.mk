@@ -0,0 +1 @@
+TEST_LIST += midi_usb_packet
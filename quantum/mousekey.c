@@ -92,6 +92,32 @@ uint8_t mk_wheel_time_to_max = MOUSEKEY_WHEEL_TIME_TO_MAX;
 
 /* Default accelerated mode */
 
+#                ifdef MOUSEKEY_ACCEL_CURVE
+#                    include "pointing_device_accel.h"
+#                    ifndef MOUSEKEY_ACCEL_SHAPE
+#                        define MOUSEKEY_ACCEL_SHAPE 512
+#                    endif
+
+static pointing_device_accel_table_t mousekey_accel_table;
+static uint8_t                       mousekey_accel_table_time = 0; // mk_time_to_max the table was built for
+
+/* fraction of the maximum speed reached after the given number of repeats, out of 256 */
+static uint16_t mousekey_accel_ramp(uint8_t repeat) {
+    if (mousekey_accel_table_time != mk_time_to_max) {
+        pointing_device_accel_config_t config = {
+            .curve     = MOUSEKEY_ACCEL_CURVE,
+            .input_max = mk_time_to_max,
+            .gain_min  = 0,
+            .gain_max  = POINTING_DEVICE_ACCEL_GAIN_ONE,
+            .shape     = MOUSEKEY_ACCEL_SHAPE,
+        };
+        pointing_device_accel_build(&mousekey_accel_table, &config);
+        mousekey_accel_table_time = mk_time_to_max;
+    }
+    return pointing_device_accel_gain(&mousekey_accel_table, repeat);
+}
+#                endif
+
 static uint8_t move_unit(void) {
     uint16_t unit;
     if (mousekey_accel & (1 << 0)) {
@@ -105,7 +131,11 @@ static uint8_t move_unit(void) {
     } else if (mousekey_repeat >= mk_time_to_max) {
         unit = MOUSEKEY_MOVE_DELTA * mk_max_speed;
     } else {
+#                ifdef MOUSEKEY_ACCEL_CURVE
+        unit = ((uint32_t)MOUSEKEY_MOVE_DELTA * mk_max_speed * mousekey_accel_ramp(mousekey_repeat)) >> POINTING_DEVICE_ACCEL_GAIN_SHIFT;
+#                else
         unit = (MOUSEKEY_MOVE_DELTA * mk_max_speed * mousekey_repeat) / mk_time_to_max;
+#                endif
     }
     return (unit > MOUSEKEY_MOVE_MAX ? MOUSEKEY_MOVE_MAX : (unit == 0 ? 1 : unit));
 }
@@ -90,13 +90,20 @@ __attribute__((weak)) report_mouse_t pointing_device_driver_get_report(report_mo
 __attribute__((weak)) uint16_t pointing_device_driver_get_cpi(void) {
     return 0;
 }
-__attribute__((weak)) void pointing_device_driver_set_cpi(uint16_t cpi) {}
+__attribute__((weak)) void           pointing_device_driver_set_cpi(uint16_t cpi) {}
+__attribute__((weak)) report_mouse_t pointing_device_driver_get_report_unclamped(report_mouse_t mouse_report, int16_t *x, int16_t *y) {
+    mouse_report = pointing_device_driver_get_report(mouse_report);
+    *x           = mouse_report.x;
+    *y           = mouse_report.y;
+    return mouse_report;
+}
 
 const pointing_device_driver_t custom_pointing_device_driver = {
-    .init       = pointing_device_driver_init,
-    .get_report = pointing_device_driver_get_report,
-    .get_cpi    = pointing_device_driver_get_cpi,
-    .set_cpi    = pointing_device_driver_set_cpi,
+    .init                 = pointing_device_driver_init,
+    .get_report           = pointing_device_driver_get_report,
+    .get_cpi              = pointing_device_driver_get_cpi,
+    .set_cpi              = pointing_device_driver_set_cpi,
+    .get_report_unclamped = pointing_device_driver_get_report_unclamped,
 };
 #endif
 
@@ -177,6 +184,9 @@ __attribute__((weak)) void pointing_device_init(void) {
 #endif
     }
 
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+    pointing_device_accel_init();
+#endif
     pointing_device_init_kb();
     pointing_device_init_user();
 }
@@ -239,6 +249,207 @@ report_mouse_t pointing_device_adjust_by_defines(report_mouse_t mouse_report) {
     return mouse_report;
 }
 
+#if defined(POINTING_DEVICE_ACCEL_ENABLE) && !(defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)) && !defined(POINTING_DEVICE_ACCUMULATE)
+/**
+ * @brief Applies the pointer acceleration curve to the mouse report
+ *
+ * @param mouse_report[in] takes a report_mouse_t to be accelerated
+ * @return report_mouse_t with accelerated x and y values
+ */
+static report_mouse_t pointing_device_accelerate(report_mouse_t mouse_report) {
+    int16_t x = mouse_report.x;
+    int16_t y = mouse_report.y;
+    pointing_device_accel_apply_default(&x, &y);
+    mouse_report.x = CONSTRAIN_HID_XY(x);
+    mouse_report.y = CONSTRAIN_HID_XY(y);
+    return mouse_report;
+}
+#endif
+
+#ifdef POINTING_DEVICE_ACCUMULATE
+/*
+    Decoupled motion pipeline.
+
+    The sampling stage reads the sensor on every call, as often as the keyboard
+    loop allows, and adds the movement to 32 bit accumulators. Drivers that
+    implement get_report_unclamped pass their full movement on, so it is not
+    clamped to the report range before it is accumulated. The report stage
+    runs once per POINTING_DEVICE_REPORT_INTERVAL_MS and takes as much of the
+    accumulated movement as fits in a report, leaving the rest for the next
+    one, so no motion is lost to clamping at high CPI. With
+    POINTING_DEVICE_ACCEL_ENABLE, the curve is applied to the whole movement
+    since the last report before that, and the accelerated movement that does
+    not fit is carried over the same way.
+
+    Keyboards with long running tasks can call pointing_device_sample() from
+    within them to keep the sensor sampled.
+*/
+typedef struct {
+    int32_t x;
+    int32_t y;
+    int32_t h;
+    int32_t v;
+} pointing_device_motion_t;
+
+static pointing_device_motion_t         accumulated_motion = {};
+#    ifdef POINTING_DEVICE_ACCEL_ENABLE
+// Accelerated movement that did not fit in the reports yet
+static int32_t accelerated_x = 0;
+static int32_t accelerated_y = 0;
+#    endif
+static pointing_device_pipeline_stats_t pipeline_stats     = {};
+static uint8_t                          pending_samples    = 0;
+
+/**
+ * @brief Monotonic timestamp used to measure the pipeline stages, in microseconds
+ *
+ * The default implementation uses the microsecond timer on platforms that have one. Elsewhere it is derived from the millisecond timer, so stages measure in steps of 1000us, and keyboards with a finer time source may override it.
+ *
+ * @return uint32_t timestamp
+ */
+__attribute__((weak)) uint32_t pointing_device_timestamp(void) {
+#ifdef TIMER_US_AVAILABLE
+    return timer_read_us32();
+#else
+    return timer_read32() * 1000;
+#endif
+}
+
+static inline uint16_t pointing_device_clamp_duration(uint32_t duration) {
+    return duration > UINT16_MAX ? UINT16_MAX : duration;
+}
+
+/**
+ * @brief Adds a delta to an accumulator, saturating instead of overflowing
+ */
+static inline int32_t pointing_device_accumulate(int32_t accumulator, int32_t delta) {
+    if (delta > 0 && accumulator > INT32_MAX - delta) {
+        return INT32_MAX;
+    }
+    if (delta < 0 && accumulator < INT32_MIN - delta) {
+        return INT32_MIN;
+    }
+    return accumulator + delta;
+}
+
+/**
+ * @brief Takes at most limit from either direction out of an accumulator
+ *
+ * The range is kept symmetric so that the rotation and inversion defines can negate the result.
+ */
+static inline int32_t pointing_device_take(int32_t *accumulator, int32_t limit) {
+    int32_t value = *accumulator;
+    if (value > limit) {
+        value = limit;
+    } else if (value < -limit) {
+        value = -limit;
+    }
+    *accumulator -= value;
+    return value;
+}
+
+/**
+ * @brief Samples the pointing device sensor, accumulating its movement
+ *
+ * Part of the decoupled motion pipeline enabled by POINTING_DEVICE_ACCUMULATE. Called from pointing_device_task, and may be called from any
+ * other long running task to increase the sampling rate. Buttons are applied to the report straight away.
+ */
+void pointing_device_sample(void) {
+#    if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
+    static uint32_t last_exec = 0;
+    if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
+        return;
+    }
+    last_exec = timer_read32();
+#    endif
+
+#    ifdef POINTING_DEVICE_MOTION_PIN
+#        ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+    if (gpio_read_pin(POINTING_DEVICE_MOTION_PIN)) {
+#        else
+    if (!gpio_read_pin(POINTING_DEVICE_MOTION_PIN)) {
+#        endif
+        return;
+    }
+#    endif
+
+    uint32_t       start  = pointing_device_timestamp();
+    report_mouse_t sample = {.buttons = local_mouse_report.buttons};
+    int16_t        x      = 0;
+    int16_t        y      = 0;
+    if (pointing_device_driver->get_report_unclamped) {
+        sample = pointing_device_driver->get_report_unclamped(sample, &x, &y);
+    } else {
+        sample = pointing_device_driver->get_report(sample);
+        x      = sample.x;
+        y      = sample.y;
+    }
+
+    local_mouse_report.buttons = sample.buttons;
+    accumulated_motion.x       = pointing_device_accumulate(accumulated_motion.x, x);
+    accumulated_motion.y       = pointing_device_accumulate(accumulated_motion.y, y);
+    accumulated_motion.h       = pointing_device_accumulate(accumulated_motion.h, sample.h);
+    accumulated_motion.v       = pointing_device_accumulate(accumulated_motion.v, sample.v);
+
+    if (pending_samples < UINT8_MAX) {
+        pending_samples++;
+    }
+    pipeline_stats.samples++;
+    pipeline_stats.sample_time = pointing_device_clamp_duration(pointing_device_timestamp() - start);
+    if (pipeline_stats.sample_time > pipeline_stats.sample_time_max) {
+        pipeline_stats.sample_time_max = pipeline_stats.sample_time;
+    }
+}
+
+/**
+ * @brief Moves as much of the accumulated motion as fits into the report
+ *
+ * @param mouse_report[in] report_mouse_t with the current buttons
+ * @return report_mouse_t with the motion applied
+ */
+static report_mouse_t pointing_device_take_motion(report_mouse_t mouse_report) {
+#    ifdef POINTING_DEVICE_ACCEL_ENABLE
+    int16_t x = pointing_device_take(&accumulated_motion.x, INT16_MAX);
+    int16_t y = pointing_device_take(&accumulated_motion.y, INT16_MAX);
+    pointing_device_accel_apply_default(&x, &y);
+    accelerated_x = pointing_device_accumulate(accelerated_x, x);
+    accelerated_y = pointing_device_accumulate(accelerated_y, y);
+
+    mouse_report.x = pointing_device_take(&accelerated_x, XY_REPORT_MAX);
+    mouse_report.y = pointing_device_take(&accelerated_y, XY_REPORT_MAX);
+#    else
+    mouse_report.x = pointing_device_take(&accumulated_motion.x, XY_REPORT_MAX);
+    mouse_report.y = pointing_device_take(&accumulated_motion.y, XY_REPORT_MAX);
+#    endif
+    mouse_report.h = pointing_device_take(&accumulated_motion.h, HV_REPORT_MAX);
+    mouse_report.v = pointing_device_take(&accumulated_motion.v, HV_REPORT_MAX);
+
+    pipeline_stats.samples_per_report = pending_samples;
+    pending_samples                   = 0;
+    return mouse_report;
+}
+
+/**
+ * @brief Gets the timing statistics of the motion pipeline
+ *
+ * NOTE : Only available when using POINTING_DEVICE_ACCUMULATE
+ *
+ * @return const pointing_device_pipeline_stats_t*
+ */
+const pointing_device_pipeline_stats_t *pointing_device_get_pipeline_stats(void) {
+    return &pipeline_stats;
+}
+
+/**
+ * @brief Resets the timing statistics of the motion pipeline
+ *
+ * NOTE : Only available when using POINTING_DEVICE_ACCUMULATE
+ */
+void pointing_device_reset_pipeline_stats(void) {
+    memset(&pipeline_stats, 0, sizeof(pipeline_stats));
+}
+#endif // POINTING_DEVICE_ACCUMULATE
+
 /**
  * @brief Retrieves and processes pointing device data.
  *
@@ -254,45 +465,58 @@ __attribute__((weak)) bool pointing_device_task(void) {
     };
 #endif
 
-#if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
+#if defined(POINTING_DEVICE_ACCUMULATE)
+    pointing_device_sample();
+
+    static uint32_t last_report = 0;
+    if (timer_elapsed32(last_report) < POINTING_DEVICE_REPORT_INTERVAL_MS) {
+        return false;
+    }
+    last_report = timer_read32();
+
+    uint32_t report_start = pointing_device_timestamp();
+    local_mouse_report    = pointing_device_take_motion(local_mouse_report);
+#else
+#    if (POINTING_DEVICE_TASK_THROTTLE_MS > 0)
     static uint32_t last_exec = 0;
     if (timer_elapsed32(last_exec) < POINTING_DEVICE_TASK_THROTTLE_MS) {
         return false;
     }
     last_exec = timer_read32();
-#endif
+#    endif
 
     // Gather report info
-#ifdef POINTING_DEVICE_MOTION_PIN
-#    if defined(SPLIT_POINTING_ENABLE)
-#        error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
-#    endif
-#    ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
+#    ifdef POINTING_DEVICE_MOTION_PIN
+#        if defined(SPLIT_POINTING_ENABLE)
+#            error POINTING_DEVICE_MOTION_PIN not supported when sharing the pointing device report between sides.
+#        endif
+#        ifdef POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
     if (!gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
-#    else
+#        else
     if (gpio_read_pin(POINTING_DEVICE_MOTION_PIN))
-#    endif
+#        endif
     {
-#endif
+#    endif
 
-#if defined(SPLIT_POINTING_ENABLE)
-#    if defined(POINTING_DEVICE_COMBINED)
+#    if defined(SPLIT_POINTING_ENABLE)
+#        if defined(POINTING_DEVICE_COMBINED)
         static uint8_t old_buttons = 0;
         local_mouse_report.buttons = old_buttons;
         local_mouse_report         = pointing_device_driver->get_report(local_mouse_report);
         old_buttons                = local_mouse_report.buttons;
-#    elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
+#        elif defined(POINTING_DEVICE_LEFT) || defined(POINTING_DEVICE_RIGHT)
         local_mouse_report = POINTING_DEVICE_THIS_SIDE ? pointing_device_driver->get_report(local_mouse_report) : shared_mouse_report;
+#        else
+#            error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
+#        endif
 #    else
-#        error "You need to define the side(s) the pointing device is on. POINTING_DEVICE_COMBINED / POINTING_DEVICE_LEFT / POINTING_DEVICE_RIGHT"
-#    endif
-#else
     local_mouse_report = pointing_device_driver->get_report(local_mouse_report);
-#endif // defined(SPLIT_POINTING_ENABLE)
+#    endif // defined(SPLIT_POINTING_ENABLE)
 
-#ifdef POINTING_DEVICE_MOTION_PIN
+#    ifdef POINTING_DEVICE_MOTION_PIN
     }
-#endif
+#    endif
+#endif // defined(POINTING_DEVICE_ACCUMULATE)
 
     // allow kb to intercept and modify report
 #if defined(SPLIT_POINTING_ENABLE) && defined(POINTING_DEVICE_COMBINED)
@@ -306,6 +530,9 @@ __attribute__((weak)) bool pointing_device_task(void) {
     local_mouse_report = is_keyboard_left() ? pointing_device_task_combined_kb(local_mouse_report, shared_mouse_report) : pointing_device_task_combined_kb(shared_mouse_report, local_mouse_report);
 #else
     local_mouse_report = pointing_device_adjust_by_defines(local_mouse_report);
+#    if defined(POINTING_DEVICE_ACCEL_ENABLE) && !defined(POINTING_DEVICE_ACCUMULATE)
+    local_mouse_report = pointing_device_accelerate(local_mouse_report);
+#    endif
     local_mouse_report = pointing_device_task_kb(local_mouse_report);
 #endif
     // automatic mouse layer function
@@ -321,6 +548,14 @@ __attribute__((weak)) bool pointing_device_task(void) {
     const bool send_report     = pointing_device_send() || pointing_device_force_send;
     pointing_device_force_send = false;
 
+#if defined(POINTING_DEVICE_ACCUMULATE)
+    pipeline_stats.reports++;
+    pipeline_stats.report_time = pointing_device_clamp_duration(pointing_device_timestamp() - report_start);
+    if (pipeline_stats.report_time > pipeline_stats.report_time_max) {
+        pipeline_stats.report_time_max = pipeline_stats.report_time;
+    }
+#endif
+
     return send_report;
 }
 
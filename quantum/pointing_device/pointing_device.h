@@ -26,12 +26,18 @@ typedef struct {
     report_mouse_t (*get_report)(report_mouse_t mouse_report);
     void (*set_cpi)(uint16_t);
     uint16_t (*get_cpi)(void);
+    // Optional, like get_report but passes the x/y movement out through x and y instead of clamping it to the report, may leave them untouched without movement
+    report_mouse_t (*get_report_unclamped)(report_mouse_t mouse_report, int16_t *x, int16_t *y);
 } pointing_device_driver_t;
 
 #ifdef POINTING_DEVICE_AUTO_MOUSE_ENABLE
 #    include "pointing_device_auto_mouse.h"
 #endif
 
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+#    include "pointing_device_accel.h"
+#endif
+
 #if defined(POINTING_DEVICE_DRIVER_adns5050)
 #    include "drivers/sensors/adns5050.h"
 #    define POINTING_DEVICE_MOTION_PIN_ACTIVE_LOW
@@ -78,6 +84,7 @@ void           pointing_device_driver_init(void);
 report_mouse_t pointing_device_driver_get_report(report_mouse_t mouse_report);
 uint16_t       pointing_device_driver_get_cpi(void);
 void           pointing_device_driver_set_cpi(uint16_t cpi);
+report_mouse_t pointing_device_driver_get_report_unclamped(report_mouse_t mouse_report, int16_t *x, int16_t *y);
 #endif
 
 typedef enum {
@@ -114,6 +121,38 @@ typedef int16_t hv_clamp_range_t;
 #define CONSTRAIN_HID(amt) ((amt) < INT8_MIN ? INT8_MIN : ((amt) > INT8_MAX ? INT8_MAX : (amt)))
 #define CONSTRAIN_HID_XY(amt) ((amt) < XY_REPORT_MIN ? XY_REPORT_MIN : ((amt) > XY_REPORT_MAX ? XY_REPORT_MAX : (amt)))
 
+#ifdef POINTING_DEVICE_ACCUMULATE
+#    if defined(SPLIT_POINTING_ENABLE)
+#        error POINTING_DEVICE_ACCUMULATE is not supported when sharing the pointing device report between sides.
+#    endif
+#    ifndef POINTING_DEVICE_REPORT_INTERVAL_MS
+#        ifdef USB_POLLING_INTERVAL_MS
+#            define POINTING_DEVICE_REPORT_INTERVAL_MS USB_POLLING_INTERVAL_MS
+#        else
+#            define POINTING_DEVICE_REPORT_INTERVAL_MS 1
+#        endif
+#    endif
+// Sample on every call, the report interval sets the report rate
+#    ifndef POINTING_DEVICE_TASK_THROTTLE_MS
+#        define POINTING_DEVICE_TASK_THROTTLE_MS 0
+#    endif
+
+typedef struct {
+    uint32_t samples;            // sensor samples taken
+    uint32_t reports;            // reports built from the accumulated motion
+    uint8_t  samples_per_report; // samples accumulated into the last report
+    uint16_t sample_time;        // duration of the last sample, in microseconds
+    uint16_t sample_time_max;    // longest sample, in microseconds
+    uint16_t report_time;        // duration of the last report stage, in microseconds
+    uint16_t report_time_max;    // longest report stage, in microseconds
+} pointing_device_pipeline_stats_t;
+
+void                                    pointing_device_sample(void);
+const pointing_device_pipeline_stats_t *pointing_device_get_pipeline_stats(void);
+void                                    pointing_device_reset_pipeline_stats(void);
+uint32_t                                pointing_device_timestamp(void);
+#endif
+
 void           pointing_device_init(void);
 bool           pointing_device_task(void);
 bool           pointing_device_send(void);
@@ -0,0 +1,182 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "pointing_device_accel.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * \brief Evaluates a piecewise linear curve through the configured points.
+ */
+static float pointing_device_accel_points(const pointing_device_accel_config_t *config, uint32_t input) {
+    const pointing_device_accel_point_t *points = config->points;
+    uint8_t                              count  = config->point_count;
+
+    if (input <= points[0].input) {
+        return points[0].gain;
+    }
+    for (uint8_t i = 1; i < count; i++) {
+        if (input <= points[i].input) {
+            float t = (float)(input - points[i - 1].input) / (points[i].input - points[i - 1].input);
+            return points[i - 1].gain + t * ((float)points[i].gain - points[i - 1].gain);
+        }
+    }
+    return points[count - 1].gain;
+}
+
+/**
+ * \brief Evaluates a curve at the given input.
+ */
+static uint16_t pointing_device_accel_evaluate(const pointing_device_accel_config_t *config, uint32_t input) {
+    if (config->curve == POINTING_DEVICE_ACCEL_CURVE_LINEAR && config->points && config->point_count > 0) {
+        return (uint16_t)(pointing_device_accel_points(config, input) + 0.5f);
+    }
+    if (config->input_max == 0 || input >= config->input_max) {
+        return config->gain_max;
+    }
+
+    float t = (float)input / config->input_max;
+    float ramp;
+    switch (config->curve) {
+        case POINTING_DEVICE_ACCEL_CURVE_SIGMOID: {
+            // Logistic function, rescaled so that the ramp starts at 0 and ends at 1
+            float k     = (float)config->shape / POINTING_DEVICE_ACCEL_GAIN_ONE;
+            float start = 1.0f / (1.0f + expf(k * 0.5f));
+            float end   = 1.0f / (1.0f + expf(-k * 0.5f));
+            ramp        = end > start ? (1.0f / (1.0f + expf(-k * (t - 0.5f))) - start) / (end - start) : t;
+        } break;
+        case POINTING_DEVICE_ACCEL_CURVE_POWER:
+            ramp = powf(t, (float)config->shape / POINTING_DEVICE_ACCEL_GAIN_ONE);
+            break;
+        default:
+            ramp = t;
+            break;
+    }
+
+    float gain = config->gain_min + ramp * ((float)config->gain_max - config->gain_min);
+    if (gain < 0) {
+        gain = 0;
+    } else if (gain > UINT16_MAX) {
+        gain = UINT16_MAX;
+    }
+    return (uint16_t)(gain + 0.5f);
+}
+
+void pointing_device_accel_build(pointing_device_accel_table_t *table, const pointing_device_accel_config_t *config) {
+    uint32_t input_max = config->input_max;
+    if (config->curve == POINTING_DEVICE_ACCEL_CURVE_LINEAR && config->points && config->point_count > 0) {
+        input_max = config->points[config->point_count - 1].input;
+    }
+
+    // Smallest power of two spacing for the table to cover the whole curve
+    uint8_t shift = 0;
+    while (((uint32_t)(POINTING_DEVICE_ACCEL_TABLE_SIZE - 1) << shift) < input_max && shift < 15) {
+        shift++;
+    }
+
+    table->shift = shift;
+    for (uint8_t i = 0; i < POINTING_DEVICE_ACCEL_TABLE_SIZE; i++) {
+        table->gain[i] = pointing_device_accel_evaluate(config, (uint32_t)i << shift);
+    }
+}
+
+uint16_t pointing_device_accel_gain(const pointing_device_accel_table_t *table, uint16_t input) {
+    uint16_t index = input >> table->shift;
+    if (index >= POINTING_DEVICE_ACCEL_TABLE_SIZE - 1) {
+        return table->gain[POINTING_DEVICE_ACCEL_TABLE_SIZE - 1];
+    }
+
+    int32_t fraction = input - (index << table->shift);
+    int32_t g0       = table->gain[index];
+    int32_t g1       = table->gain[index + 1];
+    return g0 + (((g1 - g0) * fraction) >> table->shift);
+}
+
+static inline int16_t pointing_device_accel_scale(int16_t value, uint16_t gain, int16_t *remainder) {
+    int32_t scaled = (int32_t)value * gain + *remainder;
+    int32_t counts = scaled >> POINTING_DEVICE_ACCEL_GAIN_SHIFT;
+    *remainder     = scaled - (counts << POINTING_DEVICE_ACCEL_GAIN_SHIFT);
+
+    if (counts > INT16_MAX) {
+        return INT16_MAX;
+    } else if (counts < -INT16_MAX) {
+        return -INT16_MAX;
+    }
+    return counts;
+}
+
+void pointing_device_accel_apply(const pointing_device_accel_table_t *table, pointing_device_accel_state_t *state, int16_t *x, int16_t *y) {
+    uint16_t ax = abs(*x);
+    uint16_t ay = abs(*y);
+
+    // Approximates the length of the movement without a square root, within 7%
+    uint16_t speed = ax > ay ? ax + ((3 * ay) >> 3) : ay + ((3 * ax) >> 3);
+    uint16_t gain  = pointing_device_accel_gain(table, speed);
+
+    *x = pointing_device_accel_scale(*x, gain, &state->x);
+    *y = pointing_device_accel_scale(*y, gain, &state->y);
+}
+
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+
+#    ifndef POINTING_DEVICE_ACCEL_CURVE
+#        define POINTING_DEVICE_ACCEL_CURVE POINTING_DEVICE_ACCEL_CURVE_POWER
+#    endif
+#    ifndef POINTING_DEVICE_ACCEL_INPUT_MAX
+#        define POINTING_DEVICE_ACCEL_INPUT_MAX 64
+#    endif
+#    ifndef POINTING_DEVICE_ACCEL_GAIN_MIN
+#        define POINTING_DEVICE_ACCEL_GAIN_MIN 256
+#    endif
+#    ifndef POINTING_DEVICE_ACCEL_GAIN_MAX
+#        define POINTING_DEVICE_ACCEL_GAIN_MAX 768
+#    endif
+#    ifndef POINTING_DEVICE_ACCEL_SHAPE
+#        define POINTING_DEVICE_ACCEL_SHAPE 512
+#    endif
+
+#    ifdef POINTING_DEVICE_ACCEL_POINTS
+static const pointing_device_accel_point_t accel_points[] = POINTING_DEVICE_ACCEL_POINTS;
+#    endif
+
+static pointing_device_accel_config_t accel_config = {
+    .curve     = POINTING_DEVICE_ACCEL_CURVE,
+    .input_max = POINTING_DEVICE_ACCEL_INPUT_MAX,
+    .gain_min  = POINTING_DEVICE_ACCEL_GAIN_MIN,
+    .gain_max  = POINTING_DEVICE_ACCEL_GAIN_MAX,
+    .shape     = POINTING_DEVICE_ACCEL_SHAPE,
+#    ifdef POINTING_DEVICE_ACCEL_POINTS
+    .points      = accel_points,
+    .point_count = sizeof(accel_points) / sizeof(accel_points[0]),
+#    endif
+};
+
+static pointing_device_accel_table_t accel_table;
+static pointing_device_accel_state_t accel_state;
+
+void pointing_device_accel_init(void) {
+    pointing_device_accel_build(&accel_table, &accel_config);
+    memset(&accel_state, 0, sizeof(accel_state));
+}
+
+/**
+ * \brief Replaces the acceleration curve of the pointing device, rebuilding its table.
+ */
+void pointing_device_accel_set_config(const pointing_device_accel_config_t *config) {
+    accel_config = *config;
+    pointing_device_accel_init();
+}
+
+const pointing_device_accel_config_t *pointing_device_accel_get_config(void) {
+    return &accel_config;
+}
+
+/**
+ * \brief Applies the pointing device acceleration curve to a movement.
+ */
+void pointing_device_accel_apply_default(int16_t *x, int16_t *y) {
+    pointing_device_accel_apply(&accel_table, &accel_state, x, y);
+}
+
+#endif // POINTING_DEVICE_ACCEL_ENABLE
@@ -0,0 +1,85 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+    Table driven pointer acceleration.
+
+    A curve maps an input (the speed of the pointer in counts per report, or
+    the number of repeats of a mousekey) to a gain. Curves are evaluated once
+    into a small lookup table whenever they are configured, so applying one
+    costs a table lookup, a linear interpolation and a few multiplications,
+    whatever the curve. Gains are fixed point with 8 fractional bits.
+*/
+
+#ifndef POINTING_DEVICE_ACCEL_TABLE_SIZE
+#    define POINTING_DEVICE_ACCEL_TABLE_SIZE 17
+#endif
+
+#if POINTING_DEVICE_ACCEL_TABLE_SIZE < 2 || POINTING_DEVICE_ACCEL_TABLE_SIZE > 255
+#    error "POINTING_DEVICE_ACCEL_TABLE_SIZE must be between 2 and 255"
+#endif
+
+#define POINTING_DEVICE_ACCEL_GAIN_SHIFT 8
+#define POINTING_DEVICE_ACCEL_GAIN_ONE (1 << POINTING_DEVICE_ACCEL_GAIN_SHIFT)
+
+typedef enum {
+    POINTING_DEVICE_ACCEL_CURVE_LINEAR,  // piecewise linear through the configured points, or from gain_min to gain_max without points
+    POINTING_DEVICE_ACCEL_CURVE_SIGMOID, // logistic ramp from gain_min to gain_max, centred on half of input_max, shape sets the steepness
+    POINTING_DEVICE_ACCEL_CURVE_POWER,   // gain_min + (gain_max - gain_min) * (input / input_max) ^ shape
+} pointing_device_accel_curve_t;
+
+typedef struct {
+    uint16_t input;
+    uint16_t gain;
+} pointing_device_accel_point_t;
+
+typedef struct {
+    pointing_device_accel_curve_t        curve;
+    uint16_t                             input_max;   // input at which the curve reaches gain_max, larger inputs use gain_max
+    uint16_t                             gain_min;    // gain at zero input
+    uint16_t                             gain_max;    // gain at input_max
+    uint16_t                             shape;       // sigmoid steepness or power exponent, fixed point with 8 fractional bits
+    const pointing_device_accel_point_t *points;      // points of the piecewise linear curve, sorted by input
+    uint8_t                              point_count; // number of points
+} pointing_device_accel_config_t;
+
+typedef struct {
+    uint16_t gain[POINTING_DEVICE_ACCEL_TABLE_SIZE];
+    uint8_t  shift; // inputs between two table entries, as a power of two
+} pointing_device_accel_table_t;
+
+typedef struct {
+    int16_t x; // sub-count remainders carried over to the next report, in 1/256 counts
+    int16_t y;
+} pointing_device_accel_state_t;
+
+/**
+ * \brief Evaluates a curve into a lookup table.
+ *
+ * Uses floating point for the sigmoid and power curves, so it should not be called on every report.
+ */
+void pointing_device_accel_build(pointing_device_accel_table_t *table, const pointing_device_accel_config_t *config);
+
+/**
+ * \brief Looks up the gain for the given input, interpolating between table entries.
+ */
+uint16_t pointing_device_accel_gain(const pointing_device_accel_table_t *table, uint16_t input);
+
+/**
+ * \brief Scales a movement by the gain for its speed.
+ *
+ * Fractions of a count are carried over in the state, so slow movements are not lost to rounding.
+ */
+void pointing_device_accel_apply(const pointing_device_accel_table_t *table, pointing_device_accel_state_t *state, int16_t *x, int16_t *y);
+
+#ifdef POINTING_DEVICE_ACCEL_ENABLE
+void                                  pointing_device_accel_init(void);
+void                                  pointing_device_accel_set_config(const pointing_device_accel_config_t *config);
+const pointing_device_accel_config_t *pointing_device_accel_get_config(void);
+void                                  pointing_device_accel_apply_default(int16_t *x, int16_t *y);
+#endif
@@ -0,0 +1,201 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+extern "C" {
+#include "pointing_device_accel.h"
+}
+
+#define GAIN_ONE POINTING_DEVICE_ACCEL_GAIN_ONE
+
+class PointingDeviceAccel : public ::testing::Test {
+   protected:
+    pointing_device_accel_table_t build(pointing_device_accel_curve_t curve, uint16_t input_max, uint16_t gain_min, uint16_t gain_max, uint16_t shape) {
+        pointing_device_accel_config_t config = {};
+        config.curve                          = curve;
+        config.input_max                      = input_max;
+        config.gain_min                       = gain_min;
+        config.gain_max                       = gain_max;
+        config.shape                          = shape;
+
+        pointing_device_accel_table_t table;
+        pointing_device_accel_build(&table, &config);
+        return table;
+    }
+};
+
+TEST_F(PointingDeviceAccel, LinearRamp) {
+    auto table = build(POINTING_DEVICE_ACCEL_CURVE_LINEAR, 64, GAIN_ONE, 3 * GAIN_ONE, 0);
+
+    EXPECT_EQ(pointing_device_accel_gain(&table, 0), GAIN_ONE);
+    EXPECT_EQ(pointing_device_accel_gain(&table, 32), 2 * GAIN_ONE);
+    EXPECT_EQ(pointing_device_accel_gain(&table, 33), 2 * GAIN_ONE + 8);
+    EXPECT_EQ(pointing_device_accel_gain(&table, 64), 3 * GAIN_ONE);
+    EXPECT_EQ(pointing_device_accel_gain(&table, 1000), 3 * GAIN_ONE);
+}
+
+TEST_F(PointingDeviceAccel, PiecewiseLinearPoints) {
+    const pointing_device_accel_point_t points[] = {{4, GAIN_ONE}, {8, 2 * GAIN_ONE}, {40, 2 * GAIN_ONE}};
+
+    pointing_device_accel_config_t config = {};
+    config.curve                          = POINTING_DEVICE_ACCEL_CURVE_LINEAR;
+    config.points                         = points;
+    config.point_count                    = 3;
+
+    pointing_device_accel_table_t table;
+    pointing_device_accel_build(&table, &config);
+
+    EXPECT_EQ(pointing_device_accel_gain(&table, 0), GAIN_ONE);
+    EXPECT_EQ(pointing_device_accel_gain(&table, 4), GAIN_ONE);
+    EXPECT_EQ(pointing_device_accel_gain(&table, 6), GAIN_ONE + GAIN_ONE / 2);
+    EXPECT_EQ(pointing_device_accel_gain(&table, 8), 2 * GAIN_ONE);
+    EXPECT_EQ(pointing_device_accel_gain(&table, 30), 2 * GAIN_ONE);
+    EXPECT_EQ(pointing_device_accel_gain(&table, 200), 2 * GAIN_ONE);
+}
+
+TEST_F(PointingDeviceAccel, PowerCurve) {
+    // Quadratic ramp from 0 to 1
+    auto table = build(POINTING_DEVICE_ACCEL_CURVE_POWER, 256, 0, GAIN_ONE, 2 * GAIN_ONE);
+
+    EXPECT_EQ(pointing_device_accel_gain(&table, 0), 0);
+    EXPECT_EQ(pointing_device_accel_gain(&table, 64), GAIN_ONE / 16);
+    EXPECT_EQ(pointing_device_accel_gain(&table, 128), GAIN_ONE / 4);
+    EXPECT_EQ(pointing_device_accel_gain(&table, 256), GAIN_ONE);
+
+    // Between table entries the curve is interpolated, stay within a few percent of the exact value
+    for (uint16_t input = 0; input <= 256; input++) {
+        float exact = GAIN_ONE * (input / 256.0f) * (input / 256.0f);
+        EXPECT_NEAR(pointing_device_accel_gain(&table, input), exact, 2.0f) << "input " << input;
+    }
+}
+
+TEST_F(PointingDeviceAccel, SigmoidCurve) {
+    auto table = build(POINTING_DEVICE_ACCEL_CURVE_SIGMOID, 64, GAIN_ONE, 3 * GAIN_ONE, 10 * GAIN_ONE);
+
+    EXPECT_EQ(pointing_device_accel_gain(&table, 0), GAIN_ONE);
+    EXPECT_EQ(pointing_device_accel_gain(&table, 32), 2 * GAIN_ONE);
+    EXPECT_EQ(pointing_device_accel_gain(&table, 64), 3 * GAIN_ONE);
+
+    // Flat at both ends, steep in the middle
+    EXPECT_LT(pointing_device_accel_gain(&table, 8) - GAIN_ONE, 32);
+    EXPECT_LT(3 * GAIN_ONE - pointing_device_accel_gain(&table, 56), 32);
+    EXPECT_GT(pointing_device_accel_gain(&table, 36) - pointing_device_accel_gain(&table, 28), 128);
+}
+
+TEST_F(PointingDeviceAccel, GainIsMonotonic) {
+    const pointing_device_accel_curve_t curves[] = {POINTING_DEVICE_ACCEL_CURVE_LINEAR, POINTING_DEVICE_ACCEL_CURVE_SIGMOID, POINTING_DEVICE_ACCEL_CURVE_POWER};
+
+    for (auto curve : curves) {
+        auto     table    = build(curve, 100, GAIN_ONE / 2, 4 * GAIN_ONE, 3 * GAIN_ONE);
+        uint16_t previous = 0;
+        for (uint16_t input = 0; input < 512; input++) {
+            uint16_t gain = pointing_device_accel_gain(&table, input);
+            EXPECT_GE(gain, previous) << "curve " << curve << " input " << input;
+            previous = gain;
+        }
+    }
+}
+
+TEST_F(PointingDeviceAccel, UnityGainLeavesMovementUnchanged) {
+    auto                          table = build(POINTING_DEVICE_ACCEL_CURVE_LINEAR, 64, GAIN_ONE, GAIN_ONE, 0);
+    pointing_device_accel_state_t state = {};
+
+    for (int16_t value = -300; value <= 300; value += 7) {
+        int16_t x = value, y = -value / 2;
+        pointing_device_accel_apply(&table, &state, &x, &y);
+        EXPECT_EQ(x, value);
+        EXPECT_EQ(y, -value / 2);
+    }
+    EXPECT_EQ(state.x, 0);
+    EXPECT_EQ(state.y, 0);
+}
+
+TEST_F(PointingDeviceAccel, RemainderIsCarriedOver) {
+    // A third of a count per report
+    auto                          table = build(POINTING_DEVICE_ACCEL_CURVE_LINEAR, 64, GAIN_ONE / 3, GAIN_ONE / 3, 0);
+    pointing_device_accel_state_t state = {};
+
+    int32_t total_x = 0, total_y = 0;
+    for (int i = 0; i < 300; i++) {
+        int16_t x = 1, y = -1;
+        pointing_device_accel_apply(&table, &state, &x, &y);
+        total_x += x;
+        total_y += y;
+    }
+
+    // 300 * 85 / 256, slow movements are not lost to rounding
+    EXPECT_EQ(total_x, 99);
+    EXPECT_EQ(total_y, -100);
+}
+
+TEST_F(PointingDeviceAccel, SpeedUsesBothAxes) {
+    auto                          table = build(POINTING_DEVICE_ACCEL_CURVE_LINEAR, 16, GAIN_ONE, 2 * GAIN_ONE, 0);
+    pointing_device_accel_state_t state = {};
+
+    // |(8, 8)| is about 11, so both axes get the same gain of about 1.7
+    int16_t x = 8, y = 8;
+    pointing_device_accel_apply(&table, &state, &x, &y);
+    EXPECT_EQ(x, y);
+    EXPECT_GE(x, 13);
+    EXPECT_LE(x, 14);
+}
+
+TEST_F(PointingDeviceAccel, OutputSaturates) {
+    auto                          table = build(POINTING_DEVICE_ACCEL_CURVE_LINEAR, 64, 4 * GAIN_ONE, 4 * GAIN_ONE, 0);
+    pointing_device_accel_state_t state = {};
+
+    int16_t x = 20000, y = -20000;
+    pointing_device_accel_apply(&table, &state, &x, &y);
+    EXPECT_EQ(x, INT16_MAX);
+    EXPECT_EQ(y, -INT16_MAX);
+}
+
+TEST_F(PointingDeviceAccel, Benchmark) {
+    const uint32_t iterations = 1000000;
+    const struct {
+        pointing_device_accel_curve_t curve;
+        const char*                   name;
+    } curves[] = {
+        {POINTING_DEVICE_ACCEL_CURVE_LINEAR, "linear"},
+        {POINTING_DEVICE_ACCEL_CURVE_SIGMOID, "sigmoid"},
+        {POINTING_DEVICE_ACCEL_CURVE_POWER, "power"},
+    };
+
+    std::printf("\n%-16s %12s %12s\n", "curve", "ns/report", "ns/build");
+    for (auto& entry : curves) {
+        pointing_device_accel_config_t config = {};
+        config.curve                          = entry.curve;
+        config.input_max                      = 64;
+        config.gain_min                       = GAIN_ONE;
+        config.gain_max                       = 3 * GAIN_ONE;
+        config.shape                          = 2 * GAIN_ONE;
+
+        pointing_device_accel_table_t table;
+        auto                          start = std::chrono::steady_clock::now();
+        pointing_device_accel_build(&table, &config);
+        auto build_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+        pointing_device_accel_state_t state = {};
+        uint32_t                      seed  = 1;
+        int32_t                       sum   = 0;
+        start                               = std::chrono::steady_clock::now();
+        for (uint32_t i = 0; i < iterations; i++) {
+            seed      = seed * 1103515245 + 12345;
+            int16_t x = (int8_t)(seed >> 16);
+            int16_t y = (int8_t)(seed >> 24);
+            pointing_device_accel_apply(&table, &state, &x, &y);
+            sum += x + y;
+        }
+        auto apply_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+
+        std::printf("%-16s %12.2f %12lld\n", entry.name, (double)apply_ns / iterations, (long long)build_ns);
+        // Keeps the loop from being optimised away
+        EXPECT_NE(sum, INT32_MIN);
+    }
+    std::fflush(stdout);
+}
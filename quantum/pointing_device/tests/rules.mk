@@ -0,0 +1,6 @@
+pointing_device_accel_SRC := \
+    $(QUANTUM_PATH)/pointing_device/tests/pointing_device_accel.cpp \
+    $(QUANTUM_PATH)/pointing_device/pointing_device_accel.c
+
+pointing_device_accel_INC := \
+    $(QUANTUM_PATH)/pointing_device
@@ -0,0 +1 @@
+TEST_LIST += pointing_device_accel
@@ -24,11 +24,11 @@
 #ifdef MIDI_BASIC
 
 void process_midi_basic_noteon(uint8_t note) {
-    midi_send_noteon(&midi_device, 0, note, 127);
+    midi_send_usb_packet(midi_usb_packet_noteon(0, 0, note, 127));
 }
 
 void process_midi_basic_noteoff(uint8_t note) {
-    midi_send_noteoff(&midi_device, 0, note, 0);
+    midi_send_usb_packet(midi_usb_packet_noteoff(0, 0, note, 0));
 }
 
 void process_midi_all_notes_off(void) {
@@ -245,9 +245,8 @@ bool process_midi(uint16_t keycode, keyrecord_t *record) {
 
 #endif // MIDI_ADVANCED
 
-void midi_task(void) {
-    midi_device_process(&midi_device);
 #ifdef MIDI_ADVANCED
+static void midi_modulation_task(void) {
     if (timer_elapsed(midi_modulation_timer) < midi_config.modulation_interval) return;
     midi_modulation_timer = timer_read();
 
@@ -265,5 +264,14 @@ void midi_task(void) {
 
         if (midi_modulation > 127) midi_modulation = 127;
     }
+}
+#endif
+
+void midi_task(void) {
+    midi_device_process(&midi_device);
+#ifdef MIDI_ADVANCED
+    midi_modulation_task();
 #endif
+    // send everything queued during this pass in as few transfers as possible
+    midi_flush_usb_packets();
 }
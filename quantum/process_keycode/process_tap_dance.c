@@ -22,6 +22,7 @@
 #include "timer.h"
 #include "wait.h"
 #include "keymap_introspection.h"
+#include "progmem.h"
 
 static uint16_t active_td;
 static uint16_t last_tap_time;
@@ -80,64 +81,113 @@ void tap_dance_dual_role_reset(tap_dance_state_t *state, void *user_data) {
     }
 }
 
+static tap_dance_state_t tap_dance_states[TAP_DANCE_MAX_SIMULTANEOUS];
+
+tap_dance_state_t *tap_dance_get_state(uint8_t tap_dance_idx) {
+    for (uint8_t i = 0; i < TAP_DANCE_MAX_SIMULTANEOUS; i++) {
+        if (tap_dance_states[i].in_use && tap_dance_states[i].index == tap_dance_idx) {
+            return &tap_dance_states[i];
+        }
+    }
+    return NULL;
+}
+
+static tap_dance_state_t *tap_dance_acquire_state(uint8_t tap_dance_idx) {
+    tap_dance_state_t *state = tap_dance_get_state(tap_dance_idx);
+    if (state) {
+        return state;
+    }
+
+    for (uint8_t i = 0; i < TAP_DANCE_MAX_SIMULTANEOUS; i++) {
+        if (!tap_dance_states[i].in_use) {
+            state         = &tap_dance_states[i];
+            state->index  = tap_dance_idx;
+            state->in_use = true;
+            return state;
+        }
+    }
+    return NULL;
+}
+
+static inline void tap_dance_read_action(tap_dance_state_t *state, tap_dance_action_t *action) {
+    memcpy_P(action, tap_dance_get(state->index), sizeof(tap_dance_action_t));
+}
+
 static inline void _process_tap_dance_action_fn(tap_dance_state_t *state, void *user_data, tap_dance_user_fn_t fn) {
     if (fn) {
         fn(state, user_data);
     }
 }
 
-static inline void process_tap_dance_action_on_each_tap(tap_dance_action_t *action) {
-    action->state.count++;
-    action->state.weak_mods = get_mods();
-    action->state.weak_mods |= get_weak_mods();
+static inline void process_tap_dance_action_on_each_tap(tap_dance_state_t *state) {
+    tap_dance_action_t action;
+    tap_dance_read_action(state, &action);
+
+    state->count++;
+    state->weak_mods = get_mods();
+    state->weak_mods |= get_weak_mods();
 #ifndef NO_ACTION_ONESHOT
-    action->state.oneshot_mods = get_oneshot_mods();
+    state->oneshot_mods = get_oneshot_mods();
 #endif
-    _process_tap_dance_action_fn(&action->state, action->user_data, action->fn.on_each_tap);
+    _process_tap_dance_action_fn(state, action.user_data, action.fn.on_each_tap);
 }
 
-static inline void process_tap_dance_action_on_each_release(tap_dance_action_t *action) {
-    _process_tap_dance_action_fn(&action->state, action->user_data, action->fn.on_each_release);
+static inline void process_tap_dance_action_on_each_release(tap_dance_state_t *state) {
+    tap_dance_action_t action;
+    tap_dance_read_action(state, &action);
+
+    _process_tap_dance_action_fn(state, action.user_data, action.fn.on_each_release);
 }
 
-static inline void process_tap_dance_action_on_reset(tap_dance_action_t *action) {
-    _process_tap_dance_action_fn(&action->state, action->user_data, action->fn.on_reset);
-    del_weak_mods(action->state.weak_mods);
+static inline void process_tap_dance_action_on_reset(tap_dance_state_t *state) {
+    tap_dance_action_t action;
+    tap_dance_read_action(state, &action);
+
+    _process_tap_dance_action_fn(state, action.user_data, action.fn.on_reset);
+    del_weak_mods(state->weak_mods);
 #ifndef NO_ACTION_ONESHOT
-    del_mods(action->state.oneshot_mods);
+    del_mods(state->oneshot_mods);
 #endif
     send_keyboard_report();
-    action->state = (const tap_dance_state_t){0};
+    // Releases the state slot
+    *state = (const tap_dance_state_t){0};
 }
 
-static inline void process_tap_dance_action_on_dance_finished(tap_dance_action_t *action) {
-    if (!action->state.finished) {
-        action->state.finished = true;
-        add_weak_mods(action->state.weak_mods);
+static inline void process_tap_dance_action_on_dance_finished(tap_dance_state_t *state) {
+    if (!state->finished) {
+        tap_dance_action_t action;
+        tap_dance_read_action(state, &action);
+
+        state->finished = true;
+        add_weak_mods(state->weak_mods);
 #ifndef NO_ACTION_ONESHOT
-        add_mods(action->state.oneshot_mods);
+        add_mods(state->oneshot_mods);
 #endif
         send_keyboard_report();
-        _process_tap_dance_action_fn(&action->state, action->user_data, action->fn.on_dance_finished);
+        _process_tap_dance_action_fn(state, action.user_data, action.fn.on_dance_finished);
     }
     active_td = 0;
-    if (!action->state.pressed) {
+    if (!state->pressed) {
         // There will not be a key release event, so reset now.
-        process_tap_dance_action_on_reset(action);
+        process_tap_dance_action_on_reset(state);
     }
 }
 
 bool preprocess_tap_dance(uint16_t keycode, keyrecord_t *record) {
-    tap_dance_action_t *action;
+    tap_dance_state_t *state;
 
     if (!record->event.pressed) return false;
 
     if (!active_td || keycode == active_td) return false;
 
-    action                             = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
-    action->state.interrupted          = true;
-    action->state.interrupting_keycode = keycode;
-    process_tap_dance_action_on_dance_finished(action);
+    state = tap_dance_get_state(QK_TAP_DANCE_GET_INDEX(active_td));
+    if (state == NULL) {
+        active_td = 0;
+        return false;
+    }
+    state->interrupted          = true;
+    state->interrupting_keycode = keycode;
+    process_tap_dance_action_on_dance_finished(state);
 
     // Tap dance actions can leave some weak mods active (e.g., if the tap dance is mapped to a keycode with
     // modifiers), but these weak mods should not affect the keypress which interrupted the tap dance.
@@ -151,8 +201,8 @@ bool preprocess_tap_dance(uint16_t keycode, keyrecord_t *record) {
 }
 
 bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
-    int                 td_index;
-    tap_dance_action_t *action;
+    int                td_index;
+    tap_dance_state_t *state;
 
     switch (keycode) {
         case QK_TAP_DANCE ... QK_TAP_DANCE_MAX:
@@ -160,17 +210,26 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
             if (td_index >= tap_dance_count()) {
                 return false;
             }
-            action = tap_dance_get(td_index);
 
-            action->state.pressed = record->event.pressed;
+            if (record->event.pressed) {
+                state = tap_dance_acquire_state(td_index);
+            } else {
+                state = tap_dance_get_state(td_index);
+            }
+            if (state == NULL) {
+                // Either every state slot is taken by another dance, or the press was dropped for that reason
+                return false;
+            }
+
+            state->pressed = record->event.pressed;
             if (record->event.pressed) {
                 last_tap_time = timer_read();
-                process_tap_dance_action_on_each_tap(action);
-                active_td = action->state.finished ? 0 : keycode;
+                process_tap_dance_action_on_each_tap(state);
+                active_td = state->finished ? 0 : keycode;
             } else {
-                process_tap_dance_action_on_each_release(action);
-                if (action->state.finished) {
-                    process_tap_dance_action_on_reset(action);
+                process_tap_dance_action_on_each_release(state);
+                if (state->finished) {
+                    process_tap_dance_action_on_reset(state);
                     if (active_td == keycode) {
                         active_td = 0;
                     }
@@ -184,17 +243,21 @@ bool process_tap_dance(uint16_t keycode, keyrecord_t *record) {
 }
 
 void tap_dance_task(void) {
-    tap_dance_action_t *action;
+    tap_dance_state_t *state;
 
     if (!active_td || timer_elapsed(last_tap_time) <= GET_TAPPING_TERM(active_td, &(keyrecord_t){})) return;
 
-    action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(active_td));
-    if (!action->state.interrupted) {
-        process_tap_dance_action_on_dance_finished(action);
+    state = tap_dance_get_state(QK_TAP_DANCE_GET_INDEX(active_td));
+    if (state == NULL) {
+        active_td = 0;
+        return;
+    }
+    if (!state->interrupted) {
+        process_tap_dance_action_on_dance_finished(state);
     }
 }
 
 void reset_tap_dance(tap_dance_state_t *state) {
     active_td = 0;
-    process_tap_dance_action_on_reset((tap_dance_action_t *)state);
+    process_tap_dance_action_on_reset(state);
 }
@@ -28,15 +28,17 @@ typedef struct {
 #ifndef NO_ACTION_ONESHOT
     uint8_t oneshot_mods;
 #endif
-    bool pressed : 1;
-    bool finished : 1;
-    bool interrupted : 1;
+    uint8_t index; // tap dance the state belongs to, see TD_INDEX()
+    bool    pressed : 1;
+    bool    finished : 1;
+    bool    interrupted : 1;
+    bool    in_use : 1;
 } tap_dance_state_t;
 
 typedef void (*tap_dance_user_fn_t)(tap_dance_state_t *state, void *user_data);
 
+// Tap dance actions are read-only and stored in PROGMEM, runtime state is kept separately, see tap_dance_get_state()
 typedef struct tap_dance_action_t {
-    tap_dance_state_t state;
     struct {
         tap_dance_user_fn_t on_each_tap;
         tap_dance_user_fn_t on_dance_finished;
@@ -58,13 +60,13 @@ typedef struct {
 } tap_dance_dual_role_t;
 
 #define ACTION_TAP_DANCE_DOUBLE(kc1, kc2) \
-    { .fn = {tap_dance_pair_on_each_tap, tap_dance_pair_finished, tap_dance_pair_reset, NULL}, .user_data = (void *)&((tap_dance_pair_t){kc1, kc2}), }
+    { .fn = {tap_dance_pair_on_each_tap, tap_dance_pair_finished, tap_dance_pair_reset, NULL}, .user_data = (void *)&((const tap_dance_pair_t){kc1, kc2}), }
 
 #define ACTION_TAP_DANCE_LAYER_MOVE(kc, layer) \
-    { .fn = {tap_dance_dual_role_on_each_tap, tap_dance_dual_role_finished, tap_dance_dual_role_reset, NULL}, .user_data = (void *)&((tap_dance_dual_role_t){kc, layer, layer_move}), }
+    { .fn = {tap_dance_dual_role_on_each_tap, tap_dance_dual_role_finished, tap_dance_dual_role_reset, NULL}, .user_data = (void *)&((const tap_dance_dual_role_t){kc, layer, layer_move}), }
 
 #define ACTION_TAP_DANCE_LAYER_TOGGLE(kc, layer) \
-    { .fn = {NULL, tap_dance_dual_role_finished, tap_dance_dual_role_reset, NULL}, .user_data = (void *)&((tap_dance_dual_role_t){kc, layer, layer_invert}), }
+    { .fn = {NULL, tap_dance_dual_role_finished, tap_dance_dual_role_reset, NULL}, .user_data = (void *)&((const tap_dance_dual_role_t){kc, layer, layer_invert}), }
 
 #define ACTION_TAP_DANCE_FN(user_fn) \
     { .fn = {NULL, user_fn, NULL, NULL}, .user_data = NULL, }
@@ -76,7 +78,21 @@ typedef struct {
     { .fn = {user_fn_on_each_tap, user_fn_on_dance_finished, user_fn_on_dance_reset, user_fn_on_each_release}, .user_data = NULL, }
 
 #define TD_INDEX(code) QK_TAP_DANCE_GET_INDEX(code)
-#define TAP_DANCE_KEYCODE(state) TD(((tap_dance_action_t *)state) - tap_dance_actions)
+#define TAP_DANCE_KEYCODE(state) TD((state)->index)
+
+#ifndef TAP_DANCE_MAX_SIMULTANEOUS
+#    define TAP_DANCE_MAX_SIMULTANEOUS 3
+#endif
+
+/**
+ * \brief Get the runtime state of a tap dance that is currently in progress.
+ *
+ * Only a small pool of `TAP_DANCE_MAX_SIMULTANEOUS` states is kept in RAM, so
+ * tap dances that are not in progress have no state.
+ *
+ * \return the state, or NULL if the tap dance is not in progress
+ */
+tap_dance_state_t *tap_dance_get_state(uint8_t tap_dance_idx);
 
 void reset_tap_dance(tap_dance_state_t *state);
 
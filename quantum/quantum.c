@@ -84,6 +84,10 @@
 #    include "process_layer_lock.h"
 #endif
 
+#ifdef EEPROM_DRIVER
+#    include "eeprom_driver.h"
+#endif
+
 #ifdef AUDIO_ENABLE
 #    ifndef GOODBYE_SONG
 #        define GOODBYE_SONG SONG(GOODBYE_SOUND)
@@ -148,6 +152,7 @@ __attribute__((weak)) void unregister_code16(uint16_t code) {
  */
 __attribute__((weak)) void tap_code16_delay(uint16_t code, uint16_t delay) {
     register_code16(code);
+    flush_keyboard_report();
     for (uint16_t i = delay; i > 0; i--) {
         wait_ms(1);
     }
@@ -210,6 +215,10 @@ void shutdown_quantum(bool jump_to_bootloader) {
 #ifdef HAPTIC_ENABLE
     haptic_shutdown();
 #endif
+#ifdef EEPROM_DRIVER
+    // Ensure deferred EEPROM writes reach the device before the MCU resets
+    eeprom_driver_flush();
+#endif
 }
 
 void reset_keyboard(void) {
@@ -316,107 +325,11 @@ bool process_record_quantum(keyrecord_t *record) {
             // Must run first to be able to mask key_up events.
             process_key_lock(&keycode, record) &&
 #endif
-#if defined(DYNAMIC_MACRO_ENABLE) && !defined(DYNAMIC_MACRO_USER_CALL)
-            // Must run asap to ensure all keypresses are recorded.
-            process_dynamic_macro(keycode, record) &&
-#endif
-#ifdef REPEAT_KEY_ENABLE
-            process_last_key(keycode, record) && process_repeat_key(keycode, record) &&
-#endif
-#if defined(AUDIO_ENABLE) && defined(AUDIO_CLICKY)
-            process_clicky(keycode, record) &&
-#endif
-#ifdef HAPTIC_ENABLE
-            process_haptic(keycode, record) &&
-#endif
-#if defined(VIA_ENABLE)
-            process_record_via(keycode, record) &&
-#endif
-#if defined(POINTING_DEVICE_ENABLE) && defined(POINTING_DEVICE_AUTO_MOUSE_ENABLE)
-            process_auto_mouse(keycode, record) &&
-#endif
-            process_record_kb(keycode, record) &&
-#if defined(SECURE_ENABLE)
-            process_secure(keycode, record) &&
-#endif
-#if defined(SEQUENCER_ENABLE)
-            process_sequencer(keycode, record) &&
-#endif
-#if defined(MIDI_ENABLE) && defined(MIDI_ADVANCED)
-            process_midi(keycode, record) &&
-#endif
-#ifdef AUDIO_ENABLE
-            process_audio(keycode, record) &&
-#endif
-#if defined(BACKLIGHT_ENABLE)
-            process_backlight(keycode, record) &&
-#endif
-#if defined(LED_MATRIX_ENABLE)
-            process_led_matrix(keycode, record) &&
-#endif
-#ifdef STENO_ENABLE
-            process_steno(keycode, record) &&
-#endif
-#if (defined(AUDIO_ENABLE) || (defined(MIDI_ENABLE) && defined(MIDI_BASIC))) && !defined(NO_MUSIC_MODE)
-            process_music(keycode, record) &&
-#endif
-#ifdef CAPS_WORD_ENABLE
-            process_caps_word(keycode, record) &&
-#endif
-#ifdef KEY_OVERRIDE_ENABLE
-            process_key_override(keycode, record) &&
-#endif
-#ifdef TAP_DANCE_ENABLE
-            process_tap_dance(keycode, record) &&
-#endif
-#if defined(UNICODE_COMMON_ENABLE)
-            process_unicode_common(keycode, record) &&
-#endif
-#ifdef LEADER_ENABLE
-            process_leader(keycode, record) &&
-#endif
-#ifdef AUTO_SHIFT_ENABLE
-            process_auto_shift(keycode, record) &&
-#endif
-#ifdef DYNAMIC_TAPPING_TERM_ENABLE
-            process_dynamic_tapping_term(keycode, record) &&
-#endif
-#ifdef SPACE_CADET_ENABLE
-            process_space_cadet(keycode, record) &&
-#endif
-#ifdef MAGIC_ENABLE
-            process_magic(keycode, record) &&
-#endif
-#ifdef GRAVE_ESC_ENABLE
-            process_grave_esc(keycode, record) &&
-#endif
-#if defined(RGBLIGHT_ENABLE) || defined(RGB_MATRIX_ENABLE)
-            process_underglow(keycode, record) &&
-#endif
-#if defined(RGB_MATRIX_ENABLE)
-            process_rgb_matrix(keycode, record) &&
-#endif
-#ifdef JOYSTICK_ENABLE
-            process_joystick(keycode, record) &&
-#endif
-#ifdef PROGRAMMABLE_BUTTON_ENABLE
-            process_programmable_button(keycode, record) &&
-#endif
-#ifdef AUTOCORRECT_ENABLE
-            process_autocorrect(keycode, record) &&
-#endif
-#ifdef TRI_LAYER_ENABLE
-            process_tri_layer(keycode, record) &&
-#endif
-#if !defined(NO_ACTION_LAYER)
-            process_default_layer(keycode, record) &&
-#endif
-#ifdef LAYER_LOCK_ENABLE
-            process_layer_lock(keycode, record) &&
-#endif
-#ifdef BLUETOOTH_ENABLE
-            process_connection(keycode, record) &&
-#endif
+#define PROCESS_RECORD_OBSERVER(handler) handler(keycode, record) &&
+#define PROCESS_RECORD_RANGE(handler, first, last) (keycode < (first) || keycode > (last) || handler(keycode, record)) &&
+#include "process_record_handlers.inc"
+#undef PROCESS_RECORD_OBSERVER
+#undef PROCESS_RECORD_RANGE
             true)) {
         return false;
     }
@@ -186,6 +186,10 @@ extern layer_state_t layer_state;
 #    include "dynamic_keymap.h"
 #endif
 
+#ifdef SPARSE_KEYMAP_ENABLE
+#    include "sparse_keymap.h"
+#endif
+
 #ifdef JOYSTICK_ENABLE
 #    include "joystick.h"
 #endif
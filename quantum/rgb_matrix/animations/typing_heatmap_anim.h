@@ -61,9 +61,9 @@ bool TYPING_HEATMAP(effect_params_t* params) {
         memset(g_rgb_frame_buffer, 0, sizeof g_rgb_frame_buffer);
     }
 
-    // The heatmap animation might run in several iterations depending on
-    // `RGB_MATRIX_LED_PROCESS_LIMIT`, therefore we only want to update the
-    // timer when the animation starts.
+    // The heatmap animation might run in several iterations, one per slice
+    // of LEDs, therefore we only want to update the timer when the animation
+    // starts.
     if (params->iter == 0) {
         decrease_heatmap_values = timer_elapsed(heatmap_decrease_timer) >= RGB_MATRIX_TYPING_HEATMAP_DECREASE_DELAY_MS;
 
@@ -74,9 +74,11 @@ bool TYPING_HEATMAP(effect_params_t* params) {
     }
 
     // Render heatmap & decrease
+    // Slices are sized at run time, so the scan stops once every LED of this one is done
     uint8_t count = 0;
-    for (uint8_t row = 0; row < MATRIX_ROWS && count < RGB_MATRIX_LED_PROCESS_LIMIT; row++) {
-        for (uint8_t col = 0; col < MATRIX_COLS && RGB_MATRIX_LED_PROCESS_LIMIT; col++) {
+    uint8_t limit = led_max - led_min;
+    for (uint8_t row = 0; row < MATRIX_ROWS && count < limit; row++) {
+        for (uint8_t col = 0; col < MATRIX_COLS && count < limit; col++) {
             if (g_led_config.matrix_co[row][col] >= led_min && g_led_config.matrix_co[row][col] < led_max) {
                 count++;
                 uint8_t val = g_rgb_frame_buffer[row][col];
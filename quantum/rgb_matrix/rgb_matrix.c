@@ -22,6 +22,7 @@
 #include "eeconfig.h"
 #include "keyboard.h"
 #include "sync_timer.h"
+#include "effect_render.h"
 #include "debug.h"
 #include <string.h>
 #include <math.h>
@@ -76,6 +77,10 @@ static uint8_t         rgb_last_enable   = UINT8_MAX;
 static uint8_t         rgb_last_effect   = UINT8_MAX;
 static effect_params_t rgb_effect_params = {0, LED_FLAG_ALL, false};
 static rgb_task_states rgb_task_state    = SYNCING;
+static effect_render_t rgb_render;
+#ifdef RGB_MATRIX_RENDER_STATS
+static effect_render_stats_t rgb_render_stats[RGB_MATRIX_EFFECT_MAX];
+#endif // RGB_MATRIX_RENDER_STATS
 
 // double buffers
 static uint32_t rgb_timer_buffer;
@@ -276,6 +281,7 @@ static void rgb_task_sync(void) {
 static void rgb_task_start(void) {
     // reset iter
     rgb_effect_params.iter = 0;
+    effect_render_frame_begin(&rgb_render);
 
     // update double buffers
     g_rgb_timer = rgb_timer_buffer;
@@ -295,6 +301,8 @@ static void rgb_task_render(uint8_t effect) {
         rgb_matrix_set_color_all(0, 0, 0);
     }
 
+    effect_render_iter_begin(&rgb_render);
+
     // each effect can opt to do calculations
     // and/or request PWM buffer updates.
     switch (effect) {
@@ -335,6 +343,9 @@ static void rgb_task_render(uint8_t effect) {
             return;
     }
 
+    struct rgb_matrix_limits_t limits = rgb_matrix_get_limits(rgb_effect_params.iter);
+    effect_render_iter_end(&rgb_render, limits.led_min_index, limits.led_max_index);
+
     rgb_effect_params.iter++;
 
     // next task
@@ -352,6 +363,15 @@ static void rgb_task_flush(uint8_t effect) {
     rgb_last_effect = effect;
     rgb_last_enable = rgb_matrix_config.enable;
 
+    uint32_t frame_time = effect_render_frame_end(&rgb_render);
+#ifdef RGB_MATRIX_RENDER_STATS
+    if (effect < RGB_MATRIX_EFFECT_MAX) {
+        effect_render_stats_update(&rgb_render_stats[effect], frame_time);
+    }
+#else
+    (void)frame_time;
+#endif // RGB_MATRIX_RENDER_STATS
+
     // update pwm buffers
     rgb_matrix_update_pwm_buffers();
 
@@ -408,32 +428,33 @@ __attribute__((weak)) bool rgb_matrix_indicators_user(void) {
 
 struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter) {
     struct rgb_matrix_limits_t limits = {0};
-#if defined(RGB_MATRIX_LED_PROCESS_LIMIT) && RGB_MATRIX_LED_PROCESS_LIMIT > 0 && RGB_MATRIX_LED_PROCESS_LIMIT < RGB_MATRIX_LED_COUNT
-#    if defined(RGB_MATRIX_SPLIT)
-    limits.led_min_index = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);
-    limits.led_max_index = limits.led_min_index + RGB_MATRIX_LED_PROCESS_LIMIT;
-    if (limits.led_max_index > RGB_MATRIX_LED_COUNT) limits.led_max_index = RGB_MATRIX_LED_COUNT;
-    if (is_keyboard_left() && (limits.led_max_index > k_rgb_matrix_split[0])) limits.led_max_index = k_rgb_matrix_split[0];
-    if (!(is_keyboard_left()) && (limits.led_min_index < k_rgb_matrix_split[0])) limits.led_min_index = k_rgb_matrix_split[0];
-#    else
-    limits.led_min_index = RGB_MATRIX_LED_PROCESS_LIMIT * (iter);
-    limits.led_max_index = limits.led_min_index + RGB_MATRIX_LED_PROCESS_LIMIT;
-    if (limits.led_max_index > RGB_MATRIX_LED_COUNT) limits.led_max_index = RGB_MATRIX_LED_COUNT;
-#    endif
-#else
-#    if defined(RGB_MATRIX_SPLIT)
-    limits.led_min_index = 0;
-    limits.led_max_index = RGB_MATRIX_LED_COUNT;
+    effect_render_get_limits(&rgb_render, iter, &limits.led_min_index, &limits.led_max_index);
+#if defined(RGB_MATRIX_SPLIT)
     if (is_keyboard_left() && (limits.led_max_index > k_rgb_matrix_split[0])) limits.led_max_index = k_rgb_matrix_split[0];
     if (!(is_keyboard_left()) && (limits.led_min_index < k_rgb_matrix_split[0])) limits.led_min_index = k_rgb_matrix_split[0];
-#    else
-    limits.led_min_index = 0;
-    limits.led_max_index = RGB_MATRIX_LED_COUNT;
-#    endif
 #endif
     return limits;
 }
 
+uint8_t rgb_matrix_get_process_limit(void) {
+    return rgb_render.process_limit;
+}
+
+#ifdef RGB_MATRIX_RENDER_STATS
+const effect_render_stats_t *rgb_matrix_get_render_stats(uint8_t mode) {
+    if (mode >= RGB_MATRIX_EFFECT_MAX) {
+        return NULL;
+    }
+    return &rgb_render_stats[mode];
+}
+
+void rgb_matrix_reset_render_stats(void) {
+    for (uint8_t i = 0; i < RGB_MATRIX_EFFECT_MAX; i++) {
+        effect_render_stats_reset(&rgb_render_stats[i]);
+    }
+}
+#endif // RGB_MATRIX_RENDER_STATS
+
 void rgb_matrix_indicators_advanced(effect_params_t *params) {
     /* special handling is needed for "params->iter", since it's already been incremented.
      * Could move the invocations to rgb_task_render, but then it's missing a few checks
@@ -455,6 +476,15 @@ __attribute__((weak)) bool rgb_matrix_indicators_advanced_user(uint8_t led_min,
 void rgb_matrix_init(void) {
     rgb_matrix_driver.init();
 
+#ifdef RGB_MATRIX_ADAPTIVE_PROCESS_LIMIT
+    effect_render_init(&rgb_render, RGB_MATRIX_LED_COUNT, RGB_MATRIX_LED_PROCESS_LIMIT, true, RGB_MATRIX_RENDER_BUDGET_US);
+#else
+    effect_render_init(&rgb_render, RGB_MATRIX_LED_COUNT, RGB_MATRIX_LED_PROCESS_LIMIT, false, RGB_MATRIX_RENDER_BUDGET_US);
+#endif
+#ifdef RGB_MATRIX_RENDER_STATS
+    rgb_matrix_reset_render_stats();
+#endif
+
 #ifdef RGB_MATRIX_KEYREACTIVE_ENABLED
     g_last_hit_tracker.count = 0;
     for (uint8_t i = 0; i < LED_HITS_TO_REMEMBER; ++i) {
@@ -24,6 +24,7 @@
 #include "rgb_matrix_drivers.h"
 #include "color.h"
 #include "keyboard.h"
+#include "effect_render.h"
 
 #ifndef RGB_MATRIX_TIMEOUT
 #    define RGB_MATRIX_TIMEOUT 0
@@ -90,12 +91,22 @@
 #    define RGB_MATRIX_LED_PROCESS_LIMIT ((RGB_MATRIX_LED_COUNT + 4) / 5)
 #endif
 
+#ifndef RGB_MATRIX_RENDER_BUDGET_US
+#    define RGB_MATRIX_RENDER_BUDGET_US 1000
+#endif
+
 struct rgb_matrix_limits_t {
     uint8_t led_min_index;
     uint8_t led_max_index;
 };
 
 struct rgb_matrix_limits_t rgb_matrix_get_limits(uint8_t iter);
+uint8_t                    rgb_matrix_get_process_limit(void);
+
+#ifdef RGB_MATRIX_RENDER_STATS
+const effect_render_stats_t *rgb_matrix_get_render_stats(uint8_t mode);
+void                         rgb_matrix_reset_render_stats(void);
+#endif
 
 #define RGB_MATRIX_USE_LIMITS_ITER(min, max, iter)                   \
     struct rgb_matrix_limits_t limits = rgb_matrix_get_limits(iter); \
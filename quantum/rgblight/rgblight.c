@@ -113,6 +113,10 @@ static bool pre_suspend_enabled;
 
 #ifdef RGBLIGHT_USE_TIMER
 animation_status_t animation_status = {};
+
+// The last colour written to each LED, so that animation frames which change nothing are not sent again
+static rgb_t rgblight_framebuffer[RGBLIGHT_LED_COUNT];
+static bool  rgblight_framebuffer_changed = false;
 #endif
 
 #ifdef RGBLIGHT_LAYERS
@@ -149,7 +153,19 @@ uint8_t rgblight_led_index(uint8_t index) {
 }
 
 void setrgb(uint8_t r, uint8_t g, uint8_t b, int index) {
-    rgblight_driver.set_color(rgblight_led_index(index), r, g, b);
+    uint8_t led = rgblight_led_index(index);
+#ifdef RGBLIGHT_USE_TIMER
+    if (led < RGBLIGHT_LED_COUNT) {
+        rgb_t *pixel = &rgblight_framebuffer[led];
+        if (pixel->r != r || pixel->g != g || pixel->b != b) {
+            pixel->r                     = r;
+            pixel->g                     = g;
+            pixel->b                     = b;
+            rgblight_framebuffer_changed = true;
+        }
+    }
+#endif
+    rgblight_driver.set_color(led, r, g, b);
 }
 
 void sethsv_raw(uint8_t hue, uint8_t sat, uint8_t val, int index) {
@@ -645,7 +661,7 @@ void rgblight_setrgb(uint8_t r, uint8_t g, uint8_t b) {
     }
 
     for (uint8_t i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), r, g, b);
+        setrgb(r, g, b, i);
     }
     rgblight_set();
 }
@@ -655,7 +671,7 @@ void rgblight_setrgb_at(uint8_t r, uint8_t g, uint8_t b, uint8_t index) {
         return;
     }
 
-    rgblight_driver.set_color(rgblight_led_index(index), r, g, b);
+    setrgb(r, g, b, index);
     rgblight_set();
 }
 
@@ -686,7 +702,7 @@ void rgblight_setrgb_range(uint8_t r, uint8_t g, uint8_t b, uint8_t start, uint8
     }
 
     for (uint8_t i = start; i < end; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), r, g, b);
+        setrgb(r, g, b, i);
     }
     rgblight_set();
 }
@@ -875,10 +891,16 @@ void rgblight_wakeup(void) {
 
 #endif
 
-void rgblight_set(void) {
+/**
+ * Write the LEDs, along with any enabled lighting layers.
+ *
+ * Animation frames are only sent when they changed a colour. Anything else is always sent, and makes the next
+ * animation frame sent too, in case the LEDs were written directly since.
+ */
+static void rgblight_write(bool force) {
     if (!rgblight_config.enable) {
         for (uint8_t i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-            rgblight_driver.set_color(rgblight_led_index(i), 0, 0, 0);
+            setrgb(0, 0, 0, i);
         }
     }
 
@@ -894,9 +916,19 @@ void rgblight_set(void) {
     }
 #endif
 
+#ifdef RGBLIGHT_USE_TIMER
+    if (!force && !rgblight_framebuffer_changed) {
+        return;
+    }
+    rgblight_framebuffer_changed = force;
+#endif
     rgblight_driver.flush();
 }
 
+void rgblight_set(void) {
+    rgblight_write(true);
+}
+
 #ifdef RGBLIGHT_SPLIT
 /* for split keyboard master side */
 uint8_t rgblight_get_change_flags(void) {
@@ -1144,6 +1176,26 @@ static uint8_t breathe_calc(uint8_t pos) {
 
 #endif
 
+#ifdef RGBLIGHT_USE_TIMER
+// Convert a colour once per frame, for effects that light many LEDs with it
+static rgb_t rgblight_effect_color(uint8_t hue, uint8_t sat, uint8_t val) {
+    return rgblight_hsv_to_rgb((hsv_t){hue, sat, val > RGBLIGHT_LIMIT_VAL ? RGBLIGHT_LIMIT_VAL : val});
+}
+
+#    if defined(RGBLIGHT_EFFECT_BREATHING) || defined(RGBLIGHT_EFFECT_RAINBOW_MOOD)
+static void rgblight_effect_fill(rgb_t rgb) {
+    if (!rgblight_config.enable) {
+        return;
+    }
+
+    for (uint8_t i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
+        setrgb(rgb.r, rgb.g, rgb.b, i);
+    }
+    rgblight_write(false);
+}
+#    endif
+#endif
+
 // Effects
 #ifdef RGBLIGHT_EFFECT_BREATHING
 
@@ -1151,7 +1203,7 @@ __attribute__((weak)) const uint8_t RGBLED_BREATHING_INTERVALS[] PROGMEM = {30,
 
 void rgblight_effect_breathing(animation_status_t *anim) {
     uint8_t val = breathe_calc(anim->pos);
-    rgblight_sethsv_noeeprom_old(rgblight_config.hue, rgblight_config.sat, val);
+    rgblight_effect_fill(rgblight_effect_color(rgblight_config.hue, rgblight_config.sat, val));
     anim->pos = (anim->pos + 1);
 }
 #endif
@@ -1160,7 +1212,7 @@ void rgblight_effect_breathing(animation_status_t *anim) {
 __attribute__((weak)) const uint8_t RGBLED_RAINBOW_MOOD_INTERVALS[] PROGMEM = {120, 60, 30};
 
 void rgblight_effect_rainbow_mood(animation_status_t *anim) {
-    rgblight_sethsv_noeeprom_old(anim->current_hue, rgblight_config.sat, rgblight_config.val);
+    rgblight_effect_fill(rgblight_effect_color(anim->current_hue, rgblight_config.sat, rgblight_config.val));
     anim->current_hue++;
 }
 #endif
@@ -1180,7 +1232,7 @@ void rgblight_effect_rainbow_swirl(animation_status_t *anim) {
         hue = (RGBLIGHT_RAINBOW_SWIRL_RANGE / rgblight_ranges.effect_num_leds * i + anim->current_hue);
         sethsv(hue, rgblight_config.sat, rgblight_config.val, i + rgblight_ranges.effect_start_pos);
     }
-    rgblight_set();
+    rgblight_write(false);
 
     if (anim->delta % 2) {
         anim->current_hue++;
@@ -1214,8 +1266,13 @@ void rgblight_effect_snake(animation_status_t *anim) {
     }
 #    endif
 
+    rgb_t colors[RGBLIGHT_EFFECT_SNAKE_LENGTH];
+    for (j = 0; j < RGBLIGHT_EFFECT_SNAKE_LENGTH; j++) {
+        colors[j] = rgblight_effect_color(rgblight_config.hue, rgblight_config.sat, (uint8_t)(rgblight_config.val * (RGBLIGHT_EFFECT_SNAKE_LENGTH - j) / RGBLIGHT_EFFECT_SNAKE_LENGTH));
+    }
+
     for (i = 0; i < rgblight_ranges.effect_num_leds; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i + rgblight_ranges.effect_start_pos), 0, 0, 0);
+        rgb_t color = {0, 0, 0};
 
         for (j = 0; j < RGBLIGHT_EFFECT_SNAKE_LENGTH; j++) {
             k = pos + j * increment;
@@ -1226,11 +1283,12 @@ void rgblight_effect_snake(animation_status_t *anim) {
                 k = k + rgblight_ranges.effect_num_leds;
             }
             if (i == k) {
-                sethsv(rgblight_config.hue, rgblight_config.sat, (uint8_t)(rgblight_config.val * (RGBLIGHT_EFFECT_SNAKE_LENGTH - j) / RGBLIGHT_EFFECT_SNAKE_LENGTH), i + rgblight_ranges.effect_start_pos);
+                color = colors[j];
             }
         }
+        setrgb(color.r, color.g, color.b, i + rgblight_ranges.effect_start_pos);
     }
-    rgblight_set();
+    rgblight_write(false);
     if (increment == 1) {
         if (pos - RGBLIGHT_EFFECT_SNAKE_INCREMENT < 0) {
             pos = rgblight_ranges.effect_num_leds - 1;
@@ -1260,6 +1318,7 @@ void rgblight_effect_knight(animation_status_t *anim) {
     static int8_t high_bound = RGBLIGHT_EFFECT_KNIGHT_LENGTH - 1;
     static int8_t increment  = RGBLIGHT_EFFECT_KNIGHT_INCREMENT;
     uint8_t       i, cur;
+    rgb_t         color = rgblight_effect_color(rgblight_config.hue, rgblight_config.sat, rgblight_config.val);
 
 #    if defined(RGBLIGHT_SPLIT) && !defined(RGBLIGHT_SPLIT_NO_ANIMATION_SYNC)
     if (anim->pos == 0) { // restart signal
@@ -1271,19 +1330,19 @@ void rgblight_effect_knight(animation_status_t *anim) {
 #    endif
     // Set all the LEDs to 0
     for (i = rgblight_ranges.effect_start_pos; i < rgblight_ranges.effect_end_pos; i++) {
-        rgblight_driver.set_color(rgblight_led_index(i), 0, 0, 0);
+        setrgb(0, 0, 0, i);
     }
     // Determine which LEDs should be lit up
     for (i = 0; i < RGBLIGHT_EFFECT_KNIGHT_LED_NUM; i++) {
         cur = (i + RGBLIGHT_EFFECT_KNIGHT_OFFSET) % rgblight_ranges.effect_num_leds + rgblight_ranges.effect_start_pos;
 
         if (i >= low_bound && i <= high_bound) {
-            sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, cur);
+            setrgb(color.r, color.g, color.b, cur);
         } else {
-            rgblight_driver.set_color(rgblight_led_index(cur), 0, 0, 0);
+            setrgb(0, 0, 0, cur);
         }
     }
-    rgblight_set();
+    rgblight_write(false);
 
     // Move from low_bound to high_bound changing the direction we increment each
     // time a boundary is hit.
@@ -1323,11 +1382,15 @@ void rgblight_effect_christmas(animation_status_t *anim) {
     // Additionally, these interpolated colors get shown with a slightly darker value, to make them less prominent than the main colors.
     val = 255 - (3 * (hue < hue_green / 2 ? hue : hue_green - hue) / 2);
 
+    rgb_t colors[2] = {
+        rgblight_effect_color(hue_green - hue, rgblight_config.sat, val),
+        rgblight_effect_color(hue, rgblight_config.sat, val),
+    };
     for (i = 0; i < rgblight_ranges.effect_num_leds; i++) {
-        uint8_t local_hue = (i / RGBLIGHT_EFFECT_CHRISTMAS_STEP) % 2 ? hue : hue_green - hue;
-        sethsv(local_hue, rgblight_config.sat, val, i + rgblight_ranges.effect_start_pos);
+        rgb_t color = colors[(i / RGBLIGHT_EFFECT_CHRISTMAS_STEP) % 2];
+        setrgb(color.r, color.g, color.b, i + rgblight_ranges.effect_start_pos);
     }
-    rgblight_set();
+    rgblight_write(false);
 
     if (anim->pos == 0) {
         increment = 1;
@@ -1354,16 +1417,15 @@ void rgblight_effect_rgbtest(animation_status_t *anim) {
 
 #ifdef RGBLIGHT_EFFECT_ALTERNATING
 void rgblight_effect_alternating(animation_status_t *anim) {
+    rgb_t on  = rgblight_effect_color(rgblight_config.hue, rgblight_config.sat, rgblight_config.val);
+    rgb_t off = rgblight_effect_color(rgblight_config.hue, rgblight_config.sat, 0);
+
     for (int i = 0; i < rgblight_ranges.effect_num_leds; i++) {
-        if (i < rgblight_ranges.effect_num_leds / 2 && anim->pos) {
-            sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, i + rgblight_ranges.effect_start_pos);
-        } else if (i >= rgblight_ranges.effect_num_leds / 2 && !anim->pos) {
-            sethsv(rgblight_config.hue, rgblight_config.sat, rgblight_config.val, i + rgblight_ranges.effect_start_pos);
-        } else {
-            sethsv(rgblight_config.hue, rgblight_config.sat, 0, i + rgblight_ranges.effect_start_pos);
-        }
+        bool   lit   = (i < rgblight_ranges.effect_num_leds / 2) == (anim->pos != 0);
+        rgb_t *color = lit ? &on : &off;
+        setrgb(color->r, color->g, color->b, i + rgblight_ranges.effect_start_pos);
     }
-    rgblight_set();
+    rgblight_write(false);
     anim->pos = (anim->pos + 1) % 2;
 }
 #endif
@@ -1430,7 +1492,7 @@ void rgblight_effect_twinkle(animation_status_t *anim) {
         sethsv(c->h, c->s, c->v, i + rgblight_ranges.effect_start_pos);
     }
 
-    rgblight_set();
+    rgblight_write(false);
 }
 #endif
 
@@ -2,47 +2,29 @@
 
 #include <stdint.h>
 #include <stdbool.h>
-#include "atomic_util.h"
+#include "spsc_ring.h"
 
 #ifndef RBUF_SIZE
 #    define RBUF_SIZE 32
 #endif
 
-static uint8_t     rbuf[RBUF_SIZE];
-static uint8_t     rbuf_head = 0;
-static uint8_t     rbuf_tail = 0;
+SPSC_RING_DECLARE(rbuf_ring, uint8_t, RBUF_SIZE)
+
+static rbuf_ring_t rbuf;
 static inline bool rbuf_enqueue(uint8_t data) {
-    bool ret = false;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        uint8_t next = (rbuf_head + 1) % RBUF_SIZE;
-        if (next != rbuf_tail) {
-            rbuf[rbuf_head] = data;
-            rbuf_head       = next;
-            ret             = true;
-        }
-    }
-    return ret;
+    return rbuf_ring_enqueue(&rbuf, data);
 }
 static inline uint8_t rbuf_dequeue(void) {
     uint8_t val = 0;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        if (rbuf_head != rbuf_tail) {
-            val       = rbuf[rbuf_tail];
-            rbuf_tail = (rbuf_tail + 1) % RBUF_SIZE;
-        }
-    }
-
+    rbuf_ring_dequeue(&rbuf, &val);
     return val;
 }
+static inline uint8_t rbuf_dequeue_n(uint8_t *data, uint8_t count) {
+    return rbuf_ring_dequeue_n(&rbuf, data, count);
+}
 static inline bool rbuf_has_data(void) {
-    bool has_data;
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        has_data = (rbuf_head != rbuf_tail);
-    }
-    return has_data;
+    return !rbuf_ring_empty(&rbuf);
 }
 static inline void rbuf_clear(void) {
-    ATOMIC_BLOCK(ATOMIC_RESTORESTATE) {
-        rbuf_head = rbuf_tail = 0;
-    }
+    rbuf_ring_clear(&rbuf);
 }
@@ -0,0 +1,18 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "sparse_keymap.h"
+#include "keycodes.h"
+#include "progmem.h"
+
+uint16_t sparse_keymap_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+    uint16_t                     key    = row * MATRIX_COLS + column;
+    const sparse_keymap_layer_t *sparse = &sparse_keymap_layers[layer];
+    uint32_t                     bitmap = pgm_read_dword(&sparse->bitmap[key / 32]);
+
+    if (!(bitmap & (1UL << (key % 32)))) {
+        return KC_TRNS;
+    }
+    uint16_t index = pgm_read_word(&sparse->index[key / 32]) + sparse_keymap_rank(bitmap, key % 32);
+    return pgm_read_word(&sparse_keymap_keycodes[index]);
+}
@@ -0,0 +1,48 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include "matrix.h"
+
+/**
+ * \file
+ *
+ * \defgroup sparse_keymap Sparse keymaps
+ *
+ * Stores each layer as a bitmap of its keys that are not `KC_TRNS`, plus the
+ * keycodes of those keys only. Keys are numbered `row * MATRIX_COLS + column`
+ * and split into blocks of 32. Each block keeps the index of its first
+ * keycode, so a lookup is one bitmap read and one popcount.
+ * \{
+ */
+
+#define SPARSE_KEYMAP_KEYS (MATRIX_ROWS * MATRIX_COLS)
+#define SPARSE_KEYMAP_BLOCKS ((SPARSE_KEYMAP_KEYS + 31) / 32)
+
+typedef struct {
+    uint32_t bitmap[SPARSE_KEYMAP_BLOCKS]; // bit n is set when key n is not KC_TRNS
+    uint16_t index[SPARSE_KEYMAP_BLOCKS];  // index in sparse_keymap_keycodes of the first keycode of each block
+} sparse_keymap_layer_t;
+
+/* Provided by the keymap, usually generated by `qmk json2c`. The keycodes are
+ * ordered by layer, row and column. */
+extern const sparse_keymap_layer_t sparse_keymap_layers[];
+extern const uint16_t              sparse_keymap_keycodes[];
+
+/**
+ * \brief Number of keys set in `bitmap` below `bit`.
+ */
+static inline uint8_t sparse_keymap_rank(uint32_t bitmap, uint8_t bit) {
+    return __builtin_popcountl(bitmap & ((1UL << bit) - 1));
+}
+
+/**
+ * \brief Keycode of a key in the sparse keymap, `KC_TRNS` if it is not stored.
+ *
+ * Does not check that `layer` exists, see `keycode_at_keymap_location_raw()`.
+ */
+uint16_t sparse_keymap_keycode(uint8_t layer, uint8_t row, uint8_t column);
+
+/** \} */
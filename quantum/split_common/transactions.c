@@ -239,25 +239,39 @@ static void master_matrix_handlers_slave(matrix_row_t master_matrix[], matrix_ro
 #ifdef ENCODER_ENABLE
 
 static bool encoder_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t  last_update   = 0;
-    static uint8_t   last_checksum = 0;
+    static uint32_t  last_update  = 0;
+    static uint8_t   acknowledged = 0; // sequence number of the next slave event to process
     encoder_events_t temp_events;
 
     bool okay = read_if_checksum_mismatch(GET_ENCODERS_CHECKSUM, GET_ENCODERS_DATA, &last_update, &temp_events, &split_shmem->encoders.events, sizeof(temp_events));
     if (okay) {
-        if (last_checksum != split_shmem->encoders.checksum) {
-            bool    actioned = false;
-            uint8_t index;
-            bool    clockwise;
-            while (okay && encoder_dequeue_event_advanced(&split_shmem->encoders.events, &index, &clockwise)) {
-                okay &= encoder_queue_event(index, clockwise);
-                actioned = true;
-            }
+        encoder_events_t *events   = &split_shmem->encoders.events;
+        const uint8_t     dequeued = events->dequeued;
+        uint8_t           sequence = dequeued;
+        uint8_t           index;
+        bool              clockwise;
+        uint8_t           count;
+
+        // The slave is at most a queue behind, anything else means either half restarted
+        if ((uint8_t)(acknowledged - dequeued) > MAX_QUEUED_ENCODER_EVENTS) {
+            acknowledged = dequeued;
+        }
 
-            if (actioned) {
-                okay &= transport_exec(CMD_ENCODER_DRAIN);
+        while (encoder_dequeue_events_advanced(events, &index, &clockwise, &count)) {
+            // Skip the events processed before the slave removed them from its queue
+            if (sequence != acknowledged) {
+                sequence++;
+                continue;
+            }
+            // Keep the remaining events on the slave until there is room for them
+            if (!encoder_queue_events(index, clockwise, count)) {
+                break;
             }
-            last_checksum = split_shmem->encoders.checksum;
+            acknowledged = ++sequence;
+        }
+
+        if (dequeued != acknowledged) {
+            okay &= transport_write(CMD_ENCODER_DRAIN, &acknowledged, sizeof(acknowledged));
         }
     }
     return okay;
@@ -271,7 +285,7 @@ static void encoder_handlers_slave(matrix_row_t master_matrix[], matrix_row_t sl
 }
 
 static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, const void *initiator2target_buffer, uint8_t target2initiator_buffer_size, void *target2initiator_buffer) {
-    encoder_signal_queue_drain();
+    encoder_signal_queue_drain_until(split_shmem->encoders.acknowledged);
 }
 
 // clang-format off
@@ -280,7 +294,7 @@ static void encoder_handlers_slave_drain(uint8_t initiator2target_buffer_size, c
 #    define TRANSACTIONS_ENCODERS_REGISTRATIONS \
     [GET_ENCODERS_CHECKSUM] = trans_target2initiator_initializer(encoders.checksum), \
     [GET_ENCODERS_DATA]     = trans_target2initiator_initializer(encoders.events), \
-    [CMD_ENCODER_DRAIN]     = trans_initiator2target_cb(encoder_handlers_slave_drain),
+    [CMD_ENCODER_DRAIN]     = trans_initiator2target_initializer_cb(encoders.acknowledged, encoder_handlers_slave_drain),
 // clang-format on
 
 #else // ENCODER_ENABLE
@@ -499,7 +513,12 @@ static void backlight_handlers_slave(matrix_row_t master_matrix[], matrix_row_t
 #if defined(RGBLIGHT_ENABLE) && defined(RGBLIGHT_SPLIT)
 
 static bool rgblight_handlers_master(matrix_row_t master_matrix[], matrix_row_t slave_matrix[]) {
-    static uint32_t     last_update = 0;
+    static uint32_t last_update = 0;
+    // Nothing to send most of the time, skip building the sync info
+    if (rgblight_get_change_flags() == 0 && timer_elapsed32(last_update) < FORCED_SYNC_THROTTLE_MS) {
+        return true;
+    }
+
     rgblight_syncinfo_t rgblight_sync;
     rgblight_get_syncinfo(&rgblight_sync);
     if (send_if_condition(PUT_RGBLIGHT, &last_update, (rgblight_sync.status.change_flags != 0), &rgblight_sync, sizeof(rgblight_sync))) {
@@ -67,6 +67,7 @@ typedef struct _split_master_matrix_sync_t {
 typedef struct _split_slave_encoder_sync_t {
     uint8_t          checksum;
     encoder_events_t events;
+    uint8_t          acknowledged; // sequence number of the next event the master has not processed
 } split_slave_encoder_sync_t;
 #endif // ENCODER_ENABLE
 
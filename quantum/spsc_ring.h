@@ -0,0 +1,145 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+/*
+    Single producer, single consumer ring buffer.
+
+    SPSC_RING_DECLARE(name, type, size) declares the `name_t` ring type, holding
+    up to `size - 1` elements of `type`, and its `name_*()` functions. `size`
+    must be a power of two between 2 and 256.
+
+    One context may enqueue while another one dequeues, for example an
+    interrupt handler and the main loop, without disabling interrupts. Each
+    index is only written by one side, and is published with release ordering
+    once the elements it covers are written or read, so the other side never
+    sees a stale element.
+
+    The producer side is enqueue, enqueue_n and back. The consumer side is
+    dequeue, dequeue_n, peek, drop and clear. The count, empty and full
+    functions can be called from either side.
+*/
+
+#ifdef __cplusplus
+#    define _Static_assert static_assert
+#endif
+
+#define spsc_ring_load_acquire(index) __atomic_load_n((index), __ATOMIC_ACQUIRE)
+#define spsc_ring_store_release(index, value) __atomic_store_n((index), (value), __ATOMIC_RELEASE)
+
+// clang-format off
+#define SPSC_RING_DECLARE(name, type, size)                                                                          \
+    _Static_assert((size) >= 2 && (size) <= 256 && ((size) & ((size) - 1)) == 0,                                     \
+                   #name " size must be a power of two between 2 and 256");                                           \
+                                                                                                                      \
+    typedef struct name##_t {                                                                                         \
+        uint8_t head; /* next slot to write, only written by the producer */                                         \
+        uint8_t tail; /* next slot to read, only written by the consumer */                                          \
+        type    buffer[size];                                                                                         \
+    } name##_t;                                                                                                       \
+                                                                                                                      \
+    static inline void name##_init(name##_t *ring) {                                                                  \
+        ring->head = 0;                                                                                               \
+        ring->tail = 0;                                                                                               \
+    }                                                                                                                 \
+                                                                                                                      \
+    static inline uint8_t name##_count(name##_t *ring) {                                                              \
+        return (uint8_t)(spsc_ring_load_acquire(&ring->head) - spsc_ring_load_acquire(&ring->tail)) & ((size) - 1);   \
+    }                                                                                                                 \
+                                                                                                                      \
+    static inline bool name##_empty(name##_t *ring) {                                                                 \
+        return spsc_ring_load_acquire(&ring->head) == spsc_ring_load_acquire(&ring->tail);                            \
+    }                                                                                                                 \
+                                                                                                                      \
+    static inline bool name##_full(name##_t *ring) {                                                                  \
+        return name##_count(ring) == (size) - 1;                                                                      \
+    }                                                                                                                 \
+                                                                                                                      \
+    static inline bool name##_enqueue(name##_t *ring, type item) {                                                    \
+        uint8_t head = ring->head;                                                                                    \
+        uint8_t next = (head + 1) & ((size) - 1);                                                                     \
+        if (next == spsc_ring_load_acquire(&ring->tail)) {                                                            \
+            return false;                                                                                             \
+        }                                                                                                             \
+        ring->buffer[head] = item;                                                                                    \
+        spsc_ring_store_release(&ring->head, next);                                                                   \
+        return true;                                                                                                  \
+    }                                                                                                                 \
+                                                                                                                      \
+    /* Enqueues as many of the items as fit, returning how many were enqueued */                                      \
+    static inline uint8_t name##_enqueue_n(name##_t *ring, const type *items, uint8_t count) {                        \
+        uint8_t head  = ring->head;                                                                                   \
+        uint8_t space = (uint8_t)(spsc_ring_load_acquire(&ring->tail) - head - 1) & ((size) - 1);                     \
+        if (count > space) {                                                                                          \
+            count = space;                                                                                            \
+        }                                                                                                             \
+        for (uint8_t i = 0; i < count; i++) {                                                                         \
+            ring->buffer[(head + i) & ((size) - 1)] = items[i];                                                       \
+        }                                                                                                             \
+        spsc_ring_store_release(&ring->head, (head + count) & ((size) - 1));                                          \
+        return count;                                                                                                 \
+    }                                                                                                                 \
+                                                                                                                      \
+    /* Newest element, which the producer may still update as long as the consumer runs in the same context */      \
+    static inline type *name##_back(name##_t *ring) {                                                                 \
+        uint8_t head = ring->head;                                                                                    \
+        if (head == spsc_ring_load_acquire(&ring->tail)) {                                                            \
+            return NULL;                                                                                              \
+        }                                                                                                             \
+        return &ring->buffer[(head - 1) & ((size) - 1)];                                                              \
+    }                                                                                                                 \
+                                                                                                                      \
+    /* Element `index` positions from the oldest one, or NULL if there are not enough elements */                    \
+    static inline type *name##_peek(name##_t *ring, uint8_t index) {                                                  \
+        uint8_t tail = ring->tail;                                                                                    \
+        if (index >= ((uint8_t)(spsc_ring_load_acquire(&ring->head) - tail) & ((size) - 1))) {                        \
+            return NULL;                                                                                              \
+        }                                                                                                             \
+        return &ring->buffer[(tail + index) & ((size) - 1)];                                                          \
+    }                                                                                                                 \
+                                                                                                                      \
+    /* Removes up to `count` of the oldest elements without reading them */                                          \
+    static inline uint8_t name##_drop(name##_t *ring, uint8_t count) {                                                \
+        uint8_t tail      = ring->tail;                                                                               \
+        uint8_t available = (uint8_t)(spsc_ring_load_acquire(&ring->head) - tail) & ((size) - 1);                     \
+        if (count > available) {                                                                                      \
+            count = available;                                                                                        \
+        }                                                                                                             \
+        spsc_ring_store_release(&ring->tail, (tail + count) & ((size) - 1));                                          \
+        return count;                                                                                                 \
+    }                                                                                                                 \
+                                                                                                                      \
+    static inline bool name##_dequeue(name##_t *ring, type *item) {                                                   \
+        uint8_t tail = ring->tail;                                                                                    \
+        if (tail == spsc_ring_load_acquire(&ring->head)) {                                                            \
+            return false;                                                                                             \
+        }                                                                                                             \
+        *item = ring->buffer[tail];                                                                                   \
+        spsc_ring_store_release(&ring->tail, (tail + 1) & ((size) - 1));                                              \
+        return true;                                                                                                  \
+    }                                                                                                                 \
+                                                                                                                      \
+    /* Dequeues up to `count` items, returning how many were dequeued */                                              \
+    static inline uint8_t name##_dequeue_n(name##_t *ring, type *items, uint8_t count) {                              \
+        uint8_t tail      = ring->tail;                                                                               \
+        uint8_t available = (uint8_t)(spsc_ring_load_acquire(&ring->head) - tail) & ((size) - 1);                     \
+        if (count > available) {                                                                                      \
+            count = available;                                                                                        \
+        }                                                                                                             \
+        for (uint8_t i = 0; i < count; i++) {                                                                         \
+            items[i] = ring->buffer[(tail + i) & ((size) - 1)];                                                       \
+        }                                                                                                             \
+        spsc_ring_store_release(&ring->tail, (tail + count) & ((size) - 1));                                          \
+        return count;                                                                                                 \
+    }                                                                                                                 \
+                                                                                                                      \
+    /* Drops every queued element */                                                                                  \
+    static inline void name##_clear(name##_t *ring) {                                                                 \
+        spsc_ring_store_release(&ring->tail, spsc_ring_load_acquire(&ring->head));                                    \
+    }
+// clang-format on
@@ -90,7 +90,9 @@ void ucis_cancel(void) {
 void register_ucis(uint8_t index) {
     const uint32_t *code_points = ucis_symbol_table[index].code_points;
 
+    unicode_batch_begin();
     for (int i = 0; i < UCIS_MAX_CODE_POINTS && code_points[i]; i++) {
         register_unicode(code_points[i]);
     }
+    unicode_batch_end();
 }
@@ -67,6 +67,11 @@ unicode_config_t unicode_config;
 uint8_t          unicode_saved_mods;
 led_t            unicode_saved_led_state;
 
+// Nesting level of unicode_batch_begin() calls
+static uint8_t unicode_batch_depth;
+// Set once the first code point of a batch has saved the mods and lock states
+static bool unicode_session_open;
+
 #if UNICODE_SELECTED_MODES != -1
 static uint8_t selected[]     = {UNICODE_SELECTED_MODES};
 static int8_t  selected_count = ARRAY_SIZE(selected);
@@ -208,7 +213,8 @@ void unicode_input_mode_step_reverse(void) {
     cycle_unicode_input_mode(-1);
 }
 
-__attribute__((weak)) void unicode_input_start(void) {
+// Saves and clears the state that gets in the way of typing code points
+static void unicode_session_start(void) {
     unicode_saved_led_state = host_keyboard_led_state();
 
     // Note the order matters here!
@@ -223,6 +229,42 @@ __attribute__((weak)) void unicode_input_start(void) {
     clear_mods();                    // Unregister mods to start from a clean state
     clear_weak_mods();
 
+    // For increased reliability, use numpad keys for inputting digits
+    if (unicode_config.input_mode == UNICODE_MODE_WINDOWS && !unicode_saved_led_state.num_lock) {
+        tap_code(KC_NUM_LOCK);
+    }
+
+    unicode_session_open = unicode_batch_depth > 0;
+}
+
+static void unicode_session_finish(void) {
+    switch (unicode_config.input_mode) {
+        case UNICODE_MODE_LINUX:
+            if (unicode_saved_led_state.caps_lock) {
+                tap_code(KC_CAPS_LOCK);
+            }
+            break;
+        case UNICODE_MODE_WINDOWS:
+            if (!unicode_saved_led_state.num_lock) {
+                tap_code(KC_NUM_LOCK);
+            }
+            break;
+    }
+
+    set_mods(unicode_saved_mods); // Reregister previously set mods
+    unicode_session_open = false;
+}
+
+__attribute__((weak)) void unicode_input_start(void) {
+    if (unicode_session_open) {
+        // Later code point of a batch, macOS is still holding the Unicode Hex Input key
+        if (unicode_config.input_mode == UNICODE_MODE_MACOS) {
+            return;
+        }
+    } else {
+        unicode_session_start();
+    }
+
     switch (unicode_config.input_mode) {
         case UNICODE_MODE_MACOS:
             register_code(UNICODE_KEY_MAC);
@@ -231,10 +273,6 @@ __attribute__((weak)) void unicode_input_start(void) {
             tap_code16(UNICODE_KEY_LNX);
             break;
         case UNICODE_MODE_WINDOWS:
-            // For increased reliability, use numpad keys for inputting digits
-            if (!unicode_saved_led_state.num_lock) {
-                tap_code(KC_NUM_LOCK);
-            }
             register_code(KC_LEFT_ALT);
             wait_ms(UNICODE_TYPE_DELAY);
             tap_code(KC_KP_PLUS);
@@ -257,19 +295,17 @@ __attribute__((weak)) void unicode_input_start(void) {
 __attribute__((weak)) void unicode_input_finish(void) {
     switch (unicode_config.input_mode) {
         case UNICODE_MODE_MACOS:
+            if (unicode_session_open) {
+                // Keep holding the Unicode Hex Input key until the batch ends
+                return;
+            }
             unregister_code(UNICODE_KEY_MAC);
             break;
         case UNICODE_MODE_LINUX:
             tap_code(KC_SPACE);
-            if (unicode_saved_led_state.caps_lock) {
-                tap_code(KC_CAPS_LOCK);
-            }
             break;
         case UNICODE_MODE_WINDOWS:
             unregister_code(KC_LEFT_ALT);
-            if (!unicode_saved_led_state.num_lock) {
-                tap_code(KC_NUM_LOCK);
-            }
             break;
         case UNICODE_MODE_WINCOMPOSE:
             tap_code(KC_ENTER);
@@ -279,7 +315,9 @@ __attribute__((weak)) void unicode_input_finish(void) {
             break;
     }
 
-    set_mods(unicode_saved_mods); // Reregister previously set mods
+    if (!unicode_session_open) {
+        unicode_session_finish();
+    }
 }
 
 __attribute__((weak)) void unicode_input_cancel(void) {
@@ -288,26 +326,34 @@ __attribute__((weak)) void unicode_input_cancel(void) {
             unregister_code(UNICODE_KEY_MAC);
             break;
         case UNICODE_MODE_LINUX:
-            tap_code(KC_ESCAPE);
-            if (unicode_saved_led_state.caps_lock) {
-                tap_code(KC_CAPS_LOCK);
-            }
-            break;
         case UNICODE_MODE_WINCOMPOSE:
             tap_code(KC_ESCAPE);
             break;
         case UNICODE_MODE_WINDOWS:
             unregister_code(KC_LEFT_ALT);
-            if (!unicode_saved_led_state.num_lock) {
-                tap_code(KC_NUM_LOCK);
-            }
             break;
         case UNICODE_MODE_EMACS:
             tap_code16(LCTL(KC_G)); // C-g cancels
             break;
     }
 
-    set_mods(unicode_saved_mods); // Reregister previously set mods
+    unicode_session_finish();
+}
+
+void unicode_batch_begin(void) {
+    unicode_batch_depth++;
+}
+
+void unicode_batch_end(void) {
+    if (unicode_batch_depth == 0 || --unicode_batch_depth > 0) {
+        return;
+    }
+    if (unicode_session_open) {
+        if (unicode_config.input_mode == UNICODE_MODE_MACOS) {
+            unregister_code(UNICODE_KEY_MAC);
+        }
+        unicode_session_finish();
+    }
 }
 
 // clang-format off
@@ -381,6 +427,7 @@ void send_unicode_string(const char *str) {
         return;
     }
 
+    unicode_batch_begin();
     while (*str) {
         int32_t code_point = 0;
         str                = decode_utf8(str, &code_point);
@@ -389,4 +436,5 @@ void send_unicode_string(const char *str) {
             register_unicode(code_point);
         }
     }
+    unicode_batch_end();
 }
@@ -103,6 +103,18 @@ void unicode_input_finish(void);
  */
 void unicode_input_cancel(void);
 
+/**
+ * \brief Start typing several characters as one batch.
+ *
+ * The mods and lock key states are saved and restored once for the whole batch instead of around every character, and the macOS input key stays held throughout. Batches can be nested, only the outermost one has an effect.
+ */
+void unicode_batch_begin(void);
+
+/**
+ * \brief Finish a batch started with `unicode_batch_begin()`, restoring the mods and lock key states.
+ */
+void unicode_batch_end(void);
+
 /**
  * \brief Send a 16-bit hex number.
  *
@@ -24,13 +24,16 @@
 
 #include "via.h"
 
+#include <string.h>
 #include "raw_hid.h"
 #include "dynamic_keymap.h"
 #include "eeprom.h"
 #include "eeconfig.h"
+#include "crc.h"
 #include "matrix.h"
 #include "timer.h"
 #include "wait.h"
+#include "util.h"
 #include "version.h" // for QMK_BUILDDATE used in EEPROM magic
 
 #if defined(AUDIO_ENABLE)
@@ -81,6 +84,32 @@ void via_eeprom_set_valid(bool valid) {
     eeprom_update_byte((void *)VIA_EEPROM_MAGIC_ADDR + 2, valid ? magic2 : 0xFF);
 }
 
+// Marks a bulk transfer target as being written, so an interrupted transfer can be undone on the next boot
+static void via_bulk_set_in_progress(uint8_t target, bool in_progress) {
+    uint8_t state = eeprom_read_byte((void *)VIA_EEPROM_BULK_STATE_ADDR);
+    if (in_progress) {
+        state |= 1 << target;
+    } else {
+        state &= ~(1 << target);
+    }
+    eeprom_update_byte((void *)VIA_EEPROM_BULK_STATE_ADDR, state);
+}
+
+// Resets only the targets of bulk transfers that did not commit
+static void via_bulk_recover(void) {
+    uint8_t state = eeprom_read_byte((void *)VIA_EEPROM_BULK_STATE_ADDR);
+    if (state == 0) {
+        return;
+    }
+    if (state & (1 << id_bulk_target_keymap)) {
+        dynamic_keymap_reset();
+    }
+    if (state & (1 << id_bulk_target_macro)) {
+        dynamic_keymap_macro_reset();
+    }
+    eeprom_update_byte((void *)VIA_EEPROM_BULK_STATE_ADDR, 0);
+}
+
 // Override this at the keyboard code level to check
 // VIA's EEPROM valid state and reset to defaults as needed.
 // Used by keyboards that store their own state in EEPROM,
@@ -100,6 +129,8 @@ void via_init(void) {
     // OK to load from EEPROM.
     if (!via_eeprom_is_valid()) {
         eeconfig_init_via();
+    } else {
+        via_bulk_recover();
     }
 }
 
@@ -112,6 +143,8 @@ void eeconfig_init_via(void) {
     dynamic_keymap_reset();
     // This resets the macros in EEPROM to nothing.
     dynamic_keymap_macro_reset();
+    // No bulk transfer is in progress on fresh data
+    eeprom_update_byte((void *)VIA_EEPROM_BULK_STATE_ADDR, 0);
     // Save the magic number last, in case saving was interrupted
     via_eeprom_set_valid(true);
 }
@@ -276,6 +309,226 @@ __attribute__((weak)) bool via_command_kb(uint8_t *data, uint8_t length) {
     return false;
 }
 
+// State of the bulk transfer in progress, see via.h for the protocol.
+static struct {
+    bool     active;
+    bool     nak_sent;
+    uint8_t  target;
+    uint8_t  window;
+    uint8_t  crc;
+    uint16_t offset;
+    uint16_t size;
+    uint16_t written;
+    uint16_t next_chunk;
+} via_bulk;
+
+// Header of a chunk report: command id, bulk command id, chunk number
+#define VIA_BULK_CHUNK_HEADER_SIZE 4
+
+static uint16_t via_bulk_target_size(uint8_t target) {
+    switch (target) {
+        case id_bulk_target_keymap:
+            return dynamic_keymap_get_layer_count() * MATRIX_ROWS * MATRIX_COLS * 2;
+        case id_bulk_target_macro:
+            return dynamic_keymap_macro_get_buffer_size();
+        default:
+            return 0;
+    }
+}
+
+static uint8_t via_bulk_check_range(uint8_t target, uint16_t offset, uint16_t size) {
+    uint16_t target_size = via_bulk_target_size(target);
+    if (target_size == 0) {
+        return id_bulk_bad_target;
+    }
+    if (size == 0 || offset > target_size || size > target_size - offset) {
+        return id_bulk_out_of_range;
+    }
+    return id_bulk_ok;
+}
+
+static void via_bulk_begin(uint8_t *data, uint8_t length) {
+    uint8_t  target = data[2];
+    uint16_t offset = (data[3] << 8) | data[4];
+    uint16_t size   = (data[5] << 8) | data[6];
+    uint8_t  window = data[7];
+
+    // A new begin always restarts, so the host can recover from any state
+    via_bulk.active = false;
+
+    uint8_t status = via_bulk_check_range(target, offset, size);
+    if (status == id_bulk_ok) {
+        if (window == 0 || window > VIA_BULK_WINDOW_SIZE) {
+            window = VIA_BULK_WINDOW_SIZE;
+        }
+
+        via_bulk.active     = true;
+        via_bulk.nak_sent   = false;
+        via_bulk.target     = target;
+        via_bulk.window     = window;
+        via_bulk.crc        = 0xFF;
+        via_bulk.offset     = offset;
+        via_bulk.size       = size;
+        via_bulk.written    = 0;
+        via_bulk.next_chunk = 0;
+
+        // Marked until the commit succeeds
+        via_bulk_set_in_progress(target, true);
+    }
+
+    data[2] = status;
+    data[3] = via_bulk.window;
+    data[4] = length - VIA_BULK_CHUNK_HEADER_SIZE;
+}
+
+// Returns true if the chunk needs to be answered
+static bool via_bulk_write(uint8_t *data, uint8_t length) {
+    uint16_t chunk  = (data[2] << 8) | data[3];
+    uint8_t  status = id_bulk_ok;
+
+    if (!via_bulk.active) {
+        status = id_bulk_bad_state;
+    } else if (chunk != via_bulk.next_chunk) {
+        // Only the first chunk past a gap is answered, the host then goes back to next_chunk
+        if (via_bulk.nak_sent) {
+            return false;
+        }
+        via_bulk.nak_sent = true;
+        status            = id_bulk_out_of_order;
+    } else if (via_bulk.written == via_bulk.size) {
+        status = id_bulk_out_of_range;
+    } else {
+        uint16_t offset     = via_bulk.offset + via_bulk.written;
+        uint16_t size       = MIN(length - VIA_BULK_CHUNK_HEADER_SIZE, via_bulk.size - via_bulk.written);
+        uint8_t *chunk_data = &data[VIA_BULK_CHUNK_HEADER_SIZE];
+        bool     stored     = true;
+
+        if (via_bulk.target == id_bulk_target_keymap) {
+            stored = dynamic_keymap_set_buffer(offset, size, chunk_data);
+        } else {
+            dynamic_keymap_macro_set_buffer(offset, size, chunk_data);
+        }
+
+        if (!stored) {
+            // Left marked, the target is reset on the next boot unless a retry commits
+            via_bulk.active = false;
+            status          = id_bulk_no_space;
+        } else {
+            via_bulk.crc = crc8_update(via_bulk.crc, chunk_data, size);
+            via_bulk.written += size;
+            via_bulk.next_chunk++;
+            via_bulk.nak_sent = false;
+
+            if (via_bulk.next_chunk % via_bulk.window != 0 && via_bulk.written != via_bulk.size) {
+                return false;
+            }
+        }
+    }
+
+    data[2] = status;
+    data[3] = via_bulk.next_chunk >> 8;
+    data[4] = via_bulk.next_chunk & 0xFF;
+    return true;
+}
+
+static void via_bulk_commit(uint8_t *data) {
+    uint8_t crc    = data[2];
+    uint8_t status = id_bulk_ok;
+
+    if (!via_bulk.active) {
+        status = id_bulk_bad_state;
+    } else if (via_bulk.written != via_bulk.size) {
+        status = id_bulk_incomplete;
+    } else {
+        via_bulk.active = false;
+        if (crc != via_bulk.crc) {
+            // Left marked, the target is reset on the next boot unless a retry commits
+            status = id_bulk_bad_crc;
+        } else {
+            via_bulk_set_in_progress(via_bulk.target, false);
+        }
+    }
+
+    data[2] = status;
+}
+
+static void via_bulk_abort(uint8_t *data) {
+    // Nothing was written yet, so the target is still intact
+    if (via_bulk.active && via_bulk.written == 0) {
+        via_bulk_set_in_progress(via_bulk.target, false);
+    }
+    via_bulk.active = false;
+
+    data[2] = id_bulk_ok;
+}
+
+// Sends up to a window of chunk reports from the requested range, reusing the command buffer.
+// The rest is left to further requests, so that a large read does not stall the matrix scan.
+static void via_bulk_read(uint8_t *data, uint8_t length) {
+    uint8_t  target = data[2];
+    uint16_t offset = (data[3] << 8) | data[4];
+    uint16_t size   = (data[5] << 8) | data[6];
+    uint8_t  crc    = 0xFF;
+    uint16_t done   = 0;
+
+    uint8_t status = via_bulk_check_range(target, offset, size);
+    if (status == id_bulk_ok) {
+        uint8_t *chunk_data = &data[VIA_BULK_CHUNK_HEADER_SIZE];
+        uint16_t chunk_size = length - VIA_BULK_CHUNK_HEADER_SIZE;
+
+        for (uint16_t chunk = 0; chunk < VIA_BULK_WINDOW_SIZE && done < size; chunk++) {
+            uint16_t count = MIN(chunk_size, size - done);
+
+            memset(chunk_data, 0, chunk_size);
+            if (target == id_bulk_target_keymap) {
+                dynamic_keymap_get_buffer(offset + done, count, chunk_data);
+            } else {
+                dynamic_keymap_macro_get_buffer(offset + done, count, chunk_data);
+            }
+            crc = crc8_update(crc, chunk_data, count);
+
+            data[0] = id_bulk_transfer;
+            data[1] = id_bulk_read;
+            data[2] = chunk >> 8;
+            data[3] = chunk & 0xFF;
+            raw_hid_send(data, length);
+
+            done += count;
+        }
+    }
+
+    memset(data, 0, length);
+    data[0] = id_bulk_transfer;
+    data[1] = id_bulk_read;
+    data[2] = status;
+    data[3] = crc;
+    data[4] = done >> 8;
+    data[5] = done & 0xFF;
+}
+
+// Returns true if the command buffer should be sent back to the host
+static bool via_bulk_transfer_command(uint8_t *data, uint8_t length) {
+    switch (data[1]) {
+        case id_bulk_begin:
+            via_bulk_begin(data, length);
+            return true;
+        case id_bulk_write:
+            return via_bulk_write(data, length);
+        case id_bulk_commit:
+            via_bulk_commit(data);
+            return true;
+        case id_bulk_abort:
+            via_bulk_abort(data);
+            return true;
+        case id_bulk_read:
+            via_bulk_read(data, length);
+            return true;
+        default:
+            data[0] = id_unhandled;
+            return true;
+    }
+}
+
 void raw_hid_receive(uint8_t *data, uint8_t length) {
     uint8_t *command_id   = &(data[0]);
     uint8_t *command_data = &(data[1]);
@@ -374,7 +627,9 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
             break;
         }
         case id_dynamic_keymap_set_keycode: {
-            dynamic_keymap_set_keycode(command_data[0], command_data[1], command_data[2], (command_data[3] << 8) | command_data[4]);
+            if (!dynamic_keymap_set_keycode(command_data[0], command_data[1], command_data[2], (command_data[3] << 8) | command_data[4])) {
+                *command_id = id_unhandled;
+            }
             break;
         }
         case id_dynamic_keymap_reset: {
@@ -433,7 +688,16 @@ void raw_hid_receive(uint8_t *data, uint8_t length) {
         case id_dynamic_keymap_set_buffer: {
             uint16_t offset = (command_data[0] << 8) | command_data[1];
             uint16_t size   = command_data[2]; // size <= 28
-            dynamic_keymap_set_buffer(offset, size, &command_data[3]);
+            if (!dynamic_keymap_set_buffer(offset, size, &command_data[3])) {
+                *command_id = id_unhandled;
+            }
+            break;
+        }
+        case id_bulk_transfer: {
+            // Chunks inside a window are not answered
+            if (!via_bulk_transfer_command(data, length)) {
+                return;
+            }
             break;
         }
 #ifdef ENCODER_MAP_ENABLE
@@ -55,11 +55,14 @@
 #    define VIA_EEPROM_CUSTOM_CONFIG_SIZE 0
 #endif
 
-#define VIA_EEPROM_CONFIG_END (VIA_EEPROM_CUSTOM_CONFIG_ADDR + VIA_EEPROM_CUSTOM_CONFIG_SIZE)
+// Bulk transfers in progress, one bit per target, see via_init()
+#define VIA_EEPROM_BULK_STATE_ADDR (VIA_EEPROM_CUSTOM_CONFIG_ADDR + VIA_EEPROM_CUSTOM_CONFIG_SIZE)
+
+#define VIA_EEPROM_CONFIG_END (VIA_EEPROM_BULK_STATE_ADDR + 1)
 
 // This is changed only when the command IDs change,
 // so VIA Configurator can detect compatible firmware.
-#define VIA_PROTOCOL_VERSION 0x000C
+#define VIA_PROTOCOL_VERSION 0x000D
 
 // This is a version number for the firmware for the keyboard.
 // It can be used to ensure the VIA keyboard definition and the firmware
@@ -93,9 +96,64 @@ enum via_command_id {
     id_dynamic_keymap_set_buffer            = 0x13,
     id_dynamic_keymap_get_encoder           = 0x14,
     id_dynamic_keymap_set_encoder           = 0x15,
+    id_bulk_transfer                        = 0x16,
     id_unhandled                            = 0xFF,
 };
 
+// Windowed bulk transfer of the dynamic keymap and macro buffers.
+//
+// Writes stream numbered chunks without waiting for a response to each one.
+// The keyboard only answers at the end of every window of chunks, or on the
+// first out of order chunk, after which the host resends from the chunk
+// number returned. Chunks are written straight to EEPROM while a CRC8 of the
+// stream is accumulated. The target is marked as in progress in EEPROM when
+// the transfer begins, and only unmarked once the commit CRC matches. If a
+// transfer is interrupted, or committed with a bad CRC, the next boot resets
+// that target to its defaults rather than leaving a half written keymap
+// behind. The other target and the layout options are kept.
+//
+// Reads send at most one window of chunks per request, so the matrix keeps
+// being scanned during large reads. The status that follows them holds the
+// number of bytes sent, and the host asks for the rest from there.
+//
+// A keymap chunk that does not fit a sparse dynamic keymap ends the transfer
+// with id_bulk_no_space, answered right away.
+//
+// [ id_bulk_transfer, id_bulk_begin,  target, offset(2), size(2), window ] -> [ ..., status, window, chunk size ]
+// [ id_bulk_transfer, id_bulk_write,  chunk(2), data... ]                  -> [ ..., status, next chunk(2) ] at window ends
+// [ id_bulk_transfer, id_bulk_commit, crc8 ]                               -> [ ..., status ]
+// [ id_bulk_transfer, id_bulk_abort ]                                      -> [ ..., status ]
+// [ id_bulk_transfer, id_bulk_read,   target, offset(2), size(2) ]         -> a report per chunk, then [ ..., status, crc8, bytes sent(2) ]
+//
+// All multi-byte values are big endian, like the rest of the protocol.
+#ifndef VIA_BULK_WINDOW_SIZE
+#    define VIA_BULK_WINDOW_SIZE 8
+#endif
+
+enum via_bulk_command_id {
+    id_bulk_begin  = 0x01,
+    id_bulk_write  = 0x02,
+    id_bulk_commit = 0x03,
+    id_bulk_abort  = 0x04,
+    id_bulk_read   = 0x05,
+};
+
+enum via_bulk_target {
+    id_bulk_target_keymap = 0x01,
+    id_bulk_target_macro  = 0x02,
+};
+
+enum via_bulk_status {
+    id_bulk_ok           = 0x00,
+    id_bulk_bad_state    = 0x01,
+    id_bulk_bad_target   = 0x02,
+    id_bulk_out_of_range = 0x03,
+    id_bulk_out_of_order = 0x04,
+    id_bulk_bad_crc      = 0x05,
+    id_bulk_incomplete   = 0x06,
+    id_bulk_no_space     = 0x07,
+};
+
 enum via_keyboard_value_id {
     id_uptime              = 0x01,
     id_layout_options      = 0x02,
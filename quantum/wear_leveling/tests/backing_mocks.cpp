@@ -14,6 +14,11 @@ void MockBackingStore::reset_instance() {
 
     locked = true;
 
+    async_erase_polls     = 0;
+    async_erase_remaining = 0;
+    async_erase_pending   = false;
+    async_erase_result    = true;
+
     backing_erasure_count     = 0;
     backing_max_write_count   = 0;
     backing_total_write_count = 0;
@@ -82,6 +87,7 @@ bool MockBackingStore::write(uint32_t address, backing_store_int_t value) {
     EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
     EXPECT_TRUE(address + BACKING_STORE_WRITE_SIZE <= WEAR_LEVELING_BACKING_SIZE) << "Address would result of out-of-bounds access";
     EXPECT_FALSE(is_locked()) << "Write was attempted without being unlocked first";
+    EXPECT_FALSE(is_erasing()) << "Write was attempted while an erase was in progress";
 
     // Drop out of write early with failure if we need to
     if (write_success_callback && !write_success_callback(backing_write_invoke_count, address)) {
@@ -113,6 +119,37 @@ bool MockBackingStore::lock(void) {
     return true;
 }
 
+bool MockBackingStore::begin_erase(void) {
+    if (async_erase_polls == 0) {
+        return erase();
+    }
+
+    async_erase_remaining = async_erase_polls;
+    async_erase_pending   = true;
+    return true;
+}
+
+bool MockBackingStore::erase_in_progress(void) {
+    if (!async_erase_pending) {
+        return false;
+    }
+    if (--async_erase_remaining > 0) {
+        return true;
+    }
+
+    async_erase_pending = false;
+    async_erase_result  = erase();
+    return false;
+}
+
+bool MockBackingStore::end_erase(void) {
+    if (async_erase_pending) {
+        async_erase_pending = false;
+        async_erase_result  = erase();
+    }
+    return async_erase_result;
+}
+
 bool MockBackingStore::read(uint32_t address, backing_store_int_t& value) const {
     // precondition: value's buffer size already matches BACKING_STORE_WRITE_SIZE
     EXPECT_TRUE(address % BACKING_STORE_WRITE_SIZE == 0) << "Supplied address was not aligned with the backing store integral size";
@@ -152,3 +189,15 @@ extern "C" bool backing_store_lock(void) {
 extern "C" bool backing_store_read(uint32_t address, backing_store_int_t* value) {
     return MockBackingStore::Instance().read(address, *value);
 }
+
+extern "C" bool backing_store_begin_erase(void) {
+    return MockBackingStore::Instance().begin_erase();
+}
+
+extern "C" bool backing_store_erase_in_progress(void) {
+    return MockBackingStore::Instance().erase_in_progress();
+}
+
+extern "C" bool backing_store_end_erase(void) {
+    return MockBackingStore::Instance().end_erase();
+}
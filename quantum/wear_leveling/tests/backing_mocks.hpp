@@ -79,6 +79,14 @@ class MockBackingStore {
 
     // Whether the backing store is locked
     bool locked;
+    // Number of polls an asynchronous erase stays in progress for, erases are synchronous if zero
+    std::uint64_t async_erase_polls;
+    // Remaining polls of the asynchronous erase in progress, if any
+    std::uint64_t async_erase_remaining;
+    // Whether an asynchronous erase has been started and not yet completed
+    bool async_erase_pending;
+    // Result of the last completed asynchronous erase
+    bool async_erase_result;
     // The actual data stored in the emulated flash
     storage_t backing_storage;
     // The number of erase cycles that have occurred
@@ -162,6 +170,18 @@ class MockBackingStore {
     bool write(std::uint32_t address, backing_store_int_t value);
     bool lock();
     bool read(std::uint32_t address, backing_store_int_t& value) const;
+    bool begin_erase();
+    bool erase_in_progress();
+    bool end_erase();
+
+    bool is_erasing() const {
+        return async_erase_pending;
+    }
+
+    // Makes erases started by consolidation asynchronous, completing after the given number of polls
+    void set_async_erase_polls(std::uint64_t polls) {
+        async_erase_polls = polls;
+    }
 
     // Control over when init/writes/erases should succeed
     void set_init_callback(std::function<bool(std::uint64_t)> callback) {
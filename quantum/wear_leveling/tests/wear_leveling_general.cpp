@@ -202,3 +202,78 @@ TEST_F(WearLevelingGeneral, WriteFailure_NoSubsequentWrites) {
     wear_leveling_read(0x04, &test_val, sizeof(test_val));
     EXPECT_EQ(test_val, 0x14) << "Readback should come from cache regardless of unlock failure";
 }
+
+/**
+ * This test verifies that a consolidation with an asynchronous erase writes the cache only once the erase has completed, including any values written in the meantime.
+ */
+TEST_F(WearLevelingGeneral, AsyncErase_ConsolidationDeferred) {
+    auto& inst = MockBackingStore::Instance();
+    inst.set_async_erase_polls(3);
+
+    // Generate a test block of data
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> testvalue;
+    std::iota(testvalue.begin(), testvalue.end(), 0x20);
+
+    // Fill up the write log so that consolidation occurs
+    EXPECT_EQ(wear_leveling_write(0, testvalue.data(), testvalue.size()), WEAR_LEVELING_CONSOLIDATED) << "Write returned incorrect status";
+    EXPECT_TRUE(inst.is_erasing()) << "Erase should still be in progress";
+    EXPECT_EQ(inst.erasure_count(), 0) << "Erase should not have completed";
+
+    // Writes during the erase only update the cache
+    uint64_t write_count = inst.write_invoke_count();
+    uint8_t  test_val    = 0x55;
+    testvalue[0x03]      = test_val;
+    EXPECT_EQ(wear_leveling_write(0x03, &test_val, sizeof(test_val)), WEAR_LEVELING_SUCCESS) << "Write during erase should have succeeded";
+    EXPECT_EQ(inst.write_invoke_count(), write_count) << "Write should not have been invoked during the erase";
+
+    // The task completes the consolidation once the erase has finished
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_CONSOLIDATED) << "Task should have consolidated";
+    EXPECT_FALSE(inst.is_erasing()) << "Erase should have completed";
+    EXPECT_EQ(inst.erasure_count(), 1) << "Erase should have occurred once";
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task should have nothing left to do";
+
+    // Re-init and verify the consolidated data
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(readback, testvalue) << "Invalid readback";
+}
+
+/**
+ * This test verifies that flushing waits for an asynchronous erase and writes the consolidated data.
+ */
+TEST_F(WearLevelingGeneral, AsyncErase_FlushCompletesConsolidation) {
+    auto& inst = MockBackingStore::Instance();
+    inst.set_async_erase_polls(100);
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> testvalue;
+    std::iota(testvalue.begin(), testvalue.end(), 0x40);
+
+    EXPECT_EQ(wear_leveling_write(0, testvalue.data(), testvalue.size()), WEAR_LEVELING_CONSOLIDATED) << "Write returned incorrect status";
+    EXPECT_TRUE(inst.is_erasing()) << "Erase should still be in progress";
+
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_CONSOLIDATED) << "Flush should have consolidated";
+    EXPECT_FALSE(inst.is_erasing()) << "Erase should have completed";
+    EXPECT_EQ(wear_leveling_flush(), WEAR_LEVELING_SUCCESS) << "Flush should have nothing left to do";
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> readback;
+    EXPECT_EQ(wear_leveling_init(), WEAR_LEVELING_SUCCESS) << "Init returned incorrect status";
+    EXPECT_EQ(wear_leveling_read(0, readback.data(), readback.size()), WEAR_LEVELING_SUCCESS) << "Failed to read";
+    EXPECT_EQ(readback, testvalue) << "Invalid readback";
+}
+
+/**
+ * This test verifies that a failed asynchronous erase is reported once the consolidation completes.
+ */
+TEST_F(WearLevelingGeneral, AsyncErase_Failure) {
+    auto& inst = MockBackingStore::Instance();
+    inst.set_async_erase_polls(2);
+    inst.set_erase_callback([](std::uint64_t count) { return false; });
+
+    std::array<std::uint8_t, WEAR_LEVELING_LOGICAL_SIZE> testvalue;
+    std::iota(testvalue.begin(), testvalue.end(), 0x60);
+
+    EXPECT_EQ(wear_leveling_write(0, testvalue.data(), testvalue.size()), WEAR_LEVELING_CONSOLIDATED) << "Write returned incorrect status";
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_FAILED) << "Task should have reported the failed erase";
+    EXPECT_EQ(wear_leveling_task(), WEAR_LEVELING_SUCCESS) << "Task should have nothing left to do";
+}
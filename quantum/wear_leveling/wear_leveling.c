@@ -162,6 +162,7 @@ static struct __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) {
     __attribute__((__aligned__(BACKING_STORE_WRITE_SIZE))) uint8_t cache[(WEAR_LEVELING_LOGICAL_SIZE)];
     uint32_t                                                       write_address;
     bool                                                           unlocked;
+    bool                                                           consolidating; // backing store erase in progress, cache to be written once complete
 } wear_leveling;
 
 /**
@@ -295,15 +296,13 @@ static wear_leveling_status_t wear_leveling_write_consolidated(void) {
 }
 
 /**
- * Forces a write of the current cache.
- * Erases the backing store, including the write log.
- * During this operation, there is the potential for data loss if a power loss occurs.
+ * Completes a consolidation once the backing store erase has finished.
+ * Waits for the erase if it is still in progress.
  */
-static wear_leveling_status_t wear_leveling_consolidate_force(void) {
-    wl_dprintf("Erasing backing store\n");
+static wear_leveling_status_t wear_leveling_consolidate_complete(void) {
+    wear_leveling.consolidating = false;
 
-    // Erase the backing store. Expectation is that any un-written values that are read back after this call come back as zero.
-    bool ok = backing_store_erase();
+    bool ok = backing_store_end_erase();
     if (!ok) {
         wl_dprintf("Failed to erase backing store\n");
         return WEAR_LEVELING_FAILED;
@@ -315,10 +314,45 @@ static wear_leveling_status_t wear_leveling_consolidate_force(void) {
         wl_dprintf("Failed to write consolidated data\n");
     }
 
+    return status;
+}
+
+/**
+ * Forces a write of the current cache.
+ * Erases the backing store, including the write log.
+ * If the backing store erases asynchronously, the cache is written once the erase completes -- see wear_leveling_task().
+ * During this operation, there is the potential for data loss if a power loss occurs.
+ */
+static wear_leveling_status_t wear_leveling_consolidate_force(void) {
+    wl_dprintf("Erasing backing store\n");
+
+    // Erase the backing store. Expectation is that any un-written values that are read back after this call come back as zero.
+    bool ok = backing_store_begin_erase();
+    if (!ok) {
+        wl_dprintf("Failed to erase backing store\n");
+        return WEAR_LEVELING_FAILED;
+    }
+
     // Next write of the log occurs after the consolidated values at the start of the backing store.
     wear_leveling.write_address = (WEAR_LEVELING_LOGICAL_SIZE) + 8; // +8 due to the FNV1a_64 of the consolidated area
+    wear_leveling.consolidating = true;
 
-    return status;
+    if (backing_store_erase_in_progress()) {
+        wl_dprintf("Erase in progress, deferring consolidated write\n");
+        return WEAR_LEVELING_CONSOLIDATED;
+    }
+
+    return wear_leveling_consolidate_complete();
+}
+
+/**
+ * Waits for any erase started for a consolidation, discarding the consolidation itself.
+ */
+static void wear_leveling_consolidate_cancel(void) {
+    if (wear_leveling.consolidating) {
+        wear_leveling.consolidating = false;
+        backing_store_end_erase();
+    }
 }
 
 /**
@@ -617,6 +651,9 @@ static wear_leveling_status_t wear_leveling_playback_log(void) {
 wear_leveling_status_t wear_leveling_init(void) {
     wl_dprintf("Init\n");
 
+    // Any pending consolidation is superseded by the data in the backing store
+    wear_leveling_consolidate_cancel();
+
     // Reset the cache
     wear_leveling_clear_cache();
 
@@ -659,7 +696,8 @@ wear_leveling_status_t wear_leveling_erase(void) {
         return WEAR_LEVELING_FAILED;
     }
 
-    // Perform the erase
+    // Perform the erase, once any erase started by a consolidation has completed
+    wear_leveling_consolidate_cancel();
     bool ret = backing_store_erase();
     wear_leveling_clear_cache();
 
@@ -691,6 +729,14 @@ wear_leveling_status_t wear_leveling_write(const uint32_t address, const void *v
     // Update the cache before writing to the backing store -- if we hit the end of the backing store during writes to the log then we'll force a consolidation in-line
     memcpy(&wear_leveling.cache[address], value, length);
 
+    // A pending consolidation writes the whole cache, including this change, once the erase has completed
+    if (wear_leveling.consolidating) {
+        if (backing_store_erase_in_progress()) {
+            return WEAR_LEVELING_SUCCESS;
+        }
+        return wear_leveling_consolidate_complete();
+    }
+
     // Unlock the backing store
     backing_store_lock_status_t lock_status = wear_leveling_unlock();
     if (lock_status == STATUS_FAILURE) {
@@ -743,6 +789,28 @@ wear_leveling_status_t wear_leveling_read(const uint32_t address, void *value, s
     return WEAR_LEVELING_SUCCESS;
 }
 
+/**
+ * Progresses a pending consolidation.
+ */
+wear_leveling_status_t wear_leveling_task(void) {
+    if (!wear_leveling.consolidating || backing_store_erase_in_progress()) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    return wear_leveling_consolidate_complete();
+}
+
+/**
+ * Completes a pending consolidation.
+ */
+wear_leveling_status_t wear_leveling_flush(void) {
+    if (!wear_leveling.consolidating) {
+        return WEAR_LEVELING_SUCCESS;
+    }
+
+    return wear_leveling_consolidate_complete();
+}
+
 /**
  * Weak implementation of bulk read, drivers can implement more optimised implementations.
  */
@@ -766,3 +834,19 @@ __attribute__((weak)) bool backing_store_write_bulk(uint32_t address, backing_st
     }
     return true;
 }
+
+/**
+ * Weak implementation of asynchronous erase, erasing synchronously. Drivers with slow erases can start the erase and
+ * complete it in backing_store_erase_in_progress()/backing_store_end_erase() instead.
+ */
+__attribute__((weak)) bool backing_store_begin_erase(void) {
+    return backing_store_erase();
+}
+
+__attribute__((weak)) bool backing_store_erase_in_progress(void) {
+    return false;
+}
+
+__attribute__((weak)) bool backing_store_end_erase(void) {
+    return true;
+}
@@ -52,3 +52,20 @@ wear_leveling_status_t wear_leveling_write(uint32_t address, const void* value,
  * @return Status of the request
  */
 wear_leveling_status_t wear_leveling_read(uint32_t address, void* value, size_t length);
+
+/**
+ * Progresses a consolidation whose backing store erase is still in progress.
+ *
+ * Backing stores supporting asynchronous erases return from a consolidation before the erase has completed, the cache is
+ * written to the backing store once it has. Should be called periodically, e.g. from the housekeeping task.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_task(void);
+
+/**
+ * Completes any pending consolidation, waiting for the backing store erase if required.
+ *
+ * @return Status of the request
+ */
+wear_leveling_status_t wear_leveling_flush(void);
@@ -76,6 +76,11 @@ bool backing_store_lock(void);
 bool backing_store_read(uint32_t address, backing_store_int_t* value);
 bool backing_store_read_bulk(uint32_t address, backing_store_int_t* values, size_t item_count); // weak implementation already provided, optimized implementation can be implemented by driver
 
+// Optional asynchronous erase, used for consolidation. The weak implementations fall back to a blocking backing_store_erase().
+bool backing_store_begin_erase(void);       // starts erasing the backing store
+bool backing_store_erase_in_progress(void); // polls the erase, advancing it if it consists of several operations
+bool backing_store_end_erase(void);         // waits for the erase to complete, returns whether all of it succeeded
+
 /**
  * Helper type used to contain a write log entry.
  */
@@ -0,0 +1,180 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "action_fuzzer.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <sstream>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_driver.hpp"
+#include "test_logger.hpp"
+
+extern "C" {
+#include "action_layer.h"
+#include "action_util.h"
+#include "quantum.h"
+}
+
+using testing::_;
+
+namespace {
+
+// clang-format off
+const uint16_t layer_0[ActionFuzzer::kKeyCount] = {
+    KC_A,           KC_B,           LSFT_T(KC_C),   LCTL_T(KC_D),
+    LT(1, KC_E),    KC_F,           KC_G,           TD(0),
+    TD(1),          OSM(MOD_LALT),  KC_H,           KC_I,
+    MO(1),          KC_LEFT_SHIFT,  KC_J,           LGUI_T(KC_K),
+};
+
+const uint16_t layer_1[ActionFuzzer::kKeyCount] = {
+    KC_1,           KC_2,           KC_TRNS,        KC_TRNS,
+    KC_TRNS,        KC_F,           KC_3,           KC_TRNS,
+    KC_TRNS,        KC_TRNS,        KC_TRNS,        KC_I,
+    KC_TRNS,        KC_TRNS,        LCTL(KC_4),     KC_TRNS,
+};
+// clang-format on
+
+} // namespace
+
+constexpr uint8_t  ActionFuzzer::kKeyCount;
+constexpr size_t   ActionFuzzer::kMaxEvents;
+constexpr uint32_t ActionFuzzer::kSettleMs;
+constexpr uint32_t ActionFuzzer::kQuietMs;
+constexpr uint32_t ActionFuzzer::kSlowScanUs;
+
+ActionFuzzer::ActionFuzzer() {
+    for (uint8_t i = 0; i < kKeyCount; i++) {
+        keys.emplace_back(0, i % MATRIX_COLS, i / MATRIX_COLS, layer_0[i]);
+        add_key(keys.back());
+        add_key(KeymapKey(1, i % MATRIX_COLS, i / MATRIX_COLS, layer_1[i]));
+    }
+}
+
+void ActionFuzzer::scan() {
+    auto start = std::chrono::steady_clock::now();
+    run_one_scan_loop();
+    auto us         = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    slowest_scan_us = std::max<uint32_t>(slowest_scan_us, us);
+}
+
+ActionFuzzer::Result ActionFuzzer::run(const uint8_t* data, size_t size) {
+    TestDriver        driver;
+    std::stringstream failure;
+    report_keyboard_t last_report = {};
+    uint32_t          reports     = 0;
+
+    test_logger.reset();
+    slowest_scan_us = 0;
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).WillRepeatedly([&](report_keyboard_t& report) {
+        for (int i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+            for (int j = i + 1; j < KEYBOARD_REPORT_KEYS; j++) {
+                if (report.keys[i] != KC_NO && report.keys[i] == report.keys[j] && failure.tellp() == 0) {
+                    failure << "key 0x" << std::hex << +report.keys[i] << " reported twice";
+                }
+            }
+        }
+        last_report = report;
+        reports++;
+    });
+
+    bool   pressed[kKeyCount] = {};
+    size_t events             = std::min(size / 2, kMaxEvents);
+    for (size_t i = 0; i < events; i++) {
+        uint8_t key = data[2 * i] % kKeyCount;
+        for (uint8_t ms = data[2 * i + 1]; ms > 0; ms--) {
+            scan();
+        }
+        if (pressed[key]) {
+            keys[key].release();
+        } else {
+            keys[key].press();
+        }
+        pressed[key] = !pressed[key];
+        scan();
+    }
+
+    for (uint8_t key = 0; key < kKeyCount; key++) {
+        if (pressed[key]) {
+            keys[key].release();
+            scan();
+        }
+    }
+    for (uint32_t ms = 0; ms < kSettleMs; ms++) {
+        scan();
+    }
+
+    uint32_t settled_reports = reports;
+    for (uint32_t ms = 0; ms < kQuietMs; ms++) {
+        scan();
+    }
+
+    if (failure.tellp() != 0) {
+        // Already failed while the trace was running
+    } else if (reports != settled_reports) {
+        failure << "still reporting " << kSettleMs << "ms after the last release";
+    } else if (last_report.mods != 0 || std::any_of(std::begin(last_report.keys), std::end(last_report.keys), [](uint8_t key) { return key != KC_NO; })) {
+        failure << "stuck keys in the last report: " << last_report;
+    } else if (get_mods() != 0 || get_weak_mods() != 0 || get_oneshot_mods() != 0) {
+        failure << "stuck mods 0x" << std::hex << +get_mods() << " weak 0x" << +get_weak_mods() << " one shot 0x" << +get_oneshot_mods();
+    } else if (layer_state != 0) {
+        failure << "stuck layers 0x" << std::hex << layer_state;
+    }
+
+    // Start the next input from a clean state, even after a failure
+    clear_keyboard();
+    clear_oneshot_mods();
+    layer_clear();
+    testing::Mock::VerifyAndClearExpectations(&driver);
+
+    return {failure.str(), slowest_scan_us, events};
+}
+
+std::string ActionFuzzer::record(const uint8_t* data, size_t size, const char* prefix) {
+    const char* dir = std::getenv("QMK_FUZZ_RECORD_DIR");
+    if (dir == nullptr) {
+        return "";
+    }
+
+    // FNV-1a, so the same input always lands in the same file
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+
+    char path[4096];
+    std::snprintf(path, sizeof(path), "%s/%s-%08x.bin", dir, prefix, hash);
+    FILE* file = std::fopen(path, "wb");
+    if (file == nullptr) {
+        return "";
+    }
+    std::fwrite(data, 1, size, file);
+    std::fclose(file);
+    return path;
+}
+
+/* libFuzzer entry point, used when the tests are built with `FUZZ=yes`. Any
+ * broken invariant aborts so that libFuzzer saves the input, slow inputs are
+ * recorded as fixtures when `QMK_FUZZ_RECORD_DIR` is set. */
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    static ActionFuzzer* fuzzer = []() {
+        TestFixture::SetUpTestCase();
+        return new ActionFuzzer();
+    }();
+
+    ActionFuzzer::Result result = fuzzer->run(data, size);
+    if (result.slowest_scan_us > ActionFuzzer::kSlowScanUs) {
+        ActionFuzzer::record(data, size, "slow");
+    }
+    if (!result.failure.empty()) {
+        std::fprintf(stderr, "action fuzzer: %s\n", result.failure.c_str());
+        std::abort();
+    }
+    return 0;
+}
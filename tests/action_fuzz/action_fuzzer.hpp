@@ -0,0 +1,65 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "test_fixture.hpp"
+
+/**
+ * @brief Feeds timed key traces through the full keyboard pipeline and checks
+ * that it always settles back into a clean state.
+ *
+ * An input is a sequence of two byte events. The first byte picks one of the
+ * `kKeyCount` keys, which is pressed if it is up and released if it is down.
+ * The second byte is the number of milliseconds to idle before that. Time is
+ * virtual, so a run is fully deterministic. After the last event every key
+ * is released and the keyboard gets `kSettleMs` to finish what it is doing.
+ *
+ * Invariants checked for every input:
+ * - no report holds the same key twice
+ * - the last report is empty, so no key or mod got stuck
+ * - no mods, weak mods, one shot mods or layers are left on
+ * - nothing is reported once the settle time is over, so every event was
+ *   processed within a bounded amount of time
+ *
+ * The wall clock time of every scan is measured as well, inputs with a scan
+ * slower than `kSlowScanUs` are reported as slow.
+ */
+class ActionFuzzer : public TestFixture {
+   public:
+    static constexpr uint8_t  kKeyCount   = 16;
+    static constexpr size_t   kMaxEvents  = 512;
+    static constexpr uint32_t kSettleMs   = 2000;
+    static constexpr uint32_t kQuietMs    = 500;
+    static constexpr uint32_t kSlowScanUs = 2000;
+
+    struct Result {
+        std::string failure; // empty if every invariant held
+        uint32_t    slowest_scan_us;
+        size_t      events;
+    };
+
+    ActionFuzzer();
+    void TestBody() override {}
+
+    Result run(const uint8_t* data, size_t size);
+
+    /**
+     * @brief Writes an input to `$QMK_FUZZ_RECORD_DIR/<prefix>-<hash>.bin`,
+     * in the format of the fixtures directory.
+     *
+     * @return the path written, or an empty string if recording is disabled
+     */
+    static std::string record(const uint8_t* data, size_t size, const char* prefix);
+
+   private:
+    void scan();
+
+    std::vector<KeymapKey> keys;
+    uint32_t               slowest_scan_us;
+};
@@ -0,0 +1,19 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// clang-format off
+const uint16_t fg_combo[] = {KC_F, KC_G, COMBO_END};
+const uint16_t hi_combo[] = {KC_H, KC_I, COMBO_END};
+
+combo_t key_combos[] = {
+    COMBO(fg_combo, KC_ESCAPE),
+    COMBO(hi_combo, LSFT_T(KC_SPACE)),
+};
+
+const tap_dance_action_t PROGMEM tap_dance_actions[] = {
+    ACTION_TAP_DANCE_DOUBLE(KC_M, KC_N),
+    ACTION_TAP_DANCE_DOUBLE(KC_P, KC_LEFT_CTRL),
+};
+// clang-format on
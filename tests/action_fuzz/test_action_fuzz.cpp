@@ -0,0 +1,86 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <dirent.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "action_fuzzer.hpp"
+
+namespace {
+
+std::vector<std::string> fixture_paths() {
+    std::vector<std::string> paths;
+    if (DIR* dir = opendir(ACTION_FUZZ_FIXTURES)) {
+        while (struct dirent* entry = readdir(dir)) {
+            std::string name = entry->d_name;
+            if (name.size() > 4 && name.compare(name.size() - 4, 4, ".bin") == 0) {
+                paths.push_back(std::string(ACTION_FUZZ_FIXTURES) + "/" + name);
+            }
+        }
+        closedir(dir);
+    }
+    std::sort(paths.begin(), paths.end());
+    return paths;
+}
+
+// Mostly short delays, so that events land inside the tapping, combo and tap dance terms
+std::vector<uint8_t> random_trace(std::mt19937& rng) {
+    std::uniform_int_distribution<int> events(1, 64);
+    std::uniform_int_distribution<int> key(0, ActionFuzzer::kKeyCount - 1);
+    std::uniform_int_distribution<int> short_delay(0, 60);
+    std::uniform_int_distribution<int> long_delay(0, 255);
+    std::bernoulli_distribution        is_long(0.15);
+
+    std::vector<uint8_t> trace;
+    for (int i = events(rng); i > 0; i--) {
+        trace.push_back(key(rng));
+        trace.push_back(is_long(rng) ? long_delay(rng) : short_delay(rng));
+    }
+    return trace;
+}
+
+} // namespace
+
+TEST_F(ActionFuzzer, ReplaysFixtures) {
+    auto paths = fixture_paths();
+    ASSERT_FALSE(paths.empty()) << "no fixtures in " << ACTION_FUZZ_FIXTURES;
+
+    for (auto& path : paths) {
+        std::ifstream        file(path, std::ios::binary);
+        std::vector<uint8_t> input((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        Result result = run(input.data(), input.size());
+        EXPECT_EQ(result.failure, "") << path;
+    }
+}
+
+TEST_F(ActionFuzzer, RandomTraces) {
+    constexpr int kTraces = 1000;
+    std::mt19937  rng(0x51AB1E);
+    size_t        events  = 0;
+    uint32_t      slowest = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kTraces; i++) {
+        auto   trace  = random_trace(rng);
+        Result result = run(trace.data(), trace.size());
+        events += result.events;
+        slowest = std::max(slowest, result.slowest_scan_us);
+
+        if (!result.failure.empty()) {
+            std::string path = record(trace.data(), trace.size(), "crash");
+            ADD_FAILURE() << "trace " << i << ": " << result.failure << (path.empty() ? "" : ", recorded as " + path);
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::printf("\nAction fuzzer, %d traces\n", kTraces);
+    std::printf("%8.0f traces/s %8.0f events/s %8u us slowest scan\n", kTraces / seconds, events / seconds, slowest);
+}
@@ -463,3 +463,38 @@ TEST_F(ActionLayer, LayerModHonorsModConfig) {
 
     VERIFY_AND_CLEAR(driver);
 }
+
+TEST_F(ActionLayer, WaitingBufferOverflowReleasesOnlyMomentaryLayers) {
+    TestDriver driver;
+    KeymapKey  toggle_key  = KeymapKey{0, 0, 0, TG(2)};
+    KeymapKey  layer_key   = KeymapKey{2, 1, 0, MO(1)};
+    KeymapKey  mod_tap_key = KeymapKey{2, 2, 0, SFT_T(KC_P)};
+    KeymapKey  regular_key = KeymapKey{2, 3, 0, KC_A};
+    set_keymap({toggle_key, layer_key, mod_tap_key, regular_key});
+
+    EXPECT_CALL(driver, send_keyboard_mock(_)).Times(AnyNumber());
+
+    tap_key(toggle_key);
+    EXPECT_TRUE(layer_state_is(2));
+
+    layer_key.press();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_cmp(layer_state, 1));
+
+    /* Release MO while the mod-tap is undecided, then overflow the waiting buffer. */
+    mod_tap_key.press();
+    run_one_scan_loop();
+    layer_key.release();
+    run_one_scan_loop();
+    for (int i = 0; i < WAITING_BUFFER_SIZE; i++) {
+        tap_key(regular_key);
+    }
+
+    EXPECT_FALSE(layer_state_cmp(layer_state, 1));
+    EXPECT_TRUE(layer_state_cmp(layer_state, 2));
+
+    mod_tap_key.release();
+    run_one_scan_loop();
+    EXPECT_TRUE(layer_state_cmp(layer_state, 2));
+    VERIFY_AND_CLEAR(driver);
+}
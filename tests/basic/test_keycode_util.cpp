@@ -50,3 +50,62 @@ INSTANTIATE_TEST_CASE_P(ConversionTestsP, KeycodeToIdentifierSuite,
     std::make_pair(HYPR(KC_SPACE), "QK_MODS(KC_SPACE, QK_LCTL | QK_LSFT | QK_LALT | QK_LGUI)")
 ));
 // clang-format on
+
+extern "C" {
+#include "keycode_string.h"
+}
+
+TEST(KeycodeString, NamesAreCanonical) {
+    EXPECT_STREQ(get_keycode_name(KC_NO), "KC_NO");
+    EXPECT_STREQ(get_keycode_name(KC_SPC), "KC_SPACE");
+    EXPECT_STREQ(get_keycode_name(QK_BOOT), "QK_BOOTLOADER");
+    EXPECT_STREQ(get_keycode_name(QK_USER_31), "QK_USER_31");
+    EXPECT_EQ(get_keycode_name(LCTL(KC_A)), nullptr);
+}
+
+TEST(KeycodeString, UnnamedKeycodesFallBackToHex) {
+    EXPECT_STREQ(get_keycode_string(KC_A), "KC_A");
+    EXPECT_STREQ(get_keycode_string(LCTL(KC_A)), "0x0104");
+    EXPECT_STREQ(get_keycode_string(0xFFFF), "0xFFFF");
+}
+
+TEST(KeycodeString, NamesAndAliasesResolve) {
+    uint16_t keycode = KC_NO;
+    EXPECT_TRUE(get_keycode_by_name("KC_SPACE", &keycode));
+    EXPECT_EQ(keycode, KC_SPACE);
+    EXPECT_TRUE(get_keycode_by_name("KC_SPC", &keycode));
+    EXPECT_EQ(keycode, KC_SPACE);
+    EXPECT_TRUE(get_keycode_by_name("XXXXXXX", &keycode));
+    EXPECT_EQ(keycode, KC_NO);
+    EXPECT_TRUE(get_keycode_by_name("QK_BOOT", &keycode));
+    EXPECT_EQ(keycode, QK_BOOT);
+    EXPECT_FALSE(get_keycode_by_name("KC_", &keycode));
+    EXPECT_FALSE(get_keycode_by_name("kc_a", &keycode));
+    EXPECT_FALSE(get_keycode_by_name("", &keycode));
+}
+
+TEST(KeycodeString, EveryNameRoundTrips) {
+    for (uint32_t keycode = 0; keycode <= 0xFFFF; keycode++) {
+        const char *name = get_keycode_name(keycode);
+        if (!name) continue;
+        std::string copy(name);
+        uint16_t    found;
+        ASSERT_TRUE(get_keycode_by_name(copy.c_str(), &found)) << copy;
+        EXPECT_EQ(found, keycode) << copy;
+    }
+}
+
+TEST(KeycodeString, RangesClassifyKeycodes) {
+    EXPECT_STREQ(get_keycode_range_name(KC_A), "QK_BASIC");
+    EXPECT_STREQ(get_keycode_range_name(LCTL(KC_A)), "QK_MODS");
+    EXPECT_STREQ(get_keycode_range_name(MT(MOD_LCTL, KC_A)), "QK_MOD_TAP");
+    EXPECT_STREQ(get_keycode_range_name(QK_MOD_TAP_MAX), "QK_MOD_TAP");
+    EXPECT_STREQ(get_keycode_range_name(MO(1)), "QK_MOMENTARY");
+    EXPECT_STREQ(get_keycode_range_name(QK_USER_MAX), "QK_USER");
+    // Overlapping ranges are classified by the narrowest one
+    EXPECT_STREQ(get_keycode_range_name(QK_UNICODEMAP), "QK_UNICODEMAP");
+    EXPECT_STREQ(get_keycode_range_name(0xFFFF), "QK_UNICODEMAP_PAIR");
+    // Gaps between ranges
+    EXPECT_EQ(get_keycode_range_name(QK_PERSISTENT_DEF_LAYER_MAX + 1), nullptr);
+    EXPECT_EQ(get_keycode_range_name(QK_SWAP_HANDS - 1), nullptr);
+}
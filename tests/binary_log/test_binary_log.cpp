@@ -0,0 +1,226 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "binary_log.h"
+#include "print.h"
+
+extern const char __start_binary_log_formats[];
+}
+
+namespace {
+
+std::vector<uint8_t> sent;
+
+int8_t capture(uint8_t c) {
+    sent.push_back(c);
+    return 0;
+}
+
+uint32_t read_u32(const std::vector<uint8_t>& data, size_t& offset) {
+    uint32_t value = 0;
+    for (int i = 0; i < 4 && offset < data.size(); i++) {
+        value |= (uint32_t)data[offset++] << (8 * i);
+    }
+    return value;
+}
+
+/* Rebuilds the text of one decoded record, the way `qmk console-decode`
+ * does. */
+std::string render(const std::vector<uint8_t>& record) {
+    uint16_t id = record[0] | record[1] << 8;
+    if (id == BINARY_LOG_DROPPED) {
+        return "<" + std::to_string(record[2] | record[3] << 8) + " dropped>\n";
+    }
+
+    std::string text;
+    size_t      offset = 2;
+    for (const char* c = __start_binary_log_formats + id; *c != '\0'; c++) {
+        if (*c != '%') {
+            text += *c;
+            continue;
+        }
+
+        std::string spec = "%";
+        for (c++; std::strchr("-+ #.*0123456789", *c) && *c != '\0'; c++) {
+            if (*c == '*') {
+                spec += std::to_string((int32_t)read_u32(record, offset));
+            } else {
+                spec += *c;
+            }
+        }
+        while (*c == 'l' || *c == 'h' || *c == 'z') {
+            c++;
+        }
+
+        char buffer[300];
+        switch (*c) {
+            case 'd':
+            case 'i':
+                snprintf(buffer, sizeof(buffer), (spec + "d").c_str(), (int32_t)read_u32(record, offset));
+                break;
+            case 'u':
+            case 'x':
+            case 'X':
+            case 'o':
+                snprintf(buffer, sizeof(buffer), (spec + *c).c_str(), read_u32(record, offset));
+                break;
+            case 'c':
+                snprintf(buffer, sizeof(buffer), (spec + "c").c_str(), record[offset++]);
+                break;
+            case 's': {
+                uint8_t     length = record[offset++];
+                std::string string(record.begin() + offset, record.begin() + offset + length);
+                offset += length;
+                snprintf(buffer, sizeof(buffer), (spec + "s").c_str(), string.c_str());
+                break;
+            }
+            default:
+                snprintf(buffer, sizeof(buffer), "%c", *c);
+                break;
+        }
+        text += buffer;
+    }
+    EXPECT_EQ(offset, record.size()) << "unused argument bytes";
+    return text;
+}
+
+// Sends the queued records and decodes them
+std::vector<std::string> drain() {
+    sent.clear();
+    binary_log_task();
+
+    std::vector<std::string> lines;
+    size_t                   start = 0;
+    for (size_t end = 0; end < sent.size(); end++) {
+        if (sent[end] != 0) {
+            continue;
+        }
+        std::vector<uint8_t> record;
+        for (size_t i = start; i < end;) {
+            uint8_t code = sent[i++];
+            for (uint8_t j = 1; j < code && i < end; j++) {
+                record.push_back(sent[i++]);
+            }
+            if (code < 0xFF && i < end) {
+                record.push_back(0);
+            }
+        }
+        lines.push_back(render(record));
+        start = end + 1;
+    }
+    EXPECT_EQ(start, sent.size()) << "unterminated record";
+    return lines;
+}
+
+} // namespace
+
+// Logs the message and checks that it decodes to what printf() would print
+#define EXPECT_LOGGED(fmt, ...)                                             \
+    do {                                                                    \
+        char expected[300];                                                 \
+        snprintf(expected, sizeof(expected), fmt, ##__VA_ARGS__);           \
+        uprintf(fmt, ##__VA_ARGS__);                                        \
+        EXPECT_EQ(drain(), std::vector<std::string>{expected}) << fmt;      \
+    } while (0)
+
+class BinaryLog : public TestFixture {
+   public:
+    void SetUp() override {
+        binary_log_set_sendchar(capture);
+        drain();
+    }
+
+    void TearDown() override {
+        binary_log_set_sendchar(sendchar);
+    }
+};
+
+TEST_F(BinaryLog, DecodesLikePrintf) {
+    EXPECT_LOGGED("plain text\n");
+    EXPECT_LOGGED("%d %u %x %X %i\n", -5, 4000000000u, 0xBEEF, 0xAB, 0);
+    EXPECT_LOGGED("%5d|%-4u|%02X|%+d|%#x\n", 42, 7, 3, 9, 255);
+    EXPECT_LOGGED("%ld %lu %lx\n", -100000L, 3000000000UL, 0xDEADBEEFUL);
+    EXPECT_LOGGED("%c%c %s|%6s|%-4s|\n", 'o', 'k', "string", "pad", "l");
+    EXPECT_LOGGED("%*d|%%|%zu\n", 6, 12, (size_t)300);
+    EXPECT_LOGGED("%s%s\n", "", "zero bytes \x01 around");
+}
+
+TEST_F(BinaryLog, ArgumentsAreEvaluatedOnce) {
+    int count = 0;
+    uprintf("%d\n", ++count);
+    EXPECT_EQ(count, 1);
+    EXPECT_EQ(drain(), std::vector<std::string>{"1\n"});
+}
+
+TEST_F(BinaryLog, DebugPrintsFollowDebugEnable) {
+    debug_enable = false;
+    dprintf("hidden %d\n", 1);
+    debug_enable = true;
+    dprintf("shown %d\n", 2);
+    EXPECT_EQ(drain(), std::vector<std::string>{"shown 2\n"});
+}
+
+TEST_F(BinaryLog, LongStringsAreCut) {
+    std::string long_string(100, 'x');
+    uprintf("%s", long_string.c_str());
+
+    // Two bytes of format offset and one of string length
+    EXPECT_EQ(drain(), std::vector<std::string>{std::string(BINARY_LOG_RECORD_SIZE - 3, 'x')});
+}
+
+TEST_F(BinaryLog, RecordsTooLongAreDropped) {
+    uprintf("%u %u %u %u %u %u %u %u %u %u %u %u\n", 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12);
+    uprintf("next\n");
+    EXPECT_EQ(drain(), (std::vector<std::string>{"<1 dropped>\n", "next\n"}));
+}
+
+TEST_F(BinaryLog, FullBufferCountsDrops) {
+    // 4 bytes each once encoded
+    size_t fits = (BINARY_LOG_BUFFER_SIZE - 1) / 4;
+    for (size_t i = 0; i < fits + 10; i++) {
+        uprintf("a\n");
+    }
+    std::vector<std::string> lines = drain();
+    EXPECT_EQ(lines.size(), fits);
+
+    uprintf("b\n");
+    EXPECT_EQ(drain(), (std::vector<std::string>{"<10 dropped>\n", "b\n"}));
+}
+
+TEST_F(BinaryLog, Benchmark) {
+    constexpr int kRecords = 50;
+    constexpr int kRounds  = 1000;
+    char          text[64];
+
+    auto start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; round++) {
+        for (int i = 0; i < kRecords; i++) {
+            uprintf("%u:%u %02X %s\n", i, round, 0x5A, "pressed");
+        }
+        binary_log_set_sendchar([](uint8_t) -> int8_t { return 0; });
+        binary_log_task();
+        binary_log_set_sendchar(capture);
+    }
+    double binary = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (int round = 0; round < kRounds; round++) {
+        for (int i = 0; i < kRecords; i++) {
+            snprintf(text, sizeof(text), "%u:%u %02X %s\n", i, round, 0x5A, "pressed");
+        }
+    }
+    double formatted = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+
+    printf("\nBinary log, %d messages\n", kRecords * kRounds);
+    printf("%-10s %8.1f ns/message, queued and sent\n", "binary", binary / (kRecords * kRounds));
+    printf("%-10s %8.1f ns/message, formatting only\n", "snprintf", formatted / (kRecords * kRounds));
+}
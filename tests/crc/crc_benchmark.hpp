@@ -0,0 +1,113 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "effect_benchmark.hpp"
+
+extern "C" {
+#include "crc.h"
+#include "fnv.h"
+}
+
+/**
+ * CRC8 tests and benchmark shared by the CRC configurations.
+ *
+ * Each configuration only differs in its config.h, which selects the CRC8
+ * implementation. All of them must compute the same values.
+ */
+namespace {
+
+#if defined(CRC8_USE_TABLE) && defined(CRC8_TABLE_SLICES)
+#    define CRC_BENCHMARK_SLICES CRC8_TABLE_SLICES
+#elif defined(CRC8_USE_TABLE)
+#    define CRC_BENCHMARK_SLICES 1
+#endif
+
+const size_t kBenchmarkSizes[] = {8, 64, 1024};
+const size_t kBenchmarkBytes   = 4 * 1024 * 1024;
+
+uint8_t reference_crc8(uint8_t crc, const uint8_t* data, size_t data_len) {
+    for (size_t i = 0; i < data_len; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = crc & 0x80 ? (crc << 1) ^ 0x31 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+std::vector<uint8_t> random_bytes(size_t size) {
+    std::mt19937         rng(0xC8C8);
+    std::vector<uint8_t> data(size);
+    for (auto& byte : data) {
+        byte = rng();
+    }
+    return data;
+}
+
+// Bytes per cycle of `hash` over buffers of `size` bytes
+template <typename Hash>
+double bytes_per_cycle(const std::vector<uint8_t>& data, size_t size, Hash hash) {
+    volatile uint64_t sink   = 0;
+    size_t            rounds = kBenchmarkBytes / size;
+
+    uint64_t start = effect_benchmark::now_cycles();
+    for (size_t i = 0; i < rounds; i++) {
+        sink = sink + hash(data.data() + i % 16, size);
+    }
+    uint64_t cycles = effect_benchmark::now_cycles() - start;
+    return (double)(rounds * size) / cycles;
+}
+
+} // namespace
+
+TEST(Crc, MatchesReference) {
+    // CRC-8/NRSC-5 check value
+    EXPECT_EQ(crc8("123456789", 9), 0xF7);
+
+    auto data = random_bytes(128);
+    for (size_t offset = 0; offset < 8; offset++) {
+        for (size_t size = 0; size + offset <= data.size(); size++) {
+            ASSERT_EQ(crc8(data.data() + offset, size), reference_crc8(0xFF, data.data() + offset, size)) << size << " bytes at " << offset;
+        }
+    }
+}
+
+TEST(Crc, UpdateContinues) {
+    auto    data = random_bytes(40);
+    uint8_t crc  = crc8(data.data(), data.size());
+
+    for (size_t split = 0; split <= data.size(); split++) {
+        uint8_t partial = crc8_update(0xFF, data.data(), split);
+        EXPECT_EQ(crc8_update(partial, data.data() + split, data.size() - split), crc) << "split at " << split;
+    }
+}
+
+TEST(Crc, Benchmark) {
+    auto data = random_bytes(kBenchmarkSizes[2] + 16);
+
+#ifdef CRC_BENCHMARK_SLICES
+    std::printf("\nCRC8, table, slice by %d\n", CRC_BENCHMARK_SLICES);
+#else
+    std::printf("\nCRC8, bit by bit\n");
+#endif
+    for (size_t size : kBenchmarkSizes) {
+        double rate = bytes_per_cycle(data, size, [](const uint8_t* d, size_t n) { return crc8(d, n); });
+        std::printf("%5zu bytes %8.3f bytes/cycle\n", size, rate);
+    }
+
+#ifndef CRC8_USE_TABLE
+    // The wear leveling checksum, for comparison. FNV-1a multiplies after every byte, so it cannot be sliced.
+    std::printf("FNV-1a 64\n");
+    for (size_t size : kBenchmarkSizes) {
+        double rate = bytes_per_cycle(data, size, [](const uint8_t* d, size_t n) { return fnv_64a_buf((void*)d, n, FNV1A_64_INIT); });
+        std::printf("%5zu bytes %8.3f bytes/cycle\n", size, rate);
+    }
+#endif
+}
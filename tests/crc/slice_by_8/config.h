@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#define CRC8_USE_TABLE
+#define CRC8_TABLE_SLICES 8
+
+#include "../config.h"
@@ -0,0 +1,5 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+CRC_ENABLE = yes
+FNV_ENABLE = yes
@@ -0,0 +1,176 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <functional>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_keymap_key.hpp"
+
+extern "C" {
+#include "key_event_queue.h"
+
+void advance_time(uint32_t ms);
+}
+
+using testing::_;
+using testing::InSequence;
+
+namespace {
+
+struct ProcessedEvent {
+    uint16_t keycode;
+    bool     pressed;
+    uint16_t time;
+};
+
+std::vector<ProcessedEvent> processed;
+// Simulated processing time of a key press, per keycode
+std::function<uint32_t(uint16_t)> processing_time = [](uint16_t) { return 0; };
+
+extern "C" bool process_record_user(uint16_t keycode, keyrecord_t* record) {
+    processed.push_back({keycode, record->event.pressed, record->event.time});
+    if (record->event.pressed) {
+        advance_time(processing_time(keycode));
+    }
+    return true;
+}
+
+class KeyEventQueue : public TestFixture {
+   public:
+    void SetUp() override {
+        processed.clear();
+        processing_time = [](uint16_t) { return 0; };
+        key_event_queue_reset_stats();
+    }
+};
+
+TEST_F(KeyEventQueue, KeysAreProcessedInTheSameScan) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+
+    set_keymap({key_a});
+
+    EXPECT_REPORT(driver, (KC_A));
+    key_a.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(key_event_queue_count(), 0);
+
+    EXPECT_EMPTY_REPORT(driver);
+    key_a.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyEventQueue, SlowHandlerDefersFollowingEvents) {
+    TestDriver driver;
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c = KeymapKey(0, 2, 0, KC_C);
+
+    set_keymap({key_b, key_c});
+    processing_time = [](uint16_t keycode) { return keycode == KC_B ? 5 : 0; };
+
+    const uint16_t scan_time = timer_read();
+
+    EXPECT_REPORT(driver, (KC_B));
+    key_b.press();
+    key_c.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The time budget is exhausted by the first handler, the second event waits for the next scan
+    ASSERT_EQ(processed.size(), 1u);
+    EXPECT_EQ(key_event_queue_count(), 1);
+
+    EXPECT_REPORT(driver, (KC_B, KC_C));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Both events carry the time they were scanned at
+    ASSERT_EQ(processed.size(), 2u);
+    EXPECT_EQ(processed[0].keycode, KC_B);
+    EXPECT_EQ(processed[0].time, scan_time);
+    EXPECT_EQ(processed[1].keycode, KC_C);
+    EXPECT_EQ(processed[1].time, scan_time);
+    EXPECT_GE(key_event_queue_get_stats()->max_latency, 5);
+
+    EXPECT_ANY_REPORT(driver).Times(2);
+    key_b.release();
+    key_c.release();
+    run_one_scan_loop();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyEventQueue, HoldDecisionUsesScanTime) {
+    TestDriver driver;
+    auto       slow_key = KeymapKey(0, 1, 0, KC_B);
+    auto       mod_tap  = KeymapKey(0, 2, 0, LSFT_T(KC_A));
+
+    set_keymap({slow_key, mod_tap});
+    processing_time = [](uint16_t keycode) { return keycode == KC_B ? TAPPING_TERM / 2 : 0; };
+
+    EXPECT_REPORT(driver, (KC_B));
+    slow_key.press();
+    mod_tap.press();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // The tapping term runs from the scanned press, not from when the slow handler returned
+    EXPECT_REPORT(driver, (KC_B, KC_LEFT_SHIFT));
+    idle_for(TAPPING_TERM / 2 + 2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_B));
+    mod_tap.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_REPORT(driver);
+    slow_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(KeyEventQueue, FullQueueProcessesOldestEvent) {
+    TestDriver driver;
+    auto       key_a = KeymapKey(0, 0, 0, KC_A);
+    auto       key_b = KeymapKey(0, 1, 0, KC_B);
+    auto       key_c = KeymapKey(0, 2, 0, KC_C);
+    auto       key_d = KeymapKey(0, 3, 0, KC_D);
+    auto       key_e = KeymapKey(0, 4, 0, KC_E);
+
+    set_keymap({key_a, key_b, key_c, key_d, key_e});
+    processing_time = [](uint16_t keycode) { return 2; };
+
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+    key_a.press();
+    key_b.press();
+    key_c.press();
+    key_d.press();
+    key_e.press();
+    run_one_scan_loop();
+
+    // Five events do not fit in a queue of four, none of them is lost and the order is kept
+    EXPECT_EQ(key_event_queue_get_stats()->overflows, 1u);
+    idle_for(10);
+    ASSERT_EQ(processed.size(), 5u);
+    for (size_t i = 0; i < processed.size(); i++) {
+        EXPECT_EQ(processed[i].keycode, KC_A + i);
+    }
+
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    key_d.release();
+    key_e.release();
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+    EXPECT_EQ(key_event_queue_count(), 0);
+}
+
+} // namespace
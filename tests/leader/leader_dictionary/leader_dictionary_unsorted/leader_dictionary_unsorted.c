@@ -0,0 +1,27 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+#include "keymap_introspection.h"
+
+// clang-format off
+const leader_sequence_t PROGMEM leader_dictionary[] = {
+    LEADER_SEQUENCE(KC_5, KC_Q, KC_W, KC_E, KC_R, KC_T),
+    LEADER_SEQUENCE(KC_2, KC_A, KC_B),
+    LEADER_SEQUENCE(KC_NO, KC_H),
+    LEADER_SEQUENCE(KC_4, KC_D, KC_F),
+    LEADER_SEQUENCE(KC_3, KC_A, KC_B, KC_C),
+    LEADER_SEQUENCE(LCTL(KC_C), KC_G),
+    LEADER_SEQUENCE(KC_1, KC_A),
+};
+// clang-format on
+
+uint16_t last_handled_sequence = 0;
+
+bool leader_dictionary_matched_user(uint16_t index) {
+    if (pgm_read_word(&leader_dictionary_get(index)->keycode) == KC_NO) {
+        last_handled_sequence = index;
+        return false;
+    }
+    return true;
+}
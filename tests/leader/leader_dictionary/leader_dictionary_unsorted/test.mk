@@ -0,0 +1,11 @@
+# --------------------------------------------------------------------------------
+# Keep this file, even if it is empty, as a marker that this folder contains tests
+# --------------------------------------------------------------------------------
+
+LEADER_ENABLE = yes
+LEADER_DICTIONARY_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = leader_dictionary_unsorted.c
+
+# The same tests, matching by scanning the dictionary instead of searching it
+SRC += ../test_leader_dictionary.cpp
@@ -0,0 +1,174 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+
+extern "C" {
+#include "keymap_introspection.h"
+
+extern uint16_t last_handled_sequence;
+}
+
+class LeaderDictionary : public TestFixture {
+   protected:
+    KeymapKey key_leader = KeymapKey(0, 0, 0, QK_LEADER);
+    KeymapKey key_a      = KeymapKey(0, 1, 0, KC_A);
+    KeymapKey key_b      = KeymapKey(0, 2, 0, KC_B);
+    KeymapKey key_c      = KeymapKey(0, 3, 0, KC_C);
+    KeymapKey key_d      = KeymapKey(0, 4, 0, KC_D);
+    KeymapKey key_f      = KeymapKey(0, 5, 0, KC_F);
+    KeymapKey key_g      = KeymapKey(0, 6, 0, KC_G);
+    KeymapKey key_h      = KeymapKey(0, 7, 0, KC_H);
+    KeymapKey key_q      = KeymapKey(0, 0, 1, KC_Q);
+    KeymapKey key_w      = KeymapKey(0, 1, 1, KC_W);
+    KeymapKey key_e      = KeymapKey(0, 2, 1, KC_E);
+    KeymapKey key_r      = KeymapKey(0, 3, 1, KC_R);
+    KeymapKey key_t      = KeymapKey(0, 4, 1, KC_T);
+
+    void SetUp() override {
+        set_keymap({key_leader, key_a, key_b, key_c, key_d, key_f, key_g, key_h, key_q, key_w, key_e, key_r, key_t});
+    }
+};
+
+TEST_F(LeaderDictionary, unique_sequence_triggers_without_timeout) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_d);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_4));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_f);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+    EXPECT_EQ(leader_sequence_timed_out(), false);
+}
+
+TEST_F(LeaderDictionary, single_key_sequence_taps_modified_keycode) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    VERIFY_AND_CLEAR(driver);
+
+    testing::InSequence s;
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL, KC_C));
+    EXPECT_REPORT(driver, (KC_LEFT_CTRL));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_g);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderDictionary, prefix_of_longer_sequence_triggers_on_timeout) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    idle_for(290);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), true);
+
+    EXPECT_REPORT(driver, (KC_1));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(20);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+    EXPECT_EQ(leader_sequence_timed_out(), true);
+}
+
+TEST_F(LeaderDictionary, intermediate_sequence_triggers_on_timeout) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_2));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(300);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderDictionary, longest_sequence_triggers_when_complete) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_a);
+    tap_key(key_b);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_3));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_c);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+}
+
+TEST_F(LeaderDictionary, five_key_sequence) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_q);
+    tap_key(key_w);
+    tap_key(key_e);
+    tap_key(key_r);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_REPORT(driver, (KC_5));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_t);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(LeaderDictionary, user_callback_handles_sequence) {
+    TestDriver driver;
+
+    last_handled_sequence = UINT16_MAX;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_h);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+    ASSERT_LT(last_handled_sequence, leader_dictionary_count());
+    EXPECT_EQ(leader_dictionary_get(last_handled_sequence)->keys[0], KC_H);
+}
+
+TEST_F(LeaderDictionary, unknown_sequence_does_nothing) {
+    TestDriver driver;
+
+    EXPECT_NO_REPORT(driver);
+    tap_key(key_leader);
+    tap_key(key_b);
+    tap_key(key_a);
+    idle_for(300);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EQ(leader_sequence_active(), false);
+    EXPECT_EQ(leader_sequence_timed_out(), true);
+
+    EXPECT_REPORT(driver, (KC_A));
+    EXPECT_EMPTY_REPORT(driver);
+    tap_key(key_a);
+    VERIFY_AND_CLEAR(driver);
+}
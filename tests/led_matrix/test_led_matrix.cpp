@@ -0,0 +1,80 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+#include "effect_benchmark.hpp"
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+#ifndef LED_MATRIX_BENCHMARK_FRAMES
+#    define LED_MATRIX_BENCHMARK_FRAMES 100
+#endif
+
+namespace {
+
+uint32_t flushes = 0;
+uint8_t  led_buffer[LED_MATRIX_LED_COUNT];
+
+void null_init(void) {}
+
+void null_set_value(int index, uint8_t value) {
+    led_buffer[index] = value;
+}
+
+void null_set_value_all(uint8_t value) {
+    for (int i = 0; i < LED_MATRIX_LED_COUNT; i++) {
+        null_set_value(i, value);
+    }
+}
+
+void null_flush(void) {
+    flushes++;
+}
+
+const effect_benchmark::Effect effects[] = {
+#define LED_MATRIX_EFFECT(name, ...) {LED_MATRIX_##name, #name},
+#include "led_matrix_effects.inc"
+#undef LED_MATRIX_EFFECT
+};
+
+} // namespace
+
+extern "C" {
+const led_matrix_driver_t led_matrix_driver = {null_init, null_set_value, null_set_value_all, null_flush};
+
+led_config_t g_led_config;
+
+uint32_t effect_render_timestamp(void) {
+    return effect_benchmark::now_ns() / 1000;
+}
+}
+
+class LedMatrixBenchmark : public TestFixture {
+   public:
+    static void SetUpTestCase() {
+        effect_benchmark::fill_led_config(g_led_config, LED_MATRIX_LED_COUNT, MATRIX_ROWS, MATRIX_COLS, LED_FLAG_KEYLIGHT, LED_FLAG_INDICATOR);
+        TestFixture::SetUpTestCase();
+    }
+};
+
+TEST_F(LedMatrixBenchmark, RenderAllEffects) {
+    std::vector<effect_benchmark::Result> results;
+
+    led_matrix_enable_noeeprom();
+    for (const effect_benchmark::Effect& effect : effects) {
+        led_matrix_mode_noeeprom(effect.mode);
+        led_matrix_reset_render_stats();
+
+        effect_benchmark::Result result = effect_benchmark::run(
+            effect.name, LED_MATRIX_LED_COUNT, LED_MATRIX_BENCHMARK_FRAMES, LED_MATRIX_LED_FLUSH_LIMIT, led_matrix_task, [] { return flushes; }, advance_time, [](uint32_t) {});
+
+        EXPECT_EQ(result.frames, LED_MATRIX_BENCHMARK_FRAMES) << effect.name;
+        EXPECT_EQ(led_matrix_get_render_stats(effect.mode)->frames, result.frames) << effect.name;
+        results.push_back(result);
+    }
+
+    effect_benchmark::print_results("LED Matrix, " STR(LED_MATRIX_LED_COUNT) " LEDs", results);
+}
@@ -0,0 +1,10 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Quadratic ramp to the maximum speed
+#define MOUSEKEY_ACCEL_CURVE POINTING_DEVICE_ACCEL_CURVE_POWER
+#define MOUSEKEY_ACCEL_SHAPE 512
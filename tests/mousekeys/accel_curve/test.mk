@@ -0,0 +1 @@
+MOUSEKEY_ENABLE = yes
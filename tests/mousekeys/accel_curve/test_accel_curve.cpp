@@ -0,0 +1,42 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+
+using testing::_;
+
+class MousekeyAccelCurve : public TestFixture {};
+
+TEST_F(MousekeyAccelCurve, CursorFollowsTheCurve) {
+    TestDriver driver;
+    KeymapKey  mouse_key = KeymapKey{0, 0, 0, QK_MOUSE_CURSOR_RIGHT};
+
+    set_keymap({mouse_key});
+
+    std::vector<int16_t> steps;
+    EXPECT_ANY_MOUSE_REPORT(driver).WillRepeatedly([&steps](report_mouse_t& report) { steps.push_back(report.x); });
+    mouse_key.press();
+    run_one_scan_loop();
+    idle_for(MOUSEKEY_DELAY + MOUSEKEY_INTERVAL * (MOUSEKEY_TIME_TO_MAX + 2));
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_MOUSE_REPORT(driver);
+    mouse_key.release();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    const int16_t max_step = MOUSEKEY_MOVE_DELTA * MOUSEKEY_MAX_SPEED;
+    ASSERT_GE(steps.size(), (size_t)MOUSEKEY_TIME_TO_MAX + 2);
+    EXPECT_EQ(steps[0], MOUSEKEY_MOVE_DELTA);
+
+    // Starts slower than the linear ramp, reaches a quarter of the maximum speed halfway through and never slows down
+    EXPECT_EQ(steps[1], 1);
+    EXPECT_EQ(steps[MOUSEKEY_TIME_TO_MAX / 2], max_step / 4);
+    for (size_t i = 2; i < steps.size(); i++) {
+        EXPECT_GE(steps[i], steps[i - 1]) << "repeat " << i;
+    }
+    EXPECT_EQ(steps[MOUSEKEY_TIME_TO_MAX], max_step);
+    EXPECT_EQ(steps.back(), max_step);
+}
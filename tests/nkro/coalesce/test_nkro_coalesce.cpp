@@ -0,0 +1,91 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "../nkro_test.hpp"
+
+TEST_F(Nkro, ChordIsSentAsSingleReport) {
+    auto key_a = KeymapKey(0, 0, 0, KC_A);
+    auto key_b = KeymapKey(0, 1, 0, KC_B);
+    auto key_c = KeymapKey(0, 2, 0, KC_C);
+
+    set_keymap({key_a, key_b, key_c});
+
+    key_a.press();
+    key_b.press();
+    key_c.press();
+    run_one_scan_loop();
+    expect_reports({make_report(0, {KC_A, KC_B, KC_C})});
+
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    run_one_scan_loop();
+    expect_reports({make_report(0, {})});
+}
+
+TEST_F(Nkro, ModifierAndKeyAreSentTogether) {
+    auto key_shift = KeymapKey(0, 0, 0, KC_LEFT_SHIFT);
+    auto key_a     = KeymapKey(0, 1, 0, KC_A);
+
+    set_keymap({key_shift, key_a});
+
+    key_shift.press();
+    key_a.press();
+    run_one_scan_loop();
+    expect_reports({make_report(MOD_BIT(KC_LEFT_SHIFT), {KC_A})});
+
+    key_a.release();
+    run_one_scan_loop();
+    expect_reports({make_report(MOD_BIT(KC_LEFT_SHIFT), {})});
+
+    key_shift.release();
+    run_one_scan_loop();
+    expect_reports({make_report(0, {})});
+}
+
+TEST_F(Nkro, TapWithinOneScanIsNotLost) {
+    register_code(KC_B);
+    register_code(KC_A);
+    unregister_code(KC_A);
+    run_one_scan_loop();
+    expect_reports({make_report(0, {KC_A, KC_B}), make_report(0, {KC_B})});
+
+    unregister_code(KC_B);
+    register_code(KC_B);
+    run_one_scan_loop();
+    expect_reports({make_report(0, {}), make_report(0, {KC_B})});
+
+    unregister_code(KC_B);
+    run_one_scan_loop();
+    expect_reports({make_report(0, {})});
+}
+
+TEST_F(Nkro, UndoneReleaseIsNotLost) {
+    register_code(KC_A);
+    run_one_scan_loop();
+    expect_reports({make_report(0, {KC_A})});
+
+    unregister_code(KC_A);
+    register_code(KC_A);
+    run_one_scan_loop();
+    expect_reports({make_report(0, {}), make_report(0, {KC_A})});
+
+    unregister_code(KC_A);
+    run_one_scan_loop();
+    expect_reports({make_report(0, {})});
+
+    // Nothing pending, nothing sent
+    run_one_scan_loop();
+    expect_reports({});
+}
+
+TEST_F(Nkro, TapCodeDelaySendsPressBeforeWaiting) {
+    uint32_t start = timer_read32();
+    tap_code_delay(KC_CAPS, 80);
+    run_one_scan_loop();
+
+    ASSERT_EQ(report_times.size(), 2u);
+    EXPECT_EQ(report_times[0], start);
+    EXPECT_GE(TIMER_DIFF_32(report_times[1], start), 80u);
+    expect_reports({make_report(0, {KC_CAPS}), make_report(0, {})});
+}
@@ -0,0 +1,56 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <cstring>
+#include <initializer_list>
+#include <vector>
+#include "keycode.h"
+#include "timer.h"
+#include "test_common.hpp"
+
+/**
+ * @brief Fixture running the keyboard in NKRO mode and recording every NKRO
+ * report sent to the host.
+ */
+class Nkro : public TestFixture {
+   public:
+    void SetUp() override {
+        keymap_config.nkro = true;
+        EXPECT_CALL(driver, send_nkro_mock(testing::_)).WillRepeatedly(testing::Invoke([this](report_nkro_t& report) {
+            reports.push_back(report);
+            report_times.push_back(timer_read32());
+        }));
+    }
+
+    void TearDown() override {
+        keymap_config.nkro = false;
+    }
+
+    static report_nkro_t make_report(uint8_t mods, std::initializer_list<uint8_t> codes) {
+        report_nkro_t report;
+        memset(&report, 0, sizeof(report));
+        report.report_id = REPORT_ID_NKRO;
+        report.mods      = mods;
+        for (uint8_t code : codes) {
+            add_key_bit(&report, code);
+        }
+        return report;
+    }
+
+    void expect_reports(std::initializer_list<report_nkro_t> expected) {
+        ASSERT_EQ(reports.size(), expected.size());
+        size_t i = 0;
+        for (const report_nkro_t& report : expected) {
+            EXPECT_EQ(memcmp(&reports[i], &report, sizeof(report)), 0) << "report " << i << " differs";
+            i++;
+        }
+        reports.clear();
+        report_times.clear();
+    }
+
+    TestDriver                 driver;
+    std::vector<report_nkro_t> reports;
+    std::vector<uint32_t>      report_times;
+};
@@ -0,0 +1,90 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "nkro_test.hpp"
+
+namespace {
+
+// Byte-wise reference of get_first_key(), returning the lowest keycode held
+uint8_t reference_first_key(const report_nkro_t& report) {
+    for (uint8_t i = 0; i < NKRO_REPORT_BITS; i++) {
+        for (uint8_t bit = 0; bit < 8; bit++) {
+            if (report.bits[i] & (1 << bit)) {
+                return i << 3 | bit;
+            }
+        }
+    }
+    return KC_NO;
+}
+
+} // namespace
+
+TEST_F(Nkro, FirstKeyMatchesByteScan) {
+    EXPECT_EQ(get_first_key(), KC_NO);
+    EXPECT_EQ(has_anykey(), 0);
+
+    // Cover every bit of the bitmap, including the bytes past the last full word
+    for (uint16_t code = 1; code < NKRO_REPORT_BITS * 8; code++) {
+        add_key_to_report(code);
+        EXPECT_EQ(get_first_key(), reference_first_key(*nkro_report)) << "code " << code;
+        EXPECT_EQ(get_first_key(), code);
+        EXPECT_EQ(has_anykey(), 1);
+
+        add_key_to_report(NKRO_REPORT_BITS * 8 - 1);
+        EXPECT_EQ(get_first_key(), code);
+
+        clear_keys_from_report();
+    }
+}
+
+TEST_F(Nkro, AnyKeyCountsBitmapBytes) {
+    add_key_to_report(KC_A);
+    add_key_to_report(KC_B);
+    EXPECT_EQ(has_anykey(), 1);
+
+    add_key_to_report(KC_1);
+    EXPECT_EQ(has_anykey(), 2);
+
+    add_key_to_report(KC_F24);
+    EXPECT_EQ(has_anykey(), 3);
+
+    del_key_from_report(KC_A);
+    del_key_from_report(KC_B);
+    del_key_from_report(KC_1);
+    EXPECT_EQ(get_first_key(), KC_F24);
+    EXPECT_EQ(has_anykey(), 1);
+
+    clear_keys_from_report();
+    EXPECT_EQ(has_anykey(), 0);
+}
+
+TEST_F(Nkro, EveryChangeIsSentWithoutCoalescing) {
+    auto key_a = KeymapKey(0, 0, 0, KC_A);
+    auto key_b = KeymapKey(0, 1, 0, KC_B);
+    auto key_c = KeymapKey(0, 2, 0, KC_C);
+
+    set_keymap({key_a, key_b, key_c});
+
+    key_a.press();
+    key_b.press();
+    key_c.press();
+    run_one_scan_loop();
+    expect_reports({make_report(0, {KC_A}), make_report(0, {KC_A, KC_B}), make_report(0, {KC_A, KC_B, KC_C})});
+
+    key_a.release();
+    key_b.release();
+    key_c.release();
+    run_one_scan_loop();
+    expect_reports({make_report(0, {KC_B, KC_C}), make_report(0, {KC_C}), make_report(0, {})});
+}
+
+TEST_F(Nkro, UnchangedReportIsNotSent) {
+    register_code(KC_A);
+    send_keyboard_report();
+    run_one_scan_loop();
+    expect_reports({make_report(0, {KC_A})});
+
+    unregister_code(KC_A);
+    run_one_scan_loop();
+    expect_reports({make_report(0, {})});
+}
@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define POINTING_DEVICE_ACCEL_ENABLE
+#define POINTING_DEVICE_ACCEL_CURVE POINTING_DEVICE_ACCEL_CURVE_LINEAR
+// Half speed up to 4 counts, double speed from 12 counts
+#define POINTING_DEVICE_ACCEL_POINTS {{4, 128}, {12, 512}}
@@ -0,0 +1,67 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+
+class PointingAccel : public TestFixture {
+   protected:
+    void SetUp() override {
+        pointing_device_accel_init();
+    }
+};
+
+TEST_F(PointingAccel, FastMotionIsAccelerated) {
+    TestDriver driver;
+
+    pd_set_x(20);
+    pd_set_y(-10);
+    EXPECT_MOUSE_REPORT(driver, (40, -20, 0, 0, 0));
+    run_one_scan_loop();
+
+    pd_clear_movement();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccel, SlowMotionIsCarriedOver) {
+    TestDriver driver;
+
+    // Half a count per report, every other report moves the pointer
+    pd_set_x(1);
+    EXPECT_NO_MOUSE_REPORT(driver);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_MOUSE_REPORT(driver, (1, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    pd_clear_movement();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccel, ConfigCanBeReplaced) {
+    TestDriver driver;
+
+    pointing_device_accel_config_t config = *pointing_device_accel_get_config();
+    config.points                         = NULL;
+    config.point_count                    = 0;
+    config.input_max                      = 16;
+    config.gain_min                       = POINTING_DEVICE_ACCEL_GAIN_ONE * 3;
+    config.gain_max                       = POINTING_DEVICE_ACCEL_GAIN_ONE * 3;
+    pointing_device_accel_set_config(&config);
+
+    pd_set_y(5);
+    EXPECT_MOUSE_REPORT(driver, (0, 15, 0, 0, 0));
+    run_one_scan_loop();
+
+    pd_clear_movement();
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,130 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+
+class PointingAccumulate : public TestFixture {
+   protected:
+    // Drops any motion left over and aligns with the report stage, which runs on every multiple of the interval
+    void settle() {
+        TestDriver driver;
+        EXPECT_ANY_MOUSE_REPORT(driver).Times(testing::AnyNumber());
+        pd_clear_movement();
+        idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS * 4);
+    }
+
+    void SetUp() override {
+        settle();
+    }
+
+    void TearDown() override {
+        settle();
+    }
+};
+
+TEST_F(PointingAccumulate, MotionIsReportedAtInterval) {
+    TestDriver driver;
+
+    pd_set_x(10);
+    EXPECT_MOUSE_REPORT(driver, (10, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    // Samples in between reports are accumulated
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS - 1);
+    VERIFY_AND_CLEAR(driver);
+
+    pd_clear_movement();
+    EXPECT_MOUSE_REPORT(driver, (30, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccumulate, AdditionalSamplesAreAccumulated) {
+    TestDriver driver;
+
+    pd_set_y(-5);
+    pointing_device_sample();
+    pointing_device_sample();
+    EXPECT_MOUSE_REPORT(driver, (0, -15, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccumulate, SaturatedMotionIsCarriedOver) {
+    TestDriver driver;
+
+    pd_set_x(100);
+    pointing_device_sample();
+    pointing_device_sample();
+    pointing_device_sample();
+    pd_clear_movement();
+
+    // Motion exceeding the report range is sent over the following reports
+    {
+        testing::InSequence s;
+        EXPECT_MOUSE_REPORT(driver, (XY_REPORT_MAX, 0, 0, 0, 0));
+        EXPECT_MOUSE_REPORT(driver, (XY_REPORT_MAX, 0, 0, 0, 0));
+        EXPECT_MOUSE_REPORT(driver, (300 - 2 * XY_REPORT_MAX, 0, 0, 0, 0));
+    }
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS * 3);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS * 2);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccumulate, SamplesAreAccumulatedBeforeClamping) {
+    TestDriver driver;
+
+    // More movement than a report holds in a single sample
+    pd_set_x(XY_REPORT_MAX * 2 + 10);
+    pointing_device_sample();
+    pd_clear_movement();
+
+    {
+        testing::InSequence s;
+        EXPECT_MOUSE_REPORT(driver, (XY_REPORT_MAX, 0, 0, 0, 0));
+        EXPECT_MOUSE_REPORT(driver, (XY_REPORT_MAX, 0, 0, 0, 0));
+        EXPECT_MOUSE_REPORT(driver, (10, 0, 0, 0, 0));
+    }
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS * 3);
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccumulate, ButtonsAreReportedAtInterval) {
+    TestDriver driver;
+
+    EXPECT_MOUSE_REPORT(driver, (0, 0, 0, 0, 1));
+    pd_press_button(POINTING_DEVICE_BUTTON1);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS - 1);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_EMPTY_MOUSE_REPORT(driver);
+    pd_release_button(POINTING_DEVICE_BUTTON1);
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccumulate, PipelineStatistics) {
+    TestDriver driver;
+
+    pointing_device_reset_pipeline_stats();
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS * 2);
+
+    const pointing_device_pipeline_stats_t *stats = pointing_device_get_pipeline_stats();
+    EXPECT_EQ(stats->samples, POINTING_DEVICE_REPORT_INTERVAL_MS * 2);
+    EXPECT_EQ(stats->reports, 2);
+    EXPECT_EQ(stats->samples_per_report, POINTING_DEVICE_REPORT_INTERVAL_MS);
+}
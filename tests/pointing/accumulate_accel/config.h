@@ -0,0 +1,14 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define POINTING_DEVICE_ACCUMULATE
+#define POINTING_DEVICE_REPORT_INTERVAL_MS 4
+#define POINTING_DEVICE_ACCEL_ENABLE
+#define POINTING_DEVICE_ACCEL_CURVE POINTING_DEVICE_ACCEL_CURVE_LINEAR
+// Double speed throughout
+#define POINTING_DEVICE_ACCEL_GAIN_MIN 512
+#define POINTING_DEVICE_ACCEL_GAIN_MAX 512
@@ -0,0 +1,65 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "gtest/gtest.h"
+#include "mouse_report_util.hpp"
+#include "test_common.hpp"
+#include "test_pointing_device_driver.h"
+
+using testing::_;
+
+class PointingAccumulateAccel : public TestFixture {
+   protected:
+    // Drops any motion left over and aligns with the report stage, which runs on every multiple of the interval
+    void settle() {
+        TestDriver driver;
+        EXPECT_ANY_MOUSE_REPORT(driver).Times(testing::AnyNumber());
+        pd_clear_movement();
+        idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS * 4);
+        pointing_device_accel_init();
+    }
+
+    void SetUp() override {
+        settle();
+    }
+
+    void TearDown() override {
+        settle();
+    }
+};
+
+TEST_F(PointingAccumulateAccel, MotionIsAcceleratedPerReport) {
+    TestDriver driver;
+
+    pd_set_x(5);
+    pointing_device_sample();
+    pointing_device_sample();
+    pd_clear_movement();
+
+    // The curve sees the movement of the whole interval, not single samples
+    EXPECT_MOUSE_REPORT(driver, (20, 0, 0, 0, 0));
+    run_one_scan_loop();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(PointingAccumulateAccel, AcceleratedMotionIsCarriedOver) {
+    TestDriver driver;
+
+    pd_set_x(100);
+    pd_set_y(-10);
+    pointing_device_sample();
+    pd_clear_movement();
+
+    // Movement the curve pushes past the report range is sent with the following report
+    {
+        testing::InSequence s;
+        EXPECT_MOUSE_REPORT(driver, (XY_REPORT_MAX, -20, 0, 0, 0));
+        EXPECT_MOUSE_REPORT(driver, (200 - XY_REPORT_MAX, 0, 0, 0, 0));
+    }
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS * 2);
+    VERIFY_AND_CLEAR(driver);
+
+    EXPECT_NO_MOUSE_REPORT(driver);
+    idle_for(POINTING_DEVICE_REPORT_INTERVAL_MS * 2);
+    VERIFY_AND_CLEAR(driver);
+}
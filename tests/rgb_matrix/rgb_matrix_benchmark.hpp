@@ -0,0 +1,98 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "gtest/gtest.h"
+#include "test_common.hpp"
+#include "effect_benchmark.hpp"
+
+extern "C" {
+void advance_time(uint32_t ms);
+}
+
+#ifndef RGB_MATRIX_BENCHMARK_FRAMES
+#    define RGB_MATRIX_BENCHMARK_FRAMES 100
+#endif
+
+#ifndef RGB_MATRIX_BENCHMARK_KEY_INTERVAL
+#    define RGB_MATRIX_BENCHMARK_KEY_INTERVAL 4
+#endif
+
+/**
+ * Null RGB Matrix driver and LED layout shared by the benchmark configurations.
+ *
+ * Each configuration only differs in its config.h, which selects the number
+ * of LEDs the layout is generated for.
+ */
+namespace {
+
+uint32_t flushes    = 0;
+bool     fake_clock = false;
+uint32_t fake_us    = 0;
+uint8_t  led_buffer[RGB_MATRIX_LED_COUNT][3];
+
+void null_init(void) {}
+
+void null_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    led_buffer[index][0] = r;
+    led_buffer[index][1] = g;
+    led_buffer[index][2] = b;
+}
+
+void null_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < RGB_MATRIX_LED_COUNT; i++) {
+        null_set_color(i, r, g, b);
+    }
+}
+
+void null_flush(void) {
+    flushes++;
+}
+
+const effect_benchmark::Effect effects[] = {
+#define RGB_MATRIX_EFFECT(name, ...) {RGB_MATRIX_##name, #name},
+#include "rgb_matrix_effects.inc"
+#undef RGB_MATRIX_EFFECT
+};
+
+} // namespace
+
+extern "C" {
+const rgb_matrix_driver_t rgb_matrix_driver = {null_init, null_set_color, null_set_color_all, null_flush};
+
+led_config_t g_led_config;
+
+uint32_t effect_render_timestamp(void) {
+    return fake_clock ? fake_us : effect_benchmark::now_ns() / 1000;
+}
+}
+
+class RgbMatrixBenchmark : public TestFixture {
+   public:
+    static void SetUpTestCase() {
+        effect_benchmark::fill_led_config(g_led_config, RGB_MATRIX_LED_COUNT, MATRIX_ROWS, MATRIX_COLS, LED_FLAG_KEYLIGHT, LED_FLAG_UNDERGLOW);
+        TestFixture::SetUpTestCase();
+    }
+};
+
+TEST_F(RgbMatrixBenchmark, RenderAllEffects) {
+    std::vector<effect_benchmark::Result> results;
+
+    rgb_matrix_enable_noeeprom();
+    for (const effect_benchmark::Effect& effect : effects) {
+        effect_benchmark::KeyHits key_hits(MATRIX_ROWS, MATRIX_COLS, RGB_MATRIX_BENCHMARK_KEY_INTERVAL);
+
+        rgb_matrix_mode_noeeprom(effect.mode);
+        rgb_matrix_reset_render_stats();
+
+        effect_benchmark::Result result = effect_benchmark::run(
+            effect.name, RGB_MATRIX_LED_COUNT, RGB_MATRIX_BENCHMARK_FRAMES, RGB_MATRIX_LED_FLUSH_LIMIT, rgb_matrix_task, [] { return flushes; }, advance_time, [&key_hits](uint32_t frame) { key_hits.on_frame(frame, rgb_matrix_handle_key_event); });
+
+        EXPECT_EQ(result.frames, RGB_MATRIX_BENCHMARK_FRAMES) << effect.name;
+        EXPECT_EQ(rgb_matrix_get_render_stats(effect.mode)->frames, result.frames) << effect.name;
+        results.push_back(result);
+    }
+
+    effect_benchmark::print_results("RGB Matrix, " STR(RGB_MATRIX_LED_COUNT) " LEDs", results);
+}
@@ -0,0 +1,59 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "rgb_matrix_benchmark.hpp"
+
+TEST(EffectRender, AdaptsProcessLimitToBudget) {
+    effect_render_t render;
+    effect_render_init(&render, 60, 12, true, 1000);
+    fake_clock = true;
+
+    // 50us per LED with a 1000us budget settles on 20 LEDs per iteration
+    for (int frame = 0; frame < 64; frame++) {
+        effect_render_frame_begin(&render);
+        for (uint8_t iter = 0;; iter++) {
+            uint8_t led_min, led_max;
+            effect_render_get_limits(&render, iter, &led_min, &led_max);
+            if (led_min >= led_max) break;
+            effect_render_iter_begin(&render);
+            fake_us += 50 * (led_max - led_min);
+            effect_render_iter_end(&render, led_min, led_max);
+        }
+        EXPECT_EQ(effect_render_frame_end(&render), 60 * 50);
+    }
+    fake_clock = false;
+
+    EXPECT_NEAR(render.process_limit, 20, 1);
+}
+
+TEST(EffectRender, FixedProcessLimit) {
+    effect_render_t render;
+    effect_render_init(&render, 60, 12, false, 1000);
+    effect_render_frame_begin(&render);
+
+    uint8_t led_min, led_max;
+    effect_render_get_limits(&render, 4, &led_min, &led_max);
+    EXPECT_EQ(led_min, 48);
+    EXPECT_EQ(led_max, 60);
+    effect_render_get_limits(&render, 5, &led_min, &led_max);
+    EXPECT_EQ(led_min, 60);
+    EXPECT_EQ(led_max, 60);
+
+    effect_render_init(&render, 60, 0, false, 1000);
+    effect_render_get_limits(&render, 0, &led_min, &led_max);
+    EXPECT_EQ(led_min, 0);
+    EXPECT_EQ(led_max, 60);
+}
+
+TEST(EffectRender, Stats) {
+    effect_render_stats_t stats;
+    effect_render_stats_reset(&stats);
+    effect_render_stats_update(&stats, 100);
+    effect_render_stats_update(&stats, 300);
+    effect_render_stats_update(&stats, 200);
+
+    EXPECT_EQ(stats.frames, 3);
+    EXPECT_EQ(stats.min, 100);
+    EXPECT_EQ(stats.max, 300);
+    EXPECT_EQ(stats.last, 200);
+}
@@ -0,0 +1,139 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+
+namespace {
+
+uint32_t flushes = 0;
+rgb_t    leds[RGBLIGHT_LED_COUNT];
+
+void null_init(void) {}
+
+void null_set_color(int index, uint8_t r, uint8_t g, uint8_t b) {
+    leds[index].r = r;
+    leds[index].g = g;
+    leds[index].b = b;
+}
+
+void null_set_color_all(uint8_t r, uint8_t g, uint8_t b) {
+    for (int i = 0; i < RGBLIGHT_LED_COUNT; i++) {
+        null_set_color(i, r, g, b);
+    }
+}
+
+void null_flush(void) {
+    flushes++;
+}
+
+} // namespace
+
+extern "C" {
+const rgblight_driver_t rgblight_driver = {null_init, null_set_color, null_set_color_all, null_flush};
+}
+
+class RGBLight : public TestFixture {
+   protected:
+    void SetUp() override {
+        rgblight_enable_noeeprom();
+        rgblight_set_speed_noeeprom(0);
+    }
+
+    void TearDown() override {
+        rgblight_mode_noeeprom(RGBLIGHT_MODE_STATIC_LIGHT);
+    }
+
+    void expect_all_leds(rgb_t color) {
+        for (uint8_t i = 0; i < RGBLIGHT_LED_COUNT; i++) {
+            EXPECT_EQ(leds[i].r, color.r) << "LED " << (int)i;
+            EXPECT_EQ(leds[i].g, color.g) << "LED " << (int)i;
+            EXPECT_EQ(leds[i].b, color.b) << "LED " << (int)i;
+        }
+    }
+};
+
+TEST_F(RGBLight, StaticColorIsAlwaysSent) {
+    TestDriver driver;
+
+    rgblight_mode_noeeprom(RGBLIGHT_MODE_STATIC_LIGHT);
+
+    flushes = 0;
+    rgblight_setrgb(10, 20, 30);
+    rgblight_setrgb(10, 20, 30);
+    EXPECT_EQ(flushes, 2);
+    expect_all_leds({.r = 10, .g = 20, .b = 30});
+}
+
+TEST_F(RGBLight, UnchangedAnimationFramesAreNotSent) {
+    TestDriver driver;
+
+    // Without saturation, every hue of the rainbow is the same white
+    rgblight_sethsv_noeeprom(0, 0, 100);
+    rgblight_mode_noeeprom(RGBLIGHT_MODE_RAINBOW_MOOD);
+
+    flushes = 0;
+    idle_for(1200);
+
+    // Only the first frame, in case the LEDs were written since the mode was set
+    EXPECT_EQ(flushes, 1);
+    expect_all_leds(hsv_to_rgb({0, 0, 100}));
+}
+
+TEST_F(RGBLight, ChangedAnimationFramesAreSent) {
+    TestDriver driver;
+
+    rgblight_sethsv_noeeprom(0, 255, 100);
+    rgblight_mode_noeeprom(RGBLIGHT_MODE_RAINBOW_SWIRL);
+
+    // The slowest swirl moves every 100ms
+    flushes = 0;
+    idle_for(1000);
+    EXPECT_GE(flushes, 9);
+}
+
+TEST_F(RGBLight, LedsWrittenDirectlyAreRestored) {
+    TestDriver driver;
+
+    rgblight_sethsv_noeeprom(0, 0, 100);
+    rgblight_mode_noeeprom(RGBLIGHT_MODE_RAINBOW_MOOD);
+    idle_for(500);
+
+    null_set_color(0, 1, 2, 3);
+    rgblight_set();
+
+    flushes = 0;
+    idle_for(200);
+    EXPECT_EQ(flushes, 1);
+    expect_all_leds(hsv_to_rgb({0, 0, 100}));
+}
+
+TEST_F(RGBLight, AlternatingLightsHalfOfTheLeds) {
+    TestDriver driver;
+
+    rgblight_sethsv_noeeprom(0, 255, 100);
+    rgblight_mode_noeeprom(RGBLIGHT_MODE_ALTERNATING);
+    idle_for(100);
+
+    rgb_t on  = hsv_to_rgb({0, 255, 100});
+    bool  lit = leds[0].r != 0;
+    for (uint8_t i = 0; i < RGBLIGHT_LED_COUNT; i++) {
+        bool first_half = i < RGBLIGHT_LED_COUNT / 2;
+        EXPECT_EQ(leds[i].r, first_half == lit ? on.r : 0) << "LED " << (int)i;
+    }
+}
+
+TEST_F(RGBLight, SnakeFadesTowardsItsTail) {
+    TestDriver driver;
+
+    rgblight_sethsv_noeeprom(0, 0, 200);
+    rgblight_mode_noeeprom(RGBLIGHT_MODE_SNAKE);
+    idle_for(100);
+
+    uint8_t lit = 0;
+    for (uint8_t i = 0; i < RGBLIGHT_LED_COUNT; i++) {
+        if (leds[i].r != 0) {
+            lit++;
+        }
+    }
+    EXPECT_EQ(lit, RGBLIGHT_EFFECT_SNAKE_LENGTH);
+}
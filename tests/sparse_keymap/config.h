@@ -0,0 +1,11 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+#define EEPROM_SIZE 1024
+
+#define DYNAMIC_KEYMAP_SPARSE
+#define DYNAMIC_KEYMAP_SPARSE_KEYCODES 64
@@ -0,0 +1,21 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "quantum.h"
+
+// Laid out like the tables generated by `qmk json2c`: a full base layer, a
+// layer with keys in both blocks of the 4x10 matrix, and an empty layer.
+
+// clang-format off
+const uint16_t PROGMEM sparse_keymap_keycodes[] = {
+    KC_A, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H, KC_I, KC_J, KC_K, KC_L, KC_M, KC_N, KC_O, KC_P, KC_Q, KC_R, KC_S, KC_T,
+    KC_U, KC_V, KC_W, KC_X, KC_Y, KC_Z, KC_A, KC_B, KC_C, KC_D, KC_E, KC_F, KC_G, KC_H, KC_I, KC_J, KC_K, KC_L, KC_M, KC_N,
+    KC_1, KC_2, KC_3, KC_4,
+};
+
+const sparse_keymap_layer_t PROGMEM sparse_keymap_layers[] = {
+    [0] = {.bitmap = {0xFFFFFFFF, 0x000000FF}, .index = {0, 32}},
+    [1] = {.bitmap = {0x80000008, 0x00000081}, .index = {40, 42}},
+    [2] = {.bitmap = {0x00000000, 0x00000000}, .index = {44, 44}},
+};
+// clang-format on
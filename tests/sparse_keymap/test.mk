@@ -0,0 +1,7 @@
+# Copyright 2026 QMK
+# SPDX-License-Identifier: GPL-2.0-or-later
+
+SPARSE_KEYMAP_ENABLE = yes
+DYNAMIC_KEYMAP_ENABLE = yes
+
+INTROSPECTION_KEYMAP_C = sparse_layers.c
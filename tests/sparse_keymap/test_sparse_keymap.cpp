@@ -0,0 +1,220 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cstdio>
+#include <random>
+#include <vector>
+
+#include "test_common.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "keymap_introspection.h"
+}
+
+namespace {
+
+constexpr uint16_t kKeys       = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS;
+constexpr uint16_t kBufferSize = kKeys * 2;
+
+// The keymap in sparse_layers.c, as dense layers
+uint16_t flash_keycode(uint8_t layer, uint8_t row, uint8_t column) {
+    uint8_t key = row * MATRIX_COLS + column;
+    switch (layer) {
+        case 0:
+            return KC_A + key % 26;
+        case 1:
+            switch (key) {
+                case 3:
+                    return KC_1;
+                case 31:
+                    return KC_2;
+                case 32:
+                    return KC_3;
+                case 39:
+                    return KC_4;
+            }
+    }
+    return KC_TRNS;
+}
+
+std::vector<uint16_t> read_keymap() {
+    std::vector<uint8_t> buffer(kBufferSize);
+    dynamic_keymap_get_buffer(0, kBufferSize, buffer.data());
+
+    std::vector<uint16_t> keymap;
+    for (uint16_t i = 0; i < kBufferSize; i += 2) {
+        keymap.push_back(buffer[i] << 8 | buffer[i + 1]);
+    }
+    return keymap;
+}
+
+uint16_t stored_keycodes(const std::vector<uint16_t>& keymap, uint16_t first = 0, uint16_t last = kKeys) {
+    uint16_t count = 0;
+    for (uint16_t key = first; key < last; key++) {
+        count += keymap[key] != KC_TRNS;
+    }
+    return count;
+}
+
+/* What a buffer write does to the dense view: every byte is written, unless
+ * the keys would not fit in the pool, and then nothing is.
+ *
+ * \return whether the write fits
+ */
+bool apply_buffer(std::vector<uint16_t>& keymap, uint16_t offset, const std::vector<uint8_t>& data) {
+    std::vector<uint16_t> written = keymap;
+    for (uint16_t i = 0; i < data.size(); i++) {
+        uint16_t& keycode = written[(offset + i) / 2];
+        keycode           = (offset + i) % 2 ? (keycode & 0xFF00) | data[i] : (keycode & 0x00FF) | (data[i] << 8);
+    }
+    if (stored_keycodes(written) > DYNAMIC_KEYMAP_SPARSE_KEYCODES) {
+        return false;
+    }
+    keymap = written;
+    return true;
+}
+
+} // namespace
+
+class SparseKeymap : public TestFixture {
+   public:
+    void SetUp() override {
+        dynamic_keymap_reset();
+    }
+};
+
+TEST_F(SparseKeymap, FlashLookups) {
+    EXPECT_EQ(keymap_layer_count_raw(), 3);
+    for (uint8_t layer = 0; layer < 4; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                EXPECT_EQ(keycode_at_keymap_location_raw(layer, row, column), flash_keycode(layer, row, column)) << +layer << "," << +row << "," << +column;
+            }
+        }
+    }
+}
+
+TEST_F(SparseKeymap, ResetCopiesFlash) {
+    for (uint8_t layer = 0; layer < DYNAMIC_KEYMAP_LAYER_COUNT; layer++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+                EXPECT_EQ(dynamic_keymap_get_keycode(layer, row, column), flash_keycode(layer, row, column)) << +layer << "," << +row << "," << +column;
+                EXPECT_EQ(keycode_at_keymap_location(layer, row, column), flash_keycode(layer, row, column));
+            }
+        }
+    }
+}
+
+TEST_F(SparseKeymap, SetKeycodeAddsAndRemovesKeys) {
+    // Added in front of keys stored on later layers
+    dynamic_keymap_set_keycode(0, 3, 9, KC_TRNS);
+    dynamic_keymap_set_keycode(2, 0, 0, LCTL(KC_Z));
+    dynamic_keymap_set_keycode(1, 3, 8, KC_ESCAPE);
+    dynamic_keymap_set_keycode(1, 0, 3, KC_5);
+    dynamic_keymap_set_keycode(1, 1, 1, KC_TRNS); // already KC_TRNS
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 3, 9), KC_TRNS);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 3, 8), KC_M);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 0, 3), KC_5);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 1, 1), KC_TRNS);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 3, 1), KC_2);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 3, 2), KC_3);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 3, 8), KC_ESCAPE);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 3, 9), KC_4);
+    EXPECT_EQ(dynamic_keymap_get_keycode(2, 0, 0), LCTL(KC_Z));
+    EXPECT_EQ(stored_keycodes(read_keymap()), 45);
+}
+
+TEST_F(SparseKeymap, FullPoolRefusesWrites) {
+    std::vector<uint16_t> keymap = read_keymap();
+    uint16_t              free   = DYNAMIC_KEYMAP_SPARSE_KEYCODES - stored_keycodes(keymap);
+
+    // Fill layer 3, the pool runs out part way
+    uint16_t stored = 0;
+    for (uint8_t column = 0; column < MATRIX_COLS; column++) {
+        for (uint8_t row = 0; row < MATRIX_ROWS; row++) {
+            stored += dynamic_keymap_set_keycode(3, row, column, KC_F1);
+        }
+    }
+    EXPECT_EQ(stored, free);
+    keymap = read_keymap();
+    EXPECT_EQ(stored_keycodes(keymap), DYNAMIC_KEYMAP_SPARSE_KEYCODES);
+    EXPECT_EQ(stored_keycodes(keymap, 3 * MATRIX_ROWS * MATRIX_COLS, kKeys), free);
+    EXPECT_EQ(dynamic_keymap_get_keycode(3, 0, 0), KC_F1);
+
+    // Stored keys can still be changed
+    EXPECT_TRUE(dynamic_keymap_set_keycode(3, 0, 0, KC_F3));
+    EXPECT_EQ(dynamic_keymap_get_keycode(3, 0, 0), KC_F3);
+
+    // A buffer write that does not fit writes nothing, not even the keys that would
+    keymap                    = read_keymap();
+    std::vector<uint8_t> data = {0x00, KC_F4, 0x00, KC_F4};
+    EXPECT_FALSE(dynamic_keymap_set_buffer((kKeys - 2) * 2, data.size(), data.data()));
+    EXPECT_EQ(read_keymap(), keymap);
+
+    // Room is made by clearing keys elsewhere
+    EXPECT_TRUE(dynamic_keymap_set_keycode(0, 0, 0, KC_TRNS));
+    EXPECT_TRUE(dynamic_keymap_set_keycode(3, MATRIX_ROWS - 1, MATRIX_COLS - 1, KC_F2));
+    EXPECT_EQ(dynamic_keymap_get_keycode(3, MATRIX_ROWS - 1, MATRIX_COLS - 1), KC_F2);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 1), KC_B);
+}
+
+TEST_F(SparseKeymap, UploadInOrder) {
+    // Layers 0 and 1 swapped, written the way VIA uploads a keymap
+    std::vector<uint16_t> keymap = read_keymap();
+    std::rotate(keymap.begin(), keymap.begin() + MATRIX_ROWS * MATRIX_COLS, keymap.begin() + 2 * MATRIX_ROWS * MATRIX_COLS);
+
+    std::vector<uint8_t> buffer;
+    for (uint16_t keycode : keymap) {
+        buffer.push_back(keycode >> 8);
+        buffer.push_back(keycode & 0xFF);
+    }
+    for (uint16_t offset = 0; offset < kBufferSize; offset += 28) {
+        uint16_t size = std::min<uint16_t>(28, kBufferSize - offset);
+        ASSERT_TRUE(dynamic_keymap_set_buffer(offset, size, &buffer[offset])) << "at " << offset;
+    }
+    EXPECT_EQ(read_keymap(), keymap);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 3), KC_1);
+    EXPECT_EQ(dynamic_keymap_get_keycode(1, 0, 0), KC_A);
+}
+
+TEST_F(SparseKeymap, BufferWritesKeepTheDenseLayout) {
+    std::vector<uint16_t> keymap = read_keymap();
+    std::mt19937          rng(0x5BA55);
+
+    for (int i = 0; i < 300; i++) {
+        uint16_t             offset = rng() % kBufferSize;
+        std::vector<uint8_t> data(1 + rng() % std::min<uint16_t>(28, kBufferSize - offset));
+        for (size_t j = 0; j < data.size(); j++) {
+            // Mostly KC_TRNS, so that the pool only fills up some of the time
+            uint16_t keycode = rng() % 3 ? KC_TRNS : KC_A + rng() % 40;
+            data[j]          = (offset + j) % 2 ? keycode & 0xFF : keycode >> 8;
+        }
+
+        bool fits = apply_buffer(keymap, offset, data);
+        ASSERT_EQ(dynamic_keymap_set_buffer(offset, data.size(), data.data()), fits) << "write " << i;
+        ASSERT_EQ(read_keymap(), keymap) << "write " << i << " of " << data.size() << " bytes at " << offset;
+    }
+
+    // Unaligned reads
+    std::vector<uint8_t> data(5);
+    dynamic_keymap_get_buffer(3, data.size(), data.data());
+    EXPECT_EQ(data[0], keymap[1] & 0xFF);
+    EXPECT_EQ(data[1], keymap[2] >> 8);
+    EXPECT_EQ(data[4], keymap[3] & 0xFF);
+
+    // Reads past the end are zero
+    dynamic_keymap_get_buffer(kBufferSize - 1, data.size(), data.data());
+    EXPECT_EQ(data[0], keymap[kKeys - 1] & 0xFF);
+    EXPECT_EQ(data[1], 0);
+}
+
+TEST_F(SparseKeymap, EepromSize) {
+    uint16_t dense  = kBufferSize;
+    uint16_t sparse = DYNAMIC_KEYMAP_LAYER_COUNT * ((MATRIX_ROWS * MATRIX_COLS + 31) / 32) * 4 + DYNAMIC_KEYMAP_SPARSE_KEYCODES * 2 + 3;
+    std::printf("\nDynamic keymap, %d layers of %d keys\n", DYNAMIC_KEYMAP_LAYER_COUNT, MATRIX_ROWS * MATRIX_COLS);
+    std::printf("%-8s %5u bytes\n%-8s %5u bytes, room for %u keycodes\n", "dense", dense, "sparse", sparse, DYNAMIC_KEYMAP_SPARSE_KEYCODES);
+    EXPECT_LT(sparse, dense);
+}
@@ -0,0 +1,241 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+extern "C" {
+#include "spsc_ring.h"
+}
+
+SPSC_RING_DECLARE(small_ring, uint8_t, 4)
+SPSC_RING_DECLARE(word_ring, uint32_t, 16)
+SPSC_RING_DECLARE(byte_ring, uint8_t, 256)
+
+class SpscRing : public ::testing::Test {};
+
+TEST_F(SpscRing, HoldsOneLessThanItsSize) {
+    small_ring_t ring;
+    small_ring_init(&ring);
+    EXPECT_TRUE(small_ring_empty(&ring));
+
+    EXPECT_TRUE(small_ring_enqueue(&ring, 1));
+    EXPECT_TRUE(small_ring_enqueue(&ring, 2));
+    EXPECT_TRUE(small_ring_enqueue(&ring, 3));
+    EXPECT_TRUE(small_ring_full(&ring));
+    EXPECT_FALSE(small_ring_enqueue(&ring, 4));
+    EXPECT_EQ(small_ring_count(&ring), 3);
+
+    uint8_t item;
+    for (uint8_t expected = 1; expected <= 3; expected++) {
+        EXPECT_TRUE(small_ring_dequeue(&ring, &item));
+        EXPECT_EQ(item, expected);
+    }
+    EXPECT_FALSE(small_ring_dequeue(&ring, &item));
+}
+
+TEST_F(SpscRing, WrapsAround) {
+    small_ring_t ring;
+    small_ring_init(&ring);
+
+    uint8_t item;
+    for (uint8_t i = 0; i < 20; i++) {
+        EXPECT_TRUE(small_ring_enqueue(&ring, i));
+        EXPECT_TRUE(small_ring_enqueue(&ring, i + 100));
+        EXPECT_TRUE(small_ring_dequeue(&ring, &item));
+        EXPECT_EQ(item, i);
+        EXPECT_TRUE(small_ring_dequeue(&ring, &item));
+        EXPECT_EQ(item, i + 100);
+    }
+    EXPECT_TRUE(small_ring_empty(&ring));
+}
+
+TEST_F(SpscRing, BatchesStopAtTheEnds) {
+    word_ring_t ring;
+    word_ring_init(&ring);
+
+    uint32_t items[20];
+    for (uint32_t i = 0; i < 20; i++) {
+        items[i] = i;
+    }
+    EXPECT_EQ(word_ring_enqueue_n(&ring, items, 10), 10);
+    EXPECT_EQ(word_ring_enqueue_n(&ring, &items[10], 10), 5);
+    EXPECT_TRUE(word_ring_full(&ring));
+
+    uint32_t out[20];
+    EXPECT_EQ(word_ring_dequeue_n(&ring, out, 4), 4);
+    EXPECT_EQ(word_ring_dequeue_n(&ring, &out[4], 20), 11);
+    for (uint32_t i = 0; i < 15; i++) {
+        EXPECT_EQ(out[i], i);
+    }
+    EXPECT_EQ(word_ring_dequeue_n(&ring, out, 20), 0);
+}
+
+TEST_F(SpscRing, PeekBackDropAndClear) {
+    word_ring_t ring;
+    word_ring_init(&ring);
+    EXPECT_EQ(word_ring_back(&ring), nullptr);
+    EXPECT_EQ(word_ring_peek(&ring, 0), nullptr);
+
+    for (uint32_t i = 0; i < 5; i++) {
+        word_ring_enqueue(&ring, i * 10);
+    }
+    EXPECT_EQ(*word_ring_peek(&ring, 0), 0);
+    EXPECT_EQ(*word_ring_peek(&ring, 4), 40);
+    EXPECT_EQ(word_ring_peek(&ring, 5), nullptr);
+
+    // The newest element can be updated in place
+    *word_ring_back(&ring) += 1;
+    EXPECT_EQ(*word_ring_peek(&ring, 4), 41);
+
+    EXPECT_EQ(word_ring_drop(&ring, 2), 2);
+    EXPECT_EQ(*word_ring_peek(&ring, 0), 20);
+    EXPECT_EQ(word_ring_drop(&ring, 10), 3);
+    EXPECT_TRUE(word_ring_empty(&ring));
+
+    word_ring_enqueue(&ring, 1);
+    word_ring_enqueue(&ring, 2);
+    word_ring_clear(&ring);
+    EXPECT_TRUE(word_ring_empty(&ring));
+    EXPECT_TRUE(word_ring_enqueue(&ring, 3));
+    EXPECT_EQ(*word_ring_peek(&ring, 0), 3);
+}
+
+namespace {
+
+constexpr uint32_t kStressItems = 500000;
+
+/* Runs a producer and a consumer thread through `kStressItems` sequence
+ * numbers, alternating between single and batch operations of varying sizes,
+ * and checks every item arrives once and in order.
+ *
+ * \return the elapsed time in nanoseconds
+ */
+double stress(word_ring_t &ring, bool batched, uint32_t &received, uint32_t &errors) {
+    word_ring_init(&ring);
+    received = 0;
+    errors   = 0;
+
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread producer([&]() {
+        uint32_t next = 0;
+        uint32_t batch[8];
+        while (next < kStressItems) {
+            if (batched) {
+                uint8_t size = 1 + next % 8;
+                for (uint8_t i = 0; i < size; i++) {
+                    batch[i] = next + i;
+                }
+                if (next + size > kStressItems) {
+                    size = kStressItems - next;
+                }
+                uint8_t count = word_ring_enqueue_n(&ring, batch, size);
+                next += count;
+                if (count == 0) {
+                    std::this_thread::yield();
+                }
+            } else if (word_ring_enqueue(&ring, next)) {
+                next++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    std::thread consumer([&]() {
+        uint32_t batch[8];
+        while (received < kStressItems) {
+            uint8_t count;
+            if (batched) {
+                count = word_ring_dequeue_n(&ring, batch, 1 + received % 8);
+            } else {
+                count = word_ring_dequeue(&ring, &batch[0]) ? 1 : 0;
+            }
+            if (count == 0) {
+                std::this_thread::yield();
+            }
+            for (uint8_t i = 0; i < count; i++) {
+                if (batch[i] != received) {
+                    errors++;
+                }
+                received++;
+            }
+        }
+    });
+
+    producer.join();
+    consumer.join();
+    return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+}
+
+} // namespace
+
+TEST_F(SpscRing, ThreadsSeeEveryItemInOrder) {
+    word_ring_t ring;
+    uint32_t    received, errors;
+
+    stress(ring, false, received, errors);
+    EXPECT_EQ(received, kStressItems);
+    EXPECT_EQ(errors, 0);
+
+    stress(ring, true, received, errors);
+    EXPECT_EQ(received, kStressItems);
+    EXPECT_EQ(errors, 0);
+}
+
+TEST_F(SpscRing, ThreadsSeeEveryByteInOrder) {
+    static byte_ring_t ring;
+    byte_ring_init(&ring);
+
+    constexpr uint32_t kBytes = 500000;
+    std::atomic<bool>  done{false};
+    uint32_t           errors = 0;
+
+    std::thread producer([&]() {
+        uint32_t next = 0;
+        while (next < kBytes) {
+            if (byte_ring_enqueue(&ring, next & 0xFF)) {
+                next++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+        done = true;
+    });
+
+    uint32_t received = 0;
+    while (received < kBytes) {
+        uint8_t item;
+        if (byte_ring_dequeue(&ring, &item)) {
+            if (item != (received & 0xFF)) {
+                errors++;
+            }
+            received++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(done);
+    EXPECT_EQ(errors, 0);
+    EXPECT_TRUE(byte_ring_empty(&ring));
+}
+
+TEST_F(SpscRing, Benchmark) {
+    word_ring_t ring;
+    uint32_t    received, errors;
+
+    std::printf("\nSPSC ring, %u items between two threads\n", kStressItems);
+    double single = stress(ring, false, received, errors);
+    std::printf("%-12s %8.1f ns/item %8.2f Mitems/s\n", "single", single / kStressItems, kStressItems * 1000.0 / single);
+    double batched = stress(ring, true, received, errors);
+    std::printf("%-12s %8.1f ns/item %8.2f Mitems/s\n", "batched", batched / kStressItems, kStressItems * 1000.0 / batched);
+    EXPECT_EQ(errors, 0);
+}
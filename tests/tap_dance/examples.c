@@ -80,13 +80,13 @@ typedef struct {
 } tap_dance_tap_hold_t;
 
 bool process_record_user(uint16_t keycode, keyrecord_t *record) {
-    tap_dance_action_t *action;
+    tap_dance_state_t *state;
 
     switch (keycode) {
         case TD(CT_CLN):
-            action = tap_dance_get(QK_TAP_DANCE_GET_INDEX(keycode));
-            if (!record->event.pressed && action->state.count && !action->state.finished) {
-                tap_dance_tap_hold_t *tap_hold = (tap_dance_tap_hold_t *)action->user_data;
+            state = tap_dance_get_state(QK_TAP_DANCE_GET_INDEX(keycode));
+            if (state && !record->event.pressed && state->count && !state->finished) {
+                tap_dance_tap_hold_t *tap_hold = (tap_dance_tap_hold_t *)pgm_read_ptr(&tap_dance_get(state->index)->user_data);
                 tap_code16(tap_hold->tap);
             }
     }
@@ -209,7 +209,7 @@ static void release_reset(tap_dance_state_t *state, void *user_data) {
     tap_code16(KC_R);
 }
 
-tap_dance_action_t tap_dance_actions[] = {
+const tap_dance_action_t PROGMEM tap_dance_actions[] = {
     [TD_ESC_CAPS] = ACTION_TAP_DANCE_DOUBLE(KC_ESC, KC_CAPS),
     [CT_EGG]      = ACTION_TAP_DANCE_FN(dance_egg),
     [CT_FLSH]     = ACTION_TAP_DANCE_FN_ADVANCED(dance_flsh_each, dance_flsh_finished, dance_flsh_reset),
@@ -432,3 +432,92 @@ TEST_F(TapDance, DanceFnAdvancedWithReleaseAndFinish) {
     EXPECT_EMPTY_REPORT(driver);
     run_one_scan_loop();
 }
+
+TEST_F(TapDance, StateOnlyWhileInProgress) {
+    TestDriver driver;
+    InSequence s;
+    auto       key_rls = KeymapKey(0, 1, 0, TD(TD_RELEASE));
+
+    set_keymap({key_rls});
+
+    EXPECT_EQ(tap_dance_get_state(TD_RELEASE), nullptr);
+
+    key_rls.press();
+    EXPECT_REPORT(driver, (KC_P));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+
+    tap_dance_state_t *state = tap_dance_get_state(TD_RELEASE);
+    ASSERT_NE(state, nullptr);
+    EXPECT_EQ(state->count, 1);
+    EXPECT_TRUE(state->pressed);
+    EXPECT_EQ(TAP_DANCE_KEYCODE(state), TD(TD_RELEASE));
+
+    key_rls.release();
+    EXPECT_REPORT(driver, (KC_U));
+    EXPECT_EMPTY_REPORT(driver);
+    run_one_scan_loop();
+    EXPECT_EQ(tap_dance_get_state(TD_RELEASE), state);
+
+    /* The state is released once the dance has been reset */
+    EXPECT_REPORT(driver, (KC_F));
+    EXPECT_EMPTY_REPORT(driver);
+    EXPECT_REPORT(driver, (KC_R));
+    EXPECT_EMPTY_REPORT(driver);
+    idle_for(TAPPING_TERM);
+    run_one_scan_loop();
+    EXPECT_EQ(tap_dance_get_state(TD_RELEASE), nullptr);
+}
+
+TEST_F(TapDance, StatePoolExhausted) {
+    TestDriver driver;
+    auto       key_rls        = KeymapKey(0, 1, 0, TD(TD_RELEASE));
+    auto       key_rls_finish = KeymapKey(0, 2, 0, TD(TD_RELEASE_AND_FINISH));
+    auto       key_esc_caps   = KeymapKey(0, 3, 0, TD(TD_ESC_CAPS));
+    auto       key_egg        = KeymapKey(0, 4, 0, TD(CT_EGG));
+
+    static_assert(TAP_DANCE_MAX_SIMULTANEOUS == 3, "test assumes the default pool size");
+
+    set_keymap({key_rls, key_rls_finish, key_esc_caps, key_egg});
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+
+    /* Held tap dance keys keep their state until released, even once interrupted */
+    key_rls.press();
+    run_one_scan_loop();
+    key_rls_finish.press();
+    run_one_scan_loop();
+    key_esc_caps.press();
+    run_one_scan_loop();
+    EXPECT_NE(tap_dance_get_state(TD_RELEASE), nullptr);
+    EXPECT_NE(tap_dance_get_state(TD_RELEASE_AND_FINISH), nullptr);
+    EXPECT_NE(tap_dance_get_state(TD_ESC_CAPS), nullptr);
+
+    /* No slot left, the press is ignored */
+    key_egg.press();
+    run_one_scan_loop();
+    EXPECT_EQ(tap_dance_get_state(CT_EGG), nullptr);
+    key_egg.release();
+    run_one_scan_loop();
+
+    key_rls.release();
+    key_rls_finish.release();
+    key_esc_caps.release();
+    run_one_scan_loop();
+    idle_for(TAPPING_TERM);
+    run_one_scan_loop();
+    EXPECT_EQ(tap_dance_get_state(TD_RELEASE), nullptr);
+    EXPECT_EQ(tap_dance_get_state(TD_RELEASE_AND_FINISH), nullptr);
+    EXPECT_EQ(tap_dance_get_state(TD_ESC_CAPS), nullptr);
+
+    /* A slot is free again */
+    key_egg.press();
+    run_one_scan_loop();
+    tap_dance_state_t *state = tap_dance_get_state(CT_EGG);
+    ASSERT_NE(state, nullptr);
+    EXPECT_EQ(state->count, 1);
+    key_egg.release();
+    run_one_scan_loop();
+    idle_for(TAPPING_TERM);
+    run_one_scan_loop();
+    EXPECT_EQ(tap_dance_get_state(CT_EGG), nullptr);
+}
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Holds every event of a shifted word typed within the tapping term at high speed
+#define WAITING_BUFFER_SIZE 32
@@ -0,0 +1,193 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <vector>
+
+#include "keyboard_report_util.hpp"
+#include "keycode.h"
+#include "test_common.hpp"
+#include "action_tapping.h"
+#include "test_fixture.hpp"
+#include "test_keymap_key.hpp"
+
+using testing::_;
+
+namespace {
+
+/* Replays typing traces with home row mods: `f` and `j` are shift mod-taps,
+ * everything else is a regular key. Shifted words are typed while holding
+ * the mod-tap on the other hand past the tapping term, so every event of the
+ * word waits in the tapping buffer until the hold is settled.
+ */
+class WaitingBufferStress : public TestFixture {
+   protected:
+    struct TraceEvent {
+        uint32_t time;
+        char     key;
+        bool     pressed;
+    };
+
+    std::vector<KeymapKey>  keys;
+    std::vector<TraceEvent> trace;
+    std::string             expected;
+
+    void SetUp() override {
+        for (char c = 'a'; c <= 'z'; c++) {
+            uint8_t  index   = c - 'a';
+            uint16_t keycode = KC_A + index;
+            if (c == 'f') keycode = LSFT_T(KC_F);
+            if (c == 'j') keycode = RSFT_T(KC_J);
+            keys.emplace_back(0, index % MATRIX_COLS, index / MATRIX_COLS, keycode);
+        }
+        keys.emplace_back(0, 0, 3, KC_SPC);
+        for (const KeymapKey& key : keys) {
+            add_key(key);
+        }
+    }
+
+    KeymapKey& key_for(char c) {
+        return c == ' ' ? keys.back() : keys[c - 'a'];
+    }
+
+    void add_stroke(char c, uint32_t press, uint32_t release) {
+        trace.push_back({press, c, true});
+        trace.push_back({release, c, false});
+    }
+
+    /* Adds a line of text typed at the given speed, words in capitals are typed while holding a home row mod.
+     *
+     * \return the time the last key is released
+     */
+    uint32_t add_text(uint32_t start, const std::string& text, uint32_t wpm, uint32_t dwell) {
+        // A word is five characters on average
+        const uint32_t interval = 60000 / (wpm * 5);
+        uint32_t       time     = start;
+
+        size_t i = 0;
+        while (i < text.size()) {
+            if (std::isupper(text[i])) {
+                size_t end = i;
+                while (end < text.size() && std::isupper(text[end])) {
+                    end++;
+                }
+                // Shift with the mod-tap that is not part of the word
+                std::string word       = text.substr(i, end - i);
+                char        shift      = word.find('F') != std::string::npos ? 'j' : 'f';
+                uint32_t    word_start = time + interval / 2;
+                for (; i < end; i++) {
+                    time += interval;
+                    add_stroke(std::tolower(text[i]), time, time + dwell);
+                    expected += text[i];
+                }
+                add_stroke(shift, word_start, std::max(time + dwell, word_start + TAPPING_TERM) + 20);
+                time = std::max(time + dwell, word_start + TAPPING_TERM) + 20;
+            } else {
+                time += interval;
+                add_stroke(text[i], time, time + dwell);
+                expected += text[i];
+                i++;
+            }
+        }
+        return time + dwell;
+    }
+
+    // Releases a key before it is pressed again, as a real switch would
+    void fix_repeated_keys() {
+        std::stable_sort(trace.begin(), trace.end(), [](const TraceEvent& a, const TraceEvent& b) { return a.time < b.time; });
+        for (size_t i = 0; i < trace.size(); i++) {
+            if (!trace[i].pressed) continue;
+            for (size_t j = i + 1; j < trace.size(); j++) {
+                if (trace[j].key != trace[i].key) continue;
+                if (trace[j].pressed) {
+                    // pressed again before being released, release it just before
+                    for (size_t k = j + 1; k < trace.size(); k++) {
+                        if (trace[k].key == trace[i].key && !trace[k].pressed) {
+                            trace[k].time = trace[j].time - 1;
+                            break;
+                        }
+                    }
+                }
+                break;
+            }
+        }
+        std::stable_sort(trace.begin(), trace.end(), [](const TraceEvent& a, const TraceEvent& b) { return a.time < b.time; });
+    }
+
+    // Replays the trace one scan per millisecond and returns the text typed on the host
+    std::string replay(TestDriver& driver) {
+        std::string          typed;
+        std::vector<uint8_t> previous;
+
+        EXPECT_ANY_REPORT(driver).WillRepeatedly([&](report_keyboard_t& report) {
+            bool                 shifted = report.mods & (MOD_BIT(KC_LEFT_SHIFT) | MOD_BIT(KC_RIGHT_SHIFT));
+            std::vector<uint8_t> current;
+            for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+                if (report.keys[i]) current.push_back(report.keys[i]);
+            }
+            for (uint8_t keycode : current) {
+                if (std::find(previous.begin(), previous.end(), keycode) != previous.end()) continue;
+                if (keycode == KC_SPC) {
+                    typed += ' ';
+                } else if (keycode >= KC_A && keycode <= KC_Z) {
+                    typed += (char)((shifted ? 'A' : 'a') + keycode - KC_A);
+                }
+            }
+            previous = current;
+        });
+
+        fix_repeated_keys();
+        size_t next = 0;
+        for (uint32_t time = 0; next < trace.size(); time++) {
+            for (; next < trace.size() && trace[next].time == time; next++) {
+                if (trace[next].pressed) {
+                    key_for(trace[next].key).press();
+                } else {
+                    key_for(trace[next].key).release();
+                }
+            }
+            run_one_scan_loop();
+        }
+        idle_for(TAPPING_TERM * 2);
+        return typed;
+    }
+};
+
+const char* const pangrams[] = {
+    "the quick brown fox jumps over the lazy dog ",
+    "pack my box with five dozen liquor jugs ",
+    "SPHINX of black quartz JUDGE my vow ",
+    "how vexingly quick daft zebras jump ",
+    "THE five boxing WIZARDS jump QUICKLY ",
+};
+
+class WaitingBufferStressSpeed : public WaitingBufferStress, public ::testing::WithParamInterface<uint32_t> {};
+
+TEST_P(WaitingBufferStressSpeed, TracesAreTypedInOrder) {
+    TestDriver driver;
+
+    uint32_t time = 0;
+    for (const char* text : pangrams) {
+        time = add_text(time, text, GetParam(), 60);
+    }
+
+    EXPECT_EQ(replay(driver), expected);
+    VERIFY_AND_CLEAR(driver);
+}
+
+// From casual typing to bursts faster than the dwell time, with keys rolling over each other
+INSTANTIATE_TEST_CASE_P(Speeds, WaitingBufferStressSpeed, ::testing::Values(80, 120, 160, 200, 240));
+
+TEST_F(WaitingBufferStress, LongShiftedWordFillsTheBuffer) {
+    TestDriver driver;
+
+    // 12 letters within the tapping term are 24 buffered events, three times the default buffer size
+    add_text(0, "PSYCHOANALYZE", 600, 15);
+
+    EXPECT_EQ(replay(driver), expected);
+    VERIFY_AND_CLEAR(driver);
+}
+
+} // namespace
@@ -0,0 +1,173 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <vector>
+#if defined(__x86_64__) || defined(__i386__)
+#    include <x86intrin.h>
+#endif
+
+/**
+ * @brief Host-side benchmark shared by the LED Matrix and RGB Matrix tests.
+ *
+ * Renders complete frames of an effect through the regular `*_matrix_task()`
+ * state machine and measures the wall clock time spent inside the task calls.
+ * Virtual time is advanced between frames so the flush limit never throttles
+ * the measurement.
+ *
+ * Cycle counts come from the time stamp counter on x86 hosts and fall back to
+ * nanoseconds elsewhere.
+ */
+namespace effect_benchmark {
+
+struct Effect {
+    uint8_t     mode;
+    const char* name;
+};
+
+struct Result {
+    std::string name;
+    uint32_t    frames;
+    uint32_t    iterations;
+    double      us_per_frame;
+    double      us_per_led;
+    double      cycles_per_frame;
+    double      cycles_per_led;
+};
+
+inline uint64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+inline uint64_t now_cycles() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    return now_ns();
+#endif
+}
+
+/**
+ * @brief Lays out `led_count` LEDs on a grid spanning the default 224x64 area,
+ * mapping the first LEDs to the switch matrix and flagging the rest as underglow.
+ */
+template <typename LedConfig>
+void fill_led_config(LedConfig& config, uint8_t led_count, uint8_t rows, uint8_t cols, uint8_t keylight_flag, uint8_t underglow_flag) {
+    const uint8_t grid_cols = 16;
+    const uint8_t grid_rows = (led_count + grid_cols - 1) / grid_cols;
+
+    for (uint8_t row = 0; row < rows; row++) {
+        for (uint8_t col = 0; col < cols; col++) {
+            uint8_t index              = row * cols + col;
+            config.matrix_co[row][col] = index < led_count ? index : 255;
+        }
+    }
+
+    for (uint8_t i = 0; i < led_count; i++) {
+        config.point[i].x = (uint16_t)(i % grid_cols) * 224 / (grid_cols - 1);
+        config.point[i].y = grid_rows > 1 ? (uint16_t)(i / grid_cols) * 64 / (grid_rows - 1) : 32;
+        config.flags[i]   = i < rows * cols ? keylight_flag : underglow_flag;
+    }
+}
+
+/**
+ * @brief Deterministic stream of synthetic key hits for reactive effects.
+ *
+ * A pseudo-random key is pressed every `interval` frames and released on the
+ * following frame.
+ */
+class KeyHits {
+   public:
+    KeyHits(uint8_t rows, uint8_t cols, uint32_t interval) : m_rows(rows), m_cols(cols), m_interval(interval) {}
+
+    template <typename HandleKeyEvent>
+    void on_frame(uint32_t frame, HandleKeyEvent handle_key_event) {
+        if (m_pressed) {
+            handle_key_event(m_row, m_col, false);
+            m_pressed = false;
+        }
+        if (m_interval && frame % m_interval == 0) {
+            m_seed    = m_seed * 1103515245 + 12345;
+            m_row     = (m_seed >> 16) % m_rows;
+            m_col     = (m_seed >> 8) % m_cols;
+            m_pressed = true;
+            handle_key_event(m_row, m_col, true);
+        }
+    }
+
+   private:
+    uint8_t  m_rows;
+    uint8_t  m_cols;
+    uint32_t m_interval;
+    uint32_t m_seed    = 1;
+    uint8_t  m_row     = 0;
+    uint8_t  m_col     = 0;
+    bool     m_pressed = false;
+};
+
+/**
+ * @brief Runs `frames` frames of the currently selected effect.
+ *
+ * @param task the subsystem task function, e.g. `rgb_matrix_task`
+ * @param flush_count returns the number of driver flushes so far, used to detect frame completion
+ * @param advance_time advances the virtual clock by the given number of milliseconds
+ * @param on_frame called before every frame with the frame number, e.g. to inject key hits
+ */
+template <typename Task, typename FlushCount, typename AdvanceTime, typename OnFrame>
+Result run(const char* name, uint8_t led_count, uint32_t frames, uint32_t flush_limit, Task task, FlushCount flush_count, AdvanceTime advance_time, OnFrame on_frame) {
+    // Safety net against effects that never request a flush
+    const uint32_t max_iterations_per_frame = 1024;
+
+    uint64_t elapsed    = 0;
+    uint64_t cycles     = 0;
+    uint32_t iterations = 0;
+    uint32_t rendered   = 0;
+
+    for (uint32_t frame = 0; frame < frames; frame++) {
+        on_frame(frame);
+        advance_time(flush_limit);
+
+        uint32_t flushed = flush_count();
+        uint32_t calls   = 0;
+        uint64_t start   = now_ns();
+        uint64_t cycle   = now_cycles();
+        while (flush_count() == flushed && calls < max_iterations_per_frame) {
+            task();
+            calls++;
+        }
+        cycles += now_cycles() - cycle;
+        elapsed += now_ns() - start;
+        iterations += calls;
+
+        if (flush_count() != flushed) {
+            rendered++;
+        }
+    }
+
+    Result result;
+    result.name         = name;
+    result.frames       = rendered;
+    result.iterations   = iterations;
+    result.us_per_frame = rendered ? (double)elapsed / 1000.0 / rendered : 0;
+    result.us_per_led   = led_count ? result.us_per_frame / led_count : 0;
+
+    result.cycles_per_frame = rendered ? (double)cycles / rendered : 0;
+    result.cycles_per_led   = led_count ? result.cycles_per_frame / led_count : 0;
+    return result;
+}
+
+inline void print_results(const char* title, const std::vector<Result>& results) {
+    std::printf("\n%s\n", title);
+    std::printf("%-32s %8s %10s %12s %12s %14s %12s\n", "effect", "frames", "iter/frame", "us/frame", "us/led", "cycles/frame", "cycles/led");
+    for (const Result& result : results) {
+        std::printf("%-32s %8u %10.1f %12.2f %12.4f %14.0f %12.1f\n", result.name.c_str(), result.frames, result.frames ? (double)result.iterations / result.frames : 0, result.us_per_frame, result.us_per_led, result.cycles_per_frame, result.cycles_per_led);
+    }
+    std::fflush(stdout);
+}
+
+} // namespace effect_benchmark
@@ -3,14 +3,13 @@
 extern "C" {
 #include "action_code.h"
 #include "keycode.h"
+#include "keycode_string.h"
 #include "quantum_keycodes.h"
 #include "util.h"
 }
 #include <string>
 #include <iomanip>
-#include <map>
-
-extern std::map<uint16_t, std::string> KEYCODE_ID_TABLE;
+#include <sstream>
 
 std::string get_mods(uint8_t mods) {
     std::stringstream s;
@@ -85,9 +84,9 @@ std::string get_qk_mods(uint16_t keycode) {
 std::string generate_identifier(uint16_t kc) {
     std::stringstream s;
     if (IS_QK_MOD_TAP(kc)) {
-        s << "MT(" << get_mods(QK_MOD_TAP_GET_MODS(kc)) << ", " << KEYCODE_ID_TABLE.at(kc & 0xFF) << ")";
+        s << "MT(" << get_mods(QK_MOD_TAP_GET_MODS(kc)) << ", " << get_keycode_string(kc & 0xFF) << ")";
     } else if (IS_QK_LAYER_TAP(kc)) {
-        s << "LT(" << +QK_LAYER_TAP_GET_LAYER(kc) << ", " << KEYCODE_ID_TABLE.at(kc & 0xFF) << ")";
+        s << "LT(" << +QK_LAYER_TAP_GET_LAYER(kc) << ", " << get_keycode_string(kc & 0xFF) << ")";
     } else if (IS_QK_TO(kc)) {
         s << "TO(" << +QK_TO_GET_LAYER(kc) << ")";
     } else if (IS_QK_MOMENTARY(kc)) {
@@ -107,7 +106,7 @@ std::string generate_identifier(uint16_t kc) {
     } else if (IS_QK_ONE_SHOT_MOD(kc)) {
         s << "OSM(" << get_mods(QK_ONE_SHOT_MOD_GET_MODS(kc)) << ")";
     } else if (IS_QK_MODS(kc)) {
-        s << "QK_MODS(" << KEYCODE_ID_TABLE.at(QK_MODS_GET_BASIC_KEYCODE(kc)) << ", " << get_qk_mods(kc) << ")";
+        s << "QK_MODS(" << get_keycode_string(QK_MODS_GET_BASIC_KEYCODE(kc)) << ", " << get_qk_mods(kc) << ")";
     } else if (IS_QK_TAP_DANCE(kc)) {
         s << "TD(" << +(kc & 0xFF) << ")";
     } else {
@@ -119,12 +118,10 @@ std::string generate_identifier(uint16_t kc) {
 }
 
 std::string get_keycode_identifier_or_default(uint16_t keycode) {
-    auto identifier = KEYCODE_ID_TABLE.find(keycode);
-    if (identifier != KEYCODE_ID_TABLE.end()) {
-        return identifier->second;
+    const char *name = get_keycode_name(keycode);
+    if (name) {
+        return std::string(name);
     }
 
-    KEYCODE_ID_TABLE[keycode] = generate_identifier(keycode);
-
-    return KEYCODE_ID_TABLE[keycode];
+    return generate_identifier(keycode);
 }
@@ -23,6 +23,7 @@ void init_logging(void) {
 }
 }
 
+#ifndef QMK_FUZZ
 int main(int argc, char **argv) {
     ::testing::InitGoogleTest(&argc, argv);
 
@@ -30,3 +31,4 @@ int main(int argc, char **argv) {
 
     return RUN_ALL_TESTS();
 }
+#endif
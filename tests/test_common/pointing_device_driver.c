@@ -44,6 +44,13 @@ report_mouse_t pointing_device_driver_get_report(report_mouse_t mouse_report) {
     return mouse_report;
 }
 
+report_mouse_t pointing_device_driver_get_report_unclamped(report_mouse_t mouse_report, int16_t *x, int16_t *y) {
+    mouse_report = pointing_device_driver_get_report(mouse_report);
+    *x           = pd_config.x;
+    *y           = pd_config.y;
+    return mouse_report;
+}
+
 __attribute__((weak)) uint16_t pointing_device_driver_get_cpi(void) {
     return pd_config.cpi;
 }
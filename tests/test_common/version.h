@@ -0,0 +1,13 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+// Placeholder values, as generated by `qmk generate-version-h --skip-all`,
+// for features such as VIA that embed build information.
+
+#pragma once
+
+#define QMK_VERSION "NA"
+#define QMK_BUILDDATE "1970-01-01-00:00:00"
+#define QMK_GIT_HASH "NA"
+#define CHIBIOS_VERSION "NA"
+#define CHIBIOS_CONTRIB_VERSION "NA"
@@ -1,13 +1,28 @@
 // Copyright 2023 QMK
 // SPDX-License-Identifier: GPL-2.0-or-later
 
+#include <cstdio>
+#include <utility>
+
 #include "keyboard_report_util.hpp"
 #include "keycode.h"
 #include "test_common.hpp"
 #include "test_keymap_key.hpp"
 
+extern "C" {
+#include "utf8.h"
+}
+
 using testing::_;
 
+namespace {
+uint8_t caps_lock_on() {
+    led_t leds{};
+    leds.caps_lock = true;
+    return leds.raw;
+}
+} // namespace
+
 class Unicode : public TestFixture {};
 
 TEST_F(Unicode, sends_bmp_unicode_sequence) {
@@ -84,3 +99,115 @@ TEST_F(Unicode, sends_unicode_string) {
 
     VERIFY_AND_CLEAR(driver);
 }
+
+TEST_F(Unicode, sends_unicode_string_holding_macos_key_once) {
+    TestDriver driver;
+
+    set_unicode_input_mode(UNICODE_MODE_MACOS);
+
+    {
+        testing::InSequence s;
+
+        // Alt+03A8 Alt+00E9, without releasing Alt in between
+        EXPECT_REPORT(driver, (KC_LEFT_ALT));
+        for (uint8_t key : {KC_0, KC_3, KC_A, KC_8, KC_0, KC_0, KC_E, KC_9}) {
+            EXPECT_REPORT(driver, (key, KC_LEFT_ALT));
+            EXPECT_REPORT(driver, (KC_LEFT_ALT));
+        }
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    send_unicode_string("Ψé");
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Unicode, sends_unicode_string_toggling_caps_lock_once) {
+    TestDriver driver;
+
+    set_unicode_input_mode(UNICODE_MODE_LINUX);
+    driver.set_leds(caps_lock_on());
+
+    {
+        testing::InSequence s;
+
+        EXPECT_REPORT(driver, (KC_CAPS_LOCK));
+        EXPECT_EMPTY_REPORT(driver);
+        EXPECT_UNICODE(driver, 0x03A8);
+        EXPECT_UNICODE(driver, 0x00E9);
+        EXPECT_REPORT(driver, (KC_CAPS_LOCK));
+        EXPECT_EMPTY_REPORT(driver);
+    }
+    send_unicode_string("Ψé");
+
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Unicode, batches_restore_mods_at_the_end) {
+    TestDriver driver;
+
+    set_unicode_input_mode(UNICODE_MODE_WINCOMPOSE);
+    add_mods(MOD_BIT(KC_LEFT_SHIFT));
+
+    EXPECT_ANY_REPORT(driver).Times(testing::AnyNumber());
+    unicode_batch_begin();
+    register_unicode(0x03A8);
+    EXPECT_EQ(get_mods(), 0);
+    unicode_batch_begin();
+    register_unicode(0x00E9);
+    unicode_batch_end();
+    EXPECT_EQ(get_mods(), 0);
+    unicode_batch_end();
+    EXPECT_EQ(get_mods(), MOD_BIT(KC_LEFT_SHIFT));
+
+    clear_mods();
+    VERIFY_AND_CLEAR(driver);
+}
+
+TEST_F(Unicode, throughput) {
+    TestDriver driver;
+
+    // Polled at 1000 Hz, the host takes in a report every millisecond
+    constexpr uint32_t kReportInterval = 1;
+    const char        *text            = "Größenänderung «Ψ» — ＱＭＫ ünd ñ ✓ ∑ ∞ ≠ é à ç ø ß ŧ ł đ";
+    int                characters      = 0;
+    for (const char *c = text; *c; c++) {
+        characters += (*c & 0xC0) != 0x80;
+    }
+
+    uint32_t reports = 0;
+    EXPECT_ANY_REPORT(driver).WillRepeatedly([&](report_keyboard_t &) { reports++; });
+
+    auto measure = [&](bool batched) {
+        reports        = 0;
+        uint32_t start = timer_read32();
+        if (batched) {
+            send_unicode_string(text);
+        } else {
+            for (const char *str = text; *str;) {
+                int32_t code_point;
+                str = decode_utf8(str, &code_point);
+                register_unicode(code_point);
+            }
+        }
+        uint32_t ms = timer_elapsed32(start) + reports * kReportInterval;
+        return std::make_pair(reports, characters * 1000.0 / ms);
+    };
+
+    const std::pair<uint8_t, const char *> modes[] = {
+        {UNICODE_MODE_MACOS, "macOS"},
+        {UNICODE_MODE_LINUX, "Linux"},
+        {UNICODE_MODE_WINCOMPOSE, "WinCompose"},
+        {UNICODE_MODE_EMACS, "Emacs"},
+    };
+    std::printf("\nUnicode input, %d characters, caps lock on\n", characters);
+    driver.set_leds(caps_lock_on());
+    for (auto &mode : modes) {
+        set_unicode_input_mode(mode.first);
+        auto single  = measure(false);
+        auto batched = measure(true);
+        std::printf("%-12s per character %5u reports %7.1f chars/s, batched %5u reports %7.1f chars/s\n", mode.second, single.first, single.second, batched.first, batched.second);
+        EXPECT_LE(batched.first, single.first);
+    }
+
+    VERIFY_AND_CLEAR(driver);
+}
@@ -0,0 +1,9 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include "test_common.h"
+
+// Room for the VIA magic, four dynamic keymap layers and the macro buffer
+#define EEPROM_SIZE 1024
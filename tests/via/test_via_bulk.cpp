@@ -0,0 +1,208 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#include "test_common.hpp"
+#include "via_host.hpp"
+
+extern "C" {
+#include "dynamic_keymap.h"
+#include "eeprom.h"
+#include "keymap_introspection.h"
+}
+
+ViaHost* ViaHost::m_this = nullptr;
+
+extern "C" void raw_hid_send(uint8_t* data, uint8_t length) {
+    ViaHost::receive(data, length);
+}
+
+namespace {
+
+const uint16_t keymap_size = DYNAMIC_KEYMAP_LAYER_COUNT * MATRIX_ROWS * MATRIX_COLS * 2;
+
+std::vector<uint8_t> make_keymap(uint8_t seed) {
+    std::vector<uint8_t> keymap;
+    for (uint16_t i = 0; i < keymap_size / 2; i++) {
+        uint16_t keycode = KC_A + (i + seed) % 26;
+        keymap.push_back(keycode >> 8);
+        keymap.push_back(keycode & 0xFF);
+    }
+    return keymap;
+}
+
+bool bulk_in_progress(uint8_t target) {
+    return eeprom_read_byte((uint8_t*)VIA_EEPROM_BULK_STATE_ADDR) & (1 << target);
+}
+
+} // namespace
+
+class ViaBulk : public TestFixture {
+   public:
+    void SetUp() override {
+        ASSERT_TRUE(via_eeprom_is_valid());
+        ASSERT_EQ(eeprom_read_byte((uint8_t*)VIA_EEPROM_BULK_STATE_ADDR), 0);
+    }
+
+    ViaHost host;
+};
+
+TEST_F(ViaBulk, ProtocolVersionAnnouncesBulkTransfers) {
+    ViaHost::report_t response = host.command({id_get_protocol_version});
+    EXPECT_EQ(response[0], id_get_protocol_version);
+    EXPECT_GE((response[1] << 8) | response[2], 0x000D);
+}
+
+TEST_F(ViaBulk, WritesKeymapInWindows) {
+    std::vector<uint8_t> keymap = make_keymap(0);
+
+    EXPECT_EQ(host.bulk_write(id_bulk_target_keymap, 0, keymap, VIA_BULK_WINDOW_SIZE), id_bulk_ok);
+    EXPECT_TRUE(via_eeprom_is_valid());
+
+    uint16_t chunks = (keymap_size + 27) / 28;
+    EXPECT_EQ(host.reports_sent(), chunks + 2u);
+    EXPECT_EQ(host.round_trips(), (chunks + VIA_BULK_WINDOW_SIZE - 1u) / VIA_BULK_WINDOW_SIZE);
+
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), KC_A);
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 1), KC_B);
+    EXPECT_EQ(dynamic_keymap_get_keycode(DYNAMIC_KEYMAP_LAYER_COUNT - 1, MATRIX_ROWS - 1, MATRIX_COLS - 1), KC_A + (keymap_size / 2 - 1) % 26);
+
+    std::vector<uint8_t> read;
+    host.reset_counters();
+    EXPECT_EQ(host.bulk_read(id_bulk_target_keymap, 0, keymap_size, read), id_bulk_ok);
+    EXPECT_EQ(read, keymap);
+    EXPECT_EQ(host.round_trips(), (chunks + VIA_BULK_WINDOW_SIZE - 1u) / VIA_BULK_WINDOW_SIZE);
+}
+
+TEST_F(ViaBulk, ReadsAtMostAWindowPerRequest) {
+    ViaHost::report_t status = host.command({id_bulk_transfer, id_bulk_read, id_bulk_target_keymap, 0, 0, (uint8_t)(keymap_size >> 8), (uint8_t)keymap_size});
+    EXPECT_EQ(status[2], id_bulk_ok);
+    EXPECT_EQ(status[4] << 8 | status[5], VIA_BULK_WINDOW_SIZE * 28);
+}
+
+TEST_F(ViaBulk, NeedsFewerRoundTripsThanPerChunkWrites) {
+    std::vector<uint8_t> keymap = make_keymap(1);
+
+    host.legacy_set_buffer(0, keymap);
+    uint32_t legacy = host.round_trips();
+
+    host.reset_counters();
+    EXPECT_EQ(host.bulk_write(id_bulk_target_keymap, 0, make_keymap(2), VIA_BULK_WINDOW_SIZE), id_bulk_ok);
+    EXPECT_LT(host.round_trips() * 4, legacy);
+}
+
+TEST_F(ViaBulk, LostChunksAreResent) {
+    std::vector<uint8_t> keymap = make_keymap(3);
+
+    EXPECT_EQ(host.bulk_write(id_bulk_target_keymap, 0, keymap, 4, {1, 2, 6, (uint16_t)((keymap_size - 1) / 28)}), id_bulk_ok);
+
+    std::vector<uint8_t> read;
+    EXPECT_EQ(host.bulk_read(id_bulk_target_keymap, 0, keymap_size, read), id_bulk_ok);
+    EXPECT_EQ(read, keymap);
+}
+
+TEST_F(ViaBulk, PartialRange) {
+    std::vector<uint8_t> keymap = make_keymap(4);
+
+    EXPECT_EQ(host.bulk_write(id_bulk_target_keymap, 0, keymap, VIA_BULK_WINDOW_SIZE), id_bulk_ok);
+    EXPECT_EQ(host.bulk_write(id_bulk_target_keymap, 40, std::vector<uint8_t>(60, 0), VIA_BULK_WINDOW_SIZE), id_bulk_ok);
+
+    std::vector<uint8_t> read;
+    EXPECT_EQ(host.bulk_read(id_bulk_target_keymap, 40, 60, read), id_bulk_ok);
+    EXPECT_EQ(read, std::vector<uint8_t>(60, 0));
+    EXPECT_EQ(host.bulk_read(id_bulk_target_keymap, 100, 20, read), id_bulk_ok);
+    EXPECT_EQ(read, std::vector<uint8_t>(keymap.begin() + 100, keymap.begin() + 120));
+}
+
+TEST_F(ViaBulk, WritesMacroBuffer) {
+    uint16_t             size = dynamic_keymap_macro_get_buffer_size();
+    std::vector<uint8_t> macros(size, 0);
+    const char           text[] = "hello\0world";
+    std::copy(text, text + sizeof(text), macros.begin());
+
+    EXPECT_EQ(host.bulk_write(id_bulk_target_macro, 0, macros, VIA_BULK_WINDOW_SIZE), id_bulk_ok);
+
+    std::vector<uint8_t> read;
+    EXPECT_EQ(host.bulk_read(id_bulk_target_macro, 0, size, read), id_bulk_ok);
+    EXPECT_EQ(read, macros);
+}
+
+TEST_F(ViaBulk, BadCrcResetsOnlyThatTarget) {
+    std::vector<uint8_t> macros(dynamic_keymap_macro_get_buffer_size(), 'm');
+    EXPECT_EQ(host.bulk_write(id_bulk_target_macro, 0, macros, VIA_BULK_WINDOW_SIZE), id_bulk_ok);
+    via_set_layout_options(0x5A);
+
+    host.command({id_bulk_transfer, id_bulk_begin, id_bulk_target_keymap, 0, 0, 0, 28, 1});
+    EXPECT_TRUE(bulk_in_progress(id_bulk_target_keymap));
+
+    ViaHost::report_t chunk = host.command({id_bulk_transfer, id_bulk_write, 0, 0, 1, 2, 3});
+    EXPECT_EQ(chunk[2], id_bulk_ok);
+
+    ViaHost::report_t commit = host.command({id_bulk_transfer, id_bulk_commit, 0x42});
+    EXPECT_EQ(commit[2], id_bulk_bad_crc);
+    EXPECT_TRUE(bulk_in_progress(id_bulk_target_keymap));
+    EXPECT_TRUE(via_eeprom_is_valid());
+
+    // The next boot restores the keymap, and keeps everything else
+    via_init();
+    EXPECT_FALSE(bulk_in_progress(id_bulk_target_keymap));
+    EXPECT_EQ(dynamic_keymap_get_keycode(0, 0, 0), keycode_at_keymap_location(0, 0, 0));
+    EXPECT_EQ(via_get_layout_options(), 0x5Au);
+
+    std::vector<uint8_t> read;
+    EXPECT_EQ(host.bulk_read(id_bulk_target_macro, 0, macros.size(), read), id_bulk_ok);
+    EXPECT_EQ(read, macros);
+}
+
+TEST_F(ViaBulk, RetryClearsTheTarget) {
+    host.command({id_bulk_transfer, id_bulk_begin, id_bulk_target_keymap, 0, 0, 0, 28, 1});
+    host.command({id_bulk_transfer, id_bulk_write, 0, 0, 1, 2, 3});
+    host.command({id_bulk_transfer, id_bulk_commit, 0x42});
+
+    EXPECT_EQ(host.bulk_write(id_bulk_target_keymap, 0, make_keymap(0), VIA_BULK_WINDOW_SIZE), id_bulk_ok);
+    EXPECT_FALSE(bulk_in_progress(id_bulk_target_keymap));
+}
+
+TEST_F(ViaBulk, CommitNeedsAllChunks) {
+    host.command({id_bulk_transfer, id_bulk_begin, id_bulk_target_keymap, 0, 0, 0, 56, 2});
+
+    // The first chunk of a window is not answered
+    ViaHost::report_t chunk = host.command({id_bulk_transfer, id_bulk_write, 0, 0});
+    EXPECT_EQ(chunk[0], 0);
+
+    ViaHost::report_t commit = host.command({id_bulk_transfer, id_bulk_commit, 0});
+    EXPECT_EQ(commit[2], id_bulk_incomplete);
+
+    ViaHost::report_t abort = host.command({id_bulk_transfer, id_bulk_abort});
+    EXPECT_EQ(abort[2], id_bulk_ok);
+    EXPECT_TRUE(bulk_in_progress(id_bulk_target_keymap));
+
+    EXPECT_EQ(host.bulk_write(id_bulk_target_keymap, 0, make_keymap(0), VIA_BULK_WINDOW_SIZE), id_bulk_ok);
+    EXPECT_FALSE(bulk_in_progress(id_bulk_target_keymap));
+}
+
+TEST_F(ViaBulk, AbortBeforeAnyChunkClearsTheTarget) {
+    host.command({id_bulk_transfer, id_bulk_begin, id_bulk_target_macro, 0, 0, 0, 28, 1});
+    EXPECT_TRUE(bulk_in_progress(id_bulk_target_macro));
+
+    host.command({id_bulk_transfer, id_bulk_abort});
+    EXPECT_FALSE(bulk_in_progress(id_bulk_target_macro));
+}
+
+TEST_F(ViaBulk, RejectsInvalidRequests) {
+    std::vector<uint8_t> read;
+
+    EXPECT_EQ(host.bulk_write(0x7F, 0, {1, 2}, 1), id_bulk_bad_target);
+    EXPECT_EQ(host.bulk_write(id_bulk_target_keymap, keymap_size - 1, {1, 2}, 1), id_bulk_out_of_range);
+    EXPECT_EQ(host.bulk_write(id_bulk_target_keymap, 0, {}, 1), id_bulk_out_of_range);
+    EXPECT_EQ(host.bulk_read(id_bulk_target_keymap, keymap_size, 1, read), id_bulk_out_of_range);
+    EXPECT_EQ(eeprom_read_byte((uint8_t*)VIA_EEPROM_BULK_STATE_ADDR), 0);
+
+    ViaHost::report_t chunk = host.command({id_bulk_transfer, id_bulk_write, 0, 0});
+    EXPECT_EQ(chunk[2], id_bulk_bad_state);
+
+    ViaHost::report_t commit = host.command({id_bulk_transfer, id_bulk_commit, 0});
+    EXPECT_EQ(commit[2], id_bulk_bad_state);
+
+    ViaHost::report_t unknown = host.command({id_bulk_transfer, 0x7F});
+    EXPECT_EQ(unknown[0], id_unhandled);
+}
@@ -0,0 +1,178 @@
+// Copyright 2026 QMK
+// SPDX-License-Identifier: GPL-2.0-or-later
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <set>
+#include <vector>
+
+extern "C" {
+#include "crc.h"
+#include "raw_hid.h"
+#include "via.h"
+}
+
+/**
+ * @brief Host side of the VIA raw HID protocol, as a configurator would drive it.
+ *
+ * Reports are handed to `raw_hid_receive()` directly, and everything the
+ * keyboard sends back through `raw_hid_send()` is queued for the host to read.
+ */
+class ViaHost {
+   public:
+    static constexpr uint8_t report_size = 32;
+    using report_t                       = std::array<uint8_t, report_size>;
+
+    ViaHost() {
+        m_this = this;
+    }
+
+    ~ViaHost() {
+        m_this = nullptr;
+    }
+
+    /** @brief Called from the test's `raw_hid_send()` implementation. */
+    static void receive(const uint8_t* data, uint8_t length) {
+        report_t report = {};
+        std::copy(data, data + length, report.begin());
+        m_this->m_received.push_back(report);
+    }
+
+    void send(report_t report) {
+        m_sent++;
+        raw_hid_receive(report.data(), report.size());
+    }
+
+    /** @brief Sends a single command and returns its response, all zeroes if there was none. */
+    report_t command(std::initializer_list<uint8_t> bytes) {
+        report_t report = {};
+        std::copy(bytes.begin(), bytes.end(), report.begin());
+        send(report);
+        report_t response = {};
+        if (!m_received.empty()) {
+            response = m_received.back();
+        }
+        m_received.clear();
+        return response;
+    }
+
+    /**
+     * @brief Writes `data` with the windowed bulk transfer, resending from the
+     * chunk the keyboard asks for after any lost chunk.
+     *
+     * @param drop chunk numbers that get lost on their first transmission
+     * @return status of the commit, or of the first failing step
+     */
+    uint8_t bulk_write(uint8_t target, uint16_t offset, const std::vector<uint8_t>& data, uint8_t window, std::set<uint16_t> drop = {}) {
+        report_t begin = command({id_bulk_transfer, id_bulk_begin, target, (uint8_t)(offset >> 8), (uint8_t)offset, (uint8_t)(data.size() >> 8), (uint8_t)data.size(), window});
+        if (begin[2] != id_bulk_ok) {
+            return begin[2];
+        }
+        window             = begin[3];
+        uint8_t  chunk_len = begin[4];
+        uint16_t chunks    = (data.size() + chunk_len - 1) / chunk_len;
+        uint16_t next      = 0;
+
+        while (next < chunks) {
+            uint16_t end = std::min<uint16_t>(next + window - next % window, chunks);
+            for (uint16_t chunk = next; chunk < end; chunk++) {
+                if (drop.erase(chunk)) {
+                    continue;
+                }
+                report_t report = {id_bulk_transfer, id_bulk_write, (uint8_t)(chunk >> 8), (uint8_t)chunk};
+                size_t   start  = chunk * chunk_len;
+                size_t   count  = std::min<size_t>(chunk_len, data.size() - start);
+                std::copy(data.begin() + start, data.begin() + start + count, report.begin() + 4);
+                send(report);
+            }
+            m_round_trips++;
+
+            // Without any answer the host times out and resends the window
+            for (const report_t& response : m_received) {
+                if (response[2] != id_bulk_ok && response[2] != id_bulk_out_of_order) {
+                    m_received.clear();
+                    return response[2];
+                }
+                next = response[3] << 8 | response[4];
+                if (response[2] == id_bulk_out_of_order) {
+                    break;
+                }
+            }
+            m_received.clear();
+        }
+
+        report_t commit = command({id_bulk_transfer, id_bulk_commit, crc8(data.data(), data.size())});
+        return commit[2];
+    }
+
+    /**
+     * @brief Reads `size` bytes with the bulk transfer, asking for the rest
+     * after every window of chunks and checking the CRC of each.
+     */
+    uint8_t bulk_read(uint8_t target, uint16_t offset, uint16_t size, std::vector<uint8_t>& data) {
+        data.clear();
+
+        do {
+            uint16_t at        = offset + data.size();
+            uint16_t remaining = size - data.size();
+            report_t report    = {id_bulk_transfer, id_bulk_read, target, (uint8_t)(at >> 8), (uint8_t)at, (uint8_t)(remaining >> 8), (uint8_t)remaining};
+            send(report);
+            m_round_trips++;
+
+            report_t status = m_received.back();
+            m_received.pop_back();
+
+            std::vector<uint8_t> window;
+            for (const report_t& chunk : m_received) {
+                size_t count = std::min<size_t>(report_size - 4, remaining - window.size());
+                window.insert(window.end(), chunk.begin() + 4, chunk.begin() + 4 + count);
+            }
+            m_received.clear();
+
+            if (status[2] != id_bulk_ok) {
+                return status[2];
+            }
+            if (status[3] != crc8(window.data(), window.size()) || (status[4] << 8 | status[5]) != window.size() || window.empty()) {
+                return id_bulk_bad_crc;
+            }
+            data.insert(data.end(), window.begin(), window.end());
+        } while (data.size() < size);
+
+        return id_bulk_ok;
+    }
+
+    /** @brief Writes `data` with one id_dynamic_keymap_set_buffer round trip per chunk. */
+    void legacy_set_buffer(uint16_t offset, const std::vector<uint8_t>& data) {
+        for (size_t done = 0; done < data.size(); done += 28) {
+            uint8_t  count  = std::min<size_t>(28, data.size() - done);
+            uint16_t at     = offset + done;
+            report_t report = {id_dynamic_keymap_set_buffer, (uint8_t)(at >> 8), (uint8_t)at, count};
+            std::copy(data.begin() + done, data.begin() + done + count, report.begin() + 4);
+            send(report);
+            m_round_trips++;
+            m_received.clear();
+        }
+    }
+
+    uint32_t round_trips() const {
+        return m_round_trips;
+    }
+
+    uint32_t reports_sent() const {
+        return m_sent;
+    }
+
+    void reset_counters() {
+        m_round_trips = 0;
+        m_sent        = 0;
+    }
+
+   private:
+    std::deque<report_t> m_received;
+    uint32_t             m_round_trips = 0;
+    uint32_t             m_sent        = 0;
+    static ViaHost*      m_this;
+};
@@ -21,6 +21,7 @@
 #include "host.h"
 #include "suspend.h"
 #include "timer.h"
+#include "spsc_ring.h"
 #ifdef SLEEP_LED_ENABLE
 #    include "sleep_led.h"
 #    include "led.h"
@@ -32,6 +33,10 @@
 #include "usb_driver.h"
 #include "usb_types.h"
 
+#ifdef MIDI_ENABLE
+#    include "qmk_midi.h"
+#endif
+
 #ifdef NKRO_ENABLE
 #    include "keycode_config.h"
 
@@ -95,34 +100,21 @@ static const USBDescriptor *usb_get_descriptor_cb(USBDriver *usbp, uint8_t dtype
  */
 
 #define USB_EVENT_QUEUE_SIZE 16
-usbevent_t event_queue[USB_EVENT_QUEUE_SIZE];
-uint8_t    event_queue_head;
-uint8_t    event_queue_tail;
+// Filled from the USB interrupt and emptied from the main loop
+SPSC_RING_DECLARE(usb_event_ring, usbevent_t, USB_EVENT_QUEUE_SIZE)
+static usb_event_ring_t event_queue;
 
 void usb_event_queue_init(void) {
     // Initialise the event queue
-    memset(&event_queue, 0, sizeof(event_queue));
-    event_queue_head = 0;
-    event_queue_tail = 0;
+    usb_event_ring_init(&event_queue);
 }
 
 static inline bool usb_event_queue_enqueue(usbevent_t event) {
-    uint8_t next = (event_queue_head + 1) % USB_EVENT_QUEUE_SIZE;
-    if (next == event_queue_tail) {
-        return false;
-    }
-    event_queue[event_queue_head] = event;
-    event_queue_head              = next;
-    return true;
+    return usb_event_ring_enqueue(&event_queue, event);
 }
 
 static inline bool usb_event_queue_dequeue(usbevent_t *event) {
-    if (event_queue_head == event_queue_tail) {
-        return false;
-    }
-    *event           = event_queue[event_queue_tail];
-    event_queue_tail = (event_queue_tail + 1) % USB_EVENT_QUEUE_SIZE;
-    return true;
+    return usb_event_ring_dequeue(&event_queue, event);
 }
 
 static inline void usb_event_suspend_handler(void) {
@@ -555,6 +547,17 @@ bool recv_midi_packet(MIDI_EventPacket_t *const event) {
     return receive_report(USB_ENDPOINT_OUT_MIDI, (uint8_t *)event, sizeof(MIDI_EventPacket_t));
 }
 
+void send_midi_packets(const midi_usb_packet_t *packets, uint8_t count) {
+    // Fill whole endpoint transfers instead of flushing a transfer per packet
+    const uint8_t per_transfer = MIDI_STREAM_EPSIZE / sizeof(midi_usb_packet_t);
+    while (count > 0) {
+        uint8_t chunk = count < per_transfer ? count : per_transfer;
+        send_report(USB_ENDPOINT_IN_MIDI, (void *)packets, chunk * sizeof(midi_usb_packet_t));
+        packets += chunk;
+        count -= chunk;
+    }
+}
+
 #endif
 
 #ifdef VIRTSER_ENABLE
@@ -681,6 +681,14 @@ bool recv_midi_packet(MIDI_EventPacket_t *const event) {
     return MIDI_Device_ReceiveEventPacket(&USB_MIDI_Interface, event);
 }
 
+void send_midi_packets(const midi_usb_packet_t *packets, uint8_t count) {
+    // The packets fill the endpoint bank, which is sent once full or flushed
+    for (uint8_t i = 0; i < count; i++) {
+        MIDI_Device_SendEventPacket(&USB_MIDI_Interface, (const MIDI_EventPacket_t *)&packets[i]);
+    }
+    MIDI_Device_Flush(&USB_MIDI_Interface);
+}
+
 #endif
 
 /*******************************************************************************
@@ -23,37 +23,72 @@
 #include "util.h"
 #include <string.h>
 
+#ifdef NKRO_ENABLE
+/* The NKRO bitmap is scanned a machine word at a time. The bitmap is not
+ * word aligned within the packed report, so words are loaded with memcpy.
+ * AVR and big endian targets keep scanning byte-wise.
+ */
+#    if defined(__AVR__) || (defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+typedef uint8_t nkro_word_t;
+#    else
+typedef uint32_t nkro_word_t;
+#    endif
+
+/** \brief Loads the bitmap word starting at byte `offset`, zero padded past the end of the bitmap */
+static inline nkro_word_t nkro_load_word(const uint8_t* bits, uint8_t offset) {
+    nkro_word_t word = 0;
+    uint8_t     size = NKRO_REPORT_BITS - offset;
+    memcpy(&word, bits + offset, size < sizeof(word) ? size : sizeof(word));
+    return word;
+}
+
+/** \brief Counts the non-zero bytes of a bitmap word */
+static inline uint8_t nkro_word_nonzero_bytes(nkro_word_t word) {
+    uint8_t cnt = 0;
+    for (; word; word >>= 8) {
+        if (word & 0xFF) cnt++;
+    }
+    return cnt;
+}
+#endif
+
 /** \brief has_anykey
  *
- * FIXME: Needs doc
+ * Returns the number of non-zero key slots in the current report, which is a
+ * key count in 6KRO mode and a count of non-zero bitmap bytes in NKRO mode.
  */
 uint8_t has_anykey(void) {
-    uint8_t  cnt = 0;
-    uint8_t* p   = keyboard_report->keys;
-    uint8_t  lp  = sizeof(keyboard_report->keys);
+    uint8_t cnt = 0;
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        p  = nkro_report->bits;
-        lp = sizeof(nkro_report->bits);
+        for (uint8_t offset = 0; offset < NKRO_REPORT_BITS; offset += sizeof(nkro_word_t)) {
+            nkro_word_t word = nkro_load_word(nkro_report->bits, offset);
+            if (word) cnt += nkro_word_nonzero_bytes(word);
+        }
+        return cnt;
     }
 #endif
-    while (lp--) {
-        if (*p++) cnt++;
+    for (uint8_t i = 0; i < KEYBOARD_REPORT_KEYS; i++) {
+        if (keyboard_report->keys[i]) cnt++;
     }
     return cnt;
 }
 
 /** \brief get_first_key
  *
- * FIXME: Needs doc
+ * Returns the lowest keycode held in NKRO mode, or the first key slot in 6KRO
+ * mode. Returns KC_NO when no key is pressed.
  */
 uint8_t get_first_key(void) {
 #ifdef NKRO_ENABLE
     if (usb_device_state_get_protocol() == USB_PROTOCOL_REPORT && keymap_config.nkro) {
-        uint8_t i = 0;
-        for (; i < NKRO_REPORT_BITS && !nkro_report->bits[i]; i++)
-            ;
-        return i << 3 | biton(nkro_report->bits[i]);
+        for (uint8_t offset = 0; offset < NKRO_REPORT_BITS; offset += sizeof(nkro_word_t)) {
+            nkro_word_t word = nkro_load_word(nkro_report->bits, offset);
+            if (word) {
+                return (offset << 3) + __builtin_ctz(word);
+            }
+        }
+        return KC_NO;
     }
 #endif
     return keyboard_report->keys[0];
@@ -143,6 +178,27 @@ void del_key_bit(report_nkro_t* nkro_report, uint8_t code) {
         dprintf("del_key_bit: can't del: %02X\n", code);
     }
 }
+
+/** \brief Checks whether a pending NKRO report undoes a change the host has not seen yet
+ *
+ * Returns true if any key or modifier that differs between `pending` and
+ * `sent` flips back in `next`, e.g. a key pressed and released before the
+ * pending report went out. Such a pending report must be sent before `next`
+ * replaces it, otherwise the host would miss the keystroke.
+ */
+bool nkro_report_reverts_pending(const report_nkro_t* sent, const report_nkro_t* pending, const report_nkro_t* next) {
+    if ((sent->mods ^ pending->mods) & (pending->mods ^ next->mods)) {
+        return true;
+    }
+    for (uint8_t offset = 0; offset < NKRO_REPORT_BITS; offset += sizeof(nkro_word_t)) {
+        nkro_word_t pending_word = nkro_load_word(pending->bits, offset);
+        nkro_word_t changed      = nkro_load_word(sent->bits, offset) ^ pending_word;
+        if (changed & (pending_word ^ nkro_load_word(next->bits, offset))) {
+            return true;
+        }
+    }
+    return false;
+}
 #endif
 
 /** \brief add key to report
@@ -341,6 +341,7 @@ void del_key_byte(report_keyboard_t* keyboard_report, uint8_t code);
 #ifdef NKRO_ENABLE
 void add_key_bit(report_nkro_t* nkro_report, uint8_t code);
 void del_key_bit(report_nkro_t* nkro_report, uint8_t code);
+bool nkro_report_reverts_pending(const report_nkro_t* sent, const report_nkro_t* pending, const report_nkro_t* next);
 #endif
 
 void add_key_to_report(uint8_t key);
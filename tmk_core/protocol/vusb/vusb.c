@@ -196,11 +196,8 @@ void console_task(void) {
     }
 
     // Send in chunks of 8 padded to 32
-    char    send_buf[CONSOLE_BUFFER_SIZE] = {0};
-    uint8_t send_buf_count                = 0;
-    while (rbuf_has_data() && send_buf_count < CONSOLE_EPSIZE) {
-        send_buf[send_buf_count++] = rbuf_dequeue();
-    }
+    uint8_t send_buf[CONSOLE_BUFFER_SIZE] = {0};
+    rbuf_dequeue_n(send_buf, CONSOLE_EPSIZE);
 
     send_report(3, send_buf, CONSOLE_BUFFER_SIZE);
 }